@@ -0,0 +1,224 @@
+/**
+ * @file bench_epc_match.c
+ * @brief 호스트 측 EPC 규칙 엔진 벤치마크
+ *
+ * 규칙 수(100 ~ 10,000)에 따른 태그 1건당 분류 시간(ns/tag)을
+ * 컴파일된 DFA(rfid_epc_rules_classify)와 규칙 순회 비교(선형 탐색) 방식으로 측정한다.
+ * 두 방식의 분류 결과가 모두 같은지도 함께 확인한다.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rfid_epc_match.h"
+
+#define BENCH_EPC_BYTES   (12)      /**< SGTIN-96 EPC 길이 */
+#define BENCH_TAG_COUNT   (100000)  /**< 측정용 태그 수 */
+#define BENCH_DFA_ROUNDS  (20)      /**< DFA 측정 반복 횟수 */
+#define BENCH_HIT_PCT     (70)      /**< 규칙에 일치하도록 만드는 태그 비율(%) */
+
+/**
+ * @brief 선형 탐색 비교용 규칙(바이트 단위 value/mask)
+ */
+typedef struct bench_rule {
+    uint8_t val[BENCH_EPC_BYTES];
+    uint8_t msk[BENCH_EPC_BYTES];
+    uint32_t bits;
+    uint32_t rule_id;
+} bench_rule_t;
+
+static uint64_t bench_rng_state_ = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief xorshift64* 난수
+ */
+static uint64_t NextRand_(void) {
+    uint64_t x = bench_rng_state_;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    bench_rng_state_ = x;
+    return x * 2685821657736338717ULL;
+}
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief SGTIN 형태의 접두사 규칙을 만든다(헤더 0x30 + 필터/파티션 + 회사 코드).
+ *
+ * @param[out] out 선형 탐색용 규칙
+ * @param[out] out_hex 규칙 value hex 문자열(BENCH_EPC_BYTES * 2 + 1 이상)
+ * @param[in]  rule_id 규칙 id
+ */
+static void MakeRule_(OUT_ bench_rule_t *out, OUT_ char *out_hex, IN_ const uint32_t rule_id) {
+    memset(out, 0, sizeof(*out));
+    out->val[0] = 0x30;
+    for (int i = 1; i < BENCH_EPC_BYTES; ++i)
+        out->val[i] = (uint8_t) NextRand_();
+
+    // 회사 코드 길이(파티션)에 따라 24 ~ 64비트 접두사
+    out->bits = 24U + (uint32_t) (NextRand_() % 41U);
+    out->rule_id = rule_id;
+    for (uint32_t b = 0; b < out->bits; ++b)
+        out->msk[b / 8U] |= (uint8_t) (0x80U >> (b % 8U));
+    for (int i = 0; i < BENCH_EPC_BYTES; ++i)
+        out->val[i] &= out->msk[i];
+
+    static const char hex[] = "0123456789ABCDEF";
+    const uint32_t nibbles = (out->bits + 3U) / 4U;
+    for (uint32_t n = 0; n < nibbles; ++n) {
+        const uint8_t byte = out->val[n / 2U];
+        out_hex[n] = hex[(0U == (n % 2U)) ? (byte >> 4) : (byte & 0x0FU)];
+    }
+    out_hex[nibbles] = '\0';
+}
+
+/**
+ * @brief 규칙 순회 방식 분류(비교 기준). 가장 긴 일치, 같으면 앞선 규칙.
+ */
+static uint32_t ClassifyLinear_(IN_ const bench_rule_t *rules, IN_ const int count, IN_ const uint8_t *epc) {
+    uint32_t best_bits = 0;
+    uint32_t best_id = RFID_EPC_RULE_NONE;
+    for (int r = 0; r < count; ++r) {
+        const bench_rule_t *rule = &rules[r];
+        if (rule->bits <= best_bits)
+            continue;
+        int hit = 1;
+        for (int i = 0; i < BENCH_EPC_BYTES; ++i) {
+            if ((epc[i] & rule->msk[i]) != rule->val[i]) {
+                hit = 0;
+                break;
+            }
+        }
+        if (0 != hit) {
+            best_bits = rule->bits;
+            best_id = rule->rule_id;
+        }
+    }
+    return best_id;
+}
+
+/**
+ * @brief 규칙 수 1개 조건에 대해 컴파일 시간과 분류 시간을 측정해 출력한다.
+ * @param[in] rule_count 규칙 수
+ * @param[in] tags 측정용 태그(BENCH_TAG_COUNT * BENCH_EPC_BYTES)
+ * @return 성공 0, 실패 1
+ */
+static int RunCase_(IN_ const int rule_count, INOUT_ uint8_t *tags) {
+    bench_rule_t *rules = (bench_rule_t *) malloc((size_t) rule_count * sizeof(bench_rule_t));
+    char *hex = (char *) malloc((size_t) rule_count * (BENCH_EPC_BYTES * 2 + 1));
+    rfid_epc_rule_t *crules = (rfid_epc_rule_t *) malloc((size_t) rule_count * sizeof(rfid_epc_rule_t));
+    uint32_t *expect = (uint32_t *) malloc(BENCH_TAG_COUNT * sizeof(uint32_t));
+    if ((NULL == rules) || (NULL == hex) || (NULL == crules) || (NULL == expect)) {
+        free(rules);
+        free(hex);
+        free(crules);
+        free(expect);
+        return 1;
+    }
+
+    for (int r = 0; r < rule_count; ++r) {
+        char *h = &hex[(size_t) r * (BENCH_EPC_BYTES * 2 + 1)];
+        MakeRule_(&rules[r], h, (uint32_t) r);
+        crules[r].value_hex = h;
+        crules[r].mask_hex = NULL;
+        crules[r].bit_length = (int) rules[r].bits;
+        crules[r].rule_id = (uint32_t) r;
+    }
+
+    // 태그 일부는 임의 규칙의 접두사를 가져와 일치하도록 만든다.
+    for (int t = 0; t < BENCH_TAG_COUNT; ++t) {
+        uint8_t *epc = &tags[(size_t) t * BENCH_EPC_BYTES];
+        for (int i = 0; i < BENCH_EPC_BYTES; ++i)
+            epc[i] = (uint8_t) NextRand_();
+        if ((int) (NextRand_() % 100U) < BENCH_HIT_PCT) {
+            const bench_rule_t *r = &rules[NextRand_() % (uint64_t) rule_count];
+            for (int i = 0; i < BENCH_EPC_BYTES; ++i)
+                epc[i] = (uint8_t) ((epc[i] & (uint8_t) ~r->msk[i]) | r->val[i]);
+        }
+    }
+
+    const uint64_t c0 = NowNs_();
+    rfid_epc_rules_t *compiled = NULL;
+    const RFID_RESULT rc = rfid_epc_rules_compile(crules, rule_count, &compiled);
+    const uint64_t c1 = NowNs_();
+    if (RFID_RESULT_OK != rc) {
+        printf("[FAIL] compile rules=%d rc=%d\n", rule_count, (int) rc);
+        free(rules);
+        free(hex);
+        free(crules);
+        free(expect);
+        return 1;
+    }
+
+    const uint64_t l0 = NowNs_();
+    for (int t = 0; t < BENCH_TAG_COUNT; ++t)
+        expect[t] = ClassifyLinear_(rules, rule_count, &tags[(size_t) t * BENCH_EPC_BYTES]);
+    const uint64_t l1 = NowNs_();
+
+    uint32_t mismatch = 0;
+    uint32_t hits = 0;
+    for (int t = 0; t < BENCH_TAG_COUNT; ++t) {
+        const uint32_t id = rfid_epc_rules_classify(compiled, &tags[(size_t) t * BENCH_EPC_BYTES], BENCH_EPC_BYTES);
+        if (id != expect[t])
+            mismatch++;
+        if (RFID_EPC_RULE_NONE != id)
+            hits++;
+    }
+
+    volatile uint32_t sink = 0;
+    const uint64_t d0 = NowNs_();
+    for (int round = 0; round < BENCH_DFA_ROUNDS; ++round) {
+        for (int t = 0; t < BENCH_TAG_COUNT; ++t)
+            sink ^= rfid_epc_rules_classify(compiled, &tags[(size_t) t * BENCH_EPC_BYTES], BENCH_EPC_BYTES);
+    }
+    const uint64_t d1 = NowNs_();
+    (void) sink;
+
+    const double dfa_ns = (double) (d1 - d0) / ((double) BENCH_TAG_COUNT * BENCH_DFA_ROUNDS);
+    const double lin_ns = (double) (l1 - l0) / (double) BENCH_TAG_COUNT;
+    printf("rules=%6d states=%8u compile=%8.2fms dfa=%7.1fns/tag linear=%9.1fns/tag speedup=%7.1fx hit=%5.1f%% mismatch=%u\n"
+           , rule_count
+           , (unsigned) rfid_epc_rules_state_count(compiled)
+           , (double) (c1 - c0) / 1e6
+           , dfa_ns
+           , lin_ns
+           , (dfa_ns > 0.0) ? (lin_ns / dfa_ns) : 0.0
+           , 100.0 * (double) hits / (double) BENCH_TAG_COUNT
+           , (unsigned) mismatch);
+
+    rfid_epc_rules_release(compiled);
+    free(rules);
+    free(hex);
+    free(crules);
+    free(expect);
+    return (0U == mismatch) ? 0 : 1;
+}
+
+int main(void) {
+    static const int rule_counts[] = {100, 1000, 5000, 10000};
+
+    uint8_t *tags = (uint8_t *) malloc((size_t) BENCH_TAG_COUNT * BENCH_EPC_BYTES);
+    if (NULL == tags)
+        return 1;
+
+    printf("[BENCH] EPC rule engine: %d tags x %d bytes\n", BENCH_TAG_COUNT, BENCH_EPC_BYTES);
+
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(rule_counts) / sizeof(rule_counts[0]); ++i)
+        failed |= RunCase_(rule_counts[i], tags);
+
+    free(tags);
+    return failed;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file bench_gs1.c
+ * @brief GS1 EPC 일괄 해석 벤치마크(EPC 1M 개, 한 코어)
+ *
+ * SGTIN-96 / SSCC-96 / GRAI-96 / GIAI-96 이 섞인 바이너리 EPC(5%는 GS1 이 아닌 EPC)를
+ * 1) rfid_gs1_decode_batch 로 해석하는 처리량(EPC/s, ns/EPC),
+ * 2) 해석 + URN 문자열 생성 처리량,
+ * 3) 비교용으로 hex 문자열을 다시 바이트로 바꾸고 비트를 하나씩 잘라 필드를 만드는 방식의 처리량을 잰다.
+ * 해석 결과가 생성한 필드와 같은지, 비교 방식과 같은지도 확인한다.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rfid_gs1.h"
+
+#define BENCH_EPCS          (1000000)   /**< EPC 수 */
+#define BENCH_EPC_BYTES     (12)        /**< 96bit EPC 길이 */
+#define BENCH_ROUNDS        (10)        /**< 일괄 해석 반복 횟수 */
+#define BENCH_FOREIGN_PCT   (5)         /**< GS1 이 아닌 EPC 비율(%) */
+
+/**
+ * @brief 생성한 EPC 의 기대 필드
+ */
+typedef struct bench_expect {
+    uint64_t company_prefix;
+    uint64_t reference;
+    uint64_t serial;
+    uint8_t scheme;
+} bench_expect_t;
+
+/**
+ * @brief 방식별 partition 표(업체 코드 비트/자릿수, 참조 비트/자릿수), 비교 방식과 EPC 생성에 쓴다.
+ */
+static const int bench_layout_[4][7][4] = {
+    {{40, 12, 4, 1}, {37, 11, 7, 2}, {34, 10, 10, 3}, {30, 9, 14, 4}, {27, 8, 17, 5}, {24, 7, 20, 6}, {20, 6, 24, 7}},
+    {{40, 12, 18, 5}, {37, 11, 21, 6}, {34, 10, 24, 7}, {30, 9, 28, 8}, {27, 8, 31, 9}, {24, 7, 34, 10}, {20, 6, 38, 11}},
+    {{40, 12, 4, 0}, {37, 11, 7, 1}, {34, 10, 10, 2}, {30, 9, 14, 3}, {27, 8, 17, 4}, {24, 7, 20, 5}, {20, 6, 24, 6}},
+    {{40, 12, 42, 13}, {37, 11, 45, 14}, {34, 10, 48, 15}, {30, 9, 52, 16}, {27, 8, 55, 17}, {24, 7, 58, 18}, {20, 6, 62, 19}}
+};
+
+static const uint8_t bench_header_[4] = {0x30, 0x31, 0x33, 0x34};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief xorshift64 난수
+ */
+static uint64_t Rand_(INOUT_ uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/**
+ * @brief 10^digits
+ */
+static uint64_t Pow10_(IN_ const int digits) {
+    uint64_t v = 1U;
+    for (int i = 0; i < digits; ++i)
+        v *= 10U;
+    return v;
+}
+
+/**
+ * @brief EPC 비트 배열(MSB first)의 [pos, pos + len) 에 값을 쓴다.
+ */
+static void PutBits_(OUT_ uint8_t *epc, IN_ const int pos, IN_ const int len, IN_ const uint64_t v) {
+    for (int i = 0; i < len; ++i) {
+        const int bit = pos + i;
+        if (0U != ((v >> (len - 1 - i)) & 1U))
+            epc[bit / 8] |= (uint8_t) (0x80U >> (bit % 8));
+    }
+}
+
+/**
+ * @brief GS1 EPC 1건을 만든다.
+ */
+static void MakeEpc_(INOUT_ uint64_t *rng, OUT_ uint8_t *epc, OUT_ bench_expect_t *expect) {
+    memset(epc, 0, BENCH_EPC_BYTES);
+    memset(expect, 0, sizeof(*expect));
+    if ((int) (Rand_(rng) % 100U) < BENCH_FOREIGN_PCT) {
+        // 제조사 TID 형태 등 GS1 이 아닌 EPC
+        for (int i = 0; i < BENCH_EPC_BYTES; ++i)
+            epc[i] = (uint8_t) Rand_(rng);
+        epc[0] = 0xE2;
+        expect->scheme = RFID_GS1_UNKNOWN;
+        return;
+    }
+
+    const int s = (int) (Rand_(rng) % 4U);
+    const int p = (int) (Rand_(rng) % 7U);
+    const int *l = bench_layout_[s][p];
+    expect->scheme = (uint8_t) (s + 1);
+    expect->company_prefix = Rand_(rng) % Pow10_(l[1]);
+    expect->reference = (l[3] > 0) ? (Rand_(rng) % Pow10_(l[3])) : 0U;
+    // GIAI-96 는 자릿수보다 비트 폭이 좁은 partition 이 있다.
+    expect->reference &= (1ULL << l[2]) - 1U;
+    PutBits_(epc, 0, 8, bench_header_[s]);
+    PutBits_(epc, 8, 3, Rand_(rng) % 8U);
+    PutBits_(epc, 11, 3, (uint64_t) p);
+    PutBits_(epc, 14, l[0], expect->company_prefix);
+    PutBits_(epc, 14 + l[0], l[2], expect->reference);
+    if ((0 == s) || (2 == s)) {
+        expect->serial = Rand_(rng) & ((1ULL << 38) - 1U);
+        PutBits_(epc, 58, 38, expect->serial);
+    }
+}
+
+/**
+ * @brief 비교 방식: hex 문자열을 다시 바이트로 바꾸고 비트를 하나씩 잘라 필드를 만든다.
+ * @return 1: 해석함, 0: 해석하지 못함
+ */
+static int SlowDecode_(IN_ const char *hex, OUT_ bench_expect_t *out) {
+    uint8_t bits[96];
+    for (int i = 0; i < BENCH_EPC_BYTES; ++i) {
+        char pair[3] = {hex[i * 2], hex[i * 2 + 1], '\0'};
+        const unsigned long b = strtoul(pair, NULL, 16);
+        for (int k = 0; k < 8; ++k)
+            bits[i * 8 + k] = (uint8_t) ((b >> (7 - k)) & 1U);
+    }
+    uint64_t header = 0;
+    uint64_t partition = 0;
+    for (int i = 0; i < 8; ++i)
+        header = (header << 1) | bits[i];
+    for (int i = 11; i < 14; ++i)
+        partition = (partition << 1) | bits[i];
+
+    int s = -1;
+    for (int k = 0; k < 4; ++k) {
+        if (bench_header_[k] == header)
+            s = k;
+    }
+    memset(out, 0, sizeof(*out));
+    if ((s < 0) || (partition > 6U))
+        return 0;
+
+    const int *l = bench_layout_[s][partition];
+    for (int i = 0; i < l[0]; ++i)
+        out->company_prefix = (out->company_prefix << 1) | bits[14 + i];
+    for (int i = 0; i < l[2]; ++i)
+        out->reference = (out->reference << 1) | bits[14 + l[0] + i];
+    if ((0 == s) || (2 == s)) {
+        for (int i = 58; i < 96; ++i)
+            out->serial = (out->serial << 1) | bits[i];
+    }
+    if ((out->company_prefix >= Pow10_(l[1])) || (out->reference >= Pow10_(l[3])))
+        return 0;
+    out->scheme = (uint8_t) (s + 1);
+    return 1;
+}
+
+int main(void) {
+    uint8_t *epcs = (uint8_t *) calloc(BENCH_EPCS, BENCH_EPC_BYTES);
+    bench_expect_t *expect = (bench_expect_t *) calloc(BENCH_EPCS, sizeof(bench_expect_t));
+    rfid_gs1_record_t *records = (rfid_gs1_record_t *) calloc(BENCH_EPCS, sizeof(rfid_gs1_record_t));
+    char *hex = (char *) calloc(BENCH_EPCS, BENCH_EPC_BYTES * 2 + 1);
+    if ((NULL == epcs) || (NULL == expect) || (NULL == records) || (NULL == hex))
+        return 1;
+
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    static const char digits[] = "0123456789ABCDEF";
+    for (int i = 0; i < BENCH_EPCS; ++i) {
+        uint8_t *epc = epcs + (size_t) i * BENCH_EPC_BYTES;
+        MakeEpc_(&rng, epc, &expect[i]);
+        char *h = hex + (size_t) i * (BENCH_EPC_BYTES * 2 + 1);
+        for (int b = 0; b < BENCH_EPC_BYTES; ++b) {
+            h[b * 2] = digits[epc[b] >> 4];
+            h[b * 2 + 1] = digits[epc[b] & 0x0F];
+        }
+    }
+
+    printf("[BENCH] GS1 decode: %d EPCs (SGTIN/SSCC/GRAI/GIAI-96, %d%% non-GS1), %d rounds\n",
+           BENCH_EPCS, BENCH_FOREIGN_PCT, BENCH_ROUNDS);
+
+    // 1) 일괄 해석
+    int decoded = 0;
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < BENCH_ROUNDS; ++r) {
+        const uint64_t t0 = NowNs_();
+        (void) rfid_gs1_decode_batch(epcs, BENCH_EPC_BYTES, BENCH_EPCS, records, &decoded);
+        const uint64_t dt = NowNs_() - t0;
+        if (dt < best)
+            best = dt;
+    }
+    uint64_t bad = 0;
+    for (int i = 0; i < BENCH_EPCS; ++i) {
+        const rfid_gs1_record_t *rec = &records[i];
+        const bench_expect_t *e = &expect[i];
+        if (rec->scheme != e->scheme)
+            bad++;
+        else if ((RFID_GS1_UNKNOWN != e->scheme)
+                 && ((rec->company_prefix != e->company_prefix) || (rec->reference != e->reference) || (rec->serial != e->serial)))
+            bad++;
+    }
+    printf("batch      : %.2f ns/EPC, %.1f M EPC/s (decoded=%d mismatch=%llu)\n",
+           (double) best / BENCH_EPCS,
+           (double) BENCH_EPCS * 1000.0 / (double) best,
+           decoded,
+           (unsigned long long) bad);
+
+    // 2) 해석 + URN
+    char urn[RFID_GS1_URN_MAX];
+    size_t urn_bytes = 0;
+    uint64_t t0 = NowNs_();
+    (void) rfid_gs1_decode_batch(epcs, BENCH_EPC_BYTES, BENCH_EPCS, records, &decoded);
+    for (int i = 0; i < BENCH_EPCS; ++i) {
+        size_t len = 0;
+        if (RFID_RESULT_OK == rfid_gs1_format_urn(&records[i], 0, urn, sizeof(urn), &len))
+            urn_bytes += len;
+    }
+    uint64_t t1 = NowNs_();
+    printf("batch+URN  : %.2f ns/EPC, %.1f M EPC/s (avg URN %.1f chars)\n",
+           (double) (t1 - t0) / BENCH_EPCS,
+           (double) BENCH_EPCS * 1000.0 / (double) (t1 - t0),
+           (decoded > 0) ? (double) urn_bytes / decoded : 0.0);
+
+    // 3) 비교: hex 재파싱 + 비트 단위 자르기
+    uint64_t slow_bad = 0;
+    t0 = NowNs_();
+    for (int i = 0; i < BENCH_EPCS; ++i) {
+        bench_expect_t got;
+        (void) SlowDecode_(hex + (size_t) i * (BENCH_EPC_BYTES * 2 + 1), &got);
+        if ((got.scheme != records[i].scheme)
+            || ((RFID_GS1_UNKNOWN != got.scheme) && ((got.company_prefix != records[i].company_prefix)
+                                                     || (got.reference != records[i].reference)
+                                                     || (got.serial != records[i].serial))))
+            slow_bad++;
+    }
+    t1 = NowNs_();
+    printf("hex+bits   : %.2f ns/EPC, %.1f M EPC/s (disagree=%llu)\n",
+           (double) (t1 - t0) / BENCH_EPCS,
+           (double) BENCH_EPCS * 1000.0 / (double) (t1 - t0),
+           (unsigned long long) slow_bad);
+
+    free(hex);
+    free(records);
+    free(expect);
+    free(epcs);
+    return ((0U == bad) && (0U == slow_bad)) ? 0 : 1;
+}
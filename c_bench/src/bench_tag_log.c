@@ -0,0 +1,224 @@
+/**
+ * @file bench_tag_log.c
+ * @brief mmap 태그 로그 기록/스캔 벤치마크
+ *
+ * 1) 100k tags/s 로 일정하게 append 하면서 append 1회 지연(p50/p99/max)과 dropped, msync 최대 시간을 잰다.
+ * 2) 제한 없이 append 해 writer 가 따라가는 최대 기록 속도를 잰다.
+ * 3) 기록된 세그먼트를 mmap 으로 스캔해 레코드 처리 속도(MiB/s)를 잰다.
+ *
+ * 사용법: rfid_bench_tag_log [dir]  (dir 생략 시 /tmp 아래 임시 디렉터리를 만들고 끝나면 지운다)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rfid_tag_log.h"
+
+#define BENCH_RATE          (100000)    /**< 목표 처리량(tags/s) */
+#define BENCH_BATCH         (100)       /**< append 1회 태그 수(1 ms 분량) */
+#define BENCH_PACED_SEC     (3)         /**< 일정 속도 구간 길이(s) */
+#define BENCH_BURST_TAGS    (2000000)   /**< 제한 없는 구간 태그 수 */
+#define BENCH_EPC_BYTES     (12)
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief uint64 비교(qsort 용)
+ */
+static int CompareU64_(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *) a;
+    const uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief 태그 배치를 채운다(EPC 하위 4바이트에 순번).
+ */
+static void FillBatch_(OUT_ rfid_tag_t *tags, IN_ const uint32_t base) {
+    for (int i = 0; i < BENCH_BATCH; ++i) {
+        const uint32_t seq = base + (uint32_t) i;
+        rfid_tag_t *t = &tags[i];
+        t->rssi = -40 - (int) (seq % 30U);
+        t->readcnt = 1U + (seq % 5U);
+        t->antenna = 1 + (int) (seq % 4U);
+        t->ts = (uint64_t) seq;
+        t->epc_len = BENCH_EPC_BYTES;
+        for (int b = 0; b < BENCH_EPC_BYTES; ++b)
+            t->epc_bytes[b] = (uint8_t) ((b < 8) ? (0x30 + b) : (seq >> (8 * (BENCH_EPC_BYTES - 1 - b))));
+        t->rule_id = RFID_EPC_RULE_NONE;
+    }
+}
+
+/**
+ * @brief 통계 출력
+ */
+static void PrintStats_(IN_ const char *name, IN_ rfid_tag_log_t *log) {
+    rfid_tag_log_stat_t st;
+    (void) rfid_tag_log_get_stats(log, &st);
+    printf("  %-6s appended=%llu dropped=%llu written=%llu synced=%llu lost=%llu segments=%u"
+           " queue_peak=%u/%u syncs=%u sync_max=%.1fms errno=%d\n",
+           name,
+           (unsigned long long) st.appended,
+           (unsigned long long) st.dropped,
+           (unsigned long long) st.written,
+           (unsigned long long) st.synced,
+           (unsigned long long) st.lost,
+           st.segments_opened,
+           st.queue_peak,
+           st.queue_capacity,
+           st.sync_count,
+           (double) st.sync_max_us / 1000.0,
+           st.last_errno);
+}
+
+/**
+ * @brief 디렉터리의 세그먼트를 모두 스캔한다.
+ * @return 레코드 수
+ */
+static uint64_t ScanDir_(IN_ const char *dir, IN_ const int remove_files, OUT_ uint64_t *out_ns, OUT_ uint64_t *out_sum) {
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t ns = 0;
+    DIR *d = opendir(dir);
+    if (NULL == d)
+        return 0;
+
+    const struct dirent *e;
+    while (NULL != (e = readdir(d))) {
+        const size_t n = strlen(e->d_name);
+        if ((n < 5U) || (0 != strcmp(e->d_name + n - 4U, ".rtl")))
+            continue;
+        char path[4096];
+        (void) snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+
+        rfid_tag_log_segment_t *seg = NULL;
+        if (RFID_RESULT_OK == rfid_tag_log_segment_map(path, &seg)) {
+            uint64_t count = 0;
+            const uint64_t t0 = NowNs_();
+            const rfid_tag_log_record_t *recs = rfid_tag_log_segment_records(seg, &count);
+            for (uint64_t i = 0; i < count; ++i)
+                sum += (recs[i].antenna == 2U) ? recs[i].epc[BENCH_EPC_BYTES - 1] : 0U;
+            ns += NowNs_() - t0;
+            total += count;
+            rfid_tag_log_segment_unmap(&seg);
+        }
+        if (0 != remove_files)
+            (void) unlink(path);
+    }
+    (void) closedir(d);
+    *out_ns = ns;
+    *out_sum = sum;
+    return total;
+}
+
+int main(int argc, char **argv) {
+    char tmp[] = "/tmp/rfid_tag_log_XXXXXX";
+    const int own_dir = (argc < 2);
+    const char *dir = own_dir ? mkdtemp(tmp) : argv[1];
+    if (NULL == dir) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+
+    rfid_tag_log_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.dir = dir;
+
+    rfid_tag_log_t *log = NULL;
+    if (RFID_RESULT_OK != rfid_tag_log_open(&params, &log)) {
+        fprintf(stderr, "rfid_tag_log_open(%s) failed\n", dir);
+        return 1;
+    }
+
+    rfid_tag_t *tags = (rfid_tag_t *) calloc(BENCH_BATCH, sizeof(rfid_tag_t));
+    const int batches = BENCH_RATE / BENCH_BATCH * BENCH_PACED_SEC;
+    uint64_t *lat = (uint64_t *) calloc((size_t) batches, sizeof(uint64_t));
+    if ((NULL == tags) || (NULL == lat))
+        return 1;
+
+    printf("[BENCH] tag log: dir=%s record=%zu B, %d tags/s x %d s, batch=%d\n",
+           dir, sizeof(rfid_tag_log_record_t), BENCH_RATE, BENCH_PACED_SEC, BENCH_BATCH);
+
+    // 1) 일정 속도: 1 ms 마다 BENCH_BATCH 건
+    uint32_t seq = 0;
+    const uint64_t start = NowNs_();
+    for (int b = 0; b < batches; ++b) {
+        const uint64_t due = start + (uint64_t) b * 1000000ULL;
+        uint64_t now = NowNs_();
+        if (now < due) {
+            const struct timespec ts = {0, (long) (due - now)};
+            (void) nanosleep(&ts, NULL);
+        }
+        FillBatch_(tags, seq);
+        seq += BENCH_BATCH;
+        const uint64_t t0 = NowNs_();
+        (void) rfid_tag_log_append(log, 1, tags, BENCH_BATCH);
+        lat[b] = NowNs_() - t0;
+    }
+    const uint64_t f0 = NowNs_();
+    (void) rfid_tag_log_flush(log);
+    const uint64_t f1 = NowNs_();
+    qsort(lat, (size_t) batches, sizeof(uint64_t), CompareU64_);
+    printf("paced : append/batch p50=%.2fus p99=%.2fus max=%.2fus (%.1f ns/tag) flush=%.1fms\n",
+           (double) lat[batches / 2] / 1000.0,
+           (double) lat[(batches * 99) / 100] / 1000.0,
+           (double) lat[batches - 1] / 1000.0,
+           (double) lat[batches / 2] / BENCH_BATCH,
+           (double) (f1 - f0) / 1e6);
+    PrintStats_("paced", log);
+
+    // 2) 제한 없음: writer 가 비우는 속도 이상으로 넣으면 큐가 차서 dropped 가 생긴다.
+    rfid_tag_log_stat_t before;
+    (void) rfid_tag_log_get_stats(log, &before);
+    const uint64_t b0 = NowNs_();
+    for (int n = 0; n < BENCH_BURST_TAGS; n += BENCH_BATCH) {
+        FillBatch_(tags, seq);
+        seq += BENCH_BATCH;
+        (void) rfid_tag_log_append(log, 2, tags, BENCH_BATCH);
+    }
+    (void) rfid_tag_log_flush(log);
+    const uint64_t b1 = NowNs_();
+    rfid_tag_log_stat_t after;
+    (void) rfid_tag_log_get_stats(log, &after);
+    const double sec = (double) (b1 - b0) / 1e9;
+    printf("burst : %d tags in %.3fs -> written %.0f tags/s (%.1f MiB/s), dropped %llu\n",
+           BENCH_BURST_TAGS,
+           sec,
+           (double) (after.written - before.written) / sec,
+           (double) (after.written - before.written) * sizeof(rfid_tag_log_record_t) / sec / (1024.0 * 1024.0),
+           (unsigned long long) (after.dropped - before.dropped));
+    PrintStats_("total", log);
+
+    rfid_tag_log_close(&log);
+
+    // 3) 스캔
+    uint64_t scan_ns = 0;
+    uint64_t sum = 0;
+    const uint64_t total = ScanDir_(dir, own_dir, &scan_ns, &sum);
+    const double ssec = (double) scan_ns / 1e9;
+    printf("scan  : %llu records in %.3fs -> %.0f MiB/s, %.1f Mrec/s (checksum %llu)\n",
+           (unsigned long long) total,
+           ssec,
+           (ssec > 0.0) ? (double) total * sizeof(rfid_tag_log_record_t) / ssec / (1024.0 * 1024.0) : 0.0,
+           (ssec > 0.0) ? (double) total / ssec / 1e6 : 0.0,
+           (unsigned long long) sum);
+
+    if (own_dir)
+        (void) rmdir(dir);
+    free(lat);
+    free(tags);
+    return (total == after.written) ? 0 : 1;
+}
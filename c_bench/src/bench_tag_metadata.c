@@ -0,0 +1,215 @@
+/**
+ * @file bench_tag_metadata.c
+ * @brief 태그 응답 metadata 선택에 따른 bytes/tag 벤치마크
+ *
+ * GET_TAG_ID_BUFFER(0x29) 응답 프레임을 SDK 형식대로 만들고 SDK 파서(TMR_SR_parseMetadataFromMessage)로
+ * 다시 읽어, metadata 조합별로 태그 1건의 응답 크기, 256바이트 패킷당 태그 수,
+ * 400 tags/s 를 가져오는 데 필요한 왕복 횟수와 링크 시간, 호스트 파싱 시간(ns/tag)을 비교한다.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tm_reader.h"
+#include "serial_reader_imp.h"
+#include "rfid_types.h"
+
+#define BENCH_EPC_BYTES        (12)     /**< SGTIN-96 EPC 길이 */
+#define BENCH_TAGS_PER_SEC     (400)    /**< 목표 처리량(tags/s) */
+#define BENCH_PARSE_ROUNDS     (200000) /**< 파싱 측정 반복 횟수 */
+#define BENCH_FRAME_PREFIX     (9)      /**< FF, len, opcode, status(2), flags(2), read options, tag count */
+#define BENCH_FRAME_CRC        (2)
+#define BENCH_CMD_BYTES        (8)      /**< FF, len, opcode, flags(2), read options, CRC(2) */
+#define BENCH_BITS_PER_BYTE    (10.0)   /**< start + 8 data + stop */
+
+/**
+ * @brief 비교할 metadata 조합
+ */
+typedef struct bench_case {
+    const char *name;
+    uint16_t flags;
+} bench_case_t;
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Gen2 태그 1건의 응답 레코드를 SDK 형식대로 기록한다.
+ *
+ * @param[out] msg 프레임 버퍼
+ * @param[in,out] pos 기록 위치
+ * @param[in] flags metadata 플래그
+ * @param[in] seq 태그 순번(EPC/metadata 값 생성용)
+ */
+static void PutRecord_(OUT_ uint8_t *msg, INOUT_ uint32_t *pos, IN_ const uint16_t flags, IN_ const uint32_t seq) {
+    uint32_t i = *pos;
+    if (flags & TMR_TRD_METADATA_FLAG_READCOUNT)
+        msg[i++] = (uint8_t) (1U + (seq % 7U));
+    if (flags & TMR_TRD_METADATA_FLAG_RSSI)
+        msg[i++] = (uint8_t) (int8_t) (-40 - (int) (seq % 30U));
+    if (flags & TMR_TRD_METADATA_FLAG_ANTENNAID)
+        msg[i++] = (uint8_t) (0x11U + (seq % 2U));
+    if (flags & TMR_TRD_METADATA_FLAG_FREQUENCY) {
+        msg[i++] = 0x0E;
+        msg[i++] = 0x1B;
+        msg[i++] = 0x28;
+    }
+    if (flags & TMR_TRD_METADATA_FLAG_TIMESTAMP) {
+        msg[i++] = (uint8_t) (seq >> 24);
+        msg[i++] = (uint8_t) (seq >> 16);
+        msg[i++] = (uint8_t) (seq >> 8);
+        msg[i++] = (uint8_t) seq;
+    }
+    if (flags & TMR_TRD_METADATA_FLAG_PHASE) {
+        msg[i++] = 0x00;
+        msg[i++] = (uint8_t) (seq % 180U);
+    }
+    if (flags & TMR_TRD_METADATA_FLAG_PROTOCOL)
+        msg[i++] = (uint8_t) TMR_TAG_PROTOCOL_GEN2;
+    if (flags & TMR_TRD_METADATA_FLAG_DATA) {
+        msg[i++] = 0x00;  // data bit 길이 0
+        msg[i++] = 0x00;
+    }
+    if (flags & TMR_TRD_METADATA_FLAG_GPIO_STATUS)
+        msg[i++] = 0x00;
+    if (flags & TMR_TRD_METADATA_FLAG_GEN2_Q)
+        msg[i++] = 0x04;
+    if (flags & TMR_TRD_METADATA_FLAG_GEN2_LF)
+        msg[i++] = 0x02;
+    if (flags & TMR_TRD_METADATA_FLAG_GEN2_TARGET)
+        msg[i++] = 0x00;
+
+    // EPC 비트 길이(PC + EPC + CRC), PC, EPC, CRC
+    const uint32_t bits = (uint32_t) (2 + BENCH_EPC_BYTES + 2) * 8U;
+    msg[i++] = (uint8_t) (bits >> 8);
+    msg[i++] = (uint8_t) bits;
+    msg[i++] = 0x30;
+    msg[i++] = 0x00;
+    for (int b = 0; b < BENCH_EPC_BYTES; ++b)
+        msg[i++] = (uint8_t) ((b < 8) ? (0x30 + b) : (seq >> (8 * (BENCH_EPC_BYTES - 1 - b))));
+    msg[i++] = 0xAB;
+    msg[i++] = 0xCD;
+    *pos = i;
+}
+
+/**
+ * @brief 한 조합에 대해 응답 프레임을 채우고 파싱해 결과를 출력한다.
+ * @param[in] reader 파서에 넘길 Reader(필드 일부만 참조됨)
+ * @param[in] c 비교 조합
+ * @param[in] base_bytes 기준 조합의 태그당 링크 바이트(0이면 비교 생략)
+ * @param[out] out_wire_bytes 태그당 링크 바이트(프레임/명령 오버헤드 포함)
+ * @return 성공 0, 파싱 결과 불일치 1
+ */
+static int RunCase_(IN_ TMR_Reader *reader
+                    , IN_ const bench_case_t *c
+                    , IN_ const double base_bytes
+                    , OUT_ double *out_wire_bytes) {
+    uint8_t msg[TMR_SR_MAX_PACKET_SIZE + 64];
+    memset(msg, 0, sizeof(msg));
+
+    // 레코드 1건 크기 측정
+    uint32_t pos = BENCH_FRAME_PREFIX;
+    PutRecord_(msg, &pos, c->flags, 0);
+    const uint32_t record = pos - BENCH_FRAME_PREFIX;
+
+    // SDK 수신 버퍼(TMR_SR_MAX_PACKET_SIZE, 헤더/CRC 포함)에 들어가는 만큼 채운 프레임
+    const uint32_t per_frame = (TMR_SR_MAX_PACKET_SIZE - BENCH_FRAME_PREFIX - BENCH_FRAME_CRC) / record;
+    pos = BENCH_FRAME_PREFIX;
+    for (uint32_t t = 0; t < per_frame; ++t)
+        PutRecord_(msg, &pos, c->flags, t);
+    msg[0] = 0xFF;
+    msg[1] = (uint8_t) (pos - 5);
+    msg[2] = TMR_SR_OPCODE_GET_TAG_ID_BUFFER;
+    msg[5] = (uint8_t) (c->flags >> 8);
+    msg[6] = (uint8_t) c->flags;
+    msg[8] = (uint8_t) per_frame;
+
+    // SDK 파서로 다시 읽어 레코드 경계가 맞는지 확인
+    int bad = 0;
+    TMR_TagReadData trd;
+    uint8_t cursor = BENCH_FRAME_PREFIX;
+    for (uint32_t t = 0; t < per_frame; ++t) {
+        TMR_TRD_init(&trd);
+        TMR_SR_parseMetadataFromMessage(reader, &trd, c->flags, &cursor, msg);
+        if ((BENCH_EPC_BYTES != trd.tag.epcByteCount) || (TMR_TAG_PROTOCOL_GEN2 != trd.tag.protocol))
+            bad = 1;
+    }
+    if ((uint32_t) cursor != pos)
+        bad = 1;
+
+    volatile uint32_t sink = 0;
+    const uint64_t t0 = NowNs_();
+    for (uint32_t r = 0; r < BENCH_PARSE_ROUNDS / per_frame; ++r) {
+        cursor = BENCH_FRAME_PREFIX;
+        for (uint32_t t = 0; t < per_frame; ++t) {
+            TMR_SR_parseMetadataFromMessage(reader, &trd, c->flags, &cursor, msg);
+            sink += trd.tag.epc[BENCH_EPC_BYTES - 1];
+        }
+    }
+    const uint64_t t1 = NowNs_();
+    (void) sink;
+    const uint32_t parsed = (BENCH_PARSE_ROUNDS / per_frame) * per_frame;
+
+    const uint32_t frames = (BENCH_TAGS_PER_SEC + per_frame - 1U) / per_frame;
+    const double wire = (double) BENCH_TAGS_PER_SEC * record
+                        + (double) frames * (BENCH_FRAME_PREFIX + BENCH_FRAME_CRC + BENCH_CMD_BYTES);
+    *out_wire_bytes = wire / BENCH_TAGS_PER_SEC;
+
+    printf("%-22s flags=0x%04X record=%3u B/tag tags/frame=%3u frames/%d=%3u wire=%6.1f B/tag"
+           " link@115200=%6.1fms link@921600=%5.1fms parse=%5.1fns/tag%s"
+           , c->name
+           , (unsigned) c->flags
+           , (unsigned) record
+           , (unsigned) per_frame
+           , BENCH_TAGS_PER_SEC
+           , (unsigned) frames
+           , *out_wire_bytes
+           , wire * BENCH_BITS_PER_BYTE * 1000.0 / 115200.0
+           , wire * BENCH_BITS_PER_BYTE * 1000.0 / 921600.0
+           , (double) (t1 - t0) / (double) parsed
+           , bad ? " [PARSE MISMATCH]" : "");
+    if (base_bytes > 0.0)
+        printf(" (%.0f%% of default)", 100.0 * *out_wire_bytes / base_bytes);
+    printf("\n");
+    return bad;
+}
+
+int main(void) {
+    static const bench_case_t cases[] = {
+        {"sdk default (ALL)", TMR_TRD_METADATA_FLAG_ALL},
+        {"RFID_TAG_META_ALL", TMR_TRD_METADATA_FLAG_PROTOCOL | TMR_TRD_METADATA_FLAG_READCOUNT
+                              | TMR_TRD_METADATA_FLAG_RSSI | TMR_TRD_METADATA_FLAG_ANTENNAID
+                              | TMR_TRD_METADATA_FLAG_TIMESTAMP},
+        {"rssi + antenna", TMR_TRD_METADATA_FLAG_PROTOCOL | TMR_TRD_METADATA_FLAG_RSSI | TMR_TRD_METADATA_FLAG_ANTENNAID},
+        {"epc only", TMR_TRD_METADATA_FLAG_PROTOCOL},
+    };
+
+    // 파서는 Reader의 일부 상태(continuousReading, versionInfo 등)만 참조한다.
+    TMR_Reader *reader = (TMR_Reader *) calloc(1, sizeof(TMR_Reader));
+    if (NULL == reader)
+        return 1;
+
+    printf("[BENCH] tag metadata: %d-byte EPC, %d tags/s, GET_TAG_ID_BUFFER frames\n", BENCH_EPC_BYTES, BENCH_TAGS_PER_SEC);
+
+    int failed = 0;
+    double base = 0.0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        double wire = 0.0;
+        failed |= RunCase_(reader, &cases[i], base, &wire);
+        if (0 == i)
+            base = wire;
+    }
+
+    free(reader);
+    return failed;
+}
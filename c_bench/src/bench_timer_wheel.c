@@ -0,0 +1,184 @@
+/**
+ * @file bench_timer_wheel.c
+ * @brief 계층형 타이밍 휠 벤치마크(타이머 1M 개)
+ *
+ * 1) 타이머 1M 개를 0 ~ 60 s 사이 만료 시각으로 등록하는 시간(ns/op)을 잰다.
+ * 2) 1 ms 씩 60 s 를 진행하면서 매 tick 마다 일부 타이머를 재등록(태그 재검출)하고,
+ *    advance 1회 지연(p50/p99/max)과 만료 1건당 시간을 잰다. 재등록은 처음 60 s 동안만 하고 모든 타이머가 만료될 때까지 진행한다.
+ *    늦거나 이른 만료가 없는지 함께 확인한다. max 는 상위 단계 슬롯을 한꺼번에 내리는 tick 이다.
+ * 3) 비교용으로 만료 시각 배열 1M 개를 매 tick 전체 순회하는 방식의 tick 당 시간을 잰다.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "rfid_timer_wheel.h"
+
+#define BENCH_TIMERS        (1000000)   /**< 타이머 수 */
+#define BENCH_SPAN_MS       (60000U)    /**< 만료 시각 범위(ms) */
+#define BENCH_RESCHED_TICK  (200)       /**< tick 당 재등록 수 */
+#define BENCH_CANCEL_PCT    (5)         /**< 취소 비율(%) */
+#define BENCH_SCAN_TICKS    (200)       /**< 전체 순회 비교 tick 수 */
+#define BENCH_EXPIRY_BUF    (4096)      /**< advance 1회 버퍼 */
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief uint64 비교(qsort 용)
+ */
+static int CompareU64_(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *) a;
+    const uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief xorshift64 난수
+ */
+static uint64_t Rand_(INOUT_ uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+int main(void) {
+    const uint64_t start_ms = 1000000ULL;
+    rfid_timer_wheel_t *wheel = NULL;
+    if (RFID_RESULT_OK != rfid_timer_wheel_create(BENCH_TIMERS, start_ms, &wheel)) {
+        fprintf(stderr, "rfid_timer_wheel_create failed\n");
+        return 1;
+    }
+
+    rfid_timer_id_t *ids = (rfid_timer_id_t *) calloc(BENCH_TIMERS, sizeof(rfid_timer_id_t));
+    uint64_t *deadline = (uint64_t *) calloc(BENCH_TIMERS, sizeof(uint64_t));
+    uint64_t *lat = (uint64_t *) calloc(BENCH_SPAN_MS * 3U, sizeof(uint64_t));
+    rfid_timer_expiry_t *expiry = (rfid_timer_expiry_t *) calloc(BENCH_EXPIRY_BUF, sizeof(rfid_timer_expiry_t));
+    if ((NULL == ids) || (NULL == deadline) || (NULL == lat) || (NULL == expiry))
+        return 1;
+
+    printf("[BENCH] timer wheel: %d timers, deadlines within %u ms, %d reschedules/tick, %d%% cancelled\n",
+           BENCH_TIMERS, BENCH_SPAN_MS, BENCH_RESCHED_TICK, BENCH_CANCEL_PCT);
+
+    // 1) 등록/취소
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    uint64_t t0 = NowNs_();
+    for (int i = 0; i < BENCH_TIMERS; ++i) {
+        deadline[i] = start_ms + 1U + (Rand_(&rng) % BENCH_SPAN_MS);
+        if (RFID_RESULT_OK != rfid_timer_wheel_schedule(wheel, deadline[i], (uint64_t) i, &ids[i]))
+            return 1;
+    }
+    uint64_t t1 = NowNs_();
+    printf("schedule   : %.1f ns/op\n", (double) (t1 - t0) / BENCH_TIMERS);
+
+    int cancelled = 0;
+    t0 = NowNs_();
+    for (int i = 0; i < BENCH_TIMERS; i += 100 / BENCH_CANCEL_PCT) {
+        (void) rfid_timer_wheel_cancel(wheel, ids[i]);
+        deadline[i] = 0U;
+        cancelled++;
+    }
+    t1 = NowNs_();
+    printf("cancel     : %.1f ns/op\n", (double) (t1 - t0) / cancelled);
+
+    // 2) 1 ms tick 진행 + 재등록. 재등록은 만료 전 타이머만 골라 now + 1..SPAN 으로 미룬다(태그 재검출).
+    uint64_t resched_ns = 0;
+    uint64_t resched_count = 0;
+    uint64_t advance_ns = 0;
+    uint64_t expired = 0;
+    uint64_t bad = 0;
+    int ticks = 0;
+    uint64_t now = start_ms;
+    while ((expired + (uint64_t) cancelled < BENCH_TIMERS) && (ticks < (int) (BENCH_SPAN_MS * 3U))) {
+        now++;
+
+        const uint64_t r0 = NowNs_();
+        for (int k = 0; (k < BENCH_RESCHED_TICK) && (ticks < (int) BENCH_SPAN_MS); ++k) {
+            const int i = (int) (Rand_(&rng) % BENCH_TIMERS);
+            if (deadline[i] <= now)
+                continue;
+            deadline[i] = now + 1U + (Rand_(&rng) % BENCH_SPAN_MS);
+            (void) rfid_timer_wheel_reschedule(wheel, ids[i], deadline[i]);
+            resched_count++;
+        }
+        resched_ns += NowNs_() - r0;
+
+        const uint64_t a0 = NowNs_();
+        int count = 0;
+        do {
+            (void) rfid_timer_wheel_advance(wheel, now, expiry, BENCH_EXPIRY_BUF, &count);
+            for (int e = 0; e < count; ++e) {
+                const uint64_t i = expiry[e].user_data;
+                if (deadline[i] != now)
+                    bad++;
+                deadline[i] = 0U;
+            }
+            expired += (uint64_t) count;
+        } while (BENCH_EXPIRY_BUF == count);
+        lat[ticks] = NowNs_() - a0;
+        advance_ns += lat[ticks];
+        ticks++;
+    }
+    qsort(lat, (size_t) ticks, sizeof(uint64_t), CompareU64_);
+    printf("reschedule : %.1f ns/op (%llu ops)\n",
+           (resched_count > 0U) ? (double) resched_ns / (double) resched_count : 0.0,
+           (unsigned long long) resched_count);
+    printf("advance    : %d ticks, p50=%.2fus p99=%.2fus max=%.2fus, %.1f ns/expired, expired=%llu late/early=%llu\n",
+           ticks,
+           (double) lat[ticks / 2] / 1000.0,
+           (double) lat[(ticks * 99) / 100] / 1000.0,
+           (double) lat[ticks - 1] / 1000.0,
+           (expired > 0U) ? (double) advance_ns / (double) expired : 0.0,
+           (unsigned long long) expired,
+           (unsigned long long) bad);
+
+    rfid_timer_wheel_stat_t st;
+    (void) rfid_timer_wheel_get_stats(wheel, &st);
+    printf("stats      : active=%u scheduled=%llu cancelled=%llu expired=%llu cascaded=%llu (%.2f/timer)\n",
+           st.active,
+           (unsigned long long) st.scheduled,
+           (unsigned long long) st.cancelled,
+           (unsigned long long) st.expired,
+           (unsigned long long) st.cascaded,
+           (double) st.cascaded / (double) BENCH_TIMERS);
+
+    // 3) 비교: 만료 시각 배열 전체 순회
+    rng = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < BENCH_TIMERS; ++i)
+        deadline[i] = start_ms + 1U + (Rand_(&rng) % BENCH_SPAN_MS);
+    uint64_t hits = 0;
+    t0 = NowNs_();
+    for (int t = 1; t <= BENCH_SCAN_TICKS; ++t) {
+        const uint64_t scan_now = start_ms + (uint64_t) t;
+        for (int i = 0; i < BENCH_TIMERS; ++i) {
+            if ((0U != deadline[i]) && (deadline[i] <= scan_now)) {
+                deadline[i] = 0U;
+                hits++;
+            }
+        }
+    }
+    t1 = NowNs_();
+    printf("full scan  : %.2f us/tick (%llu expired in %d ticks)\n",
+           (double) (t1 - t0) / 1000.0 / BENCH_SCAN_TICKS,
+           (unsigned long long) hits,
+           BENCH_SCAN_TICKS);
+
+    rfid_timer_wheel_destroy(&wheel);
+    free(expiry);
+    free(lat);
+    free(deadline);
+    free(ids);
+    return ((0U == bad) && (0U == st.active)) ? 0 : 1;
+}
@@ -2,12 +2,19 @@
 
 #include "rfid_api.h"
 
+#include <limits.h>   // INT_MAX
+#include <pthread.h>  // pthread_mutex_init, pthread_mutex_destroy
+#include <stdarg.h>   // va_list
+#include <stddef.h>   // offsetof
+#include <stdio.h>    // vsnprintf
 #include <stdlib.h>   // malloc, free, qsort
 #include <string.h>   // memset, strncpy
 #include <stdint.h>
+#include <time.h>     // clock_gettime
 
 // MercuryAPI headers (CMake에서 third_party/mercuryapi/c/include 를 include dir로 추가하는 것을 전제)
 #include "tm_reader.h"
+#include "serial_reader_imp.h"
 #include "tmr_params.h"
 #include "tmr_read_plan.h"
 #include "tmr_region.h"
@@ -15,28 +22,70 @@
 #include "tmr_tag_protocol.h"
 #include "tmr_status.h"
 
+#include "rfid_api_internal.h"
+#include "rfid_util_internal.h"
+
 // 내부 상수
 #define RFID_DEFAULT_PLAN_READTIME (1000U)
-#define RFID_MAX_ANTENNAS        (16U)
 #define RFID_REGIONLIST_MAX      (32U)
 
-/**
- * @brief RFID Reader 상태를 관리하는 내부 컨텍스트 구조체.
- * @note 외부에는 opaque 타입(rfid_ctx_t)으로 노출되며, 구현부에서만 정의된다.
- *
- * @param reader      MercuryAPI Reader 핸들
- * @param reader_created Reader가 생성되었는지 여부(1: 생성됨, 0: 미생성)
- * @param initialized 초기화 상태(1: init 완료, 0: 미완료)
- * @param region      사용자가 지정한 RFID Region 값
- * @param readPowerDbm 설정된 읽기 전력(dBm), 0이면 기본값 사용
- */
-typedef struct rfid_ctx {
-    TMR_Reader reader;
-    int reader_created;
-    int initialized;
-    RFID_REGION region;
-    int readPowerDbm;
-} rfid_ctx_t;
+// dwell 스케줄러 상수
+#define RFID_DWELL_DEFAULT_UPDATE_CYCLES (8)
+#define RFID_DWELL_DEFAULT_MIN_SHARE_PCT (5)
+#define RFID_DWELL_DEFAULT_MAX_SHARE_PCT (80)
+#define RFID_DWELL_WEIGHT_SCALE          (1000U)  // 가중치 단위(‰)
+#define RFID_DWELL_SEEN_SLOTS            (4096U)  // 신규 태그 판정용 EPC 해시 테이블 크기(2의 거듭제곱)
+#define RFID_DWELL_SEEN_PROBE            (8U)     // 선형 탐사 최대 길이
+#define RFID_DWELL_FORGET_WINDOWS        (4U)     // 이 횟수의 평가 구간 동안 안 보이면 다시 "신규"로 취급
+#define RFID_DWELL_YIELD_FLOOR           (0.1)    // 발견율 0인 안테나에도 남겨둘 최소 점수(tags/s)
+
+// Gen2 튜닝 상수
+#define RFID_GEN2_DEFAULT_EVAL_CYCLES    (4)
+#define RFID_GEN2_DYNAMIC_Q_POPULATION   (1024.0) // 이 이상이면 dynamic Q 사용
+#define RFID_GEN2_SMALL_POPULATION       (16.0)   // 이하: S0 / target A / high-speed 링크
+#define RFID_GEN2_MEDIUM_POPULATION      (128.0)  // 이하: S1 / target A, 초과: S2 / target AB
+#define RFID_GEN2_DENSE_POPULATION       (256.0)  // 초과: dense 링크 프로파일
+#define RFID_GEN2_BAND_HYSTERESIS        (0.25)   // 모집단 추정이 이 비율 이상 바뀌어야 session/target/링크 변경
+
+// 안테나별 read power 제어 상수
+#define RFID_POWER_DEFAULT_MIN_CDBM      (1000)
+#define RFID_POWER_DEFAULT_MAX_CDBM      (2700)
+#define RFID_POWER_DEFAULT_STEP_CDBM     (100)
+#define RFID_POWER_DEFAULT_UPDATE_CYCLES (4)
+#define RFID_POWER_DEFAULT_DEADBAND_PCT  (15)
+#define RFID_POWER_MIN_STEP_CDBM         (25)     // 방향이 뒤집힐 때 조정 폭을 절반씩 줄이는 하한
+#define RFID_POWER_FOREIGN_HOLD_WINDOWS  (8U)     // 다른 구역 태그로 감쇄한 뒤 증가를 막는 평가 구간 수
+
+// Select 필터 상수
+
+// 시리얼 링크(baud) 상수
+#define RFID_LINK_DEFAULT_MAX_RATE       (921600U)
+#define RFID_LINK_DEFAULT_PROBE_COUNT    (8U)
+#define RFID_LINK_DEFAULT_FALLBACK_ERRS  (3U)
+#define RFID_LINK_BITS_PER_BYTE          (10.0)   // start + 8 data + stop
+#define RFID_LINK_RATE_COUNT             (8U)
+
+// 모듈이 지원하는 baud(오름차순)
+static const uint32_t rfid_link_rates_[RFID_LINK_RATE_COUNT] = {
+    9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U
+};
+
+// 상태 카운터 상수
+#define RFID_FRAME_SOH                   (0xFFU)  // 프레임 시작 바이트
+#define RFID_FRAME_MAX_LEN               (0xF8U)  // SDK가 유효한 SOH로 보는 최대 길이 바이트
+#define RFID_FRAME_TX_OVERHEAD           (5U)     // SOH + LEN + OP + CRC(2)
+#define RFID_FRAME_RX_OVERHEAD_CRC       (7U)     // SOH + LEN + OP + STATUS(2) + CRC(2)
+#define RFID_FRAME_RX_OVERHEAD           (5U)     // CRC 미사용 응답
+#define RFID_FRAME_OP_READ_MULTIPLE      (0x22U)  // 동기 search 명령(Read Tag Multiple)
+#define RFID_FRAME_OP_MULTI_PROTOCOL     (0x2FU)  // multi-protocol/연속 search 명령
+#define RFID_COUNTER_RATE_ALPHA          (0.5)    // 안테나별 rate 평활 계수
+
+// 모듈 프레임 CRC 표(SDK tm_crc 와 같은 ThingMagic 변형 CRC-16, 4비트 단위)
+static const uint16_t rfid_frame_crc_table_[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef
+};
+
 
 /**
  * @brief TMR 에러 코드를 문자열로 변환한다.
@@ -45,7 +94,7 @@ typedef struct rfid_ctx {
  * @param[in] code TMR 에러 코드
  * @return 에러 코드 문자열. 매칭되지 않으면 "UNKNOWN_TMR_ERROR_CODE" 반환
  */
-static const char* TMR_ErrorCodeToString(TMR_ErrorCode code) {
+const char* RfidErrorCodeToString_(TMR_ErrorCode code) {
     switch (code) {
         /* =========================
          * SUCCESS
@@ -306,32 +355,6 @@ static const char* TMR_ErrorCodeToString(TMR_ErrorCode code) {
     }
 }
 
-/**
- * @brief 상태 코드와 에러 문자열 OUT 매개변수를 설정한다.
- *
- * @param[out] out_status  TMR 상태 코드 출력 포인터(NULL 허용)
- * @param[out] out_errstr  상태 문자열 출력 포인터(NULL 허용)
- * @param[in]  st          TMR 상태 코드 값
- *
- * @note 문자열은 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
- */
-static inline void SetOutStatusAndErr_(OUT_ uint32_t *out_status, OUT_ const char **out_errstr, IN_ TMR_Status st) {
-    if (NULL != out_status)
-        *out_status = (uint32_t) st;
-
-    if (NULL != out_errstr)
-        *out_errstr = TMR_ErrorCodeToString((TMR_ErrorCode) st);
-}
-
-/**
- * @brief 문자열이 NULL이거나 빈 문자열인지 확인한다.
- * @param s 검사할 문자열
- * @return NULL이거나 빈 문자열이면 1, 아니면 0
- */
-static int IsNullOrEmpty_(IN_ const char *s) {
-    return (NULL == s) || ('\0' == s[0]);
-}
-
 /**
  * @brief 상·하위 32비트 값을 결합하여 64비트 타임스탬프(ms)를 생성한다.
  * @param low  타임스탬프 하위 32비트 값
@@ -402,7 +425,7 @@ static TMR_Region MapRegion_(IN_ const RFID_REGION region) {
  *         RFID_RESULT_INVALID_ARG: 잘못된 인자,
  *         RFID_RESULT_REGION_FAIL: 지역 선택 실패
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
  */
 static RFID_RESULT SelectAutoRegion_(IN_ TMR_Reader *reader
                                      , OUT_ TMR_Region *out_region
@@ -477,6 +500,12 @@ const char* rfid_result_to_string(IN_ const RFID_RESULT result) {
         case RFID_RESULT_READ_FAIL:
             return "RFID_RESULT_READ_FAIL";
 
+        case RFID_RESULT_WRITE_FAIL:
+            return "RFID_RESULT_WRITE_FAIL";
+
+        case RFID_RESULT_BUSY:
+            return "RFID_RESULT_BUSY";
+
         case RFID_RESULT_INTERNAL_ERROR:
         default:
             return "RFID_RESULT_INTERNAL_ERROR";
@@ -520,6 +549,11 @@ static RFID_RESULT ValidateInitParams_(OUT_ rfid_ctx_t **out_ctx, IN_ const rfid
         return RFID_RESULT_DISABLED;
     if (0 != IsNullOrEmpty_(params->uri))
         return RFID_RESULT_INVALID_ARG;
+    if ((params->plan_count < 0) || (params->plan_count > RFID_PLAN_MAX) || ((params->plan_count > 0) && (NULL == params->plans)))
+        return RFID_RESULT_INVALID_ARG;
+    // read plan 목록을 쓰면 안테나는 각 항목에서 지정한다.
+    if ((params->plan_count > 0) && (NULL == params->antennas) && (0 == params->antenna_count))
+        return RFID_RESULT_OK;
     if ((NULL == params->antennas) || (params->antenna_count <= 0) || (params->antenna_count > (int) RFID_MAX_ANTENNAS))
         return RFID_RESULT_INVALID_ARG;
     return RFID_RESULT_OK;
@@ -561,7 +595,7 @@ static RFID_RESULT DestroyReader_(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status
  *         RFID_RESULT_INVALID_ARG: 잘못된 인자,
  *         RFID_RESULT_CONNECT_FAIL: 생성 실패
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
  */
 static RFID_RESULT CreateReader_(IN_ rfid_ctx_t *ctx
                                  , IN_ const char *uri
@@ -596,7 +630,7 @@ static RFID_RESULT CreateReader_(IN_ rfid_ctx_t *ctx
  *         RFID_RESULT_INVALID_ARG: 잘못된 인자,
  *         RFID_RESULT_CONNECT_FAIL: 연결 실패
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
  */
 static RFID_RESULT ConnectReader_(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
     SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
@@ -624,7 +658,7 @@ static RFID_RESULT ConnectReader_(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status
  *         RFID_RESULT_REGION_FAIL: Region 매핑/설정 실패,
  *         기타: SelectAutoRegion_() 결과 반환
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
  */
 static RFID_RESULT ConfigureRegion_(IN_ TMR_Reader *reader
                                     , IN_ const RFID_REGION region
@@ -656,312 +690,3437 @@ static RFID_RESULT ConfigureRegion_(IN_ TMR_Reader *reader
 }
 
 /**
- * @brief GEN2 Read Plan(안테나 리스트 포함)을 설정한다.
- *
- * @param[in]  reader      MercuryAPI Reader 핸들
- * @param[in]  antennas    안테나 번호 배열(1..N)
- * @param[in]  antenna_count 안테나 개수
- * @param[in]  plan_timeout_ms plan timeout(ms), 0 이하이면 기본값 사용
- * @param[out] out_status  TMR 상태 코드 출력 포인터(NULL 허용)
- * @param[out] out_errstr  상태 문자열 출력 포인터(NULL 허용)
+ * @brief transport 포인터로부터 소유 컨텍스트를 구한다.
+ * @note transport는 항상 ctx->reader.u.serialReader.transport 이다.
+ */
+static rfid_ctx_t* LinkCtx_(IN_ TMR_SR_SerialTransport *transport) {
+    return (rfid_ctx_t *) (void *) ((char *) transport
+                                    - offsetof(rfid_ctx_t, reader)
+                                    - offsetof(TMR_Reader, u.serialReader.transport));
+}
+
+/**
+ * @brief 모듈 프레임 CRC에 1바이트를 더한다(SDK tm_crc 와 같은 계산).
+ */
+static uint16_t CounterCrcByte_(IN_ const uint16_t crc, IN_ const uint8_t b) {
+    uint16_t c = crc;
+    c = (uint16_t) (((uint16_t) (c << 4) | (b >> 4)) ^ rfid_frame_crc_table_[c >> 12]);
+    c = (uint16_t) (((uint16_t) (c << 4) | (b & 0x0FU)) ^ rfid_frame_crc_table_[c >> 12]);
+    return c;
+}
+
+/**
+ * @brief 수신 바이트열로 프레임 경계/CRC를 추적한다.
  *
- * @return RFID_RESULT_OK: 성공,
- *         RFID_RESULT_INVALID_ARG: 인자 오류,
- *         RFID_RESULT_PLAN_FAIL: 설정 실패
+ * SDK의 TMR_SR_receiveMessage 와 같은 기준(SOH 0xFF + 길이 <= 0xF8)으로 프레임 시작을 찾고,
+ * 프레임이 끝나면 CRC를 직접 검사한다. SDK 내부를 바꾸지 않고 transport 계층에서 센다.
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] data 수신 바이트
+ * @param[in] len 수신 바이트 수
  */
-static RFID_RESULT ConfigureReadPlan_(IN_ TMR_Reader *reader
-                                      , IN_ const int *antennas
-                                      , IN_ const int antenna_count
-                                      , IN_ const int plan_timeout_ms
-                                      , OUT_ uint32_t *out_status
-                                      , OUT_ const char **out_errstr) {
-    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
-
-    if ((NULL == reader) || (NULL == antennas) || (antenna_count <= 0) || (antenna_count > (int) RFID_MAX_ANTENNAS))
-        return RFID_RESULT_INVALID_ARG;
+static void CounterRxBytes_(IN_ rfid_ctx_t *ctx, IN_ const uint8_t *data, IN_ const uint32_t len) {
+    rfid_counter_t *c = &ctx->counter;
+    uint64_t frames = 0;
+    uint64_t crc_errors = 0;
+    uint64_t resyncs = 0;
+    uint64_t discarded = 0;
+
+    for (uint32_t i = 0; i < len; ++i) {
+        const uint8_t b = data[i];
+        if (0U == c->rx_pos) {
+            if (RFID_FRAME_SOH != b) {
+                discarded++;
+                if (0 == c->rx_skipping) {
+                    c->rx_skipping = 1;
+                    resyncs++;
+                }
+                continue;
+            }
+            c->rx_pos = 1U;
+            c->rx_crc = 0xFFFFU;
+            c->rx_crc_on = (true == ctx->reader.u.serialReader.crcEnabled) ? 1 : 0;
+            continue;
+        }
 
-    uint8_t antenna_list_u8[RFID_MAX_ANTENNAS];
-    for (int i = 0; i < antenna_count; ++i) {
-        const int ant = antennas[i];
-        if (ant <= 0 || ant > 255)
-            return RFID_RESULT_INVALID_ARG;
+        if (1U == c->rx_pos) {
+            if (b > RFID_FRAME_MAX_LEN) {
+                // 앞의 0xFF 는 SOH가 아니었다. 이번 바이트가 0xFF 이면 새 SOH 후보로 본다.
+                discarded++;
+                if (0 == c->rx_skipping) {
+                    c->rx_skipping = 1;
+                    resyncs++;
+                }
+                if (RFID_FRAME_SOH != b) {
+                    discarded++;
+                    c->rx_pos = 0U;
+                }
+                continue;
+            }
+            c->rx_skipping = 0;
+            c->rx_need = (uint32_t) b + ((0 != c->rx_crc_on) ? RFID_FRAME_RX_OVERHEAD_CRC : RFID_FRAME_RX_OVERHEAD);
+        }
 
-        antenna_list_u8[i] = (uint8_t) ant;
+        if ((0 == c->rx_crc_on) || (c->rx_pos + 2U < c->rx_need))
+            c->rx_crc = CounterCrcByte_(c->rx_crc, b);
+        else if (c->rx_pos + 2U == c->rx_need)
+            c->rx_crc_hi = b;
+        c->rx_pos++;
+
+        if (c->rx_pos == c->rx_need) {
+            frames++;
+            if ((0 != c->rx_crc_on) && ((c->rx_crc_hi != (uint8_t) (c->rx_crc >> 8)) || (b != (uint8_t) (c->rx_crc & 0xFFU))))
+                crc_errors++;
+            c->rx_pos = 0U;
+        }
     }
 
-    const uint32_t readTime = (plan_timeout_ms > 0)
-                                  ? (uint32_t) plan_timeout_ms
-                                  : (uint32_t) RFID_DEFAULT_PLAN_READTIME;
-
-    TMR_ReadPlan plan;
-    memset(&plan, 0, sizeof(plan));
+    if (0U != frames)
+        __atomic_fetch_add(&c->rx_frames, frames, __ATOMIC_RELAXED);
+    if (0U != crc_errors)
+        __atomic_fetch_add(&c->crc_errors, crc_errors, __ATOMIC_RELAXED);
+    if (0U != resyncs)
+        __atomic_fetch_add(&c->soh_resyncs, resyncs, __ATOMIC_RELAXED);
+    if (0U != discarded)
+        __atomic_fetch_add(&c->discarded_bytes, discarded, __ATOMIC_RELAXED);
+}
 
-    const TMR_Status st1 = TMR_RP_init_simple(&plan
-                                              , (uint8_t) antenna_count
-                                              , antenna_list_u8
-                                              , TMR_TAG_PROTOCOL_GEN2
-                                              , readTime);
-    if (TMR_SUCCESS != st1) {
-        SetOutStatusAndErr_(out_status, out_errstr, st1);
-        return RFID_RESULT_PLAN_FAIL;
+/**
+ * @brief 송신 바이트/프레임을 세는 transport 송신 함수
+ */
+static TMR_Status LinkSend_(IN_ TMR_SR_SerialTransport *transport
+                            , IN_ uint32_t length
+                            , IN_ uint8_t *message
+                            , IN_ const uint32_t timeoutMs) {
+    rfid_ctx_t *ctx = LinkCtx_(transport);
+    rfid_link_t *link = &ctx->link;
+    const TMR_Status st = link->send(transport, length, message, timeoutMs);
+    if (TMR_SUCCESS != st)
+        return st;
+
+    __atomic_fetch_add(&link->tx_bytes, (uint64_t) length, __ATOMIC_RELAXED);
+    // 절전 해제용 0xFF 프리앰블은 프레임이 아니다(길이 바이트가 전체 길이와 맞지 않음).
+    if ((length >= RFID_FRAME_TX_OVERHEAD) && (RFID_FRAME_SOH == message[0])
+        && ((uint32_t) message[1] + RFID_FRAME_TX_OVERHEAD == length)) {
+        __atomic_fetch_add(&ctx->counter.tx_frames, 1U, __ATOMIC_RELAXED);
+        // 반이중 명령/응답이므로 새 명령을 보내면 받다 만 응답은 버려진 것이다.
+        ctx->counter.rx_pos = 0U;
+        // search 명령을 다 보낸 시각을 모듈 태그 시각의 기준으로 쓴다.
+        if ((RFID_FRAME_OP_READ_MULTIPLE == message[2]) || (RFID_FRAME_OP_MULTI_PROTOCOL == message[2])) {
+            ctx->trace.search_tx_us = LinkNowUs_();
+            ctx->trace.search_seq++;
+        }
     }
+    return st;
+}
 
-    const TMR_Status st2 = TMR_paramSet(reader, TMR_PARAM_READ_PLAN, &plan);
-    SetOutStatusAndErr_(out_status, out_errstr, st2);
+/**
+ * @brief 수신 바이트/프레임/오류를 세는 transport 수신 함수
+ */
+static TMR_Status LinkReceive_(IN_ TMR_SR_SerialTransport *transport
+                               , IN_ uint32_t length
+                               , OUT_ uint32_t *messageLength
+                               , OUT_ uint8_t *message
+                               , IN_ const uint32_t timeoutMs) {
+    rfid_ctx_t *ctx = LinkCtx_(transport);
+    rfid_link_t *link = &ctx->link;
+    const TMR_Status st = link->receive(transport, length, messageLength, message, timeoutMs);
+    if (NULL != messageLength)
+        __atomic_fetch_add(&link->rx_bytes, (uint64_t) *messageLength, __ATOMIC_RELAXED);
+
+    if ((TMR_SUCCESS == st) && (NULL != messageLength)) {
+        ctx->trace.rx_us = LinkNowUs_();
+        CounterRxBytes_(ctx, message, *messageLength);
+    }
+    else {
+        if (TMR_ERROR_TIMEOUT == st)
+            __atomic_fetch_add(&ctx->counter.timeouts, 1U, __ATOMIC_RELAXED);
+        ctx->counter.rx_pos = 0U;
+    }
+    return st;
+}
 
-    return (st2 == TMR_SUCCESS) ? RFID_RESULT_OK : RFID_RESULT_PLAN_FAIL;
+/**
+ * @brief 링크 설정을 초기화한다(연결 전).
+ * @param[in] link 링크 상태
+ * @param[in] params baud 협상 설정
+ */
+static void LinkInit_(IN_ rfid_link_t *link, IN_ const rfid_baud_params_t *params) {
+    memset(link, 0, sizeof(*link));
+    link->enabled = (0 != params->enable) ? 1 : 0;
+    link->max_rate = (params->max_rate > 0U) ? params->max_rate : RFID_LINK_DEFAULT_MAX_RATE;
+    link->probe_count = (params->probe_count > 0) ? (uint32_t) params->probe_count : RFID_LINK_DEFAULT_PROBE_COUNT;
+    link->fallback_errs = (params->fallback_errors > 0)
+                              ? (uint32_t) params->fallback_errors
+                              : RFID_LINK_DEFAULT_FALLBACK_ERRS;
 }
 
 /**
- * @brief 읽기 전력(dBm)이 양수인 경우 Reader에 설정한다.
- *
- * @param[in]  reader MercuryAPI Reader 핸들
- * @param[in]  read_power_cdbm 읽기 전력(cdBm), 0 이하이면 설정하지 않음
- * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
- * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ * @brief version 명령 왕복으로 현재 baud의 링크를 검증한다(응답 CRC는 SDK가 확인).
  *
- * @return RFID_RESULT_OK: 성공,
- *         RFID_RESULT_INTERNAL_ERROR: 설정 실패
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  rounds 왕복 횟수
+ * @param[out] out_rtt_us 왕복 평균 시간(us, NULL 허용)
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @return 모든 왕복 성공 시 TMR_SUCCESS, 아니면 첫 실패 상태
  */
-static RFID_RESULT ConfigureWritePower_(IN_ TMR_Reader *reader
-                                       , IN_ const int read_power_cdbm
-                                       , OUT_ uint32_t *out_status
-                                       , OUT_ const char **out_errstr) {
-    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
-    if (read_power_cdbm <= 0)
-        return RFID_RESULT_OK;
+static TMR_Status LinkVerify_(IN_ rfid_ctx_t *ctx, IN_ const uint32_t rounds, OUT_ double *out_rtt_us) {
+    TMR_SR_VersionInfo info;
+    const uint64_t t0 = LinkNowUs_();
+    for (uint32_t i = 0; i < rounds; ++i) {
+        const TMR_Status st = TMR_SR_cmdVersion(&ctx->reader, &info);
+        if (TMR_SUCCESS != st)
+            return st;
+    }
+    if ((NULL != out_rtt_us) && (rounds > 0U))
+        *out_rtt_us = (double) (LinkNowUs_() - t0) / (double) rounds;
+    return TMR_SUCCESS;
+}
 
-    const int32_t power_cdbm = (int32_t) read_power_cdbm;
-    const TMR_Status st = TMR_paramSet(reader, TMR_PARAM_RADIO_READPOWER, &power_cdbm);
+/**
+ * @brief 모듈과 호스트 transport의 baud를 함께 바꾸고 검증한다. 검증에 실패하면 이전 baud로 되돌린다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] rate 목표 baud
+ *
+ * @return 성공 시 TMR_SUCCESS.
+ *         실패 시 원인 상태를 반환하며, 이전 baud로 되돌리지 못했으면 TMR_ERROR_TIMEOUT 을 반환한다.
+ */
+static TMR_Status LinkSwitch_(IN_ rfid_ctx_t *ctx, IN_ const uint32_t rate) {
+    rfid_link_t *link = &ctx->link;
+    TMR_SR_SerialReader *sr = &ctx->reader.u.serialReader;
+    TMR_SR_SerialTransport *transport = &sr->transport;
+    const uint32_t prev = sr->baudRate;
+
+    // 모듈이 명령을 거부하면 이전 baud 그대로이다.
+    TMR_Status st = TMR_SR_cmdSetBaudRate(&ctx->reader, rate);
+    if (TMR_SUCCESS != st)
+        return st;
 
-    SetOutStatusAndErr_(out_status, out_errstr, st);
+    double rtt = 0.0;
+    st = transport->setBaudRate(transport, rate);
+    if (TMR_SUCCESS == st) {
+        sr->baudRate = rate;
+        st = LinkVerify_(ctx, link->probe_count, &rtt);
+    }
+    if (TMR_SUCCESS == st) {
+        link->probe_rtt_us = rtt;
+        return TMR_SUCCESS;
+    }
 
-    return (st == TMR_SUCCESS) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+    // 되돌리기: 모듈이 되돌림 명령을 못 받았을 수 있으므로 호스트를 목표 baud에 맞춰 한 번 더 시도한다.
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (0 != attempt)
+            (void) transport->setBaudRate(transport, rate);
+        (void) TMR_SR_cmdSetBaudRate(&ctx->reader, prev);
+        (void) transport->setBaudRate(transport, prev);
+        sr->baudRate = prev;
+        if (TMR_SUCCESS == LinkVerify_(ctx, 1U, &rtt)) {
+            link->probe_rtt_us = rtt;
+            return st;
+        }
+    }
+    return TMR_ERROR_TIMEOUT;
 }
 
 /**
- * @brief RFID Reader를 생성/연결하고 Region 및 Read Plan을 설정하여 컨텍스트를 초기화한다.
- * @param[out] out_ctx 초기화 완료 후 생성된 컨텍스트 포인터를 반환받을 출력 포인터
- * @param[in]  params 초기화 파라미터(사용 여부, URI, Region, 안테나 목록/개수, plan timeout, read power 등)
+ * @brief 연결 직후 링크를 준비한다. 시리얼 transport이면 바이트 계수를 시작하고,
+ *        baud 변경을 지원하는 transport에서 협상이 켜져 있으면 지원 baud를 한 단계씩 올리며
+ *        검증을 통과한 최고 baud에 머문다.
+ *
+ * @param[in] ctx RFID 컨텍스트
  * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
  * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
- * @return 성공 시 RFID_RESULT_OK, 비활성화 시 RFID_RESULT_DISABLED, 인자 오류 시 RFID_RESULT_INVALID_ARG,
- *         연결 실패 시 RFID_RESULT_CONNECT_FAIL, Region 설정 실패 시 RFID_RESULT_REGION_FAIL,
- *         Read plan 설정 실패 시 RFID_RESULT_PLAN_FAIL, 메모리/기타 내부 오류 시 RFID_RESULT_INTERNAL_ERROR
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @return RFID_RESULT_OK: 성공(협상 실패로 연결 baud에 머문 경우 포함),
+ *         RFID_RESULT_CONNECT_FAIL: 협상 중 링크를 잃음
  */
-RFID_RESULT rfid_init(OUT_ rfid_ctx_t **out_ctx
-                      , IN_ const rfid_init_params_t *params
-                      , OUT_ uint32_t *out_status
-                      , OUT_ const char **out_errstr) {
-    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
-
-    // ------------------------------
-    // 파라미터 유효성 검사
-    // ------------------------------
-    RFID_RESULT ret = ValidateInitParams_(out_ctx, params);
-    if (RFID_RESULT_OK != ret) {
-        SetOutStatusAndErr_(out_status, out_errstr, -1);
-        return ret;
-    }
+static RFID_RESULT LinkAttach_(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
+    rfid_link_t *link = &ctx->link;
+    TMR_SR_SerialTransport *transport = &ctx->reader.u.serialReader.transport;
 
-    *out_ctx = NULL;
+    if ((TMR_READER_TYPE_SERIAL != ctx->reader.readerType)
+        || (NULL == transport->sendBytes) || (NULL == transport->receiveBytes))
+        return RFID_RESULT_OK;
 
-    // ------------------------------
-    // 컨텍스트 할당 및 초기화
-    // ------------------------------
-    rfid_ctx_t *ctx = (rfid_ctx_t *) malloc(sizeof(*ctx));
-    if (NULL == ctx) {
-        SetOutStatusAndErr_(out_status, out_errstr, -1);
-        return RFID_RESULT_INTERNAL_ERROR;
+    // TCP 등 baud 개념이 없는 transport는 setBaudRate가 없다. 바이트 계수와 지연 추적 hook은 그대로 걸고
+    // baud 협상과 오류 시 강등만 끈다.
+    if (NULL == transport->setBaudRate)
+        link->enabled = 0;
+
+    link->tracked = 1;
+    link->send = transport->sendBytes;
+    link->receive = transport->receiveBytes;
+    transport->sendBytes = LinkSend_;
+    transport->receiveBytes = LinkReceive_;
+
+    link->connect_rate = ctx->reader.u.serialReader.baudRate;
+    link->verified_max = link->connect_rate;
+    if (0 == link->enabled) {
+        (void) LinkVerify_(ctx, 1U, &link->probe_rtt_us);
+        return RFID_RESULT_OK;
     }
 
-    memset(ctx, 0, sizeof(*ctx));
-    ctx->initialized = 0;
-    ctx->reader_created = 0;
-    ctx->region = params->region;
-    ctx->readPowerDbm = params->write_power_cdbm;
+    for (uint32_t i = 0; i < RFID_LINK_RATE_COUNT; ++i) {
+        const uint32_t rate = rfid_link_rates_[i];
+        if ((rate <= link->connect_rate) || (rate > link->max_rate))
+            continue;
 
-    // ------------------------------
-    // Reader 생성/연결 및 설정
-    // ------------------------------
-    ret = CreateReader_(ctx, params->uri, out_status, out_errstr);
-    if (RFID_RESULT_OK != ret) {
-        free(ctx);
-        return ret;
+        const TMR_Status st = LinkSwitch_(ctx, rate);
+        if (TMR_ERROR_TIMEOUT == st) {
+            SetOutStatusAndErr_(out_status, out_errstr, st);
+            return RFID_RESULT_CONNECT_FAIL;
+        }
+        // 한 단계가 실패하면 그보다 높은 baud도 불안정하다고 보고 멈춘다.
+        if (TMR_SUCCESS != st)
+            break;
+        link->verified_max = rate;
     }
+    return RFID_RESULT_OK;
+}
 
-    // Reader 연결
-    ret = ConnectReader_(ctx, out_status, out_errstr);
-    if (RFID_RESULT_OK != ret) {
-        DestroyReader_(ctx, NULL, NULL);
-        free(ctx);
-        return ret;
+/**
+ * @brief rfid_read() 한 번의 통신 결과를 반영한다. 연속 통신 오류가 기준에 도달하면 baud를 한 단계 낮춘다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] st rfid_read() 중 마지막 TMR 상태
+ * @param[in] tx0 rfid_read() 시작 시 누적 송신 바이트
+ * @param[in] rx0 rfid_read() 시작 시 누적 수신 바이트
+ * @param[in] t0_us rfid_read() 시작 시각(us)
+ */
+static void LinkEndCycle_(IN_ rfid_ctx_t *ctx
+                          , IN_ const TMR_Status st
+                          , IN_ const uint64_t tx0
+                          , IN_ const uint64_t rx0
+                          , IN_ const uint64_t t0_us) {
+    rfid_link_t *link = &ctx->link;
+    if (0 == link->tracked)
+        return;
+
+    const uint64_t elapsed_us = LinkNowUs_() - t0_us;
+    if (elapsed_us > 0U) {
+        const double bps = ((double) ((link->tx_bytes - tx0) + (link->rx_bytes - rx0)) * 1e6) / (double) elapsed_us;
+        link->bytes_per_sec = (link->bytes_per_sec > 0.0) ? (0.5 * link->bytes_per_sec + 0.5 * bps) : bps;
     }
 
-    // Region 설정
-    ret = ConfigureRegion_(&ctx->reader, params->region, out_status, out_errstr);
-    if (RFID_RESULT_OK != ret) {
-        DestroyReader_(ctx, NULL, NULL);
-        free(ctx);
-        return ret;
+    if (!TMR_ERROR_IS_COMM(st)) {
+        link->consecutive_errs = 0;
+        return;
     }
 
-    // Read Plan 설정
-    ret = ConfigureReadPlan_(&ctx->reader
-                             , params->antennas
-                             , params->antenna_count
-                             , params->plan_timeout_ms
-                             , out_status
-                             , out_errstr);
-    if (RFID_RESULT_OK != ret) {
-        DestroyReader_(ctx, NULL, NULL);
-        free(ctx);
-        return ret;
+    link->comm_errors++;
+    link->consecutive_errs++;
+    if ((0 == link->enabled) || (link->consecutive_errs < link->fallback_errs))
+        return;
+    link->consecutive_errs = 0;
+
+    const uint32_t cur = ctx->reader.u.serialReader.baudRate;
+    uint32_t lower = 0;
+    for (uint32_t i = 0; i < RFID_LINK_RATE_COUNT; ++i) {
+        if ((rfid_link_rates_[i] < cur) && (rfid_link_rates_[i] >= link->connect_rate))
+            lower = rfid_link_rates_[i];
     }
+    if (0U == lower)
+        return;
 
-    // 쓰기 전력 설정
-    ret = ConfigureWritePower_(&ctx->reader, params->write_power_cdbm, out_status, out_errstr);
-    if (RFID_RESULT_OK != ret) {
-        DestroyReader_(ctx, NULL, NULL);
-        free(ctx);
-        return ret;
+    if (TMR_SUCCESS == LinkSwitch_(ctx, lower)) {
+        link->verified_max = lower;
+        link->fallbacks++;
     }
+}
 
-    // ------------------------------
-    // 초기화 완료
-    // ------------------------------
-    ctx->initialized = 1;
-    *out_ctx = ctx;
-    return RFID_RESULT_OK;
+/**
+ * @brief 상태 카운터를 초기화한다.
+ * @param[in] counter 카운터
+ */
+static void CounterInit_(IN_ rfid_counter_t *counter) {
+    memset(counter, 0, sizeof(*counter));
+    counter->start_us = LinkNowUs_();
 }
 
 /**
- * @brief RFID 컨텍스트를 해제한다.
- *
- * @param[in,out] inout_ctx 해제할 컨텍스트 포인터 주소
- * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
- * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
- *
- * @return RFID_RESULT_OK: 성공,
- *         RFID_RESULT_INVALID_ARG: 잘못된 인자
- *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
+ * @brief 평활화된 rate 를 갱신한다(다른 스레드가 읽을 수 있으므로 atomic 저장).
  */
-RFID_RESULT rfid_deinit(INOUT_ rfid_ctx_t **inout_ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
-    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+static void CounterRate_(IN_ double *rate, IN_ const double sample) {
+    double cur;
+    __atomic_load(rate, &cur, __ATOMIC_RELAXED);
+    const double next = (cur > 0.0) ? ((1.0 - RFID_COUNTER_RATE_ALPHA) * cur + RFID_COUNTER_RATE_ALPHA * sample) : sample;
+    __atomic_store(rate, &next, __ATOMIC_RELAXED);
+}
 
-    if (NULL == inout_ctx) {
-        SetOutStatusAndErr_(out_status, out_errstr, -1);
-        return RFID_RESULT_INVALID_ARG;
+/**
+ * @brief rfid_read() 한 번의 결과를 카운터에 반영한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] st rfid_read() 중 마지막 TMR 상태
+ * @param[in] tags 반환 태그(실패 시 NULL)
+ * @param[in] count 반환 태그 수
+ * @param[in] depth 모듈 태그 버퍼에 쌓인 태그 수
+ * @param[in] overflow 결과 버퍼 초과로 버린 태그 수
+ * @param[in] t0_us rfid_read() 시작 시각(us)
+ */
+static void CounterEndCycle_(IN_ rfid_ctx_t *ctx
+                             , IN_ const TMR_Status st
+                             , IN_ const rfid_tag_t *tags
+                             , IN_ const int count
+                             , IN_ const uint32_t depth
+                             , IN_ const uint32_t overflow
+                             , IN_ const uint64_t t0_us) {
+    rfid_counter_t *c = &ctx->counter;
+    __atomic_fetch_add(&c->read_cycles, 1U, __ATOMIC_RELAXED);
+    if (TMR_SUCCESS != st) {
+        __atomic_fetch_add(&c->read_errors, 1U, __ATOMIC_RELAXED);
+        if ((TMR_ERROR_TAG_ID_BUFFER_FULL == st) || (TMR_ERROR_BUFFER_OVERFLOW == st))
+            __atomic_fetch_add(&c->buffer_overflows, 1U, __ATOMIC_RELAXED);
+        return;
     }
 
-    if (NULL == *inout_ctx) {
-        SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
-        return RFID_RESULT_OK;
+    if (0U != overflow)
+        __atomic_fetch_add(&c->overflow_tags, (uint64_t) overflow, __ATOMIC_RELAXED);
+    __atomic_store_n(&c->queue_depth, depth, __ATOMIC_RELAXED);
+    if (depth > __atomic_load_n(&c->queue_peak, __ATOMIC_RELAXED))
+        __atomic_store_n(&c->queue_peak, depth, __ATOMIC_RELAXED);
+
+    uint64_t reads[RFID_ANTENNA_MAX + 1];
+    uint64_t unique[RFID_ANTENNA_MAX + 1];
+    memset(reads, 0, sizeof(reads));
+    memset(unique, 0, sizeof(unique));
+    for (int i = 0; i < count; ++i) {
+        const int ant = ((tags[i].antenna > 0) && (tags[i].antenna <= RFID_ANTENNA_MAX)) ? tags[i].antenna : 0;
+        reads[ant] += tags[i].readcnt;
+        unique[ant]++;
     }
 
-    rfid_ctx_t *ctx = *inout_ctx;
-
-    if (ctx->initialized) {
-        const TMR_Status st = TMR_destroy(&ctx->reader);
-        SetOutStatusAndErr_(out_status, out_errstr, st);
+    const uint64_t elapsed_us = LinkNowUs_() - t0_us;
+    for (int a = 0; a <= RFID_ANTENNA_MAX; ++a) {
+        rfid_counter_antenna_t *ca = &c->ants[a];
+        // 한 번도 읽지 않은 안테나는 rate 도 만들지 않는다.
+        if ((0U == unique[a]) && (0U == __atomic_load_n(&ca->unique_tags, __ATOMIC_RELAXED)))
+            continue;
+        if (0U != unique[a]) {
+            __atomic_fetch_add(&ca->reads, reads[a], __ATOMIC_RELAXED);
+            __atomic_fetch_add(&ca->unique_tags, unique[a], __ATOMIC_RELAXED);
+        }
+        if (elapsed_us > 0U) {
+            CounterRate_(&ca->reads_per_sec, (double) reads[a] * 1e6 / (double) elapsed_us);
+            CounterRate_(&ca->unique_per_sec, (double) unique[a] * 1e6 / (double) elapsed_us);
+        }
     }
+}
 
-    free(ctx);
-    *inout_ctx = NULL;
-    return RFID_RESULT_OK;
+/**
+ * @brief EPC 바이트열의 64비트 FNV-1a 해시를 계산한다.
+ * @param epc EPC 바이트 배열
+ * @param len EPC 바이트 수
+ * @return 해시 값(0은 빈 슬롯 표시용으로 예약되어 1로 치환)
+ */
+static uint64_t HashEpc_(IN_ const uint8_t *epc, IN_ const uint32_t len) {
+    const uint64_t h = RfidFnv1a_(epc, len);
+    return (0U == h) ? 1U : h;
 }
 
 /**
- * @brief Write Power(centi-dBm)를 변경한다. (wrapper)
- *
- * - ConfigureWritePower_() 내부 구현을 직접 노출하지 않고, 인자 검증/전처리를 포함한 API를 제공한다.
- * - read_power_cdbm <= 0 이면 "기본값 사용"으로 간주하며, 장치 파라미터를 변경하지 않고 성공을 반환한다.
- * - ctx가 NULL이거나 초기화되지 않은 경우, RFID_RESULT_INVALID_ARG / RFID_RESULT_NOT_INITIALIZED 를 반환한다.
+ * @brief dwell 스케줄러를 초기화한다.
  *
- * @param[in]  ctx RFID 컨텍스트(in)
- * @param[in]  read_power_cdbm 읽기 전력(centi-dBm). 예: 3000 == 30.00 dBm
- * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
- * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ * @param[in] dwell 스케줄러 상태
+ * @param[in] params 사용자 설정(0 필드는 기본값)
  *
- * @return RFID_RESULT 결과 코드
+ * @return RFID_RESULT_OK: 성공(비활성 포함),
+ *         RFID_RESULT_INVALID_ARG: 범위 오류(min > max),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
  */
-RFID_RESULT rfid_set_write_power(IN_ rfid_ctx_t *ctx
-                               , IN_ const int read_power_cdbm
-                               , OUT_ uint32_t *out_status
-                               , OUT_ const char **out_errstr) {
-    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+static RFID_RESULT DwellInit_(IN_ rfid_dwell_t *dwell, IN_ const rfid_dwell_params_t *params) {
+    memset(dwell, 0, sizeof(*dwell));
+    if (0 == params->enable)
+        return RFID_RESULT_OK;
 
-    if (NULL == ctx) {
-        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
-        if (NULL != out_errstr) *out_errstr = "RFID_INVALID_ARG(ctx)";
+    const int update_cycles = (params->update_cycles > 0) ? params->update_cycles : RFID_DWELL_DEFAULT_UPDATE_CYCLES;
+    const int min_pct = (params->min_share_pct > 0) ? params->min_share_pct : RFID_DWELL_DEFAULT_MIN_SHARE_PCT;
+    const int max_pct = (params->max_share_pct > 0) ? params->max_share_pct : RFID_DWELL_DEFAULT_MAX_SHARE_PCT;
+    if ((min_pct > max_pct) || (max_pct > 100))
         return RFID_RESULT_INVALID_ARG;
-    }
 
-    if (!ctx->initialized) {
-        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
-        if (NULL != out_errstr) *out_errstr = "RFID_NOT_INITIALIZED";
-        return RFID_RESULT_NOT_INITIALIZED;
-    }
+    dwell->seen = (rfid_seen_slot_t *) calloc(RFID_DWELL_SEEN_SLOTS, sizeof(rfid_seen_slot_t));
+    if (NULL == dwell->seen)
+        return RFID_RESULT_INTERNAL_ERROR;
 
-    /* "기본값 사용" 요청: 장치 파라미터를 건드리지 않음 */
-    if (read_power_cdbm <= 0) {
-        ctx->readPowerDbm = 0;
-        return RFID_RESULT_OK;
+    dwell->enabled = 1;
+    dwell->update_cycles = (uint32_t) update_cycles;
+    dwell->min_permille = (uint32_t) min_pct * (RFID_DWELL_WEIGHT_SCALE / 100U);
+    dwell->max_permille = (uint32_t) max_pct * (RFID_DWELL_WEIGHT_SCALE / 100U);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief dwell 스케줄러 자원을 해제한다.
+ * @param dwell 스케줄러 상태
+ */
+static void DwellFree_(IN_ rfid_dwell_t *dwell) {
+    free(dwell->seen);
+    dwell->seen = NULL;
+    dwell->enabled = 0;
+}
+
+/**
+ * @brief 스케줄러의 안테나 목록을 read 요청 안테나 목록과 맞춘다.
+ *
+ * 기존 안테나의 가중치/통계는 유지하고, 새 안테나는 균등 점유율로 시작한다.
+ * 구성이 바뀌면 가중치 합을 RFID_DWELL_WEIGHT_SCALE 로 다시 맞춘다.
+ *
+ * @param dwell 스케줄러 상태
+ * @param antennas 안테나 번호 배열
+ * @param antenna_count 안테나 개수(1..RFID_MAX_ANTENNAS)
+ */
+static void DwellSyncAntennas_(IN_ rfid_dwell_t *dwell, IN_ const int *antennas, IN_ const int antenna_count) {
+    int same = (dwell->ant_count == antenna_count);
+    for (int i = 0; same && (i < antenna_count); ++i)
+        same = (dwell->ants[i].antenna == antennas[i]);
+    if (same)
+        return;
+
+    rfid_dwell_antenna_t next[RFID_MAX_ANTENNAS];
+    memset(next, 0, sizeof(next));
+
+    uint32_t total = 0;
+    for (int i = 0; i < antenna_count; ++i) {
+        next[i].antenna = antennas[i];
+        next[i].weight = RFID_DWELL_WEIGHT_SCALE / (uint32_t) antenna_count;
+        for (int k = 0; k < dwell->ant_count; ++k) {
+            if (dwell->ants[k].antenna == antennas[i]) {
+                next[i] = dwell->ants[k];
+                break;
+            }
+        }
+        if (0U == next[i].weight)
+            next[i].weight = 1U;
+        total += next[i].weight;
+    }
+
+    for (int i = 0; i < antenna_count; ++i) {
+        const uint32_t w = (uint32_t) (((uint64_t) next[i].weight * RFID_DWELL_WEIGHT_SCALE) / total);
+        next[i].weight = (0U == w) ? 1U : w;
+    }
+
+    memcpy(dwell->ants, next, sizeof(next));
+    dwell->ant_count = antenna_count;
+}
+
+/**
+ * @brief 태그 1건을 기록하고, 최근 구간에서 처음 본 태그면 해당 안테나의 신규 발견 수를 올린다.
+ *
+ * @param dwell 스케줄러 상태
+ * @param epc EPC 바이트 배열
+ * @param epc_len EPC 바이트 수
+ * @param antenna 태그를 읽은 안테나 번호
+ */
+static void DwellObserveTag_(IN_ rfid_dwell_t *dwell
+                             , IN_ const uint8_t *epc
+                             , IN_ const uint32_t epc_len
+                             , IN_ const int antenna) {
+    if ((0 == dwell->enabled) || (NULL == dwell->seen))
+        return;
+
+    const uint64_t h = HashEpc_(epc, epc_len);
+    const uint32_t forget = dwell->update_cycles * RFID_DWELL_FORGET_WINDOWS;
+    const uint32_t mask = RFID_DWELL_SEEN_SLOTS - 1U;
+
+    int is_new = 1;
+    rfid_seen_slot_t *victim = NULL;
+    for (uint32_t p = 0; p < RFID_DWELL_SEEN_PROBE; ++p) {
+        rfid_seen_slot_t *slot = &dwell->seen[(uint32_t) (h + p) & mask];
+        if (slot->hash == h) {
+            is_new = ((dwell->cycle - slot->last_cycle) > forget);
+            victim = slot;
+            break;
+        }
+        if (0U == slot->hash) {
+            victim = slot;
+            break;
+        }
+        if ((NULL == victim) || (slot->last_cycle < victim->last_cycle))
+            victim = slot;
+    }
+
+    victim->hash = h;
+    victim->last_cycle = dwell->cycle;
+
+    if (0 == is_new)
+        return;
+
+    for (int i = 0; i < dwell->ant_count; ++i) {
+        if (dwell->ants[i].antenna == antenna) {
+            dwell->ants[i].window_new++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 평가 구간의 신규 태그 발견율로 안테나별 가중치를 다시 계산한다.
+ *
+ * 발견율(EMA)에 비례해 점유율을 배분하되 [min, max] 범위로 제한하고,
+ * 제한에 걸린 안테나를 고정한 뒤 남은 몫을 나머지에 재분배(water-filling)한다.
+ *
+ * @param dwell 스케줄러 상태
+ */
+static void DwellReweight_(IN_ rfid_dwell_t *dwell) {
+    const int n = dwell->ant_count;
+    if (n <= 0)
+        return;
+
+    uint32_t min_p = dwell->min_permille;
+    uint32_t max_p = dwell->max_permille;
+    const uint32_t fair = (RFID_DWELL_WEIGHT_SCALE + (uint32_t) n - 1U) / (uint32_t) n;
+    if (min_p * (uint32_t) n > RFID_DWELL_WEIGHT_SCALE)
+        min_p = RFID_DWELL_WEIGHT_SCALE / (uint32_t) n;
+    if (max_p < fair)
+        max_p = fair;
+
+    double score[RFID_MAX_ANTENNAS];
+    double share[RFID_MAX_ANTENNAS];
+    int fixed[RFID_MAX_ANTENNAS];
+
+    for (int i = 0; i < n; ++i) {
+        rfid_dwell_antenna_t *a = &dwell->ants[i];
+        const double yield = (a->window_ms > 0U)
+                                 ? ((double) a->window_new * 1000.0) / (double) a->window_ms
+                                 : 0.0;
+        a->yield_ema = 0.5 * a->yield_ema + 0.5 * yield;
+        a->last_new = a->window_new;
+        a->last_ms = (uint32_t) a->window_ms;
+        a->window_new = 0;
+        a->window_ms = 0;
+
+        score[i] = a->yield_ema + RFID_DWELL_YIELD_FLOOR;
+        share[i] = 0.0;
+        fixed[i] = 0;
+    }
+
+    for (int iter = 0; iter < n; ++iter) {
+        double remaining = (double) RFID_DWELL_WEIGHT_SCALE;
+        double free_score = 0.0;
+        for (int i = 0; i < n; ++i) {
+            if (fixed[i])
+                remaining -= share[i];
+            else
+                free_score += score[i];
+        }
+        if (free_score <= 0.0)
+            break;
+
+        int changed = 0;
+        for (int i = 0; i < n; ++i) {
+            if (fixed[i])
+                continue;
+            const double s = remaining * score[i] / free_score;
+            if (s < (double) min_p) {
+                share[i] = (double) min_p;
+                fixed[i] = 1;
+                changed = 1;
+            }
+            else if (s > (double) max_p) {
+                share[i] = (double) max_p;
+                fixed[i] = 1;
+                changed = 1;
+            }
+            else {
+                share[i] = s;
+            }
+        }
+        if (0 == changed)
+            break;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        const uint32_t w = (uint32_t) (share[i] + 0.5);
+        dwell->ants[i].weight = (0U == w) ? 1U : w;
+    }
+}
+
+/**
+ * @brief read 1회가 끝났음을 기록하고, 주기가 되면 가중치를 다시 계산한다.
+ *
+ * @param dwell 스케줄러 상태
+ * @param read_ms 이번 read에 사용한 전체 시간(ms)
+ */
+static void DwellEndCycle_(IN_ rfid_dwell_t *dwell, IN_ const uint32_t read_ms) {
+    if ((0 == dwell->enabled) || (dwell->ant_count <= 0))
+        return;
+
+    uint32_t total = 0;
+    for (int i = 0; i < dwell->ant_count; ++i)
+        total += dwell->ants[i].weight;
+    if (0U == total)
+        total = 1U;
+
+    for (int i = 0; i < dwell->ant_count; ++i)
+        dwell->ants[i].window_ms += ((uint64_t) read_ms * dwell->ants[i].weight) / total;
+
+    dwell->cycle++;
+    if (0U == (dwell->cycle % dwell->update_cycles))
+        DwellReweight_(dwell);
+}
+
+/**
+ * @brief 다른 구역 태그 항목 정렬용 비교 함수(hash 오름차순)
+ */
+static int CompareForeign_(IN_ const void *a, IN_ const void *b) {
+    const uint64_t ha = ((const rfid_foreign_entry_t *) a)->hash;
+    const uint64_t hb = ((const rfid_foreign_entry_t *) b)->hash;
+    return (ha < hb) ? -1 : ((ha > hb) ? 1 : 0);
+}
+
+/**
+ * @brief 값을 [lo, hi] 범위로 제한한다.
+ */
+static int ClampInt_(IN_ const int v, IN_ const int lo, IN_ const int hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+/**
+ * @brief 안테나별 read power 제어기를 초기화한다.
+ *
+ * @param[in] pw 제어기 상태
+ * @param[in] params 초기화 파라미터(안테나 목록, 안테나별/공통 전력, 제어 설정)
+ *
+ * @return RFID_RESULT_OK: 성공(비활성 포함),
+ *         RFID_RESULT_INVALID_ARG: 범위 오류/잘못된 EPC,
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+static RFID_RESULT PowerInit_(IN_ rfid_power_t *pw, IN_ const rfid_init_params_t *params) {
+    const rfid_power_ctrl_params_t *pc = &params->power_ctrl;
+
+    memset(pw, 0, sizeof(*pw));
+    if ((NULL == params->antenna_power_cdbm) && (RFID_POWER_CTRL_OFF == pc->mode))
+        return RFID_RESULT_OK;
+
+    if ((pc->mode < RFID_POWER_CTRL_OFF) || (pc->mode > RFID_POWER_CTRL_RSSI_BAND))
+        return RFID_RESULT_INVALID_ARG;
+
+    pw->mode = pc->mode;
+    pw->min_cdbm = (pc->min_cdbm > 0) ? pc->min_cdbm : RFID_POWER_DEFAULT_MIN_CDBM;
+    pw->max_cdbm = (pc->max_cdbm > 0) ? pc->max_cdbm : RFID_POWER_DEFAULT_MAX_CDBM;
+    pw->step_cdbm = (pc->step_cdbm > 0) ? pc->step_cdbm : RFID_POWER_DEFAULT_STEP_CDBM;
+    pw->update_cycles = (pc->update_cycles > 0) ? (uint32_t) pc->update_cycles : RFID_POWER_DEFAULT_UPDATE_CYCLES;
+    pw->deadband_pct = (pc->deadband_pct > 0) ? (uint32_t) pc->deadband_pct : RFID_POWER_DEFAULT_DEADBAND_PCT;
+    pw->target_rate = pc->target_reads_per_sec;
+    pw->rssi_low = pc->rssi_low_dbm;
+    pw->rssi_high = pc->rssi_high_dbm;
+
+    if (pw->min_cdbm > pw->max_cdbm)
+        return RFID_RESULT_INVALID_ARG;
+    if ((RFID_POWER_CTRL_READ_RATE == pw->mode) && (pw->target_rate <= 0))
+        return RFID_RESULT_INVALID_ARG;
+    if ((RFID_POWER_CTRL_RSSI_BAND == pw->mode) && (pw->rssi_low >= pw->rssi_high))
+        return RFID_RESULT_INVALID_ARG;
+    if ((pc->foreign_count < 0) || ((pc->foreign_count > 0) && (NULL == pc->foreign_tags)))
+        return RFID_RESULT_INVALID_ARG;
+
+    // 자동 제어 시 시작 전력: 공통 전력이 있으면 그 값, 없으면 범위 중앙
+    if (RFID_POWER_CTRL_OFF != pw->mode) {
+        pw->default_cdbm = (params->write_power_cdbm > 0)
+                               ? ClampInt_(params->write_power_cdbm, pw->min_cdbm, pw->max_cdbm)
+                               : (pw->min_cdbm + pw->max_cdbm) / 2;
+    }
+
+    for (int i = 0; i < params->antenna_count; ++i) {
+        rfid_power_antenna_t *a = &pw->ants[i];
+        a->antenna = params->antennas[i];
+        a->power_cdbm = pw->default_cdbm;
+        if ((NULL != params->antenna_power_cdbm) && (params->antenna_power_cdbm[i] > 0)) {
+            a->power_cdbm = params->antenna_power_cdbm[i];
+            if (RFID_POWER_CTRL_OFF != pw->mode)
+                a->power_cdbm = ClampInt_(a->power_cdbm, pw->min_cdbm, pw->max_cdbm);
+        }
+        a->step_cdbm = pw->step_cdbm;
+    }
+    pw->ant_count = params->antenna_count;
+
+    if (pc->foreign_count > 0) {
+        pw->foreign = (rfid_foreign_entry_t *) calloc((size_t) pc->foreign_count, sizeof(rfid_foreign_entry_t));
+        if (NULL == pw->foreign)
+            return RFID_RESULT_INTERNAL_ERROR;
+
+        for (int i = 0; i < pc->foreign_count; ++i) {
+            uint8_t epc[TMR_MAX_EPC_BYTE_COUNT];
+            uint32_t epc_len = 0;
+            if ((0 != IsNullOrEmpty_(pc->foreign_tags[i].epc))
+                || (TMR_SUCCESS != TMR_hexToBytes(pc->foreign_tags[i].epc, epc, sizeof(epc), &epc_len))) {
+                free(pw->foreign);
+                pw->foreign = NULL;
+                return RFID_RESULT_INVALID_ARG;
+            }
+            pw->foreign[i].hash = HashEpc_(epc, epc_len);
+            pw->foreign[i].home_antenna = pc->foreign_tags[i].home_antenna;
+        }
+        pw->foreign_count = pc->foreign_count;
+        qsort(pw->foreign, (size_t) pw->foreign_count, sizeof(rfid_foreign_entry_t), CompareForeign_);
+    }
+
+    pw->enabled = 1;
+    pw->dirty = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief read power 제어기 자원을 해제한다.
+ * @param pw 제어기 상태
+ */
+static void PowerFree_(IN_ rfid_power_t *pw) {
+    free(pw->foreign);
+    pw->foreign = NULL;
+    pw->foreign_count = 0;
+    pw->enabled = 0;
+}
+
+/**
+ * @brief 안테나 상태를 찾고, 없으면 시작 전력으로 추가한다.
+ * @param pw 제어기 상태
+ * @param antenna 안테나 번호
+ * @return 안테나 상태, 더 추가할 공간이 없으면 NULL
+ */
+static rfid_power_antenna_t* PowerAntenna_(IN_ rfid_power_t *pw, IN_ const int antenna) {
+    for (int i = 0; i < pw->ant_count; ++i) {
+        if (pw->ants[i].antenna == antenna)
+            return &pw->ants[i];
+    }
+    if (pw->ant_count >= (int) RFID_MAX_ANTENNAS)
+        return NULL;
+
+    rfid_power_antenna_t *a = &pw->ants[pw->ant_count++];
+    memset(a, 0, sizeof(*a));
+    a->antenna = antenna;
+    a->power_cdbm = pw->default_cdbm;
+    a->step_cdbm = pw->step_cdbm;
+    if (a->power_cdbm > 0)
+        pw->dirty = 1;
+    return a;
+}
+
+/**
+ * @brief 안테나별 전력 목록을 Reader에 적용한다(TMR_PARAM_RADIO_PORTREADPOWERLIST).
+ *
+ * @param[in] reader MercuryAPI Reader 핸들
+ * @param[in] pw 제어기 상태(power_cdbm > 0 인 안테나만 적용)
+ * @return TMR 상태 코드
+ */
+static TMR_Status PowerApply_(IN_ TMR_Reader *reader, IN_ rfid_power_t *pw) {
+    TMR_PortValue values[RFID_MAX_ANTENNAS];
+    TMR_PortValueList list;
+    list.list = values;
+    list.max = (uint8_t) RFID_MAX_ANTENNAS;
+    list.len = 0;
+
+    for (int i = 0; i < pw->ant_count; ++i) {
+        if (pw->ants[i].power_cdbm <= 0)
+            continue;
+        values[list.len].port = (uint8_t) pw->ants[i].antenna;
+        values[list.len].value = (int32_t) pw->ants[i].power_cdbm;
+        list.len++;
+    }
+
+    TMR_Status st = TMR_SUCCESS;
+    if (list.len > 0)
+        st = TMR_paramSet(reader, TMR_PARAM_RADIO_PORTREADPOWERLIST, &list);
+
+    pw->last_apply_status = (uint32_t) st;
+    if (TMR_SUCCESS == st)
+        pw->dirty = 0;
+    return st;
+}
+
+/**
+ * @brief 태그 1건을 안테나별 read rate/RSSI/다른 구역 read 통계에 반영한다.
+ *
+ * @param pw 제어기 상태
+ * @param epc EPC 바이트 배열
+ * @param epc_len EPC 바이트 수
+ * @param antenna 태그를 읽은 안테나 번호
+ * @param rssi RSSI(dBm)
+ * @param read_count 이번 read에서의 ReadCount
+ */
+static void PowerObserveTag_(IN_ rfid_power_t *pw
+                             , IN_ const uint8_t *epc
+                             , IN_ const uint32_t epc_len
+                             , IN_ const int antenna
+                             , IN_ const int rssi
+                             , IN_ const uint32_t read_count) {
+    if ((0 == pw->enabled) || (RFID_POWER_CTRL_OFF == pw->mode))
+        return;
+
+    rfid_power_antenna_t *a = NULL;
+    for (int i = 0; i < pw->ant_count; ++i) {
+        if (pw->ants[i].antenna == antenna) {
+            a = &pw->ants[i];
+            break;
+        }
+    }
+    if (NULL == a)
+        return;
+
+    a->window_reads += (read_count > 0U) ? read_count : 1U;
+    a->window_rssi_sum += rssi;
+    a->window_rssi_n++;
+
+    if (pw->foreign_count <= 0)
+        return;
+
+    rfid_foreign_entry_t key;
+    key.hash = HashEpc_(epc, epc_len);
+    key.home_antenna = 0;
+    const rfid_foreign_entry_t *hit = (const rfid_foreign_entry_t *) bsearch(&key
+                                                                             , pw->foreign
+                                                                             , (size_t) pw->foreign_count
+                                                                             , sizeof(rfid_foreign_entry_t)
+                                                                             , CompareForeign_);
+    if ((NULL != hit) && (hit->home_antenna != antenna)) {
+        a->window_foreign++;
+        a->foreign_total++;
+    }
+}
+
+/**
+ * @brief 평가 구간 측정값으로 안테나 1개의 전력을 조정한다.
+ *
+ * - 다른 구역 태그가 읽혔으면 최대 조정 폭으로 낮추고 일정 구간 증가를 막는다.
+ * - 그 외에는 READ_RATE/RSSI_BAND 목표와 비교해 한 단계 올리거나 내린다(불감대 내이면 유지).
+ * - 조정 방향이 뒤집히면 조정 폭을 절반으로 줄이고, 같은 방향이 이어지면 다시 키운다(진동 억제).
+ *
+ * @param pw 제어기 상태
+ * @param a 안테나 상태
+ */
+static void PowerAdjust_(IN_ rfid_power_t *pw, IN_ rfid_power_antenna_t *a) {
+    const double rate = ((double) a->window_reads * 1000.0) / (double) a->window_ms;
+    const int has_rssi = (a->window_rssi_n > 0U);
+    const double rssi = has_rssi ? (double) a->window_rssi_sum / (double) a->window_rssi_n : a->rssi_ema;
+
+    if (0 == a->measured) {
+        a->rate_ema = rate;
+        a->rssi_ema = rssi;
+        a->measured = has_rssi;
+    }
+    else {
+        a->rate_ema = 0.5 * a->rate_ema + 0.5 * rate;
+        if (has_rssi)
+            a->rssi_ema = 0.5 * a->rssi_ema + 0.5 * rssi;
+    }
+
+    int dir = 0;
+    int step = a->step_cdbm;
+    if (a->window_foreign > 0U) {
+        dir = -1;
+        step = pw->step_cdbm;
+        a->hold_up = RFID_POWER_FOREIGN_HOLD_WINDOWS;
+    }
+    else {
+        if (RFID_POWER_CTRL_READ_RATE == pw->mode) {
+            const double band = (double) pw->target_rate * (double) pw->deadband_pct / 100.0;
+            if (a->rate_ema < (double) pw->target_rate - band)
+                dir = 1;
+            else if (a->rate_ema > (double) pw->target_rate + band)
+                dir = -1;
+        }
+        else if ((RFID_POWER_CTRL_RSSI_BAND == pw->mode) && has_rssi) {
+            // 태그가 없으면 RSSI를 판단할 수 없으므로 유지한다.
+            if (a->rssi_ema < (double) pw->rssi_low)
+                dir = 1;
+            else if (a->rssi_ema > (double) pw->rssi_high)
+                dir = -1;
+        }
+
+        if ((dir > 0) && (a->hold_up > 0U))
+            dir = 0;
+        if (a->hold_up > 0U)
+            a->hold_up--;
+
+        if (0 != dir) {
+            const int last_dir = (a->last_step_cdbm > 0) ? 1 : ((a->last_step_cdbm < 0) ? -1 : 0);
+            if ((0 != last_dir) && (dir != last_dir))
+                step = (step / 2 < RFID_POWER_MIN_STEP_CDBM) ? RFID_POWER_MIN_STEP_CDBM : step / 2;
+            else if (dir == last_dir)
+                step = (step * 2 > pw->step_cdbm) ? pw->step_cdbm : step * 2;
+        }
+    }
+
+    a->window_reads = 0;
+    a->window_ms = 0;
+    a->window_rssi_sum = 0;
+    a->window_rssi_n = 0;
+    a->window_foreign = 0;
+
+    if (0 == dir)
+        return;
+
+    a->step_cdbm = step;
+    const int next = ClampInt_(a->power_cdbm + dir * step, pw->min_cdbm, pw->max_cdbm);
+    if (next == a->power_cdbm)
+        return;
+
+    a->last_step_cdbm = next - a->power_cdbm;
+    a->power_cdbm = next;
+    a->adjustments++;
+    pw->dirty = 1;
+}
+
+/**
+ * @brief read 1회의 안테나별 dwell 시간을 누적하고, 주기가 되면 전력을 조정한다.
+ *
+ * @param ctx RFID 컨텍스트
+ * @param antennas 이번 read에 사용한 안테나 목록
+ * @param antenna_count 안테나 개수
+ * @param read_ms 이번 read 시간(ms)
+ */
+static void PowerEndCycle_(IN_ rfid_ctx_t *ctx
+                           , IN_ const int *antennas
+                           , IN_ const int antenna_count
+                           , IN_ const uint32_t read_ms) {
+    rfid_power_t *pw = &ctx->power;
+    if ((0 == pw->enabled) || (RFID_POWER_CTRL_OFF == pw->mode))
+        return;
+
+    // dwell 스케줄러가 multi plan을 쓰면 안테나별 점유율대로, 아니면 균등하게 나눈다.
+    const int weighted = (0 != ctx->dwell.enabled) && (ctx->dwell.ant_count == antenna_count) && (antenna_count > 1);
+    uint32_t total = 0;
+    for (int i = 0; weighted && (i < antenna_count); ++i)
+        total += ctx->dwell.ants[i].weight;
+    if (0U == total)
+        total = 1U;
+
+    for (int i = 0; i < antenna_count; ++i) {
+        rfid_power_antenna_t *a = PowerAntenna_(pw, antennas[i]);
+        if (NULL == a)
+            continue;
+        a->window_ms += weighted
+                            ? ((uint64_t) read_ms * ctx->dwell.ants[i].weight) / total
+                            : (uint64_t) read_ms / (uint64_t) antenna_count;
+    }
+
+    pw->cycle++;
+    if (0U != (pw->cycle % pw->update_cycles))
+        return;
+
+    for (int i = 0; i < pw->ant_count; ++i) {
+        if (pw->ants[i].window_ms > 0U)
+            PowerAdjust_(pw, &pw->ants[i]);
+    }
+}
+
+/**
+ * @brief Gen2 설정 값의 범위를 검사한다.
+ * @param s 검사할 설정
+ * @return 유효하면 1, 아니면 0
+ */
+static int Gen2SettingsValid_(IN_ const rfid_gen2_settings_t *s) {
+    if ((s->q < -1) || (s->q > RFID_GEN2_Q_MAX))
+        return 0;
+    if ((s->session < 0) || (s->session > 3))
+        return 0;
+    if ((s->target < RFID_GEN2_TARGET_A) || (s->target > RFID_GEN2_TARGET_BA))
+        return 0;
+    if ((s->link < RFID_GEN2_LINK_KEEP) || (s->link > RFID_GEN2_LINK_DENSE))
+        return 0;
+    return 1;
+}
+
+/**
+ * @brief RFID_GEN2_TARGET 값을 MercuryAPI의 TMR_GEN2_Target 값으로 매핑한다.
+ * @param target 변환할 target
+ * @return 대응하는 TMR_GEN2_Target 값
+ */
+static TMR_GEN2_Target MapGen2Target_(IN_ const RFID_GEN2_TARGET target) {
+    switch (target) {
+        case RFID_GEN2_TARGET_B:
+            return TMR_GEN2_TARGET_B;
+        case RFID_GEN2_TARGET_AB:
+            return TMR_GEN2_TARGET_AB;
+        case RFID_GEN2_TARGET_BA:
+            return TMR_GEN2_TARGET_BA;
+        case RFID_GEN2_TARGET_A:
+        default:
+            return TMR_GEN2_TARGET_A;
+    }
+}
+
+/**
+ * @brief Gen2 설정을 Reader에 적용한다. prev가 주어지면 바뀐 항목만 설정한다.
+ *
+ * @param[in] reader MercuryAPI Reader 핸들
+ * @param[in] next 적용할 설정
+ * @param[in] prev 현재 적용된 설정(NULL이면 전체 적용)
+ *
+ * @return 첫 번째 실패한 TMR 상태 코드, 모두 성공하면 TMR_SUCCESS
+ */
+static TMR_Status Gen2Apply_(IN_ TMR_Reader *reader
+                             , IN_ const rfid_gen2_settings_t *next
+                             , IN_ const rfid_gen2_settings_t *prev) {
+    TMR_Status st = TMR_SUCCESS;
+
+    if ((NULL == prev) || (prev->link != next->link)) {
+        TMR_GEN2_LinkFrequency blf = TMR_GEN2_LINKFREQUENCY_250KHZ;
+        TMR_GEN2_Tari tari = TMR_GEN2_TARI_25US;
+        TMR_GEN2_TagEncoding enc = TMR_GEN2_MILLER_M_4;
+
+        switch (next->link) {
+            case RFID_GEN2_LINK_HIGH_SPEED:
+                blf = TMR_GEN2_LINKFREQUENCY_640KHZ;
+                tari = TMR_GEN2_TARI_6_25US;
+                enc = TMR_GEN2_FM0;
+                break;
+            case RFID_GEN2_LINK_DENSE:
+                enc = TMR_GEN2_MILLER_M_8;
+                break;
+            case RFID_GEN2_LINK_BALANCED:
+            case RFID_GEN2_LINK_KEEP:
+            default:
+                break;
+        }
+
+        if (RFID_GEN2_LINK_KEEP != next->link) {
+            st = TMR_paramSet(reader, TMR_PARAM_GEN2_BLF, &blf);
+            if (TMR_SUCCESS == st)
+                st = TMR_paramSet(reader, TMR_PARAM_GEN2_TARI, &tari);
+            if (TMR_SUCCESS == st)
+                st = TMR_paramSet(reader, TMR_PARAM_GEN2_TAGENCODING, &enc);
+            if (TMR_SUCCESS != st)
+                return st;
+        }
+    }
+
+    if ((NULL == prev) || (prev->session != next->session)) {
+        TMR_GEN2_Session session = (TMR_GEN2_Session) next->session;
+        st = TMR_paramSet(reader, TMR_PARAM_GEN2_SESSION, &session);
+        if (TMR_SUCCESS != st)
+            return st;
+    }
+
+    if ((NULL == prev) || (prev->target != next->target)) {
+        TMR_GEN2_Target target = MapGen2Target_(next->target);
+        st = TMR_paramSet(reader, TMR_PARAM_GEN2_TARGET, &target);
+        if (TMR_SUCCESS != st)
+            return st;
+    }
+
+    if ((NULL == prev) || (prev->q != next->q)) {
+        TMR_GEN2_Q q;
+        memset(&q, 0, sizeof(q));
+        if (next->q < 0) {
+            q.type = TMR_SR_GEN2_Q_DYNAMIC;
+        }
+        else {
+            q.type = TMR_SR_GEN2_Q_STATIC;
+            q.u.staticQ.initialQ = (uint8_t) next->q;
+        }
+        st = TMR_paramSet(reader, TMR_PARAM_GEN2_Q, &q);
+    }
+
+    return st;
+}
+
+/**
+ * @brief 설정을 적용하고 튜너 상태(current/applied/last_apply_status)를 갱신한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] next 적용할 설정
+ * @return TMR 상태 코드
+ */
+static TMR_Status Gen2Commit_(IN_ rfid_ctx_t *ctx, IN_ const rfid_gen2_settings_t *next) {
+    rfid_gen2_tuner_t *t = &ctx->gen2;
+    const TMR_Status st = Gen2Apply_(&ctx->reader, next, (0 != t->applied) ? &t->current : NULL);
+
+    t->last_apply_status = (uint32_t) st;
+    if (TMR_SUCCESS == st) {
+        t->current = *next;
+        t->applied = 1;
+    }
+    else {
+        // 일부만 적용되었을 수 있으므로 다음에는 전체를 다시 적용한다.
+        t->applied = 0;
+    }
+    return st;
+}
+
+/**
+ * @brief 모집단 추정치에 대한 기준 Q(ceil(log2 N))를 계산한다.
+ * @param population 추정 모집단
+ * @return 0..RFID_GEN2_Q_MAX
+ */
+static int Gen2BaseQ_(IN_ const double population) {
+    int q = 0;
+    while ((q < RFID_GEN2_Q_MAX) && ((double) (1U << q) < population))
+        ++q;
+    return q;
+}
+
+/**
+ * @brief 추정 모집단과 Q별 처리량 기록으로 다음 설정을 고른다.
+ *
+ * - session/target/링크는 모집단 구간으로 결정하되, 추정치가 히스테리시스 이상 바뀐 경우에만 바꾼다.
+ *   (소: S0/A/high-speed, 중: S1/A/balanced, 대: S2/AB(A/B flipping)/balanced 또는 dense)
+ * - Q는 ceil(log2 N)와 그 ±1 중 아직 측정하지 않은 값을 한 번씩 시험한 뒤 처리량이 가장 좋은 값을 쓴다.
+ *   모집단이 매우 크면 dynamic Q를 쓴다.
+ *
+ * @param[in]  t 튜너 상태
+ * @param[out] out 선택된 설정
+ * @return 구간(session/target/링크)이 바뀌었으면 1, 아니면 0
+ */
+static int Gen2Choose_(IN_ const rfid_gen2_tuner_t *t, OUT_ rfid_gen2_settings_t *out) {
+    const double pop = t->population;
+    *out = t->current;
+
+    const double ref = (t->band_population > 1.0) ? t->band_population : 1.0;
+    const double delta = (pop > ref) ? (pop - ref) / ref : (ref - pop) / ref;
+    const int band_changed = (0 == t->applied) || (delta > RFID_GEN2_BAND_HYSTERESIS);
+
+    if (0 != band_changed) {
+        if (pop <= RFID_GEN2_SMALL_POPULATION) {
+            out->session = 0;
+            out->target = RFID_GEN2_TARGET_A;
+            out->link = RFID_GEN2_LINK_HIGH_SPEED;
+        }
+        else if (pop <= RFID_GEN2_MEDIUM_POPULATION) {
+            out->session = 1;
+            out->target = RFID_GEN2_TARGET_A;
+            out->link = RFID_GEN2_LINK_BALANCED;
+        }
+        else {
+            out->session = 2;
+            out->target = RFID_GEN2_TARGET_AB;
+            out->link = (pop > RFID_GEN2_DENSE_POPULATION) ? RFID_GEN2_LINK_DENSE : RFID_GEN2_LINK_BALANCED;
+        }
+    }
+
+    if (pop >= RFID_GEN2_DYNAMIC_Q_POPULATION) {
+        out->q = -1;
+        return band_changed;
+    }
+
+    const int base = Gen2BaseQ_(pop);
+    const int lo = (base > 0) ? base - 1 : 0;
+    const int hi = (base < RFID_GEN2_Q_MAX) ? base + 1 : RFID_GEN2_Q_MAX;
+
+    // 미측정 후보 우선(기준 Q부터)
+    if (0 == t->q_seen[base]) {
+        out->q = base;
+        return band_changed;
+    }
+    for (int q = lo; q <= hi; ++q) {
+        if (0 == t->q_seen[q]) {
+            out->q = q;
+            return band_changed;
+        }
+    }
+
+    int best = base;
+    for (int q = lo; q <= hi; ++q) {
+        if (t->q_rate[q] > t->q_rate[best])
+            best = q;
+    }
+    out->q = best;
+    return band_changed;
+}
+
+/**
+ * @brief Gen2 튜너 상태를 설정 값으로 (재)초기화한다. 모듈에는 적용하지 않는다.
+ *
+ * @param[in] t 튜너 상태
+ * @param[in] params 사용자 설정(0 필드는 기본값)
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: 범위 오류
+ */
+static RFID_RESULT Gen2Reset_(IN_ rfid_gen2_tuner_t *t, IN_ const rfid_gen2_tune_params_t *params) {
+    if ((params->mode < RFID_GEN2_TUNE_OFF) || (params->mode > RFID_GEN2_TUNE_MANUAL))
+        return RFID_RESULT_INVALID_ARG;
+    if ((RFID_GEN2_TUNE_MANUAL == params->mode) && (0 == Gen2SettingsValid_(&params->manual)))
+        return RFID_RESULT_INVALID_ARG;
+
+    const rfid_gen2_settings_t current = t->current;
+    const int applied = t->applied;
+
+    memset(t, 0, sizeof(*t));
+    t->mode = params->mode;
+    t->eval_cycles = (params->eval_cycles > 0) ? (uint32_t) params->eval_cycles : RFID_GEN2_DEFAULT_EVAL_CYCLES;
+    t->current = current;
+    t->applied = applied;
+    if (RFID_GEN2_TUNE_MANUAL == params->mode) {
+        // init 시점(applied==0)에는 ConfigureGen2_()가 current 값을 적용한다.
+        if (0 == applied)
+            t->current = params->manual;
+    }
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief read 1회의 결과를 반영하고, 평가 주기가 되면 AUTO 모드에서 설정을 다시 고른다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] tag_count 이번 read에서 받은 태그 수(중복 제거 후)
+ * @param[in] read_ms 이번 read 시간(ms)
+ *
+ * @note 적용 실패는 read 결과에 영향을 주지 않으며 last_apply_status 로만 노출한다.
+ */
+static void Gen2EndCycle_(IN_ rfid_ctx_t *ctx, IN_ const uint32_t tag_count, IN_ const uint32_t read_ms) {
+    rfid_gen2_tuner_t *t = &ctx->gen2;
+    if (RFID_GEN2_TUNE_AUTO != t->mode)
+        return;
+
+    if (tag_count > t->window_max_tags)
+        t->window_max_tags = tag_count;
+    t->window_tags += tag_count;
+    t->window_ms += read_ms;
+    t->cycle++;
+
+    if (0U != (t->cycle % t->eval_cycles))
+        return;
+
+    const double observed = (double) t->window_max_tags;
+    t->population = (t->population <= 0.0) ? observed : (0.5 * t->population + 0.5 * observed);
+    t->tags_per_sec = (t->window_ms > 0U) ? ((double) t->window_tags * 1000.0) / (double) t->window_ms : 0.0;
+
+    if ((0 != t->applied) && (t->current.q >= 0)) {
+        const int q = t->current.q;
+        t->q_rate[q] = (0 != t->q_seen[q]) ? (0.5 * t->q_rate[q] + 0.5 * t->tags_per_sec) : t->tags_per_sec;
+        t->q_seen[q] = 1;
+    }
+
+    t->window_max_tags = 0;
+    t->window_tags = 0;
+    t->window_ms = 0;
+
+    rfid_gen2_settings_t next;
+    const int band_changed = Gen2Choose_(t, &next);
+    if (0 != band_changed) {
+        // 구간이 바뀌면 이전 Q 처리량 기록은 더 이상 유효하지 않다.
+        memset(t->q_rate, 0, sizeof(t->q_rate));
+        memset(t->q_seen, 0, sizeof(t->q_seen));
+        t->band_population = t->population;
+    }
+
+    if ((0 != t->applied) && (0 == memcmp(&next, &t->current, sizeof(next))))
+        return;
+
+    (void) Gen2Commit_(ctx, &next);
+}
+
+/**
+ * @brief 튜닝 모드에 맞는 초기 Gen2 설정을 Reader에 적용한다.
+ *
+ * - OFF: 아무것도 설정하지 않는다(모듈 기본값 유지).
+ * - AUTO: 모집단을 모르는 상태의 중립 값(dynamic Q, S1, target A, balanced 링크)으로 시작한다.
+ * - MANUAL: 사용자가 지정한 값을 적용한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INTERNAL_ERROR: 파라미터 적용 실패
+ */
+static RFID_RESULT ConfigureGen2_(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
+    rfid_gen2_settings_t initial;
+    memset(&initial, 0, sizeof(initial));
+
+    switch (ctx->gen2.mode) {
+        case RFID_GEN2_TUNE_AUTO:
+            initial.q = -1;
+            initial.session = 1;
+            initial.target = RFID_GEN2_TARGET_A;
+            initial.link = RFID_GEN2_LINK_BALANCED;
+            break;
+        case RFID_GEN2_TUNE_MANUAL:
+            initial = ctx->gen2.current;
+            break;
+        case RFID_GEN2_TUNE_OFF:
+        default:
+            return RFID_RESULT_OK;
+    }
+
+    const TMR_Status st = Gen2Commit_(ctx, &initial);
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    return (TMR_SUCCESS == st) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+}
+
+/**
+ * @brief 요청된 태그 metadata만 응답에 포함하도록 TMR_PARAM_METADATAFLAG 를 설정한다.
+ *
+ * - 프로토콜 필드는 SDK가 태그 파싱에 사용하므로 항상 포함한다.
+ * - dwell/전력 제어/read plan 목록이 켜져 있으면 내부에서 쓰는 필드(안테나, RSSI/read count)를 함께 요청한다.
+ * - embedded read 가 켜져 있으면 data 필드를 함께 요청한다.
+ * - 모듈이 지원하지 않으면 SDK 기본값(전체)을 유지한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  tag_metadata RFID_TAG_META_* 조합(0이면 설정하지 않음)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INTERNAL_ERROR: 파라미터 적용 실패
+ */
+static RFID_RESULT ConfigureMetadata_(IN_ rfid_ctx_t *ctx
+                                      , IN_ const uint32_t tag_metadata
+                                      , OUT_ uint32_t *out_status
+                                      , OUT_ const char **out_errstr) {
+    ctx->meta_flags = TMR_TRD_METADATA_FLAG_NONE;
+    if (RFID_TAG_META_DEFAULT == tag_metadata)
+        return RFID_RESULT_OK;
+
+    uint32_t meta = tag_metadata;
+    if ((0 != ctx->dwell.enabled) || (ctx->plans.count > 0))
+        meta |= RFID_TAG_META_ANTENNA;
+    if ((0 != ctx->power.enabled) && (RFID_POWER_CTRL_OFF != ctx->power.mode))
+        meta |= RFID_TAG_META_ANTENNA | RFID_TAG_META_RSSI | RFID_TAG_META_READCOUNT;
+
+    uint32_t flags = TMR_TRD_METADATA_FLAG_PROTOCOL;
+    if (0U != (meta & RFID_TAG_META_READCOUNT))
+        flags |= TMR_TRD_METADATA_FLAG_READCOUNT;
+    if (0U != (meta & RFID_TAG_META_RSSI))
+        flags |= TMR_TRD_METADATA_FLAG_RSSI;
+    if (0U != (meta & RFID_TAG_META_ANTENNA))
+        flags |= TMR_TRD_METADATA_FLAG_ANTENNAID;
+    if (0U != (meta & RFID_TAG_META_TIMESTAMP))
+        flags |= TMR_TRD_METADATA_FLAG_TIMESTAMP;
+    if (0 != ctx->embedded.enabled)
+        flags |= TMR_TRD_METADATA_FLAG_DATA;
+
+    TMR_TRD_MetadataFlag value = (TMR_TRD_MetadataFlag) flags;
+    const TMR_Status st = TMR_paramSet(&ctx->reader, TMR_PARAM_METADATAFLAG, &value);
+    if ((TMR_ERROR_UNSUPPORTED == st) || (TMR_ERROR_UNIMPLEMENTED_FEATURE == st))
+        return RFID_RESULT_OK;
+
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    if (TMR_SUCCESS != st)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    ctx->meta_flags = value;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief RFID_GEN2_BANK 값을 MercuryAPI의 TMR_GEN2_Bank 값으로 매핑한다.
+ * @param bank 변환할 bank
+ * @return 대응하는 TMR_GEN2_Bank 값
+ */
+static TMR_GEN2_Bank MapGen2Bank_(IN_ const RFID_GEN2_BANK bank) {
+    switch (bank) {
+        case RFID_GEN2_BANK_TID:
+            return TMR_GEN2_BANK_TID;
+        case RFID_GEN2_BANK_USER:
+            return TMR_GEN2_BANK_USER;
+        case RFID_GEN2_BANK_EPC:
+        default:
+            return TMR_GEN2_BANK_EPC;
+    }
+}
+
+/**
+ * @brief embedded read 설정을 검사하고 SDK ReadData tagop 을 만든다.
+ *
+ * @param[out] emb 상태 저장소
+ * @param[in]  read 설정(NULL 또는 enable 0이면 비활성)
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: 뱅크/길이 범위 오류
+ */
+static RFID_RESULT EmbeddedInit_(OUT_ rfid_embedded_t *emb, IN_ const rfid_embedded_read_t *read) {
+    memset(emb, 0, sizeof(*emb));
+    if ((NULL == read) || (0 == read->enable))
+        return RFID_RESULT_OK;
+
+    if (((int) read->bank < (int) RFID_GEN2_BANK_EPC) || ((int) read->bank > (int) RFID_GEN2_BANK_USER)
+        || (read->word_count <= 0) || (read->word_count > RFID_TAG_DATA_MAX_WORDS))
+        return RFID_RESULT_INVALID_ARG;
+
+    if (TMR_SUCCESS != TMR_TagOp_init_GEN2_ReadData(&emb->tagop, MapGen2Bank_(read->bank), read->word_address, (uint8_t) read->word_count))
+        return RFID_RESULT_INVALID_ARG;
+
+    emb->bank = read->bank;
+    emb->enabled = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 태그 응답의 embedded read 결과를 rfid_tag_t 로 옮긴다.
+ * @note 단일 뱅크 ReadData 결과는 trd->data 에 오지만, 모듈에 따라 뱅크별 목록에 채우는 경우가 있어 함께 확인한다.
+ *
+ * @param emb embedded read 상태
+ * @param trd 태그 응답
+ * @param dst 결과 태그
+ */
+static void EmbeddedCopyData_(IN_ const rfid_embedded_t *emb, IN_ const TMR_TagReadData *trd, OUT_ rfid_tag_t *dst) {
+    if (0 == emb->enabled)
+        return;
+
+    const TMR_uint8List *src = &trd->data;
+    if (0U == src->len) {
+        if (RFID_GEN2_BANK_TID == emb->bank)
+            src = &trd->tidMemData;
+        else if (RFID_GEN2_BANK_USER == emb->bank)
+            src = &trd->userMemData;
+        else
+            src = &trd->epcMemData;
+    }
+    if ((NULL == src->list) || (0U == src->len))
+        return;
+
+    dst->data_len = (src->len > RFID_TAG_DATA_MAX_BYTES) ? RFID_TAG_DATA_MAX_BYTES : src->len;
+    memcpy(dst->data, src->list, dst->data_len);
+}
+
+/**
+ * @brief Select 필터 목록을 검사하고 컨텍스트 저장소로 복사한다.
+ *
+ * - 단일 select 형태(single)와 multi-select 형태(multi_items)를 함께 만든다.
+ * - multi-select에서는 invert 비트 대신 Select action으로 결합/반전을 표현한다.
+ *   (ANY: 첫 필터 ON_N_OFF, 이후 ON_N_NOP / ALL: 첫 필터 ON_N_OFF, 이후 NOP_N_OFF, 반전 시 대칭 action)
+ *
+ * @param[out] sel 필터 저장소
+ * @param[in]  filters 필터 배열
+ * @param[in]  count 필터 개수(0..RFID_SELECT_MAX)
+ * @param[in]  combine 결합 방식
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: 범위 오류/잘못된 mask
+ */
+RFID_RESULT RfidSelectInit_(OUT_ rfid_select_t *sel
+                            , IN_ const rfid_select_filter_t *filters
+                            , IN_ const int count
+                            , IN_ const RFID_SELECT_COMBINE combine) {
+    if ((count < 0) || (count > RFID_SELECT_MAX) || ((count > 0) && (NULL == filters)))
+        return RFID_RESULT_INVALID_ARG;
+    if ((combine < RFID_SELECT_ANY) || (combine > RFID_SELECT_ALL))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_select_t next;
+    memset(&next, 0, sizeof(next));
+    next.combine = combine;
+    next.multi_supported = 1;
+
+    for (int i = 0; i < count; ++i) {
+        const rfid_select_filter_t *f = &filters[i];
+        if ((f->bank < RFID_GEN2_BANK_EPC) || (f->bank > RFID_GEN2_BANK_USER) || (0 != IsNullOrEmpty_(f->mask_hex)))
+            return RFID_RESULT_INVALID_ARG;
+
+        uint32_t mask_len = 0;
+        if (TMR_SUCCESS != TMR_hexToBytes(f->mask_hex, next.masks[i], RFID_SELECT_MASK_BYTES, &mask_len))
+            return RFID_RESULT_INVALID_ARG;
+
+        const int max_bits = (int) (mask_len * 8U);
+        const int bits = (f->mask_bits > 0) ? f->mask_bits : max_bits;
+        if ((0 == bits) || (bits > max_bits))
+            return RFID_RESULT_INVALID_ARG;
+
+        const TMR_GEN2_Bank bank = MapGen2Bank_(f->bank);
+        const int invert = (0 != f->invert);
+        (void) TMR_TF_init_gen2_select(&next.single[i], invert ? true : false, bank, f->bit_pointer, (uint16_t) bits, next.masks[i]);
+        (void) TMR_TF_init_gen2_select(&next.multi_items[i], false, bank, f->bit_pointer, (uint16_t) bits, next.masks[i]);
+
+        TMR_GEN2_Select_action action = invert ? OFF_N_ON : ON_N_OFF;
+        if (i > 0) {
+            if (RFID_SELECT_ANY == combine)
+                action = invert ? NOP_N_ON : ON_N_NOP;
+            else
+                action = invert ? OFF_N_NOP : NOP_N_OFF;
+        }
+        next.multi_items[i].u.gen2Select.action = action;
+    }
+    next.count = count;
+
+    // 마스크 포인터가 sel 내부를 가리키도록 복사 후 다시 연결한다.
+    *sel = next;
+    for (int i = 0; i < sel->count; ++i) {
+        sel->single[i].u.gen2Select.mask = sel->masks[i];
+        sel->multi_items[i].u.gen2Select.mask = sel->masks[i];
+        sel->multi_ptrs[i] = &sel->multi_items[i];
+    }
+    sel->multi.type = TMR_FILTER_TYPE_MULTI;
+    sel->multi.u.multiFilterList.tagFilterList = sel->multi_ptrs;
+    sel->multi.u.multiFilterList.max = (uint16_t) RFID_SELECT_MAX;
+    sel->multi.u.multiFilterList.len = (uint16_t) sel->count;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief read plan에 설정할 필터를 고른다.
+ *
+ * - 필터 1개: 단일 select
+ * - 여러 개 + multi-select 지원: multi-select
+ * - 여러 개 + 미지원: ALL이면 첫 필터만 리더에서 적용, ANY면 리더 필터 없음(나머지는 호스트에서 비교)
+ *
+ * @param sel 필터 저장소
+ * @return 설정할 필터, 없으면 NULL
+ */
+TMR_TagFilter* RfidSelectPlanFilter_(IN_ rfid_select_t *sel) {
+    if (sel->count <= 0)
+        return NULL;
+    if (1 == sel->count)
+        return &sel->single[0];
+    if (0 != sel->multi_supported)
+        return &sel->multi;
+    return (RFID_SELECT_ALL == sel->combine) ? &sel->single[0] : NULL;
+}
+
+/**
+ * @brief 태그가 필터 저장소의 EPC 뱅크 조건을 만족하는지 호스트에서 비교한다.
+ *
+ * @param sel 필터 저장소
+ * @param tag 태그 데이터
+ * @return 일치하면 1(필터가 없으면 1)
+ *
+ * @note EPC 뱅크가 아닌 필터는 호스트에서 비교할 수 없으므로 일치로 간주한다.
+ */
+static int SelectTagMatch_(IN_ rfid_select_t *sel, IN_ TMR_TagData *tag) {
+    if (sel->count <= 0)
+        return 1;
+
+    const int any = (RFID_SELECT_ANY == sel->combine);
+    for (int i = 0; i < sel->count; ++i) {
+        TMR_TagFilter *f = &sel->single[i];
+        const int match = (TMR_GEN2_BANK_EPC != f->u.gen2Select.bank) || TMR_TF_match(f, tag);
+        if (any && match)
+            return 1;
+        if (!any && !match)
+            return 0;
+    }
+    return any ? 0 : 1;
+}
+
+/**
+ * @brief 리더에서 다 걸러내지 못한 경우 태그가 필터 조건을 만족하는지 호스트에서 확인한다.
+ *
+ * @param sel 필터 저장소
+ * @param tag 태그 데이터
+ * @return 통과하면 1, 걸러내야 하면 0
+ *
+ * @note EPC 뱅크가 아닌 필터는 호스트에서 비교할 수 없으므로 일치로 간주한다.
+ */
+static int SelectHostMatch_(IN_ rfid_select_t *sel, IN_ TMR_TagData *tag) {
+    if ((sel->count <= 1) || (0 != sel->multi_supported))
+        return 1;
+    return SelectTagMatch_(sel, tag);
+}
+
+/**
+ * @brief 멀티 select 미지원 모듈을 위한 호스트 비교가 필요한 필터 저장소가 있는지 확인한다.
+ * @param ctx RFID 컨텍스트
+ * @return 있으면 1
+ */
+static int SelectHostFiltering_(IN_ const rfid_ctx_t *ctx) {
+    if ((ctx->select.count > 1) && (0 == ctx->select.multi_supported))
+        return 1;
+    for (int i = 0; i < ctx->plans.count; ++i) {
+        if ((ctx->plans.select[i].count > 1) && (0 == ctx->plans.select[i].multi_supported))
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 리더에 multi-select 로 넘기는 필터 저장소가 있는지 확인한다(미지원 감지 대상).
+ * @param ctx RFID 컨텍스트
+ * @return 있으면 1
+ */
+static int SelectMultiInUse_(IN_ const rfid_ctx_t *ctx) {
+    if ((ctx->select.count > 1) && (0 != ctx->select.multi_supported))
+        return 1;
+    for (int i = 0; i < ctx->plans.count; ++i) {
+        if ((ctx->plans.select[i].count > 1) && (0 != ctx->plans.select[i].multi_supported))
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 모듈이 multi-select 를 지원하지 않는 것으로 표시한다(전역/plan 목록 필터 모두).
+ * @param ctx RFID 컨텍스트
+ */
+static void SelectDisableMulti_(IN_ rfid_ctx_t *ctx) {
+    ctx->select.multi_supported = 0;
+    for (int i = 0; i < ctx->plans.count; ++i)
+        ctx->plans.select[i].multi_supported = 0;
+    ctx->plans.dirty = 1;
+}
+
+/**
+ * @brief 조기 종료 read 설정(stop trigger, fast search)과 embedded read tagop 을 simple plan 에 반영한다.
+ * @param ctx RFID 컨텍스트
+ * @param plan 대상 simple plan
+ * @return TMR 상태 코드
+ */
+static TMR_Status PlanSetOptions_(IN_ rfid_ctx_t *ctx, IN_ TMR_ReadPlan *plan) {
+    TMR_Status st = TMR_SUCCESS;
+    if (0U != ctx->stop_count)
+        st = TMR_RP_set_stopTrigger(plan, ctx->stop_count);
+    if ((TMR_SUCCESS == st) && (0 != ctx->fast_search))
+        st = TMR_RP_set_useFastSearch(plan, true);
+    if ((TMR_SUCCESS == st) && (0 != ctx->embedded.enabled))
+        st = TMR_RP_set_tagop(plan, &ctx->embedded.tagop);
+    return st;
+}
+
+/**
+ * @brief 가중치 read plan 목록을 검사하고 컨텍스트 저장소로 복사한다.
+ *
+ * @param[out] list 저장소
+ * @param[in]  entries 항목 배열
+ * @param[in]  count 항목 수(0..RFID_PLAN_MAX)
+ *
+ * @return RFID_RESULT_OK: 성공(count 0 포함), RFID_RESULT_INVALID_ARG: 범위 오류/잘못된 필터
+ */
+static RFID_RESULT PlanListInit_(OUT_ rfid_plan_list_t *list, IN_ const rfid_plan_entry_t *entries, IN_ const int count) {
+    memset(list, 0, sizeof(*list));
+    for (int p = 0; p < count; ++p) {
+        const rfid_plan_entry_t *e = &entries[p];
+        if ((NULL == e->antennas) || (e->antenna_count <= 0) || (e->antenna_count > (int) RFID_MAX_ANTENNAS) || (e->weight <= 0))
+            return RFID_RESULT_INVALID_ARG;
+
+        for (int i = 0; i < e->antenna_count; ++i) {
+            const int ant = e->antennas[i];
+            if ((ant <= 0) || (ant > 255))
+                return RFID_RESULT_INVALID_ARG;
+            list->antennas[p][i] = (uint8_t) ant;
+
+            int known = 0;
+            for (int j = 0; (j < list->all_count) && (0 == known); ++j)
+                known = (list->all_antennas[j] == ant);
+            if (0 == known) {
+                if (list->all_count >= (int) RFID_MAX_ANTENNAS)
+                    return RFID_RESULT_INVALID_ARG;
+                list->all_antennas[list->all_count++] = ant;
+            }
+        }
+        list->antenna_count[p] = e->antenna_count;
+        list->weight[p] = (uint32_t) e->weight;
+
+        const RFID_RESULT ret = RfidSelectInit_(&list->select[p], e->select_filters, e->select_count, e->select_combine);
+        if (RFID_RESULT_OK != ret)
+            return ret;
+    }
+    list->count = count;
+    list->dirty = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 가중치 read plan 목록으로 SDK multi plan 을 만들어 Reader 에 설정한다.
+ *
+ * - 항목마다 simple plan(안테나, 가중치, 필터, stop trigger, embedded read)을 만들고 TMR_RP_init_multi 로 묶는다.
+ * - 모든 항목의 안테나가 같으면 SDK가 한 번의 검색 명령으로, 다르면 가중치 비율의 시간으로 순차 수행한다.
+ *
+ * @param ctx RFID 컨텍스트
+ * @return TMR 상태 코드
+ */
+static TMR_Status PlanListBuild_(IN_ rfid_ctx_t *ctx) {
+    rfid_plan_list_t *list = &ctx->plans;
+    rfid_plan_storage_t *ps = &ctx->plan;
+    TMR_TagFilter *global = RfidSelectPlanFilter_(&ctx->select);
+
+    memset(&ps->plan, 0, sizeof(ps->plan));
+    uint32_t total_weight = 0;
+    TMR_Status st = TMR_SUCCESS;
+    for (int p = 0; (p < list->count) && (TMR_SUCCESS == st); ++p) {
+        memset(&ps->sub_plans[p], 0, sizeof(ps->sub_plans[p]));
+        st = TMR_RP_init_simple(&ps->sub_plans[p]
+                                , (uint8_t) list->antenna_count[p]
+                                , list->antennas[p]
+                                , TMR_TAG_PROTOCOL_GEN2
+                                , list->weight[p]);
+        TMR_TagFilter *filter = (list->select[p].count > 0) ? RfidSelectPlanFilter_(&list->select[p]) : global;
+        if ((TMR_SUCCESS == st) && (NULL != filter))
+            st = TMR_RP_set_filter(&ps->sub_plans[p], filter);
+        if (TMR_SUCCESS == st)
+            st = PlanSetOptions_(ctx, &ps->sub_plans[p]);
+        ps->sub_ptrs[p] = &ps->sub_plans[p];
+        total_weight += list->weight[p];
+    }
+    if (TMR_SUCCESS == st)
+        st = TMR_RP_init_multi(&ps->plan, ps->sub_ptrs, (uint8_t) list->count, total_weight);
+    if (TMR_SUCCESS == st)
+        st = TMR_paramSet(&ctx->reader, TMR_PARAM_READ_PLAN, &ps->plan);
+    if (TMR_SUCCESS == st) {
+        list->dirty = 0;
+        list->built_stop = ctx->stop_count;
+        list->built_fast = ctx->fast_search;
+    }
+    return st;
+}
+
+/**
+ * @brief 태그를 읽힌 안테나와 EPC Select 조건으로 가중치 read plan 항목에 귀속시킨다.
+ *
+ * @param ctx RFID 컨텍스트
+ * @param tag 태그 데이터
+ * @param antenna 읽힌 안테나(0이면 안테나 비교 생략)
+ * @return 항목 index, 해당 항목이 없으면 -1
+ */
+static int PlanListAttribute_(IN_ rfid_ctx_t *ctx, IN_ TMR_TagData *tag, IN_ const int antenna) {
+    rfid_plan_list_t *list = &ctx->plans;
+    for (int p = 0; p < list->count; ++p) {
+        if (antenna > 0) {
+            int has = 0;
+            for (int i = 0; (i < list->antenna_count[p]) && (0 == has); ++i)
+                has = ((int) list->antennas[p][i] == antenna);
+            if (0 == has)
+                continue;
+        }
+        rfid_select_t *sel = (list->select[p].count > 0) ? &list->select[p] : &ctx->select;
+        if (0 != SelectTagMatch_(sel, tag))
+            return p;
+    }
+    return -1;
+}
+
+/**
+ * @brief read 결과 태그를 결과에 포함할지 판단하고, read plan 목록 사용 시 항목별 태그 수를 집계한다.
+ *
+ * @param ctx RFID 컨텍스트
+ * @param tag 태그 데이터
+ * @param antenna 읽힌 안테나
+ * @return 포함하면 1, 걸러내야 하면 0
+ */
+int RfidReadAcceptTag_(IN_ rfid_ctx_t *ctx, IN_ TMR_TagData *tag, IN_ const int antenna) {
+    if (0 == ctx->plans.count)
+        return SelectHostMatch_(&ctx->select, tag);
+
+    const int p = PlanListAttribute_(ctx, tag, antenna);
+    if (p >= 0) {
+        ctx->plans.tags[p]++;
+        return 1;
+    }
+    // 어느 항목 조건에도 맞지 않는 태그는 리더가 걸러내지 못한 경우에만 버린다.
+    return (0 != SelectHostFiltering_(ctx)) ? 0 : 1;
+}
+
+/**
+ * @brief read 1회 시간을 가중치 비율로 항목별 누적 read 시간에 더한다.
+ * @param list read plan 목록
+ * @param read_ms 이번 read 시간(ms)
+ */
+static void PlanListEndCycle_(IN_ rfid_plan_list_t *list, IN_ const uint32_t read_ms) {
+    uint32_t total = 0;
+    for (int p = 0; p < list->count; ++p)
+        total += list->weight[p];
+    if (0U == total)
+        return;
+    for (int p = 0; p < list->count; ++p)
+        list->airtime_ms[p] += ((uint64_t) read_ms * list->weight[p]) / total;
+}
+
+/**
+ * @brief TMR_read() 실패가 multi-select 미지원 때문인지 판단한다.
+ * @param st TMR_read() 결과
+ * @return 미지원으로 볼 수 있으면 1, 아니면 0
+ */
+static int IsSelectUnsupported_(IN_ const TMR_Status st) {
+    return (TMR_ERROR_UNSUPPORTED == st)
+           || (TMR_ERROR_UNIMPLEMENTED_FEATURE == st)
+           || (TMR_ERROR_MSG_INVALID_PARAMETER_VALUE == st);
+}
+
+/**
+ * @brief GEN2 Read Plan(안테나 리스트 포함)을 설정한다.
+ *
+ * - dwell 스케줄러가 활성이고 안테나가 2개 이상이면, 안테나별 simple plan을 가중치와 함께 묶은
+ *   multi plan을 사용한다. (모듈이 per-antenna read time을 지원하면 SDK가 setAntennaReadTimeList로,
+ *   아니면 하위 plan을 가중치 비율의 시간으로 순차 수행한다.)
+ * - 그 외에는 단일 simple plan을 사용한다.
+ * - 가중치 read plan 목록(ctx->plans)이 있으면 위 규칙 대신 목록으로 만든 multi plan 을 사용한다(antennas 무시).
+ * - plan이 참조하는 안테나 목록/하위 plan은 ctx->plan 에 보관한다.
+ *
+ * @param[in]  ctx         RFID 컨텍스트
+ * @param[in]  antennas    안테나 번호 배열(1..N)
+ * @param[in]  antenna_count 안테나 개수
+ * @param[in]  plan_timeout_ms plan timeout(ms), 0 이하이면 기본값 사용
+ * @param[out] out_status  TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr  상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_PLAN_FAIL: 설정 실패
+ *
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ */
+RFID_RESULT RfidConfigureReadPlan_(IN_ rfid_ctx_t *ctx
+                                   , IN_ const int *antennas
+                                   , IN_ const int antenna_count
+                                   , IN_ const int plan_timeout_ms
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    // 가중치 read plan 목록: 만들어 둔 multi plan 을 쓰고, 필터/가중치/stop trigger 가 바뀐 경우만 다시 만든다.
+    if ((NULL != ctx) && (ctx->plans.count > 0)) {
+        if ((0 == ctx->plans.dirty) && (ctx->plans.built_stop == ctx->stop_count) && (ctx->plans.built_fast == ctx->fast_search))
+            return RFID_RESULT_OK;
+        const TMR_Status st = PlanListBuild_(ctx);
+        SetOutStatusAndErr_(out_status, out_errstr, st);
+        return (TMR_SUCCESS == st) ? RFID_RESULT_OK : RFID_RESULT_PLAN_FAIL;
+    }
+
+    if ((NULL == ctx) || (NULL == antennas) || (antenna_count <= 0) || (antenna_count > (int) RFID_MAX_ANTENNAS))
+        return RFID_RESULT_INVALID_ARG;
+
+    for (int i = 0; i < antenna_count; ++i) {
+        const int ant = antennas[i];
+        if (ant <= 0 || ant > 255)
+            return RFID_RESULT_INVALID_ARG;
+    }
+
+    rfid_plan_storage_t *ps = &ctx->plan;
+    for (int i = 0; i < antenna_count; ++i)
+        ps->antennas[i] = (uint8_t) antennas[i];
+
+    const uint32_t readTime = (plan_timeout_ms > 0)
+                                  ? (uint32_t) plan_timeout_ms
+                                  : (uint32_t) RFID_DEFAULT_PLAN_READTIME;
+
+    memset(&ps->plan, 0, sizeof(ps->plan));
+
+    TMR_TagFilter *filter = RfidSelectPlanFilter_(&ctx->select);
+    TMR_Status st1 = TMR_SUCCESS;
+    if ((0 != ctx->dwell.enabled) && (antenna_count > 1)) {
+        DwellSyncAntennas_(&ctx->dwell, antennas, antenna_count);
+
+        uint32_t total_weight = 0;
+        for (int i = 0; (i < antenna_count) && (TMR_SUCCESS == st1); ++i) {
+            memset(&ps->sub_plans[i], 0, sizeof(ps->sub_plans[i]));
+            st1 = TMR_RP_init_simple(&ps->sub_plans[i]
+                                     , 1
+                                     , &ps->antennas[i]
+                                     , TMR_TAG_PROTOCOL_GEN2
+                                     , ctx->dwell.ants[i].weight);
+            if ((TMR_SUCCESS == st1) && (NULL != filter))
+                st1 = TMR_RP_set_filter(&ps->sub_plans[i], filter);
+            if (TMR_SUCCESS == st1)
+                st1 = PlanSetOptions_(ctx, &ps->sub_plans[i]);
+            ps->sub_ptrs[i] = &ps->sub_plans[i];
+            total_weight += ctx->dwell.ants[i].weight;
+        }
+
+        // per-antenna read time 경로는 하위 weight를 최상위 weight로 나누므로 합계를 넣는다.
+        if (TMR_SUCCESS == st1)
+            st1 = TMR_RP_init_multi(&ps->plan, ps->sub_ptrs, (uint8_t) antenna_count, total_weight);
+    }
+    else {
+        st1 = TMR_RP_init_simple(&ps->plan
+                                 , (uint8_t) antenna_count
+                                 , ps->antennas
+                                 , TMR_TAG_PROTOCOL_GEN2
+                                 , readTime);
+        if ((TMR_SUCCESS == st1) && (NULL != filter))
+            st1 = TMR_RP_set_filter(&ps->plan, filter);
+        if (TMR_SUCCESS == st1)
+            st1 = PlanSetOptions_(ctx, &ps->plan);
+    }
+    if (TMR_SUCCESS != st1) {
+        SetOutStatusAndErr_(out_status, out_errstr, st1);
+        return RFID_RESULT_PLAN_FAIL;
+    }
+
+    const TMR_Status st2 = TMR_paramSet(&ctx->reader, TMR_PARAM_READ_PLAN, &ps->plan);
+    SetOutStatusAndErr_(out_status, out_errstr, st2);
+
+    return (st2 == TMR_SUCCESS) ? RFID_RESULT_OK : RFID_RESULT_PLAN_FAIL;
+}
+
+/**
+ * @brief 읽기 전력(dBm)이 양수인 경우 Reader에 설정한다.
+ *
+ * @param[in]  reader MercuryAPI Reader 핸들
+ * @param[in]  read_power_cdbm 읽기 전력(cdBm), 0 이하이면 설정하지 않음
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INTERNAL_ERROR: 설정 실패
+ *
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ */
+static RFID_RESULT ConfigureWritePower_(IN_ TMR_Reader *reader
+                                       , IN_ const int read_power_cdbm
+                                       , OUT_ uint32_t *out_status
+                                       , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+    if (read_power_cdbm <= 0)
+        return RFID_RESULT_OK;
+
+    const int32_t power_cdbm = (int32_t) read_power_cdbm;
+    const TMR_Status st = TMR_paramSet(reader, TMR_PARAM_RADIO_READPOWER, &power_cdbm);
+
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+
+    return (st == TMR_SUCCESS) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+}
+
+/**
+ * @brief 기대 EPC 목록(hex)을 바이너리로 변환한다.
+ * @param[in]  cond 조기 종료 조건
+ * @param[out] out_list 변환 결과(호출자가 free). 기대 EPC가 없으면 NULL
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: hex 오류, RFID_RESULT_INTERNAL_ERROR: 메모리 부족
+ */
+static RFID_RESULT EarlyExitLoadExpected_(IN_ const rfid_early_exit_t *cond, OUT_ rfid_expected_epc_t **out_list) {
+    *out_list = NULL;
+    if (cond->expected_count <= 0)
+        return RFID_RESULT_OK;
+
+    rfid_expected_epc_t *list = (rfid_expected_epc_t *) calloc((size_t) cond->expected_count, sizeof(*list));
+    if (NULL == list)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    for (int i = 0; i < cond->expected_count; ++i) {
+        const char *hex = cond->expected_epcs[i];
+        if ((0 != IsNullOrEmpty_(hex))
+            || (TMR_SUCCESS != TMR_hexToBytes(hex, list[i].epc, RFID_EPC_MAX_BYTES, &list[i].len))
+            || (0U == list[i].len)) {
+            free(list);
+            return RFID_RESULT_INVALID_ARG;
+        }
+    }
+    *out_list = list;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 새로 읽은 태그를 기존 결과와 EPC 기준으로 합치고 기대 EPC 발견 여부를 갱신한다.
+ *
+ * - 이미 있는 EPC는 read count를 더하고 RSSI가 더 강한 쪽의 RSSI/안테나를 남긴다.
+ *
+ * @param[in,out] tags 결과 버퍼. [0, base)는 기존 고유 태그, [base, base + added)는 새로 읽은 태그
+ * @param[in]     base 기존 고유 태그 수
+ * @param[in]     added 새로 읽은 태그 수
+ * @param[in,out] expected 기대 EPC 목록(NULL 허용)
+ * @param[in]     expected_count 기대 EPC 개수
+ * @param[in,out] found 발견한 기대 EPC 수
+ * @return 합친 뒤 고유 태그 수
+ */
+static int EarlyExitMerge_(INOUT_ rfid_tag_t *tags
+                           , IN_ const int base
+                           , IN_ const int added
+                           , INOUT_ rfid_expected_epc_t *expected
+                           , IN_ const int expected_count
+                           , INOUT_ int *found) {
+    int count = base;
+    for (int i = base; i < base + added; ++i) {
+        const rfid_tag_t *t = &tags[i];
+
+        int dup = -1;
+        for (int j = 0; j < count; ++j) {
+            if ((tags[j].epc_len == t->epc_len) && (0 == memcmp(tags[j].epc_bytes, t->epc_bytes, t->epc_len))) {
+                dup = j;
+                break;
+            }
+        }
+        if (dup >= 0) {
+            rfid_tag_t *d = &tags[dup];
+            d->readcnt += t->readcnt;
+            if (t->rssi > d->rssi) {
+                d->rssi = t->rssi;
+                d->antenna = t->antenna;
+            }
+            continue;
+        }
+
+        for (int e = 0; e < expected_count; ++e) {
+            if ((0 == expected[e].seen) && (expected[e].len == t->epc_len)
+                && (0 == memcmp(expected[e].epc, t->epc_bytes, t->epc_len))) {
+                expected[e].seen = 1;
+                (*found)++;
+            }
+        }
+
+        if (i != count)
+            tags[count] = *t;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief SDK 태그 응답을 결과 태그로 옮긴다(epc_id 는 하류 전달 시 채운다).
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  trd SDK 태그 응답
+ * @param[in]  rule_id EPC 규칙 분류 결과
+ * @param[out] dst 결과 태그
+ */
+void RfidReadFillTag_(IN_ rfid_ctx_t *ctx, IN_ const TMR_TagReadData *trd, IN_ const uint32_t rule_id, OUT_ rfid_tag_t *dst) {
+    memset(dst, 0, sizeof(*dst));
+
+    // EPC bytes -> hex string
+    const uint32_t max_bytes = (uint32_t) ((RFID_EPC_MAX_LEN - 1) / 2);
+    const uint32_t use_bytes = (trd->tag.epcByteCount > max_bytes) ? max_bytes : trd->tag.epcByteCount;
+
+    // TMR_bytesToHex는 null-terminated 문자열을 만들어 준다.
+    TMR_bytesToHex(trd->tag.epc, use_bytes, dst->epc);
+
+    dst->epc_len = (trd->tag.epcByteCount > RFID_EPC_MAX_BYTES) ? RFID_EPC_MAX_BYTES : trd->tag.epcByteCount;
+    memcpy(dst->epc_bytes, trd->tag.epc, dst->epc_len);
+    dst->rule_id = rule_id;
+    dst->epc_id = RFID_EPC_ID_NONE;
+
+    // 요청하지 않은 metadata는 응답에 없으므로 기본값으로 채운다(ts는 SDK가 read 시작 시각으로 채움).
+    // metadataFlags 를 채우지 않는 reader 종류는 모든 필드가 있다고 본다.
+    const uint16_t meta = (0 != trd->metadataFlags) ? trd->metadataFlags : (uint16_t) TMR_TRD_METADATA_FLAG_ALL;
+    dst->rssi = (0 != (meta & TMR_TRD_METADATA_FLAG_RSSI)) ? (int) trd->rssi : 0;
+    dst->readcnt = (0 != (meta & TMR_TRD_METADATA_FLAG_READCOUNT)) ? (uint32_t) trd->readCount : 1U;
+    dst->antenna = (0 != (meta & TMR_TRD_METADATA_FLAG_ANTENNAID)) ? (int) trd->antenna : 0;
+    dst->ts = CombineTimestampMs_(trd->timestampLow, trd->timestampHigh);
+    EmbeddedCopyData_(&ctx->embedded, trd, dst);
+    RfidTraceTag_(&ctx->trace, trd, meta, dst);
+}
+
+/**
+ * @brief 결과 태그를 연결된 하류(intern → 로그 → 버스 → 병합 → 풀)에 넘긴다(전달 시각으로 지연 구간을 기록한다).
+ *
+ * @param[in]     ctx RFID 컨텍스트
+ * @param[in,out] tags 결과 태그(epc_id 를 채운다)
+ * @param[in]     count 태그 수
+ */
+void RfidReadDeliver_(IN_ rfid_ctx_t *ctx, INOUT_ rfid_tag_t *tags, IN_ const int count) {
+    RfidTraceDeliver_(&ctx->trace, tags, count);
+
+    // 하류(로그/버스/병합)보다 먼저 채워야 호출자가 받는 태그와 id 가 일치한다.
+    if (NULL != ctx->intern)
+        (void) rfid_epc_intern_tags(ctx->intern, tags, count, NULL);
+
+    // 큐에 복사만 하므로 read 스레드를 막지 않는다(큐가 가득 차면 로그 통계의 dropped 로 집계).
+    if (NULL != ctx->tag_log)
+        (void) rfid_tag_log_append(ctx->tag_log, ctx->tag_log_reader_id, tags, count);
+    if (NULL != ctx->tag_bus)
+        (void) rfid_tag_bus_publish(ctx->tag_bus, ctx->tag_bus_reader_id, tags, count);
+    if (NULL != ctx->merge)
+        (void) rfid_merge_push(ctx->merge, ctx->merge_reader_id, tags, count, 0U);
+    if (NULL != ctx->pool)
+        (void) rfid_pool_submit(ctx->pool, ctx->pool_reader_id, tags, count, NULL);
+}
+
+/**
+ * @brief read 1 사이클(plan 구성 → TMR_read → 태그 수집 → 제어기/통계 갱신 → 하류 전달)을 수행한다.
+ * @note 인자/상태 검사는 호출자가 한다(rfid_read, trigger read 스레드).
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  antennas 안테나 배열(가중치 read plan 목록이 있으면 무시)
+ * @param[in]  antenna_count 안테나 개수
+ * @param[in]  read_timeout_ms read 시간(ms)
+ * @param[out] out_tags 결과 태그 배열
+ * @param[in]  tag_capacity out_tags 길이(> 0)
+ * @param[out] out_count 결과 태그 수
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_READ_FAIL: read 실패
+ */
+RFID_RESULT RfidReadCycle_(IN_ rfid_ctx_t *ctx
+                           , IN_ const int *antennas
+                           , IN_ const int antenna_count
+                           , IN_ const int read_timeout_ms
+                           , OUT_ rfid_tag_t *out_tags
+                           , IN_ const int tag_capacity
+                           , OUT_ int *out_count
+                           , OUT_ uint32_t *out_status
+                           , OUT_ const char **out_errstr) {
+    *out_count = 0;
+
+    // 가중치 read plan 목록을 쓰면 목록 안테나의 합집합을 사용한다(antennas 인자는 무시).
+    const int *cycle_ants = (ctx->plans.count > 0) ? ctx->plans.all_antennas : antennas;
+    const int cycle_ant_count = (ctx->plans.count > 0) ? ctx->plans.all_count : antenna_count;
+
+    const uint64_t link_t0 = LinkNowUs_();
+    const uint64_t link_tx0 = ctx->link.tx_bytes;
+    const uint64_t link_rx0 = ctx->link.rx_bytes;
+
+    /* TMR_read() 호출 전 ReadPlan 재설정 */
+    const RFID_RESULT st_plan = RfidConfigureReadPlan_(ctx
+                                                   , cycle_ants
+                                                   , cycle_ant_count
+                                                   , read_timeout_ms
+                                                   , out_status
+                                                   , out_errstr);
+    if (RFID_RESULT_OK != st_plan)
+        return RFID_RESULT_READ_FAIL;
+
+    // 새 안테나가 추가되었거나 제어기가 전력을 바꿨으면 read 전에 반영한다(실패는 통계로만 노출).
+    if ((0 != ctx->power.enabled) && (RFID_POWER_CTRL_OFF != ctx->power.mode)) {
+        for (int i = 0; i < cycle_ant_count; ++i)
+            (void) PowerAntenna_(&ctx->power, cycle_ants[i]);
+    }
+    if ((0 != ctx->power.enabled) && (0 != ctx->power.dirty))
+        (void) PowerApply_(&ctx->reader, &ctx->power);
+
+    int32_t tag_count_from_reader = 0;
+    TMR_Status st_read = TMR_read(&ctx->reader, (uint32_t) read_timeout_ms, &tag_count_from_reader);
+
+    // multi-select 미지원 모듈: 리더 측 필터를 줄이고(나머지는 호스트에서 비교) 한 번 다시 읽는다.
+    if ((TMR_SUCCESS != st_read) && (0 != SelectMultiInUse_(ctx)) && (0 != IsSelectUnsupported_(st_read))) {
+        SelectDisableMulti_(ctx);
+        if (RFID_RESULT_OK != RfidConfigureReadPlan_(ctx, cycle_ants, cycle_ant_count, read_timeout_ms, out_status, out_errstr))
+            return RFID_RESULT_READ_FAIL;
+        st_read = TMR_read(&ctx->reader, (uint32_t) read_timeout_ms, &tag_count_from_reader);
+    }
+
+    SetOutStatusAndErr_(out_status, out_errstr, st_read);
+    if (TMR_SUCCESS != st_read) {
+        LinkEndCycle_(ctx, st_read, link_tx0, link_rx0, link_t0);
+        CounterEndCycle_(ctx, st_read, NULL, 0, 0U, 0U, link_t0);
+        return RFID_RESULT_READ_FAIL;
+    }
+
+    // 규칙 스냅샷은 호출당 1회 얻는다(읽는 도중 교체되어도 이번 결과는 같은 규칙으로 분류).
+    rfid_epc_rules_t *rules = rfid_epc_matcher_acquire(ctx->matcher);
+    const int drop_unmatched = ((NULL != rules) && (0 != ctx->matcher_drop)) ? 1 : 0;
+
+    // hasMoreTags / getNextTag 로 결과를 가져온다.
+    uint32_t fetched = 0;
+    uint32_t overflow = 0;
+    while (TMR_SUCCESS == TMR_hasMoreTags(&ctx->reader)) {
+        if (*out_count >= tag_capacity) {
+            // 버퍼 용량 초과: 이후 태그는 무시 (정책: OK 반환, count는 capacity로 제한)
+            TMR_TagReadData dummy;
+            (void) TMR_TRD_init(&dummy);
+            if ((TMR_SUCCESS == TMR_getNextTag(&ctx->reader, &dummy)) && (0 != RfidReadAcceptTag_(ctx, &dummy.tag, (int) dummy.antenna))
+                && ((0 == drop_unmatched)
+                    || (RFID_EPC_RULE_NONE != rfid_epc_rules_classify(rules, dummy.tag.epc, dummy.tag.epcByteCount)))) {
+                DwellObserveTag_(&ctx->dwell, dummy.tag.epc, dummy.tag.epcByteCount, (int) dummy.antenna);
+                PowerObserveTag_(&ctx->power
+                                 , dummy.tag.epc
+                                 , dummy.tag.epcByteCount
+                                 , (int) dummy.antenna
+                                 , (int) dummy.rssi
+                                 , (uint32_t) dummy.readCount);
+                fetched++;
+                overflow++;
+            }
+            continue;
+        }
+
+        // TMR_TRD_init 이 embedded read data 버퍼를 trd 내부 저장소에 연결한다.
+        TMR_TagReadData trd;
+        memset(&trd, 0, sizeof(trd));
+        (void) TMR_TRD_init(&trd);
+
+        const TMR_Status st_next = TMR_getNextTag(&ctx->reader, &trd);
+        SetOutStatusAndErr_(out_status, out_errstr, st_next);
+        if (TMR_SUCCESS != st_next) {
+            rfid_epc_rules_release(rules);
+            LinkEndCycle_(ctx, st_next, link_tx0, link_rx0, link_t0);
+            CounterEndCycle_(ctx, st_next, NULL, 0, 0U, 0U, link_t0);
+            return RFID_RESULT_READ_FAIL;
+        }
+
+        if (0 == RfidReadAcceptTag_(ctx, &trd.tag, (int) trd.antenna))
+            continue;
+
+        const uint32_t rule_id = rfid_epc_rules_classify(rules, trd.tag.epc, trd.tag.epcByteCount);
+        if ((0 != drop_unmatched) && (RFID_EPC_RULE_NONE == rule_id))
+            continue;
+
+        rfid_tag_t *dst = &out_tags[*out_count];
+        RfidReadFillTag_(ctx, &trd, rule_id, dst);
+
+        DwellObserveTag_(&ctx->dwell, trd.tag.epc, trd.tag.epcByteCount, dst->antenna);
+        PowerObserveTag_(&ctx->power, trd.tag.epc, trd.tag.epcByteCount, dst->antenna, dst->rssi, dst->readcnt);
+
+        (*out_count)++;
+        fetched++;
+    }
+    rfid_epc_rules_release(rules);
+
+    // stop trigger 가 걸린 read 는 timeout 전에 끝나므로 실제 소요 시간을 제어기에 넘긴다.
+    const uint32_t cycle_ms = (0U != ctx->stop_count)
+                                  ? (uint32_t) ((LinkNowUs_() - link_t0) / 1000U)
+                                  : (uint32_t) read_timeout_ms;
+    DwellEndCycle_(&ctx->dwell, cycle_ms);
+    Gen2EndCycle_(ctx, fetched, cycle_ms);
+    PowerEndCycle_(ctx, cycle_ants, cycle_ant_count, cycle_ms);
+    PlanListEndCycle_(&ctx->plans, cycle_ms);
+    LinkEndCycle_(ctx, TMR_SUCCESS, link_tx0, link_rx0, link_t0);
+
+    // 태그가 없으면 out_count=0 이고 OK 반환 (정책)
+    if (*out_count > 1)
+        qsort(out_tags, (size_t) (*out_count), sizeof(rfid_tag_t), CompareTag_);
+
+    CounterEndCycle_(ctx
+                     , TMR_SUCCESS
+                     , out_tags
+                     , *out_count
+                     , (tag_count_from_reader > 0) ? (uint32_t) tag_count_from_reader : 0U
+                     , overflow
+                     , link_t0);
+
+    RfidReadDeliver_(ctx, out_tags, *out_count);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 컨텍스트가 소유한 호스트 측 자원과 컨텍스트 자체를 해제한다.
+ * @note Reader 해제(TMR_destroy)는 호출자가 먼저 수행한다.
+ * @param ctx 해제할 컨텍스트(NULL 허용)
+ */
+static void FreeCtx_(IN_ rfid_ctx_t *ctx) {
+    if (NULL == ctx)
+        return;
+    DwellFree_(&ctx->dwell);
+    PowerFree_(&ctx->power);
+    (void) pthread_cond_destroy(&ctx->state_cond);
+    (void) pthread_mutex_destroy(&ctx->state_lock);
+    free(ctx);
+}
+
+/**
+ * @brief RFID Reader를 생성/연결하고 Region 및 Read Plan을 설정하여 컨텍스트를 초기화한다.
+ * @param[out] out_ctx 초기화 완료 후 생성된 컨텍스트 포인터를 반환받을 출력 포인터
+ * @param[in]  params 초기화 파라미터(사용 여부, URI, Region, 안테나 목록/개수, plan timeout, read power 등)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ * @return 성공 시 RFID_RESULT_OK, 비활성화 시 RFID_RESULT_DISABLED, 인자 오류 시 RFID_RESULT_INVALID_ARG,
+ *         연결 실패 시 RFID_RESULT_CONNECT_FAIL, Region 설정 실패 시 RFID_RESULT_REGION_FAIL,
+ *         Read plan 설정 실패 시 RFID_RESULT_PLAN_FAIL, 메모리/기타 내부 오류 시 RFID_RESULT_INTERNAL_ERROR
+ *
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ */
+RFID_RESULT rfid_init(OUT_ rfid_ctx_t **out_ctx
+                      , IN_ const rfid_init_params_t *params
+                      , OUT_ uint32_t *out_status
+                      , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    // ------------------------------
+    // 파라미터 유효성 검사
+    // ------------------------------
+    RFID_RESULT ret = ValidateInitParams_(out_ctx, params);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return ret;
+    }
+
+    *out_ctx = NULL;
+
+    // ------------------------------
+    // 컨텍스트 할당 및 초기화
+    // ------------------------------
+    rfid_ctx_t *ctx = (rfid_ctx_t *) malloc(sizeof(*ctx));
+    if (NULL == ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    (void) pthread_mutex_init(&ctx->state_lock, NULL);
+    (void) pthread_cond_init(&ctx->state_cond, NULL);
+    ctx->initialized = 0;
+    ctx->reader_created = 0;
+    ctx->region = params->region;
+    ctx->readPowerDbm = params->write_power_cdbm;
+
+    ret = DwellInit_(&ctx->dwell, &params->dwell);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    ret = Gen2Reset_(&ctx->gen2, &params->gen2);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    ret = PowerInit_(&ctx->power, params);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    ret = RfidSelectInit_(&ctx->select, params->select_filters, params->select_count, params->select_combine);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    ret = PlanListInit_(&ctx->plans, params->plans, params->plan_count);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    ret = EmbeddedInit_(&ctx->embedded, &params->embedded_read);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    LinkInit_(&ctx->link, &params->baud);
+    CounterInit_(&ctx->counter);
+
+    // ------------------------------
+    // Reader 생성/연결 및 설정
+    // ------------------------------
+    ret = CreateReader_(ctx, params->uri, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // Reader 연결
+    ret = ConnectReader_(ctx, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // baud 협상(이후 설정 명령부터 높은 baud 사용)
+    ret = LinkAttach_(ctx, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // Region 설정
+    ret = ConfigureRegion_(&ctx->reader, params->region, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // Read Plan 설정
+    ret = RfidConfigureReadPlan_(ctx
+                             , params->antennas
+                             , params->antenna_count
+                             , params->plan_timeout_ms
+                             , out_status
+                             , out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // 쓰기 전력 설정
+    ret = ConfigureWritePower_(&ctx->reader, params->write_power_cdbm, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // 안테나별 read power 설정
+    if (0 != ctx->power.enabled) {
+        const TMR_Status st_power = PowerApply_(&ctx->reader, &ctx->power);
+        SetOutStatusAndErr_(out_status, out_errstr, st_power);
+        if (TMR_SUCCESS != st_power) {
+            DestroyReader_(ctx, NULL, NULL);
+            FreeCtx_(ctx);
+            return RFID_RESULT_INTERNAL_ERROR;
+        }
+    }
+
+    // Gen2 파라미터 설정
+    ret = ConfigureGen2_(ctx, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // 태그 응답 metadata 설정(요청한 필드만 받아 응답 프레임당 태그 수를 늘린다)
+    ret = ConfigureMetadata_(ctx, params->tag_metadata, out_status, out_errstr);
+    if (RFID_RESULT_OK != ret) {
+        DestroyReader_(ctx, NULL, NULL);
+        FreeCtx_(ctx);
+        return ret;
+    }
+
+    // ------------------------------
+    // 초기화 완료
+    // ------------------------------
+    ctx->initialized = 1;
+    *out_ctx = ctx;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief RFID 컨텍스트를 해제한다.
+ *
+ * @param[in,out] inout_ctx 해제할 컨텍스트 포인터 주소
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 잘못된 인자
+ *
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ */
+RFID_RESULT rfid_deinit(INOUT_ rfid_ctx_t **inout_ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == inout_ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (NULL == *inout_ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+        return RFID_RESULT_OK;
+    }
+
+    rfid_ctx_t *ctx = *inout_ctx;
+
+    if (ctx->initialized) {
+        RfidTrigShutdown_(ctx);
+        (void) RfidAutoShutdown_(ctx);
+        const TMR_Status st = TMR_destroy(&ctx->reader);
+        SetOutStatusAndErr_(out_status, out_errstr, st);
+    }
+
+    FreeCtx_(ctx);
+    *inout_ctx = NULL;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief Write Power(centi-dBm)를 변경한다. (wrapper)
+ *
+ * - ConfigureWritePower_() 내부 구현을 직접 노출하지 않고, 인자 검증/전처리를 포함한 API를 제공한다.
+ * - read_power_cdbm <= 0 이면 "기본값 사용"으로 간주하며, 장치 파라미터를 변경하지 않고 성공을 반환한다.
+ * - ctx가 NULL이거나 초기화되지 않은 경우, RFID_RESULT_INVALID_ARG / RFID_RESULT_NOT_INITIALIZED 를 반환한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  read_power_cdbm 읽기 전력(centi-dBm). 예: 3000 == 30.00 dBm
+ * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_write_power(IN_ rfid_ctx_t *ctx
+                               , IN_ const int read_power_cdbm
+                               , OUT_ uint32_t *out_status
+                               , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == ctx) {
+        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
+        if (NULL != out_errstr) *out_errstr = "RFID_INVALID_ARG(ctx)";
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (!ctx->initialized) {
+        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
+        if (NULL != out_errstr) *out_errstr = "RFID_NOT_INITIALIZED";
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
+        if (NULL != out_errstr) *out_errstr = (NULL != ctx->trigger) ? "RFID_TRIGGER_ACTIVE" : "RFID_AUTONOMOUS_ACTIVE";
+        return RFID_RESULT_BUSY;
+    }
+
+    /* "기본값 사용" 요청: 장치 파라미터를 건드리지 않음 */
+    if (read_power_cdbm <= 0) {
+        ctx->readPowerDbm = 0;
+        return RFID_RESULT_OK;
+    }
+
+    /* 방어적 범위 체크(centi-dBm). 대부분 리더는 0~3000(=30dBm) 범위를 사용한다. */
+    if (read_power_cdbm > 3000) {
+        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
+        if (NULL != out_errstr) *out_errstr = "RFID_INVALID_ARG(read_power_cdbm out of range)";
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    const RFID_RESULT ret = ConfigureWritePower_(&ctx->reader, read_power_cdbm, out_status, out_errstr);
+    if (RFID_RESULT_OK == ret) {
+        ctx->readPowerDbm = read_power_cdbm;
+    }
+    return ret;
+}
+
+
+/**
+ * @brief Reader에서 태그를 읽어 out_tags에 저장한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  read_timeout_ms 읽기 타임아웃(ms), 0 이상
+ * @param[out] out_tags 태그 결과 버퍼
+ * @param[in]  tag_capacity out_tags 용량(개수)
+ * @param[out] out_count 읽힌 태그 개수
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공(태그 0개 포함),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_READ_FAIL: 읽기 실패
+ *
+ * @note out_errstr는 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ * @note SDK 외부 오류(인자 오류 등)는 out_status=-1로 설정될 수 있다.
+ */
+RFID_RESULT rfid_read(IN_ rfid_ctx_t *ctx
+                      , IN_ const int *antennas
+                      , IN_ const int antenna_count
+                      , IN_ const int read_timeout_ms
+                      , OUT_ rfid_tag_t *out_tags
+                      , IN_ const int tag_capacity
+                      , OUT_ int *out_count
+                      , OUT_ uint32_t *out_status
+                      , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if ((NULL == ctx) || (NULL == out_tags) || (NULL == out_count)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    if ((tag_capacity <= 0) || (read_timeout_ms < 0)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    return RfidReadCycle_(ctx, antennas, antenna_count, read_timeout_ms, out_tags, tag_capacity, out_count, out_status, out_errstr);
+}
+
+/**
+ * @brief 리더 측 Gen2 Select 필터를 교체한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  filters 필터 배열
+ * @param[in]  filter_count 필터 개수
+ * @param[in]  combine 결합 방식
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_select_filters(IN_ rfid_ctx_t *ctx
+                                    , IN_ const rfid_select_filter_t *filters
+                                    , IN_ const int filter_count
+                                    , IN_ const RFID_SELECT_COMBINE combine
+                                    , OUT_ uint32_t *out_status
+                                    , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    // 한 번 미지원으로 감지된 모듈은 다시 시도하지 않는다.
+    const int multi_supported = ctx->select.multi_supported;
+    const RFID_RESULT ret = RfidSelectInit_(&ctx->select, filters, filter_count, combine);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return ret;
+    }
+    ctx->select.multi_supported = multi_supported;
+    ctx->plans.dirty = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief embedded read(inventory 중 태그별 메모리 읽기) 설정을 교체한다.
+ *
+ * - 다음 rfid_read()부터 read plan 에 ReadData tagop 을 붙이거나 뗀다.
+ * - tag_metadata 로 응답 필드를 줄여 둔 경우 data 필드 요청을 함께 켜거나 끈다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  read 설정(NULL 또는 enable 0이면 해제)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_INTERNAL_ERROR: metadata 파라미터 적용 실패
+ */
+RFID_RESULT rfid_set_embedded_read(IN_ rfid_ctx_t *ctx
+                                   , IN_ const rfid_embedded_read_t *read
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    rfid_embedded_t emb;
+    const RFID_RESULT ret = EmbeddedInit_(&emb, read);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return ret;
+    }
+
+    // SDK 기본값(전체 metadata)을 쓰는 경우 data 필드는 이미 포함되어 있다.
+    if (TMR_TRD_METADATA_FLAG_NONE != ctx->meta_flags) {
+        TMR_TRD_MetadataFlag value = (0 != emb.enabled)
+                                         ? (TMR_TRD_MetadataFlag) (ctx->meta_flags | TMR_TRD_METADATA_FLAG_DATA)
+                                         : (TMR_TRD_MetadataFlag) (ctx->meta_flags & ~TMR_TRD_METADATA_FLAG_DATA);
+        if (value != ctx->meta_flags) {
+            const TMR_Status st = TMR_paramSet(&ctx->reader, TMR_PARAM_METADATAFLAG, &value);
+            SetOutStatusAndErr_(out_status, out_errstr, st);
+            if (TMR_SUCCESS != st)
+                return RFID_RESULT_INTERNAL_ERROR;
+            ctx->meta_flags = value;
+        }
+    }
+
+    ctx->embedded = emb;
+    ctx->plans.dirty = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 적응형 dwell 스케줄러의 안테나별 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stats 결과 배열
+ * @param[in]  stat_capacity out_stats 용량(개수)
+ * @param[out] out_count 채워진 개수
+ *
+ * @return RFID_RESULT_OK: 성공(비활성이면 0개),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_get_dwell_stats(IN_ const rfid_ctx_t *ctx
+                                 , OUT_ rfid_dwell_stat_t *out_stats
+                                 , IN_ const int stat_capacity
+                                 , OUT_ int *out_count) {
+    if ((NULL == ctx) || (NULL == out_stats) || (stat_capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+
+    *out_count = 0;
+    if (0 == ctx->dwell.enabled)
+        return RFID_RESULT_OK;
+
+    StateLock_(ctx);
+    uint32_t total = 0;
+    for (int i = 0; i < ctx->dwell.ant_count; ++i)
+        total += ctx->dwell.ants[i].weight;
+    if (0U == total)
+        total = 1U;
+
+    for (int i = 0; (i < ctx->dwell.ant_count) && (*out_count < stat_capacity); ++i) {
+        const rfid_dwell_antenna_t *a = &ctx->dwell.ants[i];
+        rfid_dwell_stat_t *dst = &out_stats[*out_count];
+        dst->antenna = a->antenna;
+        dst->share_permille = (int) (((uint64_t) a->weight * RFID_DWELL_WEIGHT_SCALE) / total);
+        dst->new_tags = a->last_new;
+        dst->dwell_ms = a->last_ms;
+        dst->yield_per_sec = a->yield_ema;
+        (*out_count)++;
+    }
+    StateUnlock_(ctx);
+
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 안테나 1개의 read power를 변경한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  antenna 안테나 번호
+ * @param[in]  power_cdbm read power(cdBm)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_INTERNAL_ERROR: 적용 실패
+ */
+RFID_RESULT rfid_set_antenna_power(IN_ rfid_ctx_t *ctx
+                                   , IN_ const int antenna
+                                   , IN_ const int power_cdbm
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if ((NULL == ctx) || (antenna <= 0) || (antenna > 255) || (power_cdbm <= 0)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    rfid_power_t *pw = &ctx->power;
+    rfid_power_antenna_t *a = PowerAntenna_(pw, antenna);
+    if (NULL == a) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    a->power_cdbm = (RFID_POWER_CTRL_OFF != pw->mode)
+                        ? ClampInt_(power_cdbm, pw->min_cdbm, pw->max_cdbm)
+                        : power_cdbm;
+    a->step_cdbm = (pw->step_cdbm > 0) ? pw->step_cdbm : RFID_POWER_DEFAULT_STEP_CDBM;
+    a->last_step_cdbm = 0;
+    pw->enabled = 1;
+
+    const TMR_Status st = PowerApply_(&ctx->reader, pw);
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    return (TMR_SUCCESS == st) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+}
+
+/**
+ * @brief 안테나별 read power 제어 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stats 결과 배열
+ * @param[in]  stat_capacity out_stats 용량(개수)
+ * @param[out] out_count 채워진 개수
+ *
+ * @return RFID_RESULT_OK: 성공(안테나별 전력 미사용이면 0개),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_get_power_stats(IN_ const rfid_ctx_t *ctx
+                                 , OUT_ rfid_power_stat_t *out_stats
+                                 , IN_ const int stat_capacity
+                                 , OUT_ int *out_count) {
+    if ((NULL == ctx) || (NULL == out_stats) || (stat_capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+
+    *out_count = 0;
+    const rfid_power_t *pw = &ctx->power;
+
+    // trigger 스레드의 read 사이클이 안테나 목록을 늘리므로 enabled/ant_count 도 잠금 안에서 읽는다.
+    StateLock_(ctx);
+    if (0 == pw->enabled) {
+        StateUnlock_(ctx);
+        return RFID_RESULT_OK;
+    }
+    const int n = (pw->ant_count < stat_capacity) ? pw->ant_count : stat_capacity;
+    for (int i = 0; i < n; ++i) {
+        const rfid_power_antenna_t *a = &pw->ants[i];
+        rfid_power_stat_t *dst = &out_stats[i];
+        memset(dst, 0, sizeof(*dst));
+        dst->antenna = a->antenna;
+        dst->power_cdbm = a->power_cdbm;
+        dst->reads_per_sec = a->rate_ema;
+        dst->rssi_avg = a->rssi_ema;
+        dst->foreign_reads = a->foreign_total;
+        dst->adjustments = a->adjustments;
+        dst->last_step_cdbm = a->last_step_cdbm;
+    }
+    StateUnlock_(ctx);
+    *out_count = n;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief Gen2 튜닝 모드를 변경한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  params 튜닝 설정
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_INTERNAL_ERROR: MANUAL 값 적용 실패
+ */
+RFID_RESULT rfid_set_gen2_tuning(IN_ rfid_ctx_t *ctx
+                                 , IN_ const rfid_gen2_tune_params_t *params
+                                 , OUT_ uint32_t *out_status
+                                 , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if ((NULL == ctx) || (NULL == params)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
     }
 
-    /* 방어적 범위 체크(centi-dBm). 대부분 리더는 0~3000(=30dBm) 범위를 사용한다. */
-    if (read_power_cdbm > 3000) {
-        if (NULL != out_status) *out_status = (uint32_t) TMR_ERROR_INVALID;
-        if (NULL != out_errstr) *out_errstr = "RFID_INVALID_ARG(read_power_cdbm out of range)";
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    const RFID_RESULT ret = Gen2Reset_(&ctx->gen2, params);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return ret;
+    }
+
+    if (RFID_GEN2_TUNE_MANUAL == params->mode) {
+        const TMR_Status st = Gen2Commit_(ctx, &params->manual);
+        SetOutStatusAndErr_(out_status, out_errstr, st);
+        if (TMR_SUCCESS != st)
+            return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 현재 Gen2 튜닝 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_gen2 결과
+ *
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_get_gen2_status(IN_ const rfid_ctx_t *ctx, OUT_ rfid_gen2_status_t *out_gen2) {
+    if ((NULL == ctx) || (NULL == out_gen2))
+        return RFID_RESULT_INVALID_ARG;
+
+    const rfid_gen2_tuner_t *t = &ctx->gen2;
+    memset(out_gen2, 0, sizeof(*out_gen2));
+    StateLock_(ctx);
+    out_gen2->mode = t->mode;
+    out_gen2->settings = t->current;
+    out_gen2->population_estimate = t->population;
+    out_gen2->tags_per_sec = t->tags_per_sec;
+    out_gen2->last_apply_status = t->last_apply_status;
+    StateUnlock_(ctx);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 호스트 측 EPC 규칙 보관소를 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] matcher 규칙 보관소(NULL이면 연결 해제)
+ * @param[in] drop_unmatched 1이면 불일치 태그 제외
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_epc_matcher(IN_ rfid_ctx_t *ctx, IN_ rfid_epc_matcher_t *matcher, IN_ const int drop_unmatched) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->matcher = matcher;
+    ctx->matcher_drop = (0 != drop_unmatched) ? 1 : 0;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과를 기록할 태그 로그를 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] log 태그 로그(NULL이면 연결 해제)
+ * @param[in] reader_id 레코드에 기록할 리더 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_tag_log(IN_ rfid_ctx_t *ctx, IN_ rfid_tag_log_t *log, IN_ const uint16_t reader_id) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->tag_log = log;
+    ctx->tag_log_reader_id = reader_id;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과를 발행할 공유 메모리 태그 버스를 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] bus 태그 버스(NULL이면 연결 해제)
+ * @param[in] reader_id 레코드에 기록할 리더 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_tag_bus(IN_ rfid_ctx_t *ctx, IN_ rfid_tag_bus_t *bus, IN_ const uint16_t reader_id) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->tag_bus = bus;
+    ctx->tag_bus_reader_id = reader_id;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과를 넣을 리더 간 병합 단계를 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] merge 병합 단계(NULL이면 연결 해제)
+ * @param[in] reader_id 병합 단계에 넘길 리더 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_merge(IN_ rfid_ctx_t *ctx, IN_ rfid_merge_t *merge, IN_ const uint16_t reader_id) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->merge = merge;
+    ctx->merge_reader_id = reader_id;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과 태그에 epc_id 를 채울 EPC intern 테이블을 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] intern intern 테이블(NULL이면 연결 해제)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_epc_intern(IN_ rfid_ctx_t *ctx, IN_ rfid_epc_intern_t *intern) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->intern = intern;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과를 넘길 태그 후처리 풀을 연결한다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] pool 후처리 풀(NULL이면 연결 해제)
+ * @param[in] reader_id 후처리 풀에 넘길 리더 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_pool(IN_ rfid_ctx_t *ctx, IN_ rfid_pool_t *pool, IN_ const uint16_t reader_id) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+
+    ctx->pool = pool;
+    ctx->pool_reader_id = reader_id;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 시리얼 링크 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_get_link_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_link_stat_t *out_stat) {
+    if ((NULL == ctx) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    memset(out_stat, 0, sizeof(*out_stat));
+    const rfid_link_t *link = &ctx->link;
+    if (0 == link->tracked)
+        return RFID_RESULT_OK;
+
+    StateLock_(ctx);
+    out_stat->baud_rate = ctx->reader.u.serialReader.baudRate;
+    out_stat->connect_rate = link->connect_rate;
+    out_stat->verified_max_rate = link->verified_max;
+    out_stat->probe_rtt_us = link->probe_rtt_us;
+    out_stat->tx_bytes = link->tx_bytes;
+    out_stat->rx_bytes = link->rx_bytes;
+    out_stat->bytes_per_sec = link->bytes_per_sec;
+    if (out_stat->baud_rate > 0U)
+        out_stat->utilization_pct = (link->bytes_per_sec * RFID_LINK_BITS_PER_BYTE * 100.0) / (double) out_stat->baud_rate;
+    out_stat->comm_errors = link->comm_errors;
+    out_stat->fallbacks = link->fallbacks;
+    StateUnlock_(ctx);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 리더 상태 카운터 스냅샷을 얻는다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_counters 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_get_counters(IN_ const rfid_ctx_t *ctx, OUT_ rfid_counters_t *out_counters) {
+    if ((NULL == ctx) || (NULL == out_counters))
         return RFID_RESULT_INVALID_ARG;
+
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    memset(out_counters, 0, sizeof(*out_counters));
+    const rfid_counter_t *c = &ctx->counter;
+    out_counters->uptime_ms = (LinkNowUs_() - c->start_us) / 1000U;
+    out_counters->tx_frames = __atomic_load_n(&c->tx_frames, __ATOMIC_RELAXED);
+    out_counters->tx_bytes = __atomic_load_n(&ctx->link.tx_bytes, __ATOMIC_RELAXED);
+    out_counters->rx_frames = __atomic_load_n(&c->rx_frames, __ATOMIC_RELAXED);
+    out_counters->rx_bytes = __atomic_load_n(&ctx->link.rx_bytes, __ATOMIC_RELAXED);
+    out_counters->crc_errors = __atomic_load_n(&c->crc_errors, __ATOMIC_RELAXED);
+    out_counters->soh_resyncs = __atomic_load_n(&c->soh_resyncs, __ATOMIC_RELAXED);
+    out_counters->discarded_bytes = __atomic_load_n(&c->discarded_bytes, __ATOMIC_RELAXED);
+    out_counters->timeouts = __atomic_load_n(&c->timeouts, __ATOMIC_RELAXED);
+    out_counters->read_cycles = __atomic_load_n(&c->read_cycles, __ATOMIC_RELAXED);
+    out_counters->read_errors = __atomic_load_n(&c->read_errors, __ATOMIC_RELAXED);
+    out_counters->buffer_overflows = __atomic_load_n(&c->buffer_overflows, __ATOMIC_RELAXED);
+    out_counters->overflow_tags = __atomic_load_n(&c->overflow_tags, __ATOMIC_RELAXED);
+    out_counters->queue_depth = __atomic_load_n(&c->queue_depth, __ATOMIC_RELAXED);
+    out_counters->queue_peak = __atomic_load_n(&c->queue_peak, __ATOMIC_RELAXED);
+
+    for (int a = 0; a <= RFID_ANTENNA_MAX; ++a) {
+        const rfid_counter_antenna_t *ca = &c->ants[a];
+        const uint64_t unique = __atomic_load_n(&ca->unique_tags, __ATOMIC_RELAXED);
+        if (0U == unique)
+            continue;
+        rfid_antenna_counters_t *dst = &out_counters->antennas[out_counters->antenna_count++];
+        dst->antenna = a;
+        dst->reads = __atomic_load_n(&ca->reads, __ATOMIC_RELAXED);
+        dst->unique_tags = unique;
+        __atomic_load(&ca->reads_per_sec, &dst->reads_per_sec, __ATOMIC_RELAXED);
+        __atomic_load(&ca->unique_per_sec, &dst->unique_per_sec, __ATOMIC_RELAXED);
     }
+    return RFID_RESULT_OK;
+}
 
-    const RFID_RESULT ret = ConfigureWritePower_(&ctx->reader, read_power_cdbm, out_status, out_errstr);
-    if (RFID_RESULT_OK == ret) {
-        ctx->readPowerDbm = read_power_cdbm;
+/**
+ * @brief 출력 버퍼에 서식 문자열을 덧붙인다. 버퍼가 모자라도 필요한 길이는 계속 센다.
+ *
+ * @param[out] buf 출력 버퍼(NULL 허용)
+ * @param[in] size buf 크기
+ * @param[in,out] pos 지금까지의 전체 출력 길이
+ * @param[in] fmt 서식 문자열
+ */
+static void CounterAppend_(OUT_ char *buf, IN_ const size_t size, INOUT_ size_t *pos, IN_ const char *fmt, ...) {
+    char *dst = ((NULL != buf) && (*pos < size)) ? (buf + *pos) : NULL;
+    const size_t left = (NULL != dst) ? (size - *pos) : 0U;
+
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vsnprintf(dst, left, fmt, ap);
+    va_end(ap);
+    if (n > 0)
+        *pos += (size_t) n;
+}
+
+/**
+ * @brief 카운터 지표 1개(HELP/TYPE/값)를 덧붙인다.
+ */
+static void CounterAppendMetric_(OUT_ char *buf
+                                 , IN_ const size_t size
+                                 , INOUT_ size_t *pos
+                                 , IN_ const char *name
+                                 , IN_ const char *type
+                                 , IN_ const char *help
+                                 , IN_ const char *labels
+                                 , IN_ const uint64_t value) {
+    CounterAppend_(buf, size, pos, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    CounterAppend_(buf, size, pos, "%s%s %llu\n", name, labels, (unsigned long long) value);
+}
+
+/**
+ * @brief 카운터 스냅샷을 Prometheus text exposition 형식으로 만든다.
+ *
+ * @param[in]  counters 카운터 스냅샷
+ * @param[in]  reader_label reader 라벨 값(NULL/빈 문자열이면 생략)
+ * @param[out] buf 출력 버퍼
+ * @param[in]  buf_size buf 크기
+ *
+ * @return NUL 을 뺀 전체 출력 길이, 인자 오류 시 -1
+ */
+int rfid_format_counters(IN_ const rfid_counters_t *counters
+                         , IN_ const char *reader_label
+                         , OUT_ char *buf
+                         , IN_ const size_t buf_size) {
+    if ((NULL == counters) || ((NULL == buf) && (0U != buf_size)))
+        return -1;
+
+    // 라벨 값의 \, ", 줄바꿈은 exposition 형식에 맞게 escape 한다(길면 자름).
+    char reader[128];
+    size_t rn = 0;
+    if (NULL != reader_label) {
+        for (const char *p = reader_label; ('\0' != *p) && (rn + 2U < sizeof(reader)); ++p) {
+            if (('\\' == *p) || ('"' == *p)) {
+                reader[rn++] = '\\';
+                reader[rn++] = *p;
+            }
+            else if ('\n' == *p) {
+                reader[rn++] = '\\';
+                reader[rn++] = 'n';
+            }
+            else {
+                reader[rn++] = *p;
+            }
+        }
     }
-    return ret;
+    reader[rn] = '\0';
+
+    char labels[160];
+    if (0U != rn)
+        (void) snprintf(labels, sizeof(labels), "{reader=\"%s\"}", reader);
+    else
+        labels[0] = '\0';
+
+    const struct {
+        const char *name;
+        const char *help;
+        uint64_t value;
+    } totals[] = {
+        {"rfid_tx_frames_total", "Frames sent to the reader module.", counters->tx_frames},
+        {"rfid_tx_bytes_total", "Bytes sent to the reader module.", counters->tx_bytes},
+        {"rfid_rx_frames_total", "Frames received from the reader module.", counters->rx_frames},
+        {"rfid_rx_bytes_total", "Bytes received from the reader module.", counters->rx_bytes},
+        {"rfid_crc_errors_total", "Received frames with a CRC mismatch.", counters->crc_errors},
+        {"rfid_soh_resyncs_total", "Times the receiver skipped noise to find the next start-of-header.", counters->soh_resyncs},
+        {"rfid_discarded_bytes_total", "Bytes skipped while searching for a start-of-header.", counters->discarded_bytes},
+        {"rfid_timeouts_total", "Transport receive timeouts.", counters->timeouts},
+        {"rfid_read_cycles_total", "Read cycles.", counters->read_cycles},
+        {"rfid_read_errors_total", "Read cycles that failed in the module.", counters->read_errors},
+        {"rfid_buffer_overflows_total", "Module tag buffer overflows.", counters->buffer_overflows},
+        {"rfid_overflow_tags_total", "Tags dropped because the result buffer was full.", counters->overflow_tags},
+    };
+
+    size_t pos = 0;
+    if (buf_size > 0U)
+        buf[0] = '\0';
+
+    for (size_t i = 0; i < sizeof(totals) / sizeof(totals[0]); ++i)
+        CounterAppendMetric_(buf, buf_size, &pos, totals[i].name, "counter", totals[i].help, labels, totals[i].value);
+    CounterAppendMetric_(buf, buf_size, &pos, "rfid_uptime_seconds", "gauge", "Seconds since the reader was initialized."
+                         , labels, counters->uptime_ms / 1000U);
+    CounterAppendMetric_(buf, buf_size, &pos, "rfid_queue_depth", "gauge", "Tags buffered in the module in the last read cycle."
+                         , labels, counters->queue_depth);
+    CounterAppendMetric_(buf, buf_size, &pos, "rfid_queue_peak", "gauge", "Highest module tag buffer depth seen."
+                         , labels, counters->queue_peak);
+
+    const int ants = (counters->antenna_count > RFID_ANTENNA_MAX + 1) ? (RFID_ANTENNA_MAX + 1) : counters->antenna_count;
+    const char *prefix = (0U != rn) ? "reader=\"" : "";
+    const char *suffix = (0U != rn) ? "\"," : "";
+    const struct {
+        const char *name;
+        const char *type;
+        const char *help;
+    } ant_metrics[] = {
+        {"rfid_antenna_reads_total", "counter", "Tag reads per antenna."},
+        {"rfid_antenna_unique_tags_total", "counter", "Unique tags per read cycle, summed per antenna."},
+        {"rfid_antenna_reads_per_second", "gauge", "Smoothed tag reads per second per antenna."},
+        {"rfid_antenna_unique_tags_per_second", "gauge", "Smoothed unique tags per second per antenna."},
+    };
+    for (size_t m = 0; (ants > 0) && (m < sizeof(ant_metrics) / sizeof(ant_metrics[0])); ++m) {
+        CounterAppend_(buf, buf_size, &pos, "# HELP %s %s\n# TYPE %s %s\n"
+                       , ant_metrics[m].name, ant_metrics[m].help, ant_metrics[m].name, ant_metrics[m].type);
+        for (int i = 0; i < ants; ++i) {
+            const rfid_antenna_counters_t *a = &counters->antennas[i];
+            CounterAppend_(buf, buf_size, &pos, "%s{%s%s%santenna=\"%d\"} ", ant_metrics[m].name, prefix, reader, suffix, a->antenna);
+            switch (m) {
+                case 0:
+                    CounterAppend_(buf, buf_size, &pos, "%llu\n", (unsigned long long) a->reads);
+                    break;
+                case 1:
+                    CounterAppend_(buf, buf_size, &pos, "%llu\n", (unsigned long long) a->unique_tags);
+                    break;
+                case 2:
+                    CounterAppend_(buf, buf_size, &pos, "%.3f\n", a->reads_per_sec);
+                    break;
+                default:
+                    CounterAppend_(buf, buf_size, &pos, "%.3f\n", a->unique_per_sec);
+                    break;
+            }
+        }
+    }
+
+    return (pos > (size_t) INT_MAX) ? INT_MAX : (int) pos;
 }
 
+/**
+ * @brief 가중치 read plan 항목별 누적 태그 수와 발견율을 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stats 결과 배열
+ * @param[in]  stat_capacity out_stats 용량(개수)
+ * @param[out] out_count 채워진 개수
+ *
+ * @return RFID_RESULT_OK: 성공(목록 미사용이면 0개),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_get_plan_stats(IN_ const rfid_ctx_t *ctx
+                                , OUT_ rfid_plan_stat_t *out_stats
+                                , IN_ const int stat_capacity
+                                , OUT_ int *out_count) {
+    if ((NULL == ctx) || (NULL == out_stats) || (stat_capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+
+    *out_count = 0;
+    const rfid_plan_list_t *list = &ctx->plans;
+    StateLock_(ctx);
+    uint32_t total = 0;
+    for (int p = 0; p < list->count; ++p)
+        total += list->weight[p];
+    if (0U == total) {
+        StateUnlock_(ctx);
+        return RFID_RESULT_OK;
+    }
+
+    for (int p = 0; (p < list->count) && (*out_count < stat_capacity); ++p) {
+        rfid_plan_stat_t *dst = &out_stats[*out_count];
+        dst->weight = (int) list->weight[p];
+        dst->share_permille = (int) (((uint64_t) list->weight[p] * 1000U) / total);
+        dst->tags = list->tags[p];
+        dst->airtime_ms = list->airtime_ms[p];
+        dst->yield_per_sec = (list->airtime_ms[p] > 0U)
+                                 ? ((double) list->tags[p] * 1000.0) / (double) list->airtime_ms[p]
+                                 : 0.0;
+        (*out_count)++;
+    }
+    StateUnlock_(ctx);
+    return RFID_RESULT_OK;
+}
 
 /**
- * @brief Reader에서 태그를 읽어 out_tags에 저장한다.
+ * @brief 가중치 read plan 항목의 가중치를 바꾼다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ * @param[in] weights 항목별 가중치(> 0)
+ * @param[in] weight_count weights 개수(init 때 plan_count 와 같아야 함)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류/목록 미사용,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_set_plan_weights(IN_ rfid_ctx_t *ctx, IN_ const int *weights, IN_ const int weight_count) {
+    if ((NULL == ctx) || (NULL == weights))
+        return RFID_RESULT_INVALID_ARG;
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+    if (0 != AutoActive_(ctx))
+        return RFID_RESULT_BUSY;
+    if ((0 == ctx->plans.count) || (weight_count != ctx->plans.count))
+        return RFID_RESULT_INVALID_ARG;
+
+    for (int p = 0; p < weight_count; ++p) {
+        if (weights[p] <= 0)
+            return RFID_RESULT_INVALID_ARG;
+    }
+    for (int p = 0; p < weight_count; ++p)
+        ctx->plans.weight[p] = (uint32_t) weights[p];
+    ctx->plans.dirty = 1;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 조건(고유 태그 N개 또는 기대 EPC 전부)을 충족하는 즉시 종료하는 read.
+ *
+ * - 매 read 사이클마다 stop trigger 를 "남은 필요 태그 수"로 설정한다.
+ *   (고유 태그 N개: N - 발견 수, 기대 EPC: 아직 못 찾은 수, 둘 다면 작은 값)
+ * - 모듈이 조건과 무관한 태그로 멈추면 남은 시간으로 다시 read 하고 결과를 EPC 기준으로 합친다.
  *
  * @param[in]  ctx RFID 컨텍스트
- * @param[in]  read_timeout_ms 읽기 타임아웃(ms), 0 이상
+ * @param[in]  antennas 안테나 번호 배열
+ * @param[in]  antenna_count 안테나 개수
+ * @param[in]  read_timeout_ms 최대 대기 시간(ms), 0 이상
+ * @param[in]  cond 종료 조건
  * @param[out] out_tags 태그 결과 버퍼
  * @param[in]  tag_capacity out_tags 용량(개수)
- * @param[out] out_count 읽힌 태그 개수
+ * @param[out] out_count 읽힌 고유 태그 개수
+ * @param[out] out_report 종료 사유/지연 시간 보고(NULL 허용)
  * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
  * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
  *
- * @return RFID_RESULT_OK: 성공(태그 0개 포함),
+ * @return RFID_RESULT_OK: 성공(조건 미충족 시에도 OK, 사유는 out_report),
  *         RFID_RESULT_INVALID_ARG: 인자 오류,
  *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
- *         RFID_RESULT_READ_FAIL: 읽기 실패
+ *         RFID_RESULT_READ_FAIL: 읽기 실패(그때까지 합친 태그는 out_tags/out_count 에 남는다),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 부족
  *
- * @note out_errstr는 TMR_ErrorCodeToString()이 반환하는 정적 문자열 주소이다.
  * @note SDK 외부 오류(인자 오류 등)는 out_status=-1로 설정될 수 있다.
  */
-RFID_RESULT rfid_read(IN_ rfid_ctx_t *ctx
-                      , IN_ const int *antennas
-                      , IN_ const int antenna_count
-                      , IN_ const int read_timeout_ms
-                      , OUT_ rfid_tag_t *out_tags
-                      , IN_ const int tag_capacity
-                      , OUT_ int *out_count
-                      , OUT_ uint32_t *out_status
-                      , OUT_ const char **out_errstr) {
+RFID_RESULT rfid_read_until(IN_ rfid_ctx_t *ctx
+                            , IN_ const int *antennas
+                            , IN_ const int antenna_count
+                            , IN_ const int read_timeout_ms
+                            , IN_ const rfid_early_exit_t *cond
+                            , OUT_ rfid_tag_t *out_tags
+                            , IN_ const int tag_capacity
+                            , OUT_ int *out_count
+                            , OUT_ rfid_early_exit_report_t *out_report
+                            , OUT_ uint32_t *out_status
+                            , OUT_ const char **out_errstr) {
     SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
 
-    if ((NULL == ctx) || (NULL == out_tags) || (NULL == out_count)) {
+    if ((NULL == ctx) || (NULL == cond) || (NULL == out_tags) || (NULL == out_count)) {
         SetOutStatusAndErr_(out_status, out_errstr, -1);
         return RFID_RESULT_INVALID_ARG;
     }
@@ -971,67 +4130,98 @@ RFID_RESULT rfid_read(IN_ rfid_ctx_t *ctx
         return RFID_RESULT_NOT_INITIALIZED;
     }
 
-    if ((tag_capacity <= 0) || (read_timeout_ms < 0)) {
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    if ((tag_capacity <= 0) || (read_timeout_ms < 0) || ((cond->stop_count <= 0) && (cond->expected_count <= 0))
+        || ((cond->expected_count > 0) && (NULL == cond->expected_epcs))) {
         SetOutStatusAndErr_(out_status, out_errstr, -1);
         return RFID_RESULT_INVALID_ARG;
     }
 
     *out_count = 0;
+    if (NULL != out_report)
+        memset(out_report, 0, sizeof(*out_report));
 
-    /* TMR_read() 호출 전 ReadPlan 재설정 */
-    const RFID_RESULT st_plan = ConfigureReadPlan_(&ctx->reader
-                                                   , antennas
-                                                   , antenna_count
-                                                   , read_timeout_ms
-                                                   , out_status
-                                                   , out_errstr);
-    if (RFID_RESULT_OK != st_plan)
-        return RFID_RESULT_READ_FAIL;
-
-    int32_t tag_count_from_reader = 0;
-    const TMR_Status st_read = TMR_read(&ctx->reader, (uint32_t) read_timeout_ms, &tag_count_from_reader);
-    SetOutStatusAndErr_(out_status, out_errstr, st_read);
-    if (TMR_SUCCESS != st_read)
-        return RFID_RESULT_READ_FAIL;
-
-    // hasMoreTags / getNextTag 로 결과를 가져온다.
-    while (TMR_SUCCESS == TMR_hasMoreTags(&ctx->reader)) {
-        if (*out_count >= tag_capacity) {
-            // 버퍼 용량 초과: 이후 태그는 무시 (정책: OK 반환, count는 capacity로 제한)
-            TMR_TagReadData dummy;
-            (void) TMR_getNextTag(&ctx->reader, &dummy);
-            continue;
+    rfid_expected_epc_t *expected = NULL;
+    RFID_RESULT ret = EarlyExitLoadExpected_(cond, &expected);
+    if (RFID_RESULT_OK != ret) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return ret;
+    }
+    const int expected_count = (cond->expected_count > 0) ? cond->expected_count : 0;
+
+    const uint64_t t0 = LinkNowUs_();
+    const uint64_t deadline = t0 + ((uint64_t) read_timeout_ms * 1000U);
+    RFID_EARLY_EXIT_REASON reason = RFID_EARLY_EXIT_TIMEOUT;
+    uint32_t reads = 0;
+    int count = 0;
+    int found = 0;
+
+    for (;;) {
+        // 첫 사이클은 전체 timeout, 이후는 남은 시간만 사용한다.
+        int cycle_ms = read_timeout_ms;
+        if (reads > 0U) {
+            const uint64_t now = LinkNowUs_();
+            if (now >= deadline)
+                break;
+            cycle_ms = (int) ((deadline - now) / 1000U);
+            if (cycle_ms <= 0)
+                break;
         }
 
-        TMR_TagReadData trd;
-        memset(&trd, 0, sizeof(trd));
-
-        const TMR_Status st_next = TMR_getNextTag(&ctx->reader, &trd);
-        SetOutStatusAndErr_(out_status, out_errstr, st_next);
-        if (TMR_SUCCESS != st_next)
-            return RFID_RESULT_READ_FAIL;
-
-        rfid_tag_t *dst = &out_tags[*out_count];
-        memset(dst, 0, sizeof(*dst));
-
-        // EPC bytes -> hex string
-        const uint32_t max_bytes = (uint32_t) ((RFID_EPC_MAX_LEN - 1) / 2);
-        const uint32_t use_bytes = (trd.tag.epcByteCount > max_bytes) ? max_bytes : trd.tag.epcByteCount;
-
-        // TMR_bytesToHex는 null-terminated 문자열을 만들어 준다.
-        TMR_bytesToHex(trd.tag.epc, use_bytes, dst->epc);
-
-        dst->rssi = (int) trd.rssi;
-        dst->readcnt = (uint32_t) trd.readCount;
-        dst->antenna = (int) trd.antenna;
-        dst->ts = CombineTimestampMs_(trd.timestampLow, trd.timestampHigh);
-
-        (*out_count)++;
+        uint32_t need = UINT32_MAX;
+        if (cond->stop_count > 0)
+            need = (uint32_t) (cond->stop_count - count);
+        if ((expected_count > 0) && ((uint32_t) (expected_count - found) < need))
+            need = (uint32_t) (expected_count - found);
+
+        ctx->stop_count = need;
+        ctx->fast_search = (0 != cond->fast_search) ? 1 : 0;
+        int got = 0;
+        ret = rfid_read(ctx
+                        , antennas
+                        , antenna_count
+                        , cycle_ms
+                        , &out_tags[count]
+                        , tag_capacity - count
+                        , &got
+                        , out_status
+                        , out_errstr);
+        ctx->stop_count = 0U;
+        ctx->fast_search = 0;
+        reads++;
+        if (RFID_RESULT_OK != ret)
+            break;
+
+        count = EarlyExitMerge_(out_tags, count, got, expected, expected_count, &found);
+        if ((cond->stop_count > 0) && (count >= cond->stop_count)) {
+            reason = RFID_EARLY_EXIT_COUNT;
+            break;
+        }
+        if ((expected_count > 0) && (found >= expected_count)) {
+            reason = RFID_EARLY_EXIT_EXPECTED;
+            break;
+        }
+        if (count >= tag_capacity) {
+            reason = RFID_EARLY_EXIT_CAPACITY;
+            break;
+        }
     }
-
-    // 태그가 없으면 out_count=0 이고 OK 반환 (정책)
-    if (*out_count > 1)
-        qsort(out_tags, (size_t) (*out_count), sizeof(rfid_tag_t), CompareTag_);
-
-    return RFID_RESULT_OK;
+    free(expected);
+
+    *out_count = count;
+    if (count > 1)
+        qsort(out_tags, (size_t) count, sizeof(rfid_tag_t), CompareTag_);
+
+    if (NULL != out_report) {
+        out_report->reason = reason;
+        out_report->latency_us = (uint32_t) (LinkNowUs_() - t0);
+        out_report->reads = reads;
+        out_report->unique_tags = count;
+        out_report->expected_found = found;
+    }
+    return ret;
 }
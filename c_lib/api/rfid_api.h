@@ -5,7 +5,15 @@
 extern "C" {
 #endif
 
+#include <stddef.h>  // size_t
+
 #include "rfid_types.h"
+#include "rfid_epc_match.h"
+#include "rfid_tag_log.h"
+#include "rfid_tag_bus.h"
+#include "rfid_merge.h"
+#include "rfid_epc_intern.h"
+#include "rfid_pool.h"
 
 /**
  * @brief RFID 컨텍스트(Reader 핸들 포함). 구현부에서 정의하는 opaque 타입.
@@ -36,7 +44,7 @@ const char* rfid_region_to_string(IN_ const RFID_REGION region);
  * @param[out] out_ctx 생성된 컨텍스트(out). 성공 시 non-NULL.
  * @param[in]  params 초기화 파라미터(in). NULL이면 RFID_RESULT_INVALID_ARG.
  * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
- * @param[out] out_errstr 상태 문자열(out). NULL 허용. TMR_ErrorCodeToString() 반환 문자열.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용. RfidErrorCodeToString_() 반환 문자열.
  *
  * @return RFID_RESULT 결과 코드
  */
@@ -54,7 +62,7 @@ RFID_RESULT rfid_init(OUT_ rfid_ctx_t **out_ctx
  *
  * @param[in,out] inout_ctx 해제할 컨텍스트(in/out)
  * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
- * @param[out] out_errstr 상태 문자열(out). NULL 허용. TMR_ErrorCodeToString() 반환 문자열.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용. RfidErrorCodeToString_() 반환 문자열.
  *
  * @return RFID_RESULT 결과 코드
  */
@@ -82,6 +90,7 @@ RFID_RESULT rfid_set_write_power(IN_ rfid_ctx_t *ctx, IN_ int read_power_cdbm, O
  * - 태그가 없으면 RFID_RESULT_OK 를 반환하며 *out_count = 0 이 된다.
  * - out_tags는 호출자가 제공하는 버퍼이며, tag_capacity 만큼 채울 수 있다.
  * - SDK 외부 오류(인자 오류, 미초기화 등)는 out_status = -1 로 설정된다.
+ * - init 때 가중치 read plan 목록(plans)을 지정했으면 antennas/antenna_count 는 무시한다(NULL 허용).
  *
  * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
  * @param[in]  read_timeout_ms read 타임아웃(ms)
@@ -89,7 +98,7 @@ RFID_RESULT rfid_set_write_power(IN_ rfid_ctx_t *ctx, IN_ int read_power_cdbm, O
  * @param[in]  tag_capacity out_tags의 최대 원소 수(in). 0 이하이면 RFID_RESULT_INVALID_ARG.
  * @param[out] out_count 실제 반환된 태그 개수(out). NULL이면 RFID_RESULT_INVALID_ARG.
  * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
- * @param[out] out_errstr 상태 문자열(out). NULL 허용. TMR_ErrorCodeToString() 반환 문자열.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용. RfidErrorCodeToString_() 반환 문자열.
  *
  * @return RFID_RESULT 결과 코드
  */
@@ -103,6 +112,465 @@ RFID_RESULT rfid_set_write_power(IN_ rfid_ctx_t *ctx, IN_ int read_power_cdbm, O
                       , OUT_ uint32_t *out_status
                       , OUT_ const char **out_errstr);
 
+/**
+ * @brief 리더 측 Gen2 Select 필터를 교체한다. 다음 rfid_read()부터 read plan에 적용된다.
+ *
+ * - filter_count == 0 이면 필터를 해제한다(모든 태그 보고).
+ * - 여러 필터는 모듈의 multi-select 로 적용하며, 모듈이 지원하지 않으면 첫 read에서 감지해
+ *   리더 측에는 가능한 만큼만 적용하고 나머지는 호스트에서 EPC 기준으로 걸러낸다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  filters 필터 배열(in). filter_count > 0 이면 NULL 불가. 호출 중에만 참조한다.
+ * @param[in]  filter_count 필터 개수(0..RFID_SELECT_MAX)
+ * @param[in]  combine 결합 방식
+ * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_select_filters(IN_ rfid_ctx_t *ctx
+                                    , IN_ const rfid_select_filter_t *filters
+                                    , IN_ const int filter_count
+                                    , IN_ const RFID_SELECT_COMBINE combine
+                                    , OUT_ uint32_t *out_status
+                                    , OUT_ const char **out_errstr);
+
+/**
+ * @brief embedded read(inventory 중 태그별 메모리 읽기) 설정을 교체한다. 다음 rfid_read()부터 적용된다.
+ *
+ * - read plan 에 Gen2 ReadData tagop 을 붙여 태그별 추가 air round 없이 결과를 rfid_tag_t.data 로 받는다.
+ * - read == NULL 또는 read->enable == 0 이면 해제한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  read 설정(in). 호출 중에만 참조한다.
+ * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_embedded_read(IN_ rfid_ctx_t *ctx
+                                   , IN_ const rfid_embedded_read_t *read
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr);
+
+/**
+ * @brief 적응형 dwell 스케줄러의 안테나별 상태를 조회한다.
+ *
+ * - dwell 스케줄러가 비활성이면 RFID_RESULT_OK 를 반환하며 *out_count = 0 이 된다.
+ * - 마지막 rfid_read()에서 사용한 안테나 순서대로 채운다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_stats 결과 배열(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in]  stat_capacity out_stats의 최대 원소 수(in). 0 이하이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_count 실제 반환된 원소 수(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_dwell_stats(IN_ const rfid_ctx_t *ctx
+                                 , OUT_ rfid_dwell_stat_t *out_stats
+                                 , IN_ const int stat_capacity
+                                 , OUT_ int *out_count);
+
+/**
+ * @brief 안테나 1개의 read power(cdBm)를 변경한다(TMR_PARAM_RADIO_PORTREADPOWERLIST).
+ *
+ * - 전력 자동 제어가 켜져 있으면 이 값에서 제어를 이어간다(범위는 제어 하한/상한으로 제한).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  antenna 안테나 번호(1..255)
+ * @param[in]  power_cdbm read power(cdBm). 0 이하이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_antenna_power(IN_ rfid_ctx_t *ctx
+                                   , IN_ const int antenna
+                                   , IN_ const int power_cdbm
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr);
+
+/**
+ * @brief 안테나별 read power 제어 상태를 조회한다.
+ *
+ * - 안테나별 전력을 사용하지 않으면 RFID_RESULT_OK 를 반환하며 *out_count = 0 이 된다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_stats 결과 배열(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in]  stat_capacity out_stats의 최대 원소 수(in). 0 이하이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_count 실제 반환된 원소 수(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_power_stats(IN_ const rfid_ctx_t *ctx
+                                 , OUT_ rfid_power_stat_t *out_stats
+                                 , IN_ const int stat_capacity
+                                 , OUT_ int *out_count);
+
+/**
+ * @brief Gen2 튜닝 모드를 변경한다.
+ *
+ * - RFID_GEN2_TUNE_MANUAL: params->manual 값을 즉시 적용하고 고정한다(pinned override).
+ * - RFID_GEN2_TUNE_AUTO: 모집단 추정을 초기화하고 자동 선택을 재개한다.
+ * - RFID_GEN2_TUNE_OFF: 이후 자동 변경을 멈춘다(이미 적용된 값은 유지).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  params 튜닝 설정(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_status TMR 상태 코드(out). NULL 허용. SDK 외부 오류 시 -1.
+ * @param[out] out_errstr 상태 문자열(out). NULL 허용.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_gen2_tuning(IN_ rfid_ctx_t *ctx
+                                 , IN_ const rfid_gen2_tune_params_t *params
+                                 , OUT_ uint32_t *out_status
+                                 , OUT_ const char **out_errstr);
+
+/**
+ * @brief 현재 Gen2 튜닝 상태(적용 값, 추정 모집단, 처리량)를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_gen2 결과(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_gen2_status(IN_ const rfid_ctx_t *ctx, OUT_ rfid_gen2_status_t *out_gen2);
+
+/**
+ * @brief 호스트 측 EPC 규칙 보관소를 연결한다. 다음 rfid_read()부터 각 태그의 rule_id 를 채운다.
+ *
+ * - matcher 는 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - rfid_read()는 호출마다 스냅샷을 1회 얻어 사용하므로, 읽는 도중 규칙을 교체해도 안전하다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] matcher 규칙 보관소(in). NULL이면 연결 해제.
+ * @param[in] drop_unmatched 1이면 어떤 규칙에도 일치하지 않는 태그를 결과에서 제외한다.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_epc_matcher(IN_ rfid_ctx_t *ctx, IN_ rfid_epc_matcher_t *matcher, IN_ const int drop_unmatched);
+
+/**
+ * @brief 태그 로그를 연결한다. 다음 rfid_read()부터 결과 태그를 로그 큐에 넣는다(막히지 않음).
+ *
+ * - log 는 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - 하나의 로그를 여러 ctx 에 연결할 수 있으며, 레코드의 reader_id 로 구분한다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] log 태그 로그(in). NULL이면 연결 해제.
+ * @param[in] reader_id 레코드에 기록할 리더 id(in)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_tag_log(IN_ rfid_ctx_t *ctx, IN_ rfid_tag_log_t *log, IN_ const uint16_t reader_id);
+
+/**
+ * @brief 공유 메모리 태그 버스를 연결한다. 다음 rfid_read()부터 결과 태그를 버스에 발행한다(막히지 않음).
+ *
+ * - bus 는 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - 하나의 버스를 여러 ctx 에 연결할 수 있으며, 레코드의 reader_id 로 구분한다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] bus 태그 버스(in). NULL이면 연결 해제.
+ * @param[in] reader_id 레코드에 기록할 리더 id(in)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_tag_bus(IN_ rfid_ctx_t *ctx, IN_ rfid_tag_bus_t *bus, IN_ const uint16_t reader_id);
+
+/**
+ * @brief 리더 간 병합 단계를 연결한다. 다음 rfid_read()부터 결과 태그를 병합 단계에 넣는다(shard 잠금만 잡는다).
+ *
+ * - merge 는 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - 겹치는 구역을 읽는 여러 ctx 에 같은 병합 단계를 연결하고 ctx 마다 다른 reader_id 를 준다.
+ *   이벤트는 별도 스레드에서 rfid_merge_poll()로 꺼낸다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] merge 병합 단계(in). NULL이면 연결 해제.
+ * @param[in] reader_id 병합 단계에 넘길 리더 id(in)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_merge(IN_ rfid_ctx_t *ctx, IN_ rfid_merge_t *merge, IN_ const uint16_t reader_id);
+
+/**
+ * @brief EPC intern 테이블을 연결한다. 다음 rfid_read()부터 결과 태그의 epc_id 를 채운다(미연결 시 RFID_EPC_ID_NONE).
+ *
+ * - intern 은 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - 여러 ctx 에 같은 테이블을 연결하면 리더가 달라도 같은 EPC 는 같은 id 를 받는다.
+ * - id 는 프로세스 안에서만 유효하므로 태그 로그/태그 버스 레코드에는 기록하지 않는다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] intern intern 테이블(in). NULL이면 연결 해제.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_epc_intern(IN_ rfid_ctx_t *ctx, IN_ rfid_epc_intern_t *intern);
+
+/**
+ * @brief 태그 후처리 풀을 연결한다. 다음 rfid_read()부터 결과 태그를 풀에 복사하고 바로 반환한다.
+ *
+ * - pool 은 ctx 가 소유하지 않는다. 연결된 동안(또는 rfid_deinit 전까지) 호출자가 유지해야 한다.
+ * - 필터/해석/sink 같은 느린 처리는 풀의 stage 에서 하므로 read 스레드가 막히지 않는다.
+ *   여러 ctx 에 같은 풀을 연결하고 ctx 마다 다른 reader_id 를 준다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[in] pool 후처리 풀(in). NULL이면 연결 해제.
+ * @param[in] reader_id 풀에 넘길 리더 id(in)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_pool(IN_ rfid_ctx_t *ctx, IN_ rfid_pool_t *pool, IN_ const uint16_t reader_id);
+
+/**
+ * @brief 시리얼 링크 상태(현재 baud, 처리량, 통신 오류/하향 횟수)를 조회한다.
+ *
+ * - TCP 등 baud 개념이 없는 transport이면 RFID_RESULT_OK 를 반환하며 모든 값이 0이다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_stat 결과(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_link_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_link_stat_t *out_stat);
+
+/**
+ * @brief 리더 상태 카운터(링크 프레임/오류, read 사이클, 안테나별 처리량) 스냅샷을 얻는다.
+ *
+ * - 카운터는 read 스레드가 atomic 으로 갱신하므로 rfid_read() 와 다른 스레드(모니터링)에서 호출해도 된다.
+ *   값마다 독립적으로 읽으므로 필드 간에는 한 사이클 정도 어긋날 수 있다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_counters 결과(out). NULL이면 RFID_RESULT_INVALID_ARG.
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_counters(IN_ const rfid_ctx_t *ctx, OUT_ rfid_counters_t *out_counters);
+
+/**
+ * @brief 카운터 스냅샷을 Prometheus text exposition 형식으로 만든다.
+ *
+ * - 지표 이름은 rfid_ 로 시작하고, 누적 값은 _total counter, 나머지는 gauge 이다.
+ * - 버퍼가 작으면 잘라서 쓰고(항상 NUL 종료) 필요한 길이를 반환한다(snprintf 와 같은 규칙).
+ *
+ * @param[in]  counters 카운터 스냅샷(in)
+ * @param[in]  reader_label reader 라벨 값(in). NULL/빈 문자열이면 reader 라벨을 붙이지 않는다.
+ * @param[out] buf 출력 버퍼(out). buf_size 가 0이면 NULL 허용.
+ * @param[in]  buf_size buf 크기(in)
+ *
+ * @return NUL 을 뺀 전체 출력 길이(bytes), 인자 오류 시 -1
+ */
+int rfid_format_counters(IN_ const rfid_counters_t *counters
+                         , IN_ const char *reader_label
+                         , OUT_ char *buf
+                         , IN_ const size_t buf_size);
+
+/**
+ * @brief 가중치 read plan 항목별 누적 태그 수와 발견율(tags/s)을 조회한다.
+ *
+ * - 태그는 읽힌 안테나와 plan 의 EPC Select 필터로 항목에 귀속된다(여러 항목에 해당하면 앞선 항목).
+ * - read plan 목록을 사용하지 않으면 0개를 반환한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in). NULL이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_stats 결과 배열(out)
+ * @param[in]  stat_capacity out_stats 용량(in)
+ * @param[out] out_count 채워진 개수(out)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_plan_stats(IN_ const rfid_ctx_t *ctx
+                                , OUT_ rfid_plan_stat_t *out_stats
+                                , IN_ const int stat_capacity
+                                , OUT_ int *out_count);
+
+/**
+ * @brief 가중치 read plan 항목의 가중치를 바꾼다(다음 rfid_read()에서 multi plan 을 다시 만든다).
+ *
+ * @param[in] ctx RFID 컨텍스트(in)
+ * @param[in] weights 항목별 가중치(> 0)(in)
+ * @param[in] weight_count weights 개수. init 때 지정한 plan_count 와 같아야 한다(in).
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_set_plan_weights(IN_ rfid_ctx_t *ctx, IN_ const int *weights, IN_ const int weight_count);
+
+/**
+ * @brief 조건(고유 태그 N개 또는 기대 EPC 전부)을 충족하는 즉시 종료하는 read.
+ *
+ * - 모듈 stop trigger(남은 필요 태그 수)와 fast search 를 read plan 에 설정해
+ *   read_timeout_ms 를 다 기다리지 않고 사이클을 끝낸다.
+ * - 모듈이 조건과 무관한 태그로 멈춘 경우 남은 시간 안에서 read 를 반복하며 결과를 EPC 기준으로 합친다.
+ * - 조건을 충족하지 못하면 read_timeout_ms 까지 읽고 RFID_EARLY_EXIT_TIMEOUT 으로 보고한다(RFID_RESULT_OK).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  antennas 안테나 번호 배열(in)
+ * @param[in]  antenna_count 안테나 개수(in)
+ * @param[in]  read_timeout_ms 최대 대기 시간(ms), 0 이상(in)
+ * @param[in]  cond 종료 조건(in). stop_count <= 0 이고 expected_count <= 0 이면 RFID_RESULT_INVALID_ARG.
+ * @param[out] out_tags 태그 결과 버퍼(out)
+ * @param[in]  tag_capacity out_tags 용량(개수)(in)
+ * @param[out] out_count 읽힌 고유 태그 개수(out)
+ * @param[out] out_report 종료 사유/지연 시간 보고(out, NULL 허용)
+ * @param[out] out_status TMR 상태 코드(out, NULL 허용)
+ * @param[out] out_errstr 상태 문자열(out, NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_read_until(IN_ rfid_ctx_t *ctx
+                            , IN_ const int *antennas
+                            , IN_ const int antenna_count
+                            , IN_ const int read_timeout_ms
+                            , IN_ const rfid_early_exit_t *cond
+                            , OUT_ rfid_tag_t *out_tags
+                            , IN_ const int tag_capacity
+                            , OUT_ int *out_count
+                            , OUT_ rfid_early_exit_report_t *out_report
+                            , OUT_ uint32_t *out_status
+                            , OUT_ const char **out_errstr);
+
+/**
+ * @brief 태그 발행(commissioning) 작업 목록을 순서대로 실행한다(EPC 쓰기 → 읽어 확인 → lock).
+ *
+ * - 모듈이 지원하면 쓰기와 확인 읽기를 한 명령(read-after-write)으로 보내 태그당 왕복을 줄인다.
+ * - 단계마다 실패하면 params->max_attempts 까지 재시도한다. 쓰기 응답을 놓친 경우는 다시 쓰지 않고 새 EPC 로 확인만 한다.
+ * - lock 은 확인이 끝난 뒤 새 EPC 로 골라 보낸다.
+ * - 작업 사이에 대기 없이 다음 작업을 보내므로 컨베이어에서는 다음 태그가 필드에 들어오는 시점에 맞춰 작업을 넘긴다.
+ * - read 와 동시에 호출하지 않는다(같은 컨텍스트는 한 스레드에서만 사용).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  jobs 작업 배열(in). 호출 중에만 참조한다.
+ * @param[in]  job_count 작업 수(> 0)(in)
+ * @param[in]  params 실행 파라미터(in, NULL이면 기본값)
+ * @param[out] out_results 작업별 결과(out, job_count 개)
+ * @param[out] out_stat 호출 요약(out, NULL 허용)
+ * @param[out] out_status TMR 상태 코드(out, NULL 허용)
+ * @param[out] out_errstr 상태 문자열(out, NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드(작업이 실패해도 모두 실행했으면 RFID_RESULT_OK, 작업별 결과는 out_results)
+ */
+RFID_RESULT rfid_commission(IN_ rfid_ctx_t *ctx
+                            , IN_ const rfid_commission_job_t *jobs
+                            , IN_ const int job_count
+                            , IN_ const rfid_commission_params_t *params
+                            , OUT_ rfid_commission_result_t *out_results
+                            , OUT_ rfid_commission_stat_t *out_stat
+                            , OUT_ uint32_t *out_status
+                            , OUT_ const char **out_errstr);
+
+/**
+ * @brief 모듈을 autonomous read 로 전환하고 모듈이 보내는 태그 스트림을 받기 시작한다(호스트 polling 없음).
+ *
+ * - ARM: 현재 설정으로 read plan 을 만들고 autonomous 로 표시해 모듈 사용자 설정에 저장한다(플래시 쓰기).
+ *   모듈은 저장 직후부터, 그리고 전원이 다시 들어올 때마다 호스트 명령 없이 inventory 하며 태그를 보낸다.
+ * - RESUME: 이미 ARM 으로 저장된 모듈의 설정을 다시 불러와 스트림을 이어 받는다(플래시에 쓰지 않음).
+ *   호스트가 재시작하면 rfid_init(연결 시 SDK 가 진행 중인 스트림을 멈추고 비운다) 뒤 RESUME 으로 다시 붙는다.
+ * - 받은 태그는 batch 로 모아 rfid_read() 와 같은 경로(호스트 Select/EPC 규칙 → intern → 로그 → 버스 → 병합 → 풀)로 넘긴 뒤
+ *   params->on_tags 를 호출한다. 하류와 콜백은 내부 수신 스레드에서 실행된다.
+ * - 연속 수신 오류가 error_limit 에 이르거나 silence_ms 동안 프레임이 없으면 링크를 닫고 다시 연결해 같은 방식으로 스트림을 건다
+ *   (USB 재열거 등). 실패하면 reconnect_ms 마다 다시 시도한다.
+ * - 수신 중에는 리더 명령을 보내는 함수(rfid_read, 설정 변경, commission)와 하류 연결 함수가 RFID_RESULT_BUSY 를 반환한다.
+ *   rfid_deinit 은 수신을 멈춘 뒤 해제한다.
+ * - link 조회 함수는 다른 스레드에서 호출할 수 있으며, 진행 중인 프레임 수신(최대 poll_ms)이 끝날 때까지 기다린다.
+ * - 시리얼 리더만 지원한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  params 시작 파라미터(in, NULL이면 기본값). 호출 중에만 참조한다(on_tags/user 는 stop 까지 유지).
+ * @param[out] out_status TMR 상태 코드(out, NULL 허용)
+ * @param[out] out_errstr 상태 문자열(out, NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_autonomous_start(IN_ rfid_ctx_t *ctx
+                                  , IN_ const rfid_autonomous_params_t *params
+                                  , OUT_ uint32_t *out_status
+                                  , OUT_ const char **out_errstr);
+
+/**
+ * @brief autonomous read 수신을 멈춘다. 모듈 스트림을 정지하고 남은 태그는 하류로 넘긴다.
+ *
+ * - 시작 시 persist 가 0이었으면 autonomous 를 끈 설정을 저장해 다음 전원 투입 때 모듈이 대기 상태로 시작한다.
+ * - 이후 rfid_read() 등 일반 명령을 다시 쓸 수 있다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[out] out_status TMR 상태 코드(out, NULL 허용)
+ * @param[out] out_errstr 상태 문자열(out, NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드(수신 중이 아니면 RFID_RESULT_OK)
+ */
+RFID_RESULT rfid_autonomous_stop(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr);
+
+/**
+ * @brief autonomous read 상태(수신/전달 태그 수, 오류, 재연결 횟수, 마지막 프레임 이후 경과 시간)를 조회한다.
+ * @note 수신 중이나 rfid_autonomous_stop 과 동시에 다른 스레드에서 호출할 수 있다(rfid_deinit 과 동시에는 호출하지 않는다).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[out] out_stat 결과(out)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_autonomous_get_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_autonomous_stat_t *out_stat);
+
+/**
+ * @brief 모듈 GPI 입력(포토아이 등)에 맞춰 read 를 켜고 끄는 trigger read 를 시작한다.
+ *
+ * - 내부 trigger 스레드가 poll_ms 마다 GPI 입력을 조회한다(TMR_gpiGet). 핀 값이 debounce_ms 동안 유지되면 변화로 인정하고,
+ *   edge 가 시작 조건이면 곧바로 read 사이클(read_ms)을 돌기 시작한다.
+ * - RISING/FALLING 은 핀이 시작 쪽 값에 머무는 동안, BOTH 는 마지막 변화 뒤 hold_ms 동안 읽는다.
+ *   조건이 풀려도 hold_ms 만큼 더 읽고, max_ms 를 넘기면 다음 변화까지 읽지 않는다.
+ * - read 사이클은 rfid_read() 와 같은 경로(적응형 제어기, 호스트 Select/EPC 규칙 → intern → 로그 → 버스 → 병합 → 풀)를 거친 뒤
+ *   params->on_tags 를 호출한다. 하류와 콜백은 trigger 스레드에서 실행된다.
+ * - trigger(새 핀 값을 처음 본 시각) → 첫 read 사이클 시작, trigger → 첫 태그 전달 지연을 rfid_trigger_get_stats 로 제공한다.
+ * - 실행 중에는 리더 명령을 보내는 함수와 하류 연결 함수가 RFID_RESULT_BUSY 를 반환한다. rfid_deinit 은 trigger 를 멈춘 뒤 해제한다.
+ * - dwell/power/gen2/plan/link 조회 함수는 다른 스레드에서 호출할 수 있으며, 진행 중인 read 사이클이 끝날 때까지 기다린다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[in]  params 시작 파라미터(in). 호출 중에만 참조한다(on_tags/user 는 stop 까지 유지).
+ * @param[out] out_status TMR 상태 코드(out, NULL 허용)
+ * @param[out] out_errstr 상태 문자열(out, NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_trigger_start(IN_ rfid_ctx_t *ctx
+                               , IN_ const rfid_trigger_params_t *params
+                               , OUT_ uint32_t *out_status
+                               , OUT_ const char **out_errstr);
+
+/**
+ * @brief trigger read 를 멈춘다. 진행 중인 read 사이클은 끝까지 돌고 결과를 전달한다.
+ *
+ * @param[in] ctx RFID 컨텍스트(in)
+ *
+ * @return RFID_RESULT 결과 코드(실행 중이 아니면 RFID_RESULT_OK)
+ */
+RFID_RESULT rfid_trigger_stop(IN_ rfid_ctx_t *ctx);
+
+/**
+ * @brief trigger read 상태(GPI 조회/핀 변화/read 횟수, 현재 핀 값, trigger 지연 백분위)를 조회한다.
+ * @note 실행 중이나 rfid_trigger_stop 과 동시에 다른 스레드에서 호출할 수 있다(rfid_deinit 과 동시에는 호출하지 않는다).
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[out] out_stat 결과(out)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_trigger_get_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_trigger_stat_t *out_stat);
+
+/**
+ * @brief 태그가 모듈에서 읽힌 뒤 하류에 전달되기까지 구간별 지연 분포를 조회한다.
+ *
+ * - 결과 태그마다 호스트 단조 시계(us)로 air_us(모듈 read, 모듈 시각을 옮긴 값), rx_us(응답 프레임 수신),
+ *   parse_us(결과 태그 변환)를 채우고, 전달 시각과 함께 구간 히스토그램에 기록한다(rfid_read, autonomous/trigger read 공통).
+ * - 풀 대기(rx_us → 작업 스레드가 꺼냄)는 rfid_pool_get_stats 의 rx_p*_us 로 본다.
+ * - 모듈 시각은 tag read metadata 에 timestamp 가 있을 때만 옮긴다(없으면 untimed 로 집계).
+ * @note 읽는 중에 다른 스레드에서 호출할 수 있다.
+ *
+ * @param[in]  ctx RFID 컨텍스트(in)
+ * @param[out] out_stat 결과(out)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_get_latency_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_latency_stat_t *out_stat);
+
 #ifdef __cplusplus
 }
 #endif
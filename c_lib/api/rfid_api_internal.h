@@ -0,0 +1,725 @@
+#ifndef RFID_API_INTERNAL_H_
+#define RFID_API_INTERNAL_H_
+
+/*
+ * rfid_api.c 와 기능별 모듈(rfid_commission.c 등)이 함께 보는 컨텍스트 정의(설치하지 않는 헤더).
+ *
+ * - rfid_ctx_t 와 그 안에 값으로 들어가는 상태 구조체
+ * - 여러 모듈이 쓰는 작은 도우미(static inline)와 rfid_api.c 가 내보내는 내부 함수(Rfid 접두어)
+ */
+
+#include <pthread.h>  // pthread_mutex_t
+#include <stdint.h>
+#include <time.h>     // clock_gettime
+
+#include "rfid_api.h"
+
+#include "tm_reader.h"
+#include "tmr_read_plan.h"
+#include "tmr_tag_data.h"
+#include "tmr_status.h"
+
+#include "rfid_util_internal.h"
+
+// 구조체 크기 상수
+#define RFID_MAX_ANTENNAS                ((uint32_t) RFID_ANTENNA_MAX)
+#define RFID_GEN2_Q_MAX                  (15)
+#define RFID_SELECT_MASK_BYTES           (64U)    // 필터 1개의 최대 비교 값 크기(bytes)
+#define RFID_TRACE_STAGES                (4U)
+
+/**
+ * @brief 안테나별 dwell 스케줄러 상태
+ *
+ * @param antenna       안테나 번호
+ * @param weight        현재 read plan 가중치(‰)
+ * @param window_new    현재 평가 구간에서 새로 발견한 태그 수
+ * @param window_ms     현재 평가 구간 누적 dwell 시간(ms)
+ * @param last_new      직전 평가 구간에서 새로 발견한 태그 수
+ * @param last_ms       직전 평가 구간 누적 dwell 시간(ms)
+ * @param yield_ema     평활화된 신규 태그 발견율(tags/s)
+ */
+typedef struct rfid_dwell_antenna {
+    int antenna;
+    uint32_t weight;
+    uint32_t window_new;
+    uint64_t window_ms;
+    uint32_t last_new;
+    uint32_t last_ms;
+    double yield_ema;
+} rfid_dwell_antenna_t;
+
+/**
+ * @brief 신규 태그 판정용 EPC 해시 슬롯(0 == 빈 슬롯)
+ */
+typedef struct rfid_seen_slot {
+    uint64_t hash;
+    uint32_t last_cycle;
+} rfid_seen_slot_t;
+
+/**
+ * @brief 적응형 dwell 스케줄러 상태
+ *
+ * @param enabled        활성 여부
+ * @param update_cycles  가중치 재계산 주기(rfid_read 횟수)
+ * @param min_permille   안테나당 최소 점유율(‰)
+ * @param max_permille   안테나당 최대 점유율(‰)
+ * @param cycle          누적 read 사이클 수
+ * @param ant_count      ants[] 유효 개수
+ * @param ants           안테나별 상태
+ * @param seen           최근 본 EPC 해시 테이블(NULL이면 비활성)
+ */
+typedef struct rfid_dwell {
+    int enabled;
+    uint32_t update_cycles;
+    uint32_t min_permille;
+    uint32_t max_permille;
+    uint32_t cycle;
+    int ant_count;
+    rfid_dwell_antenna_t ants[RFID_MAX_ANTENNAS];
+    rfid_seen_slot_t *seen;
+} rfid_dwell_t;
+
+/**
+ * @brief Gen2 튜닝 엔진 상태
+ *
+ * @param mode            튜닝 모드
+ * @param eval_cycles     AUTO 재평가 주기(rfid_read 횟수)
+ * @param cycle           누적 read 사이클 수
+ * @param current         현재 적용된 값
+ * @param applied         current가 모듈에 반영되었는지 여부
+ * @param window_max_tags 평가 구간 내 사이클당 최대 태그 수
+ * @param window_tags     평가 구간 누적 태그 수
+ * @param window_ms       평가 구간 누적 read 시간(ms)
+ * @param population      추정 태그 모집단 크기(EMA)
+ * @param band_population 마지막으로 session/target/링크를 바꿀 때의 모집단 추정
+ * @param tags_per_sec    직전 평가 구간 처리량
+ * @param q_rate          static Q 값별 처리량(EMA, tags/s)
+ * @param q_seen          q_rate 측정 여부
+ * @param last_apply_status 마지막 파라미터 적용 TMR 상태
+ */
+typedef struct rfid_gen2_tuner {
+    RFID_GEN2_TUNE_MODE mode;
+    uint32_t eval_cycles;
+    uint32_t cycle;
+    rfid_gen2_settings_t current;
+    int applied;
+    uint32_t window_max_tags;
+    uint64_t window_tags;
+    uint64_t window_ms;
+    double population;
+    double band_population;
+    double tags_per_sec;
+    double q_rate[RFID_GEN2_Q_MAX + 1];
+    uint8_t q_seen[RFID_GEN2_Q_MAX + 1];
+    uint32_t last_apply_status;
+} rfid_gen2_tuner_t;
+
+/**
+ * @brief 안테나별 read power 제어 상태
+ *
+ * @param antenna         안테나 번호
+ * @param power_cdbm      현재 read power(cdBm), 0이면 공통 전력 사용
+ * @param step_cdbm       현재 조정 폭(방향이 뒤집히면 절반으로 감쇠)
+ * @param last_step_cdbm  마지막 조정 폭(부호 포함)
+ * @param hold_up         증가를 막는 남은 평가 구간 수
+ * @param window_reads    평가 구간 누적 read 수(ReadCount 합)
+ * @param window_ms       평가 구간 누적 dwell 시간(ms)
+ * @param window_rssi_sum 평가 구간 RSSI 합
+ * @param window_rssi_n   평가 구간 RSSI 표본 수
+ * @param window_foreign  평가 구간 다른 구역 태그 read 수
+ * @param rate_ema        평활화된 read rate(reads/s)
+ * @param rssi_ema        평활화된 평균 RSSI(dBm)
+ * @param measured        rate_ema/rssi_ema 유효 여부
+ * @param foreign_total   누적 다른 구역 태그 read 수
+ * @param adjustments     누적 전력 조정 횟수
+ */
+typedef struct rfid_power_antenna {
+    int antenna;
+    int power_cdbm;
+    int step_cdbm;
+    int last_step_cdbm;
+    uint32_t hold_up;
+    uint64_t window_reads;
+    uint64_t window_ms;
+    int64_t window_rssi_sum;
+    uint32_t window_rssi_n;
+    uint32_t window_foreign;
+    double rate_ema;
+    double rssi_ema;
+    int measured;
+    uint32_t foreign_total;
+    uint32_t adjustments;
+} rfid_power_antenna_t;
+
+/**
+ * @brief 다른 구역 태그 조회용 항목(hash 오름차순 정렬)
+ */
+typedef struct rfid_foreign_entry {
+    uint64_t hash;
+    int home_antenna;
+} rfid_foreign_entry_t;
+
+/**
+ * @brief 안테나별 read power 제어기 상태
+ *
+ * @param enabled        안테나별 전력 사용 여부(고정 또는 자동 제어)
+ * @param mode           자동 제어 목표
+ * @param min_cdbm       제어 하한(cdBm)
+ * @param max_cdbm       제어 상한(cdBm)
+ * @param step_cdbm      최대 조정 폭(cdBm)
+ * @param default_cdbm   새 안테나의 시작 전력(cdBm), 0이면 공통 전력 사용
+ * @param update_cycles  조정 주기(rfid_read 횟수)
+ * @param deadband_pct   READ_RATE 불감대(%)
+ * @param target_rate    READ_RATE 목표(reads/s)
+ * @param rssi_low       RSSI_BAND 하한(dBm)
+ * @param rssi_high      RSSI_BAND 상한(dBm)
+ * @param cycle          누적 read 사이클 수
+ * @param ant_count      ants[] 유효 개수
+ * @param ants           안테나별 상태
+ * @param foreign        다른 구역 태그 목록(NULL 허용)
+ * @param foreign_count  foreign 개수
+ * @param dirty          모듈에 다시 적용해야 하는지 여부
+ * @param last_apply_status 마지막 적용 TMR 상태
+ */
+typedef struct rfid_power {
+    int enabled;
+    RFID_POWER_CTRL_MODE mode;
+    int min_cdbm;
+    int max_cdbm;
+    int step_cdbm;
+    int default_cdbm;
+    uint32_t update_cycles;
+    uint32_t deadband_pct;
+    int target_rate;
+    int rssi_low;
+    int rssi_high;
+    uint32_t cycle;
+    int ant_count;
+    rfid_power_antenna_t ants[RFID_MAX_ANTENNAS];
+    rfid_foreign_entry_t *foreign;
+    int foreign_count;
+    int dirty;
+    uint32_t last_apply_status;
+} rfid_power_t;
+
+/**
+ * @brief 리더 측 Gen2 Select 필터 저장소
+ * @note TMR_RP_set_filter()는 포인터만 보관하므로 필터/마스크는 컨텍스트 수명 동안 유지되어야 한다.
+ *
+ * @param count           필터 개수(0이면 필터 없음)
+ * @param combine         결합 방식(count > 1)
+ * @param multi_supported 모듈이 multi-select를 지원하는지 여부(미지원 감지 시 0)
+ * @param masks           필터별 비교 값
+ * @param single          필터별 단일 select 형태(invert 포함, 호스트 측 비교에도 사용)
+ * @param multi_items     필터별 multi-select 형태(invert를 action으로 표현)
+ * @param multi_ptrs      multi_items 포인터 배열
+ * @param multi           multi-select 필터
+ */
+typedef struct rfid_select {
+    int count;
+    RFID_SELECT_COMBINE combine;
+    int multi_supported;
+    uint8_t masks[RFID_SELECT_MAX][RFID_SELECT_MASK_BYTES];
+    TMR_TagFilter single[RFID_SELECT_MAX];
+    TMR_TagFilter multi_items[RFID_SELECT_MAX];
+    TMR_TagFilter *multi_ptrs[RFID_SELECT_MAX];
+    TMR_TagFilter multi;
+} rfid_select_t;
+
+/**
+ * @brief 시리얼 링크 상태(baud 협상/런타임 하향/바이트 계수)
+ *
+ * @param tracked        시리얼 transport 여부(1이면 baud 변경/바이트 계수 가능)
+ * @param enabled        baud 자동 협상 사용 여부
+ * @param max_rate       시도할 최대 baud
+ * @param probe_count    baud 검증 시 version 왕복 횟수
+ * @param fallback_errs  하향 기준 연속 통신 오류 수
+ * @param connect_rate   연결 시 SDK가 probe한 baud(하향 하한)
+ * @param verified_max   검증을 통과한 최고 baud
+ * @param probe_rtt_us   현재 baud의 version 왕복 평균 시간(us)
+ * @param tx_bytes       누적 송신 바이트
+ * @param rx_bytes       누적 수신 바이트
+ * @param bytes_per_sec  평활화된 rfid_read() 구간 처리량
+ * @param consecutive_errs 연속 통신 오류 수
+ * @param comm_errors    누적 통신 오류 수
+ * @param fallbacks      런타임 baud 하향 횟수
+ * @param send           원래 transport 송신 함수
+ * @param receive        원래 transport 수신 함수
+ */
+typedef struct rfid_link {
+    int tracked;
+    int enabled;
+    uint32_t max_rate;
+    uint32_t probe_count;
+    uint32_t fallback_errs;
+    uint32_t connect_rate;
+    uint32_t verified_max;
+    double probe_rtt_us;
+    uint64_t tx_bytes;
+    uint64_t rx_bytes;
+    double bytes_per_sec;
+    uint32_t consecutive_errs;
+    uint32_t comm_errors;
+    uint32_t fallbacks;
+    TMR_Status (*send)(TMR_SR_SerialTransport *, uint32_t, uint8_t *, const uint32_t);
+    TMR_Status (*receive)(TMR_SR_SerialTransport *, uint32_t, uint32_t *, uint8_t *, const uint32_t);
+} rfid_link_t;
+
+/**
+ * @brief 안테나별 read 카운터
+ *
+ * @param reads          누적 read 수
+ * @param unique_tags    누적 고유 태그 수
+ * @param reads_per_sec  평활화된 reads/s
+ * @param unique_per_sec 평활화된 고유 tags/s
+ */
+typedef struct rfid_counter_antenna {
+    uint64_t reads;
+    uint64_t unique_tags;
+    double reads_per_sec;
+    double unique_per_sec;
+} rfid_counter_antenna_t;
+
+/**
+ * @brief 리더 상태 카운터
+ * @note 갱신은 read 스레드(transport 콜백 포함)에서만 하고, 조회는 다른 스레드에서도 할 수 있도록
+ *       모든 공개 값은 __atomic 으로 읽고 쓴다. rx_* 필드는 수신 프레임 파서 상태로 read 스레드 전용이다.
+ *
+ * @param start_us       rfid_init 시각(us)
+ * @param tx_frames      송신 프레임 수
+ * @param rx_frames      수신 프레임 수
+ * @param crc_errors     수신 프레임 CRC 오류 수
+ * @param soh_resyncs    프레임 경계 재동기 횟수
+ * @param discarded_bytes 재동기 중 버린 바이트 수
+ * @param timeouts       transport 수신 timeout 수
+ * @param read_cycles    rfid_read() 호출 수
+ * @param read_errors    모듈 read 실패 수
+ * @param buffer_overflows 모듈 태그 버퍼 넘침 수
+ * @param overflow_tags  결과 버퍼 초과로 반환하지 못한 태그 수
+ * @param queue_depth    직전 사이클 모듈 태그 버퍼 태그 수
+ * @param queue_peak     queue_depth 최대값
+ * @param ants           안테나 번호별 카운터(0: 안테나 정보 없음)
+ * @param rx_pos         수신 중인 프레임에서 받은 바이트 수(0이면 SOH 대기)
+ * @param rx_need        수신 중인 프레임 전체 길이
+ * @param rx_crc         수신 중인 프레임의 누적 CRC
+ * @param rx_crc_hi      수신한 CRC 상위 바이트
+ * @param rx_crc_on      수신 중인 프레임에 CRC가 있는지 여부
+ * @param rx_skipping    SOH 앞 잡음 바이트를 버리는 중인지 여부
+ */
+typedef struct rfid_counter {
+    uint64_t start_us;
+    uint64_t tx_frames;
+    uint64_t rx_frames;
+    uint64_t crc_errors;
+    uint64_t soh_resyncs;
+    uint64_t discarded_bytes;
+    uint64_t timeouts;
+    uint64_t read_cycles;
+    uint64_t read_errors;
+    uint64_t buffer_overflows;
+    uint64_t overflow_tags;
+    uint32_t queue_depth;
+    uint32_t queue_peak;
+    rfid_counter_antenna_t ants[RFID_ANTENNA_MAX + 1];
+    uint32_t rx_pos;
+    uint32_t rx_need;
+    uint16_t rx_crc;
+    uint8_t rx_crc_hi;
+    int rx_crc_on;
+    int rx_skipping;
+} rfid_counter_t;
+
+/**
+ * @brief SDK에 넘긴 read plan이 참조하는 저장소.
+ * @note TMR_PARAM_READ_PLAN은 plan을 얕은 복사하므로 안테나 목록/하위 plan은 컨텍스트 수명 동안 유지되어야 한다.
+ *
+ * @param antennas   simple plan 안테나 목록
+ * @param plan       최상위 plan
+ * @param sub_plans  안테나별 하위 plan(multi plan 사용 시)
+ * @param sub_ptrs   sub_plans 포인터 배열(TMR_RP_init_multi 입력)
+ */
+typedef struct rfid_plan_storage {
+    uint8_t antennas[RFID_MAX_ANTENNAS];
+    TMR_ReadPlan plan;
+    TMR_ReadPlan sub_plans[RFID_MAX_ANTENNAS];
+    TMR_ReadPlan *sub_ptrs[RFID_MAX_ANTENNAS];
+} rfid_plan_storage_t;
+
+/**
+ * @brief 가중치 read plan 목록(rfid_init_params_t.plans) 저장소와 항목별 통계
+ * @note multi plan 은 ctx->plan 의 sub_plans 로 한 번 만들어 두고, 가중치/필터/stop trigger 가 바뀔 때만 다시 만든다.
+ *
+ * @param count         항목 수(0이면 미사용)
+ * @param dirty         1이면 다음 read 전에 multi plan 을 다시 만든다
+ * @param built_stop    현재 plan 에 반영된 stop trigger 값
+ * @param built_fast    현재 plan 에 반영된 fast search 값
+ * @param antennas      항목별 안테나 목록
+ * @param antenna_count 항목별 안테나 개수
+ * @param weight        항목별 가중치
+ * @param select        항목별 Select 필터(count 0이면 전역 필터 사용)
+ * @param all_antennas  전체 항목 안테나 합집합(전력 제어/통계용)
+ * @param all_count     all_antennas 개수
+ * @param tags          항목별 누적 태그 수
+ * @param airtime_ms    항목별 누적 추정 read 시간(ms)
+ */
+typedef struct rfid_plan_list {
+    int count;
+    int dirty;
+    uint32_t built_stop;
+    int built_fast;
+    uint8_t antennas[RFID_PLAN_MAX][RFID_MAX_ANTENNAS];
+    int antenna_count[RFID_PLAN_MAX];
+    uint32_t weight[RFID_PLAN_MAX];
+    rfid_select_t select[RFID_PLAN_MAX];
+    int all_antennas[RFID_MAX_ANTENNAS];
+    int all_count;
+    uint64_t tags[RFID_PLAN_MAX];
+    uint64_t airtime_ms[RFID_PLAN_MAX];
+} rfid_plan_list_t;
+
+/**
+ * @brief 조기 종료 read 의 기대 EPC 1건
+ *
+ * @param epc  바이너리 EPC
+ * @param len  epc 유효 바이트 수
+ * @param seen 이번 rfid_read_until 호출에서 발견했는지 여부
+ */
+typedef struct rfid_expected_epc {
+    uint8_t epc[RFID_EPC_MAX_BYTES];
+    uint32_t len;
+    int seen;
+} rfid_expected_epc_t;
+
+/**
+ * @brief embedded read(inventory 중 태그별 메모리 읽기) 상태
+ * @note TMR_RP_set_tagop 은 tagop 주소만 plan 에 기록하므로 tagop 은 컨텍스트 수명 동안 유지되어야 한다.
+ *
+ * @param enabled 1이면 read plan 에 tagop 을 붙인다
+ * @param bank    읽는 뱅크(응답 data 가 뱅크별 목록으로 올 때 고르는 용도)
+ * @param tagop   SDK Gen2 ReadData tagop
+ */
+typedef struct rfid_embedded {
+    int enabled;
+    RFID_GEN2_BANK bank;
+    TMR_TagOp tagop;
+} rfid_embedded_t;
+
+/**
+ * @brief 태그 지연 추적 상태(호스트 단조 시계 us). 리더를 쓰는 스레드(rfid_read 호출자, autonomous/trigger 스레드)만 고친다.
+ *
+ * @param rx_us        마지막으로 받은 응답 바이트의 시각(프레임 해석 직전 수신이 그 프레임의 끝이다)
+ * @param search_tx_us 마지막 search 명령 송신 시각(동기 read 의 모듈 시각 0)
+ * @param search_seq   search 명령 송신 횟수
+ * @param epoch_seq    현재 구간을 잡은 search_seq
+ * @param epoch_valid  1이면 구간 기준이 있다
+ * @param epoch_fixed  1이면 구간 기준이 search 명령 송신 시각이다(0이면 수신 하한으로 맞춘다)
+ * @param epoch_us     모듈 시각 0 에 해당하는 호스트 시각
+ * @param dsp_last     마지막 모듈 시각(하위 32비트)
+ * @param dsp_high     모듈 시각 넘침 보정(상위 비트)
+ * @param drift        모듈 시계 빠르기(호스트 us / 모듈 us - 1)
+ * @param drift_ppb    drift 조회용 사본(10억분율)
+ * @param win_start    빠르기 추정 창 시작 모듈 시각
+ * @param win_min      창 안 (수신 시각 - 모듈 시각) 최솟값
+ * @param win_min_d    win_min 의 모듈 시각
+ * @param win_valid    1이면 창에 값이 있다
+ * @param prev_min     직전 창 최솟값
+ * @param prev_min_d   prev_min 의 모듈 시각
+ * @param prev_valid   1이면 직전 창이 있다
+ * @param hist         구간별 지연(us) 히스토그램
+ * @param untimed      모듈 read 시각을 정하지 못한 태그 수
+ * @param epochs       구간 기준을 새로 잡은 횟수
+ */
+typedef struct rfid_trace {
+    uint64_t rx_us;
+    uint64_t search_tx_us;
+    uint32_t search_seq;
+    uint32_t epoch_seq;
+    int epoch_valid;
+    int epoch_fixed;
+    uint64_t epoch_us;
+    uint32_t dsp_last;
+    uint64_t dsp_high;
+    double drift;
+    int64_t drift_ppb;
+    uint64_t win_start;
+    int64_t win_min;
+    uint64_t win_min_d;
+    int win_valid;
+    int64_t prev_min;
+    uint64_t prev_min_d;
+    int prev_valid;
+    uint64_t hist[RFID_TRACE_STAGES][RFID_HIST_BUCKETS];
+    uint64_t untimed;
+    uint64_t epochs;
+} rfid_trace_t;
+
+typedef struct rfid_autonomous rfid_autonomous_t;  // 정의: rfid_autonomous.c
+typedef struct rfid_trigger rfid_trigger_t;        // 정의: rfid_trigger.c
+
+/**
+ * @brief RFID Reader 상태를 관리하는 내부 컨텍스트 구조체.
+ * @note 외부에는 opaque 타입(rfid_ctx_t)으로 노출되며, 이 내부 헤더에서만 정의된다.
+ *
+ * @param reader      MercuryAPI Reader 핸들
+ * @param reader_created Reader가 생성되었는지 여부(1: 생성됨, 0: 미생성)
+ * @param initialized 초기화 상태(1: init 완료, 0: 미완료)
+ * @param region      사용자가 지정한 RFID Region 값
+ * @param readPowerDbm 설정된 읽기 전력(dBm), 0이면 기본값 사용
+ * @param plan        SDK read plan 저장소
+ * @param plans       가중치 read plan 목록(count 0이면 rfid_read()의 antennas 로 plan 구성)
+ * @param dwell       적응형 dwell 스케줄러 상태
+ * @param gen2        Gen2 튜닝 엔진 상태
+ * @param power       안테나별 read power 제어기 상태
+ * @param select      리더 측 Select 필터
+ * @param link        시리얼 링크(baud) 상태
+ * @param counter     리더 상태 카운터
+ * @param meta_flags  태그 응답 metadata 요청 값(0이면 SDK 기본값 유지)
+ * @param stop_count  read plan stop trigger(고유 태그 수, 0이면 미사용. rfid_read_until 동안만 설정)
+ * @param fast_search 1이면 read plan fast search 사용(rfid_read_until 동안만 설정)
+ * @param embedded    태그별 메모리 embedded read 설정
+ * @param raw_unsupported 1이면 모듈이 쓰기+읽기 결합 명령(read-after-write)을 지원하지 않아 따로 수행한다
+ * @param matcher     호스트 측 EPC 규칙 보관소(소유하지 않음, NULL 허용)
+ * @param matcher_drop 1이면 규칙에 일치하지 않는 태그를 결과에서 제외
+ * @param tag_log     rfid_read() 결과를 기록할 태그 로그(소유하지 않음, NULL 허용)
+ * @param tag_log_reader_id 태그 로그 레코드에 기록할 리더 id
+ * @param tag_bus     rfid_read() 결과를 발행할 공유 메모리 태그 버스(소유하지 않음, NULL 허용)
+ * @param tag_bus_reader_id 태그 버스 레코드에 기록할 리더 id
+ * @param merge       rfid_read() 결과를 넣을 리더 간 병합 단계(소유하지 않음, NULL 허용)
+ * @param merge_reader_id 병합 단계에 넘길 리더 id
+ * @param intern      rfid_read() 결과 태그에 epc_id 를 채울 EPC intern 테이블(소유하지 않음, NULL 허용)
+ * @param pool        rfid_read() 결과를 넘길 태그 후처리 풀(소유하지 않음, NULL 허용)
+ * @param pool_reader_id 후처리 풀에 넘길 리더 id
+ * @param autonomous  autonomous read 수신 상태(NULL이면 미사용. 있는 동안 다른 리더 명령은 RFID_RESULT_BUSY)
+ * @param trigger     GPI trigger read 상태(NULL이면 미사용. 있는 동안 다른 리더 명령은 RFID_RESULT_BUSY)
+ * @param trace       태그 지연 추적 상태
+ * @param auto_stop   1이면 autonomous 수신 스레드 종료 요청(state 잠금을 기다리기 전에 먼저 게시한다)
+ * @param trig_stop   1이면 trigger 스레드 종료 요청(auto_stop 과 같은 방식)
+ * @param state_lock  autonomous/trigger 스레드의 리더 사용 구간과 상태 조회 함수를 직렬화하고,
+ *                    autonomous/trigger 포인터의 게시/해제를 보호하는 잠금(state_cond 와 함께 번호표 잠금을 이룬다)
+ * @param state_cond  state 잠금 차례를 기다리는 조건 변수
+ * @param state_next  다음에 나눠 줄 state 잠금 번호표
+ * @param state_serving 지금 state 잠금을 가진 번호표
+ */
+typedef struct rfid_ctx {
+    TMR_Reader reader;
+    int reader_created;
+    int initialized;
+    RFID_REGION region;
+    int readPowerDbm;
+    rfid_plan_storage_t plan;
+    rfid_plan_list_t plans;
+    rfid_dwell_t dwell;
+    rfid_gen2_tuner_t gen2;
+    rfid_power_t power;
+    rfid_select_t select;
+    rfid_link_t link;
+    rfid_counter_t counter;
+    TMR_TRD_MetadataFlag meta_flags;
+    uint32_t stop_count;
+    int fast_search;
+    rfid_embedded_t embedded;
+    int raw_unsupported;
+    rfid_epc_matcher_t *matcher;
+    int matcher_drop;
+    rfid_tag_log_t *tag_log;
+    uint16_t tag_log_reader_id;
+    rfid_tag_bus_t *tag_bus;
+    uint16_t tag_bus_reader_id;
+    rfid_merge_t *merge;
+    uint16_t merge_reader_id;
+    rfid_epc_intern_t *intern;
+    rfid_pool_t *pool;
+    uint16_t pool_reader_id;
+    rfid_autonomous_t *autonomous;
+    rfid_trigger_t *trigger;
+    rfid_trace_t trace;
+    uint32_t auto_stop;
+    uint32_t trig_stop;
+    pthread_mutex_t state_lock;
+    pthread_cond_t state_cond;
+    uint32_t state_next;
+    uint32_t state_serving;
+} rfid_ctx_t;
+
+/**
+ * @brief TMR 에러 코드를 문자열로 변환한다(정의: rfid_api.c).
+ */
+const char* RfidErrorCodeToString_(TMR_ErrorCode code);
+
+/**
+ * @brief 상태 코드와 에러 문자열 OUT 매개변수를 설정한다.
+ *
+ * @param[out] out_status  TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr  상태 문자열 출력 포인터(NULL 허용)
+ * @param[in]  st          TMR 상태 코드 값
+ *
+ * @note 문자열은 RfidErrorCodeToString_()이 반환하는 정적 문자열 주소이다.
+ */
+static inline void SetOutStatusAndErr_(OUT_ uint32_t *out_status, OUT_ const char **out_errstr, IN_ TMR_Status st) {
+    if (NULL != out_status)
+        *out_status = (uint32_t) st;
+
+    if (NULL != out_errstr)
+        *out_errstr = RfidErrorCodeToString_((TMR_ErrorCode) st);
+}
+
+/**
+ * @brief 문자열이 NULL이거나 빈 문자열인지 확인한다.
+ * @param s 검사할 문자열
+ * @return NULL이거나 빈 문자열이면 1, 아니면 0
+ */
+static inline int IsNullOrEmpty_(IN_ const char *s) {
+    return (NULL == s) || ('\0' == s[0]);
+}
+
+/**
+ * @brief 단조 시계 기준 현재 시각(us)
+ */
+static inline uint64_t LinkNowUs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000ULL) + ((uint64_t) ts.tv_nsec / 1000ULL);
+}
+
+/**
+ * @brief autonomous read 수신 또는 trigger read 실행 중인지 확인한다(실행 중에는 리더 명령과 하류 교체를 막는다).
+ */
+static inline int AutoActive_(IN_ const rfid_ctx_t *ctx) {
+    return ((NULL != ctx->autonomous) || (NULL != ctx->trigger)) ? 1 : 0;
+}
+
+/**
+ * @brief 상태 잠금을 잡는다(조회 함수는 const 컨텍스트로 부르므로 const 를 받는다).
+ * @note 번호표 순서대로 넘긴다. autonomous/trigger 스레드는 수신/read 사이클 사이에 풀자마자 다시 잡으므로,
+ *       공정하지 않은 mutex 를 그대로 쓰면 깨어난 stop/조회 호출이 거의 항상 경쟁에서 져 끝없이 밀린다.
+ */
+static inline void StateLock_(IN_ const rfid_ctx_t *ctx) {
+    rfid_ctx_t *c = (rfid_ctx_t *) ctx;
+    (void) pthread_mutex_lock(&c->state_lock);
+    const uint32_t ticket = c->state_next++;
+    while (ticket != c->state_serving)
+        (void) pthread_cond_wait(&c->state_cond, &c->state_lock);
+    (void) pthread_mutex_unlock(&c->state_lock);
+}
+
+/**
+ * @brief 상태 잠금을 놓고 다음 번호표에 넘긴다.
+ */
+static inline void StateUnlock_(IN_ const rfid_ctx_t *ctx) {
+    rfid_ctx_t *c = (rfid_ctx_t *) ctx;
+    (void) pthread_mutex_lock(&c->state_lock);
+    c->state_serving++;
+    (void) pthread_cond_broadcast(&c->state_cond);
+    (void) pthread_mutex_unlock(&c->state_lock);
+}
+
+/**
+ * @brief 수신 스레드 전용 집계 값을 더한다(쓰는 쪽은 하나, get_stats 가 찢어진 값을 읽지 않게 원자적으로 저장).
+ */
+static inline void AutoAdd_(IN_ uint64_t *p, IN_ const uint64_t v) {
+    __atomic_store_n(p, __atomic_load_n(p, __ATOMIC_RELAXED) + v, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief stop 요청을 확인하며 ms 동안 잠든다.
+ */
+static inline void AutoSleep_(IN_ const uint32_t *stop, IN_ const uint32_t ms) {
+    uint32_t left = ms;
+    while ((left > 0U) && (0U == __atomic_load_n(stop, __ATOMIC_ACQUIRE))) {
+        const uint32_t step = (left > 50U) ? 50U : left;
+        struct timespec ts;
+        ts.tv_sec = 0;
+        ts.tv_nsec = (long) step * 1000000L;
+        (void) nanosleep(&ts, NULL);
+        left -= step;
+    }
+}
+
+/**
+ * @brief Select 필터 저장소를 채운다(정의: rfid_api.c).
+ */
+RFID_RESULT RfidSelectInit_(OUT_ rfid_select_t *sel
+                            , IN_ const rfid_select_filter_t *filters
+                            , IN_ const int count
+                            , IN_ const RFID_SELECT_COMBINE combine);
+
+/**
+ * @brief read plan/태그 명령에 설정할 필터를 고른다(정의: rfid_api.c).
+ */
+TMR_TagFilter* RfidSelectPlanFilter_(IN_ rfid_select_t *sel);
+
+/**
+ * @brief read 결과 태그를 결과에 포함할지 판단하고, read plan 목록 항목별 태그 수를 집계한다(정의: rfid_api.c).
+ */
+int RfidReadAcceptTag_(IN_ rfid_ctx_t *ctx, IN_ TMR_TagData *tag, IN_ const int antenna);
+
+/**
+ * @brief GEN2 Read Plan(안테나 리스트 포함)을 설정한다(정의: rfid_api.c).
+ */
+RFID_RESULT RfidConfigureReadPlan_(IN_ rfid_ctx_t *ctx
+                                   , IN_ const int *antennas
+                                   , IN_ const int antenna_count
+                                   , IN_ const int plan_timeout_ms
+                                   , OUT_ uint32_t *out_status
+                                   , OUT_ const char **out_errstr);
+
+/**
+ * @brief SDK 태그 응답을 결과 태그로 옮긴다(정의: rfid_api.c).
+ */
+void RfidReadFillTag_(IN_ rfid_ctx_t *ctx, IN_ const TMR_TagReadData *trd, IN_ const uint32_t rule_id, OUT_ rfid_tag_t *dst);
+
+/**
+ * @brief 결과 태그를 연결된 하류에 넘긴다(정의: rfid_api.c).
+ */
+void RfidReadDeliver_(IN_ rfid_ctx_t *ctx, INOUT_ rfid_tag_t *tags, IN_ const int count);
+
+/**
+ * @brief read 1 사이클(plan 구성 → TMR_read → 태그 수집 → 제어기/통계 갱신 → 하류 전달)을 수행한다(정의: rfid_api.c).
+ */
+RFID_RESULT RfidReadCycle_(IN_ rfid_ctx_t *ctx
+                           , IN_ const int *antennas
+                           , IN_ const int antenna_count
+                           , IN_ const int read_timeout_ms
+                           , OUT_ rfid_tag_t *out_tags
+                           , IN_ const int tag_capacity
+                           , OUT_ int *out_count
+                           , OUT_ uint32_t *out_status
+                           , OUT_ const char **out_errstr);
+
+// autonomous read(정의: rfid_autonomous.c)
+
+/**
+ * @brief 수신 스레드를 멈추고 모듈 스트림을 정지한 뒤 수신 상태를 해제한다.
+ */
+TMR_Status RfidAutoShutdown_(IN_ rfid_ctx_t *ctx);
+
+// trigger read(정의: rfid_trigger.c)
+
+/**
+ * @brief trigger 스레드를 멈추고 trigger 상태를 해제한다.
+ */
+void RfidTrigShutdown_(IN_ rfid_ctx_t *ctx);
+
+// 지연 추적(정의: rfid_trace.c)
+
+/**
+ * @brief 히스토그램 백분위 값을 구한다(기록 중인 히스토그램을 칸마다 원자적으로 읽는다).
+ */
+uint32_t RfidLatHistPercentile_(IN_ const uint64_t *hist, IN_ const uint32_t permille);
+
+/**
+ * @brief 모듈 시각 기준을 버린다(스트림 시작/재연결 시).
+ */
+void RfidTraceRestart_(IN_ rfid_trace_t *tr);
+
+/**
+ * @brief 결과 태그에 수신/변환/모듈 read 시각을 채우고 수신 쪽 구간을 기록한다.
+ */
+void RfidTraceTag_(IN_ rfid_trace_t *tr, IN_ const TMR_TagReadData *trd, IN_ const uint16_t meta, INOUT_ rfid_tag_t *dst);
+
+/**
+ * @brief 하류 전달 시각으로 전달 쪽 구간을 기록한다.
+ */
+void RfidTraceDeliver_(IN_ rfid_trace_t *tr, IN_ const rfid_tag_t *tags, IN_ const int count);
+
+#endif  // RFID_API_INTERNAL_H_
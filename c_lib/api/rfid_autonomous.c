@@ -0,0 +1,557 @@
+// c_lib/api/rfid_autonomous.c
+
+#include "rfid_api.h"
+#include "rfid_api_internal.h"
+
+// SDK 내부 헤더(이 파일만 포함): verifySearchStatus, TMR_SR_updateBaseTimeStamp, TMR_SR_receiveAutonomousReading
+#include "serial_reader_imp.h"
+
+#include <pthread.h>  // pthread_create, pthread_join
+#include <stdlib.h>   // calloc, free
+#include <string.h>   // memcpy, memset
+
+// autonomous read 상수
+#define RFID_AUTO_DEFAULT_BATCH          (64U)
+#define RFID_AUTO_DEFAULT_FLUSH_MS       (20U)
+#define RFID_AUTO_DEFAULT_POLL_MS        (100U)
+#define RFID_AUTO_DEFAULT_ERROR_LIMIT    (3U)
+#define RFID_AUTO_DEFAULT_RECONNECT_MS   (1000U)
+
+/**
+ * @brief AutoSdkSync_ 가 맞추는 SDK 시리얼 리더 내부 상태
+ */
+typedef enum RFID_AUTO_SDK_OP {
+    RFID_AUTO_SDK_RX_BEGIN = 0, // 스트림 수신 시작: 수신 대기 시간 = value(ms), 남은 태그 수/기준 시각 표시 초기화
+    RFID_AUTO_SDK_TIMEOUT, // 수신 대기 시간 = value(ms)
+    RFID_AUTO_SDK_BASETIME, // 기준 시각이 표시되지 않았으면 지금으로 갱신하고 표시
+    RFID_AUTO_SDK_HALT, // 모듈 stop 뒤 stop 응답까지 프레임을 비우고 읽기 중/남은 태그 수/기준 시각 표시 초기화
+    RFID_AUTO_SDK_LINK_DOWN, // transport 를 닫고 연결/읽기 중/남은 태그 수 표시 초기화
+    RFID_AUTO_SDK_MARK // autonomous 표시 = value(0/1)
+} RFID_AUTO_SDK_OP;
+
+/**
+ * @brief autonomous read 수신 상태
+ * @note stat 은 수신 스레드만 쓰고 rfid_autonomous_get_stats 가 다른 스레드에서 읽으므로 원자적으로 저장한다.
+ *
+ * @param ctx        소유 컨텍스트(수신 스레드 인자. ctx->autonomous 는 stop 중 먼저 NULL 이 된다)
+ * @param params     기본값을 채운 시작 파라미터(antennas 는 antennas 배열을 가리킨다)
+ * @param antennas   ARM 에 쓴 안테나 목록 복사본(재연결 시 다시 사용)
+ * @param thread     수신 스레드
+ * @param batch      하류로 넘길 태그 batch(batch_max 개)
+ * @param batch_count batch 에 모인 태그 수
+ * @param batch_t0   batch 첫 태그를 받은 단조 시각(us)
+ * @param last_rx_us 마지막 모듈 프레임을 받은 단조 시각(us)
+ * @param errs       연속 수신 오류 수
+ * @param saved_search_ms 시작 전 SDK 수신 대기 시간(stop 시 되돌린다)
+ * @param stat       상태 카운터
+ */
+struct rfid_autonomous {
+    rfid_ctx_t *ctx;
+    rfid_autonomous_params_t params;
+    int antennas[RFID_ANTENNA_MAX];
+    pthread_t thread;
+    rfid_tag_t *batch;
+    uint32_t batch_count;
+    uint64_t batch_t0;
+    uint64_t last_rx_us;
+    uint32_t errs;
+    uint32_t saved_search_ms;
+    rfid_autonomous_stat_t stat;
+};
+
+/**
+ * @brief SDK 시리얼 리더의 스트림 관련 내부 상태를 바꾼다(이 파일에서 SDK 내부 필드를 쓰는 유일한 곳).
+ *
+ * SDK 는 autonomous 스트림을 호스트 스레드에서 받거나 멈추는 공개 API 가 없어(TMR_receiveAutonomousReading 은
+ * 멈출 수 없는 detach 스레드), SDK 가 같은 일을 할 때 거치는 내부 함수와 필드 갱신을 여기서 그대로 따라 한다.
+ *
+ * - 대조한 SDK: MercuryAPI 1.31.4.35(tm_config.h TMR_VERSION) serial_reader.c, serial_reader_l3.c, tm_reader_async.c
+ * - 쓰는 필드: TMR_Reader.connected/continuousReading,
+ *   TMR_SR_SerialReader.searchTimeoutMs/tagsRemainingInBuffer/isBasetimeUpdated/enableAutonomousRead
+ * - SDK 를 올리면 위 파일에서 이 필드들의 쓰임과 verifySearchStatus 의 stop 응답 처리가 같은지 다시 확인한다.
+ *
+ * @param ctx   RFID 컨텍스트
+ * @param op    맞출 상태
+ * @param value RX_BEGIN/TIMEOUT: 수신 대기 시간(ms), MARK: autonomous 표시(0/1), 그 외: 쓰지 않음
+ * @return HALT: 모듈 stop TMR 상태, 그 외: TMR_SUCCESS
+ */
+static TMR_Status AutoSdkSync_(IN_ rfid_ctx_t *ctx, IN_ const RFID_AUTO_SDK_OP op, IN_ const uint32_t value) {
+    TMR_Reader *reader = &ctx->reader;
+    TMR_SR_SerialReader *sr = &reader->u.serialReader;
+    TMR_Status st = TMR_SUCCESS;
+
+    switch (op) {
+    case RFID_AUTO_SDK_RX_BEGIN:
+        sr->searchTimeoutMs = value;
+        sr->tagsRemainingInBuffer = 0;
+        sr->isBasetimeUpdated = false;
+        break;
+    case RFID_AUTO_SDK_TIMEOUT:
+        sr->searchTimeoutMs = value;
+        break;
+    case RFID_AUTO_SDK_BASETIME:
+        if (false == sr->isBasetimeUpdated) {
+            TMR_SR_updateBaseTimeStamp(reader);
+            sr->isBasetimeUpdated = true;
+        }
+        break;
+    case RFID_AUTO_SDK_HALT:
+        st = verifySearchStatus(reader);
+        reader->continuousReading = false;
+        sr->tagsRemainingInBuffer = 0;
+        sr->isBasetimeUpdated = false;
+        break;
+    case RFID_AUTO_SDK_LINK_DOWN:
+        sr->transport.shutdown(&sr->transport);
+        reader->connected = false;
+        reader->continuousReading = false;
+        sr->tagsRemainingInBuffer = 0;
+        break;
+    case RFID_AUTO_SDK_MARK:
+        sr->enableAutonomousRead = (0U != value) ? true : false;
+        break;
+    default:
+        break;
+    }
+    return st;
+}
+
+/**
+ * @brief 모인 batch 를 하류와 콜백에 넘긴다.
+ */
+static void AutoFlush_(IN_ rfid_ctx_t *ctx, IN_ rfid_autonomous_t *a) {
+    if (0U == a->batch_count)
+        return;
+    const int n = (int) a->batch_count;
+    a->batch_count = 0U;
+
+    RfidReadDeliver_(ctx, a->batch, n);
+    if (NULL != a->params.on_tags)
+        a->params.on_tags(a->params.user, a->batch, n);
+    AutoAdd_(&a->stat.tags, (uint64_t) n);
+    AutoAdd_(&a->stat.batches, 1U);
+}
+
+/**
+ * @brief 받은 태그 프레임을 호스트 Select/EPC 규칙으로 거른 뒤 batch 에 넣는다.
+ */
+static void AutoAccept_(IN_ rfid_ctx_t *ctx, IN_ rfid_autonomous_t *a, IN_ TMR_TagReadData *trd, IN_ const uint64_t now_us) {
+    if (0 == RfidReadAcceptTag_(ctx, &trd->tag, (int) trd->antenna)) {
+        AutoAdd_(&a->stat.filtered, 1U);
+        return;
+    }
+
+    rfid_epc_rules_t *rules = rfid_epc_matcher_acquire(ctx->matcher);
+    const uint32_t rule_id = rfid_epc_rules_classify(rules, trd->tag.epc, trd->tag.epcByteCount);
+    const int drop = ((NULL != rules) && (0 != ctx->matcher_drop) && (RFID_EPC_RULE_NONE == rule_id)) ? 1 : 0;
+    rfid_epc_rules_release(rules);
+    if (0 != drop) {
+        AutoAdd_(&a->stat.filtered, 1U);
+        return;
+    }
+
+    if (0U == a->batch_count)
+        a->batch_t0 = now_us;
+    RfidReadFillTag_(ctx, trd, rule_id, &a->batch[a->batch_count]);
+    a->batch_count++;
+}
+
+/**
+ * @brief 현재 read plan 의 autonomous 표시를 바꿔 모듈 사용자 설정에 read plan 과 함께 저장한다(플래시 쓰기).
+ *
+ * - enable 이 1이면 모듈이 저장 직후부터(그리고 전원이 다시 들어올 때마다) 스스로 inventory 하며 태그를 보낸다.
+ * - enable 이 0이면 같은 설정을 autonomous 없이 저장해 다음 전원 투입 때 대기 상태로 시작하게 한다.
+ */
+static TMR_Status AutoArm_(IN_ rfid_ctx_t *ctx, IN_ const int enable) {
+    TMR_ReadPlan plan;
+    TMR_Status st = TMR_paramGet(&ctx->reader, TMR_PARAM_READ_PLAN, &plan);
+    if (TMR_SUCCESS == st)
+        st = TMR_RP_set_enableAutonomousRead(&plan, (0 != enable) ? true : false);
+    if (TMR_SUCCESS == st)
+        st = TMR_paramSet(&ctx->reader, TMR_PARAM_READ_PLAN, &plan);
+    if (TMR_SUCCESS == st) {
+        TMR_SR_UserConfigOp config;
+        (void) TMR_init_UserConfigOp(&config, TMR_USERCONFIG_SAVE_WITH_READPLAN);
+        st = TMR_paramSet(&ctx->reader, TMR_PARAM_USER_CONFIG, &config);
+    }
+    return st;
+}
+
+/**
+ * @brief 모듈에 저장된 사용자 설정(autonomous read plan 포함)을 다시 불러와 스트림을 재개한다(플래시에 쓰지 않음).
+ * @note SDK 는 autonomous 로 저장한 프로세스에서만 복원 뒤 baud 재탐색을 건너뛴다(스트림 중에는 응답이 섞인다).
+ *       호스트 재시작 뒤에도 같은 경로를 타도록 표시를 먼저 세운다.
+ */
+static TMR_Status AutoResume_(IN_ rfid_ctx_t *ctx) {
+    TMR_SR_UserConfigOp config;
+    (void) TMR_init_UserConfigOp(&config, TMR_USERCONFIG_RESTORE);
+    // SDK 불변식: enableAutonomousRead 가 true 일 때만 RESTORE 뒤 baud 재탐색을 건너뛴다(serial_reader_l3.c).
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_MARK, 1U);
+    const TMR_Status st = TMR_paramSet(&ctx->reader, TMR_PARAM_USER_CONFIG, &config);
+    if (TMR_SUCCESS != st) {
+        // SDK 불변식: 복원이 실패해 스트림이 없으므로 표시를 되돌린다(위 표시는 RESTORE 한 번에만 쓰인다).
+        (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_MARK, 0U);
+    }
+    return st;
+}
+
+/**
+ * @brief 링크를 닫았다가 다시 연결하고 시작 방식대로 스트림을 다시 건다.
+ * @note SDK connect 는 모듈이 스트림 중이면 stop 을 보내고 남은 프레임을 비운 뒤 boot 한다.
+ */
+static TMR_Status AutoReconnect_(IN_ rfid_ctx_t *ctx, IN_ const rfid_autonomous_t *a) {
+    // SDK 불변식: connected/continuousReading 은 열린 링크와 진행 중인 읽기를 뜻한다. 닫은 링크의 표시를 남기면
+    // TMR_connect 전에 끊긴 스트림의 남은 태그 수로 프레임을 해석한다.
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_LINK_DOWN, 0U);
+
+    TMR_Status st = TMR_connect(&ctx->reader);
+    if (TMR_SUCCESS == st)
+        st = (RFID_AUTONOMOUS_RESUME == a->params.mode) ? AutoResume_(ctx) : AutoArm_(ctx, 1);
+
+    // SDK 불변식: 수신 함수는 searchTimeoutMs 만큼 기다리고, 새 스트림의 태그 시각은 새 기준 시각으로 잡는다.
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_RX_BEGIN, a->params.poll_ms);
+    return st;
+}
+
+/**
+ * @brief 수신 스레드. 모듈이 보내는 태그 프레임을 batch 로 모아 하류로 넘기고, 스트림이 끊기면 다시 연결한다.
+ * @note SDK 의 autonomous 수신 스레드(TMR_receiveAutonomousReading)는 detach 된 무한 루프라 멈출 수 없으므로
+ *       같은 수신 함수를 이 스레드에서 poll_ms 단위로 호출한다.
+ */
+static void* AutoThread_(IN_ void *arg) {
+    rfid_autonomous_t *a = (rfid_autonomous_t *) arg;
+    rfid_ctx_t *ctx = a->ctx;
+    TMR_Reader *reader = &ctx->reader;
+    TMR_Reader_StatsValues stats;
+    (void) TMR_STATS_init(&stats);
+
+    int streaming = 1;
+    __atomic_store_n(&a->last_rx_us, LinkNowUs_(), __ATOMIC_RELAXED);
+
+    while (0U == __atomic_load_n(&ctx->auto_stop, __ATOMIC_ACQUIRE)) {
+        if (0 == streaming) {
+            StateLock_(ctx);
+            // 잠금을 기다리는 동안 stop 이 게시됐으면 재연결/수신을 더 하지 않고 끝낸다.
+            if (0U != __atomic_load_n(&ctx->auto_stop, __ATOMIC_ACQUIRE)) {
+                StateUnlock_(ctx);
+                break;
+            }
+            const TMR_Status st_conn = AutoReconnect_(ctx, a);
+            StateUnlock_(ctx);
+            if (TMR_SUCCESS != st_conn) {
+                AutoAdd_(&a->stat.reconnect_failures, 1U);
+                __atomic_store_n(&a->stat.last_status, (uint32_t) st_conn, __ATOMIC_RELAXED);
+                AutoSleep_(&ctx->auto_stop, a->params.reconnect_ms);
+                continue;
+            }
+            AutoAdd_(&a->stat.reconnects, 1U);
+            RfidTraceRestart_(&ctx->trace);
+            streaming = 1;
+            a->errs = 0U;
+            __atomic_store_n(&a->last_rx_us, LinkNowUs_(), __ATOMIC_RELAXED);
+            __atomic_store_n(&a->stat.streaming, 1, __ATOMIC_RELAXED);
+        }
+
+        StateLock_(ctx);
+        if (0U != __atomic_load_n(&ctx->auto_stop, __ATOMIC_ACQUIRE)) {
+            StateUnlock_(ctx);
+            break;
+        }
+        // SDK 불변식: 태그 timestamp 는 모듈 경과 시간에 기준 시각을 더해 만든다(SDK 수신 스레드도 수신 전에 갱신).
+        (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_BASETIME, 0U);
+
+        TMR_TagReadData trd;
+        (void) TMR_TRD_init(&trd);
+        const TMR_Status st = TMR_SR_receiveAutonomousReading(reader, &trd, &stats);
+        const uint64_t now = LinkNowUs_();
+
+        if (TMR_SUCCESS == st) {
+            __atomic_store_n(&a->last_rx_us, now, __ATOMIC_RELAXED);
+            a->errs = 0U;
+            if (false == reader->isStatusResponse) {
+                AutoAdd_(&a->stat.frames, 1U);
+                AutoAccept_(ctx, a, &trd, now);
+            }
+        }
+        else if ((TMR_ERROR_NO_TAGS_FOUND == st) || (TMR_ERROR_NO_TAGS == st)
+                 || (TMR_ERROR_TAG_ID_BUFFER_FULL == st) || (TMR_ERROR_TAG_ID_BUFFER_AUTH_REQUEST == st)) {
+            // 사이클 종료/빈 사이클 알림: 모듈은 살아 있다.
+            __atomic_store_n(&a->last_rx_us, now, __ATOMIC_RELAXED);
+            a->errs = 0U;
+        }
+        else if (TMR_ERROR_TIMEOUT != st) {
+            AutoAdd_(&a->stat.rx_errors, 1U);
+            __atomic_store_n(&a->stat.last_status, (uint32_t) st, __ATOMIC_RELAXED);
+            // 다른 호스트 명령 등으로 스트림이 끝났으면 바로 다시 건다.
+            a->errs = (TMR_ERROR_END_OF_READING == st) ? a->params.error_limit : (a->errs + 1U);
+        }
+        StateUnlock_(ctx);
+
+        if ((a->batch_count >= a->params.batch_max)
+            || ((a->batch_count > 0U) && ((now - a->batch_t0) >= ((uint64_t) a->params.flush_ms * 1000U))))
+            AutoFlush_(ctx, a);
+
+        const uint64_t last_rx = __atomic_load_n(&a->last_rx_us, __ATOMIC_RELAXED);
+        if ((a->errs >= a->params.error_limit)
+            || ((a->params.silence_ms > 0U) && ((now - last_rx) >= ((uint64_t) a->params.silence_ms * 1000U)))) {
+            AutoFlush_(ctx, a);
+            streaming = 0;
+            __atomic_store_n(&a->stat.streaming, 0, __ATOMIC_RELAXED);
+        }
+    }
+
+    AutoFlush_(ctx, a);
+    return NULL;
+}
+
+/**
+ * @brief 모듈 스트림을 정지하고 수신 대기 시간을 되돌린다(수신 스레드가 돌지 않을 때 호출).
+ * @note persist 가 0이면 autonomous 를 끈 설정을 저장해 다음 전원 투입 때 모듈이 대기 상태로 시작하게 한다.
+ * @return 모듈 정지/설정 저장 TMR 상태
+ */
+static TMR_Status AutoDisarm_(IN_ rfid_ctx_t *ctx, IN_ const rfid_autonomous_t *a) {
+    // SDK 불변식: 스트림이 없으면 수신 대기 시간은 시작 전 값이다(stop 응답을 기다리는 verifySearchStatus 도 이 값을 쓴다).
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_TIMEOUT, a->saved_search_ms);
+
+    // SDK 불변식: continuousReading/tagsRemainingInBuffer 가 남으면 다음 명령 응답을 스트림 프레임으로 읽는다.
+    // SDK connect 가 스트림 중인 모듈에 쓰는 stop 절차(verifySearchStatus)와 같다.
+    TMR_Status st = AutoSdkSync_(ctx, RFID_AUTO_SDK_HALT, 0U);
+    if (0 == a->params.persist) {
+        const TMR_Status st_save = AutoArm_(ctx, 0);
+        if (TMR_SUCCESS == st)
+            st = st_save;
+    }
+    // SDK 불변식: 스트림이 없으면 enableAutonomousRead 는 false(다음 RESTORE/CLEAR 가 baud 를 다시 찾는다).
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_MARK, 0U);
+    return st;
+}
+
+/**
+ * @brief 수신 스레드를 멈추고 모듈 스트림을 정지한 뒤 수신 상태를 해제한다.
+ * @note stop 요청은 잠금보다 먼저 게시해 수신 스레드가 지금 수신을 마치면 다시 잠그지 않게 한다.
+ *       포인터를 먼저 NULL 로 게시하므로, 잠금을 잡고 읽는 get_stats 는 해제 중인 상태를 보지 않는다.
+ * @return 모듈 정지/설정 저장 TMR 상태
+ */
+TMR_Status RfidAutoShutdown_(IN_ rfid_ctx_t *ctx) {
+    __atomic_store_n(&ctx->auto_stop, 1U, __ATOMIC_RELEASE);
+    StateLock_(ctx);
+    rfid_autonomous_t *a = ctx->autonomous;
+    ctx->autonomous = NULL;
+    StateUnlock_(ctx);
+    if (NULL == a)
+        return TMR_SUCCESS;
+
+    (void) pthread_join(a->thread, NULL);
+    const TMR_Status st = AutoDisarm_(ctx, a);
+
+    free(a->batch);
+    free(a);
+    return st;
+}
+
+/**
+ * @brief 모듈을 autonomous read 로 전환하고 스트림 수신 스레드를 시작한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  params 시작 파라미터(NULL이면 기본값, RESUME 이 아니면 안테나 필요)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_BUSY: 이미 autonomous/trigger read 실행 중,
+ *         RFID_RESULT_PLAN_FAIL: read plan 설정/저장/복원 실패(시리얼 리더가 아니면 TMR_ERROR_UNSUPPORTED),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당/스레드 생성 실패
+ */
+RFID_RESULT rfid_autonomous_start(IN_ rfid_ctx_t *ctx
+                                  , IN_ const rfid_autonomous_params_t *params
+                                  , OUT_ uint32_t *out_status
+                                  , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    rfid_autonomous_params_t p;
+    memset(&p, 0, sizeof(p));
+    if (NULL != params)
+        p = *params;
+
+    const int arm = (RFID_AUTONOMOUS_RESUME != p.mode) ? 1 : 0;
+    if (((RFID_AUTONOMOUS_ARM != p.mode) && (RFID_AUTONOMOUS_RESUME != p.mode))
+        || ((0 != arm) && (0 == ctx->plans.count)
+            && ((NULL == p.antennas) || (p.antenna_count <= 0) || (p.antenna_count > RFID_ANTENNA_MAX)))) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    // SDK 는 시리얼 리더에서만 autonomous read 를 지원한다.
+    if (TMR_READER_TYPE_SERIAL != ctx->reader.readerType) {
+        SetOutStatusAndErr_(out_status, out_errstr, TMR_ERROR_UNSUPPORTED);
+        return RFID_RESULT_PLAN_FAIL;
+    }
+
+    if (0U == p.batch_max)
+        p.batch_max = RFID_AUTO_DEFAULT_BATCH;
+    if (0U == p.flush_ms)
+        p.flush_ms = RFID_AUTO_DEFAULT_FLUSH_MS;
+    if (0U == p.poll_ms)
+        p.poll_ms = RFID_AUTO_DEFAULT_POLL_MS;
+    if (0U == p.error_limit)
+        p.error_limit = RFID_AUTO_DEFAULT_ERROR_LIMIT;
+    if (0U == p.reconnect_ms)
+        p.reconnect_ms = RFID_AUTO_DEFAULT_RECONNECT_MS;
+
+    rfid_autonomous_t *a = (rfid_autonomous_t *) calloc(1, sizeof(*a));
+    if (NULL != a)
+        a->batch = (rfid_tag_t *) calloc(p.batch_max, sizeof(rfid_tag_t));
+    if ((NULL == a) || (NULL == a->batch)) {
+        if (NULL != a)
+            free(a);
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    if ((0 != arm) && (0 == ctx->plans.count)) {
+        memcpy(a->antennas, p.antennas, (size_t) p.antenna_count * sizeof(int));
+        p.antennas = a->antennas;
+    }
+    else {
+        p.antennas = NULL;
+        p.antenna_count = 0;
+    }
+    a->ctx = ctx;
+    a->params = p;
+
+    TMR_Status st = TMR_SUCCESS;
+    if (0 != arm) {
+        const RFID_RESULT ret = RfidConfigureReadPlan_(ctx, p.antennas, p.antenna_count, 0, out_status, out_errstr);
+        if (RFID_RESULT_OK != ret) {
+            free(a->batch);
+            free(a);
+            return ret;
+        }
+        if (p.on_time_ms > 0U)
+            st = TMR_paramSet(&ctx->reader, TMR_PARAM_READ_ASYNCONTIME, &p.on_time_ms);
+        if (TMR_SUCCESS == st)
+            st = AutoArm_(ctx, 1);
+    }
+    else {
+        st = AutoResume_(ctx);
+    }
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    if (TMR_SUCCESS != st) {
+        free(a->batch);
+        free(a);
+        return RFID_RESULT_PLAN_FAIL;
+    }
+
+    // 수신 대기를 짧게 잘라 stop 요청을 poll_ms 안에 확인한다.
+    // SDK 불변식: 새 스트림은 남은 태그 수 0, 첫 태그 전에 기준 시각을 다시 잡는다.
+    a->saved_search_ms = ctx->reader.u.serialReader.searchTimeoutMs;
+    (void) AutoSdkSync_(ctx, RFID_AUTO_SDK_RX_BEGIN, p.poll_ms);
+    RfidTraceRestart_(&ctx->trace);
+    a->stat.running = 1;
+    a->stat.streaming = 1;
+
+    __atomic_store_n(&ctx->auto_stop, 0U, __ATOMIC_RELEASE);
+    StateLock_(ctx);
+    ctx->autonomous = a;
+    StateUnlock_(ctx);
+    if (0 != pthread_create(&a->thread, NULL, AutoThread_, a)) {
+        StateLock_(ctx);
+        ctx->autonomous = NULL;
+        StateUnlock_(ctx);
+        (void) AutoDisarm_(ctx, a);
+        free(a->batch);
+        free(a);
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief autonomous read 수신을 멈추고 모듈 스트림을 정지한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공(수신 중이 아니었던 경우 포함),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_INTERNAL_ERROR: 모듈 정지/설정 저장 실패(수신 스레드는 멈춘 상태)
+ */
+RFID_RESULT rfid_autonomous_stop(IN_ rfid_ctx_t *ctx, OUT_ uint32_t *out_status, OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if (NULL == ctx) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    const TMR_Status st = RfidAutoShutdown_(ctx);
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    return (TMR_SUCCESS == st) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+}
+
+/**
+ * @brief autonomous read 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stat 결과(수신 중이 아니면 running=0 이고 나머지는 0)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_autonomous_get_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_autonomous_stat_t *out_stat) {
+    if ((NULL == ctx) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    memset(out_stat, 0, sizeof(*out_stat));
+    StateLock_(ctx);
+    const rfid_autonomous_t *a = ctx->autonomous;
+    if (NULL == a) {
+        StateUnlock_(ctx);
+        return RFID_RESULT_OK;
+    }
+
+    out_stat->frames = __atomic_load_n(&a->stat.frames, __ATOMIC_RELAXED);
+    out_stat->tags = __atomic_load_n(&a->stat.tags, __ATOMIC_RELAXED);
+    out_stat->filtered = __atomic_load_n(&a->stat.filtered, __ATOMIC_RELAXED);
+    out_stat->batches = __atomic_load_n(&a->stat.batches, __ATOMIC_RELAXED);
+    out_stat->rx_errors = __atomic_load_n(&a->stat.rx_errors, __ATOMIC_RELAXED);
+    out_stat->reconnects = __atomic_load_n(&a->stat.reconnects, __ATOMIC_RELAXED);
+    out_stat->reconnect_failures = __atomic_load_n(&a->stat.reconnect_failures, __ATOMIC_RELAXED);
+    out_stat->last_status = __atomic_load_n(&a->stat.last_status, __ATOMIC_RELAXED);
+    out_stat->streaming = __atomic_load_n(&a->stat.streaming, __ATOMIC_RELAXED);
+    out_stat->running = 1;
+
+    const uint64_t last_rx = __atomic_load_n(&a->last_rx_us, __ATOMIC_RELAXED);
+    const uint64_t now = LinkNowUs_();
+    const uint64_t idle_ms = (now > last_rx) ? ((now - last_rx) / 1000U) : 0U;
+    out_stat->idle_ms = (idle_ms > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t) idle_ms;
+    StateUnlock_(ctx);
+    return RFID_RESULT_OK;
+}
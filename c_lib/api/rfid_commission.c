@@ -0,0 +1,316 @@
+// c_lib/api/rfid_commission.c
+
+#include "rfid_api.h"
+#include "rfid_api_internal.h"
+
+#include <string.h>   // memcmp, memset
+
+// 태그 발행 상수
+#define RFID_COMMISSION_ATTEMPTS_DEFAULT (3)      // 작업당 기본 최대 시도 수
+
+/**
+ * @brief 태그 명령 결과가 모듈의 명령 미지원 때문인지 판단한다.
+ * @param st 태그 명령 결과
+ * @return 미지원으로 볼 수 있으면 1, 아니면 0
+ */
+static int IsTagOpUnsupported_(IN_ const TMR_Status st) {
+    return (TMR_ERROR_UNSUPPORTED == st)
+           || (TMR_ERROR_UNIMPLEMENTED_FEATURE == st)
+           || (TMR_ERROR_UNIMPLEMENTED_OPCODE == st)
+           || (TMR_ERROR_INVALID_OPCODE == st);
+}
+
+/**
+ * @brief 읽은 EPC 뱅크(word 2부터)가 쓴 EPC 와 같은지 비교한다.
+ * @param data 읽은 데이터
+ * @param epc 쓴 EPC
+ * @return 같으면 1, 아니면 0
+ */
+static int CommissionMatch_(IN_ const TMR_uint8List *data, IN_ const TMR_TagData *epc) {
+    return ((data->len >= epc->epcByteCount) && (0 == memcmp(data->list, epc->epc, epc->epcByteCount))) ? 1 : 0;
+}
+
+/**
+ * @brief 새 EPC 를 가진 태그의 EPC 뱅크를 읽어 쓴 값과 비교한다.
+ *
+ * - 쓰기 응답을 놓친 경우(태그에는 이미 기록됨) 다시 쓰지 않고 확인만 하는 용도로도 쓴다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  epc 쓴 EPC
+ * @param[out] out_match 일치 여부
+ * @return TMR 상태 코드
+ */
+static TMR_Status CommissionVerify_(IN_ rfid_ctx_t *ctx, IN_ TMR_TagData *epc, OUT_ int *out_match) {
+    uint8_t buf[RFID_EPC_MAX_BYTES];
+    TMR_uint8List data = {buf, (uint16_t) sizeof(buf), 0};
+    TMR_TagOp read_op;
+    TMR_TagFilter by_epc;
+    *out_match = 0;
+
+    (void) TMR_TagOp_init_GEN2_ReadData(&read_op, TMR_GEN2_BANK_EPC, 2U, (uint8_t) (epc->epcByteCount / 2U));
+    (void) TMR_TF_init_tag(&by_epc, epc);
+    const TMR_Status st = TMR_executeTagOp(&ctx->reader, &read_op, &by_epc, &data);
+    if (TMR_SUCCESS == st)
+        *out_match = CommissionMatch_(&data, epc);
+    return st;
+}
+
+/**
+ * @brief 대상 태그에 EPC 를 쓰고 다시 읽어 확인한다.
+ *
+ * - 모듈이 지원하면 쓰기와 읽기를 한 명령(read-after-write)으로 보내 태그당 왕복을 한 번으로 줄인다.
+ * - 미지원이 감지되면 ctx->raw_unsupported 를 켜고 이후로는 쓰기 후 새 EPC 로 골라 읽는다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  target 대상 태그 필터(NULL 허용)
+ * @param[in]  epc 쓸 EPC
+ * @param[out] out_written 쓰기 명령 성공 여부
+ * @param[out] out_match 읽은 EPC 일치 여부
+ * @return TMR 상태 코드
+ */
+static TMR_Status CommissionWrite_(IN_ rfid_ctx_t *ctx
+                                   , IN_ TMR_TagFilter *target
+                                   , IN_ TMR_TagData *epc
+                                   , OUT_ int *out_written
+                                   , OUT_ int *out_match) {
+    TMR_TagOp write_op;
+    *out_written = 0;
+    *out_match = 0;
+    (void) TMR_TagOp_init_GEN2_WriteTag(&write_op, epc);
+
+    if (0 == ctx->raw_unsupported) {
+        uint8_t buf[RFID_EPC_MAX_BYTES];
+        TMR_uint8List data = {buf, (uint16_t) sizeof(buf), 0};
+        TMR_TagOp read_op;
+        TMR_TagOp *ops[2] = {&write_op, &read_op};
+        TMR_TagOp list_op;
+        (void) TMR_TagOp_init_GEN2_ReadData(&read_op, TMR_GEN2_BANK_EPC, 2U, (uint8_t) (epc->epcByteCount / 2U));
+        memset(&list_op, 0, sizeof(list_op));
+        list_op.type = TMR_TAGOP_LIST;
+        list_op.u.list.list = ops;
+        list_op.u.list.len = 2U;
+
+        const TMR_Status st = TMR_executeTagOp(&ctx->reader, &list_op, target, &data);
+        if (0 == IsTagOpUnsupported_(st)) {
+            if (TMR_SUCCESS == st) {
+                *out_written = 1;
+                *out_match = CommissionMatch_(&data, epc);
+            }
+            return st;
+        }
+        ctx->raw_unsupported = 1;
+    }
+
+    const TMR_Status st = TMR_executeTagOp(&ctx->reader, &write_op, target, NULL);
+    if (TMR_SUCCESS != st)
+        return st;
+    *out_written = 1;
+    return CommissionVerify_(ctx, epc, out_match);
+}
+
+/**
+ * @brief 태그 발행 작업 1건을 실행한다(쓰기 → 확인 → lock, 단계별 재시도).
+ *
+ * - 쓰기 명령이 실패해도 태그에는 기록되었을 수 있으므로, 재시도 전에 새 EPC 로 확인 읽기를 먼저 해 본다.
+ * - 확인이 끝난 뒤에는 새 EPC 로 골라 lock 을 보낸다(lock 만 재시도).
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  job 작업
+ * @param[in]  max_attempts 최대 시도 수
+ * @param[out] out 결과
+ */
+static void CommissionRunJob_(IN_ rfid_ctx_t *ctx
+                              , IN_ const rfid_commission_job_t *job
+                              , IN_ const int max_attempts
+                              , OUT_ rfid_commission_result_t *out) {
+    const uint64_t t0 = LinkNowUs_();
+    memset(out, 0, sizeof(*out));
+    out->result = RFID_RESULT_INVALID_ARG;
+    out->stage = RFID_COMMISSION_WRITE;
+
+    TMR_TagData epc;
+    memset(&epc, 0, sizeof(epc));
+    uint32_t epc_len = 0;
+    if ((0 != IsNullOrEmpty_(job->epc))
+        || (TMR_SUCCESS != TMR_hexToBytes(job->epc, epc.epc, RFID_EPC_MAX_BYTES, &epc_len))
+        || (0U == epc_len) || (0U != (epc_len % 2U))) {
+        out->status = (uint32_t) -1;
+        return;
+    }
+    epc.protocol = TMR_TAG_PROTOCOL_GEN2;
+    epc.epcByteCount = (uint8_t) epc_len;
+
+    rfid_select_t target;
+    memset(&target, 0, sizeof(target));
+    if ((NULL != job->target) && (RFID_RESULT_OK != RfidSelectInit_(&target, job->target, 1, RFID_SELECT_ANY))) {
+        out->status = (uint32_t) -1;
+        return;
+    }
+    TMR_TagFilter *filter = RfidSelectPlanFilter_(&target);
+
+    TMR_GEN2_Password password = (TMR_GEN2_Password) job->access_password;
+    TMR_Status last = TMR_paramSet(&ctx->reader, TMR_PARAM_GEN2_ACCESSPASSWORD, &password);
+
+    // 명령 미지원은 재시도해도 같으므로 바로 끝낸다.
+    int fatal = (TMR_SUCCESS != last) ? 1 : 0;
+    int written = 0;
+    int verified = 0;
+    int locked = (0U == job->lock_mask) ? 1 : 0;
+    while ((0 == fatal) && (out->attempts < max_attempts) && ((0 == verified) || (0 == locked))) {
+        out->attempts++;
+
+        if (0 == verified) {
+            int match = 0;
+            if (0 != written)
+                last = CommissionVerify_(ctx, &epc, &match);
+            else {
+                last = CommissionWrite_(ctx, filter, &epc, &written, &match);
+                // 쓰기 응답을 놓쳐도 태그에는 기록되었을 수 있다.
+                if ((TMR_SUCCESS != last) && (0 == IsTagOpUnsupported_(last))) {
+                    const TMR_Status st_check = CommissionVerify_(ctx, &epc, &match);
+                    if ((TMR_SUCCESS == st_check) && (0 != match)) {
+                        written = 1;
+                        last = st_check;
+                    }
+                }
+            }
+            out->stage = (0 != written) ? RFID_COMMISSION_VERIFY : RFID_COMMISSION_WRITE;
+            fatal = IsTagOpUnsupported_(last);
+            verified = ((TMR_SUCCESS == last) && (0 != match)) ? 1 : 0;
+            // 읽었는데 다르면 다시 쓴다. 읽기 자체가 실패했으면 확인만 다시 한다.
+            if ((TMR_SUCCESS == last) && (0 == match))
+                written = 0;
+            if (0 == verified)
+                continue;
+        }
+
+        if (0 == locked) {
+            TMR_TagOp lock_op;
+            TMR_TagFilter by_epc;
+            out->stage = RFID_COMMISSION_LOCK;
+            (void) TMR_TagOp_init_GEN2_Lock(&lock_op, job->lock_mask, job->lock_action, password);
+            (void) TMR_TF_init_tag(&by_epc, &epc);
+            last = TMR_executeTagOp(&ctx->reader, &lock_op, &by_epc, NULL);
+            locked = (TMR_SUCCESS == last) ? 1 : 0;
+            fatal = IsTagOpUnsupported_(last);
+        }
+    }
+    out->status = (uint32_t) last;
+
+    if ((0 != verified) && (0 != locked)) {
+        out->result = RFID_RESULT_OK;
+        out->stage = RFID_COMMISSION_DONE;
+    }
+    else
+        out->result = RFID_RESULT_WRITE_FAIL;
+    out->latency_us = (uint32_t) (LinkNowUs_() - t0);
+}
+
+/**
+ * @brief 태그 발행(commissioning) 작업 목록을 순서대로 실행한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  jobs 작업 배열
+ * @param[in]  job_count 작업 수
+ * @param[in]  params 실행 파라미터(NULL이면 기본값)
+ * @param[out] out_results 작업별 결과(job_count 개)
+ * @param[out] out_stat 호출 요약(NULL 허용)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 모든 작업 실행(개별 성공 여부는 out_results),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_INTERNAL_ERROR: 안테나/timeout 파라미터 적용 실패
+ */
+RFID_RESULT rfid_commission(IN_ rfid_ctx_t *ctx
+                            , IN_ const rfid_commission_job_t *jobs
+                            , IN_ const int job_count
+                            , IN_ const rfid_commission_params_t *params
+                            , OUT_ rfid_commission_result_t *out_results
+                            , OUT_ rfid_commission_stat_t *out_stat
+                            , OUT_ uint32_t *out_status
+                            , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if ((NULL == ctx) || (NULL == jobs) || (job_count <= 0) || (NULL == out_results)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    rfid_commission_params_t p;
+    memset(&p, 0, sizeof(p));
+    if (NULL != params)
+        p = *params;
+    if ((p.antenna < 0) || (p.antenna > 255)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+    const int max_attempts = (p.max_attempts > 0) ? p.max_attempts : RFID_COMMISSION_ATTEMPTS_DEFAULT;
+
+    if (NULL != out_stat)
+        memset(out_stat, 0, sizeof(*out_stat));
+
+    TMR_Status st = TMR_SUCCESS;
+    if (p.antenna > 0) {
+        uint8_t antenna = (uint8_t) p.antenna;
+        st = TMR_paramSet(&ctx->reader, TMR_PARAM_TAGOP_ANTENNA, &antenna);
+    }
+    uint32_t saved_timeout = 0;
+    int restore_timeout = 0;
+    if ((TMR_SUCCESS == st) && (p.op_timeout_ms > 0)) {
+        st = TMR_paramGet(&ctx->reader, TMR_PARAM_COMMANDTIMEOUT, &saved_timeout);
+        if (TMR_SUCCESS == st) {
+            uint32_t timeout = (uint32_t) p.op_timeout_ms;
+            st = TMR_paramSet(&ctx->reader, TMR_PARAM_COMMANDTIMEOUT, &timeout);
+            restore_timeout = (TMR_SUCCESS == st) ? 1 : 0;
+        }
+    }
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    if (TMR_SUCCESS != st)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    // 작업 사이에 호스트 쪽 대기가 없도록 결과만 기록하며 바로 다음 작업을 보낸다.
+    const uint64_t t0 = LinkNowUs_();
+    int succeeded = 0;
+    uint32_t retries = 0;
+    uint32_t max_latency_us = 0;
+    for (int i = 0; i < job_count; ++i) {
+        rfid_commission_result_t *r = &out_results[i];
+        CommissionRunJob_(ctx, &jobs[i], max_attempts, r);
+        if (RFID_RESULT_OK == r->result)
+            succeeded++;
+        if (r->attempts > 1)
+            retries += (uint32_t) (r->attempts - 1);
+        if (r->latency_us > max_latency_us)
+            max_latency_us = r->latency_us;
+    }
+    const uint64_t elapsed_us = LinkNowUs_() - t0;
+
+    // access password 가 이후 명령에 남지 않도록 지운다.
+    TMR_GEN2_Password none = 0;
+    (void) TMR_paramSet(&ctx->reader, TMR_PARAM_GEN2_ACCESSPASSWORD, &none);
+    if (0 != restore_timeout)
+        (void) TMR_paramSet(&ctx->reader, TMR_PARAM_COMMANDTIMEOUT, &saved_timeout);
+
+    if (NULL != out_stat) {
+        out_stat->jobs = job_count;
+        out_stat->succeeded = succeeded;
+        out_stat->failed = job_count - succeeded;
+        out_stat->retries = retries;
+        out_stat->elapsed_us = elapsed_us;
+        out_stat->max_latency_us = max_latency_us;
+        out_stat->tags_per_min = (elapsed_us > 0U) ? ((double) succeeded * 60.0e6) / (double) elapsed_us : 0.0;
+    }
+    return RFID_RESULT_OK;
+}
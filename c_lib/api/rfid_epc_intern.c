@@ -0,0 +1,451 @@
+// c_lib/api/rfid_epc_intern.c
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime, posix_memalign, pthread_rwlock_t
+
+#include "rfid_epc_intern.h"
+#include "rfid_util_internal.h"
+
+#include <pthread.h>  // pthread_rwlock_*
+#include <stddef.h>   // offsetof
+#include <stdlib.h>   // calloc, free, posix_memalign
+#include <string.h>   // memcpy, memcmp, memset
+#include <time.h>     // clock_gettime
+
+// 내부 상수
+#define RFID_EPC_INTERN_CAPACITY     (262144U)     // id 용량 기본값
+#define RFID_EPC_INTERN_CAPACITY_MAX (1U << 26)
+#define RFID_EPC_INTERN_SHARDS       (64U)         // shard 수 기본값
+#define RFID_EPC_INTERN_SHARDS_MAX   (4096U)
+#define RFID_EPC_INTERN_SCAN_MAX     (128U)        // 제거 대상 탐색 1회 최대 항목 수(삽입 지연 상한)
+
+/**
+ * @brief intern 항목(EPC 1개). 배열 인덱스가 shard 안의 id 이다.
+ *
+ * @param hash         EPC 해시
+ * @param last_used_ms 마지막 조회 시각(idle_ms 사용 시, 원자적 접근)
+ * @param referenced   CLOCK 참조 비트(마지막 탐색 이후 조회됨, 원자적 접근)
+ * @param epc_len      EPC 바이트 수
+ * @param epc          바이너리 EPC
+ */
+typedef struct rfid_epc_intern_entry {
+    uint64_t hash;
+    uint64_t last_used_ms;
+    uint8_t referenced;
+    uint8_t epc_len;
+    uint8_t epc[RFID_EPC_MAX_BYTES];
+} rfid_epc_intern_entry_t;
+
+/**
+ * @brief shard(잠금 단위). 캐시 라인 단위로 정렬해 이웃 shard 와 라인을 나누지 않는다.
+ *
+ * @param lock       읽기(조회)/쓰기(발급, 제거) 잠금
+ * @param entries    항목 배열
+ * @param slots      EPC → 항목 인덱스 + 1 선형 탐사 해시 테이블(0: 빈 슬롯)
+ * @param mask       slots 크기 - 1
+ * @param used       발급한 항목 수(0 ~ used - 1 사용 중, 제거 후에는 바로 재사용하므로 줄지 않음)
+ * @param hand       CLOCK 탐색 위치
+ * @param interned   새로 발급한 id 수
+ * @param evicted    재사용한 id 수
+ * @param table_full 용량 초과 횟수
+ */
+typedef struct rfid_epc_intern_shard {
+    pthread_rwlock_t lock;
+    rfid_epc_intern_entry_t *entries;
+    uint32_t *slots;
+    uint32_t mask;
+    uint32_t used;
+    uint32_t hand;
+    uint64_t interned;
+    uint64_t evicted;
+    uint64_t table_full;
+} __attribute__((aligned(64))) rfid_epc_intern_shard_t;
+
+/**
+ * @brief EPC intern 테이블
+ *
+ * @param shards     shard 배열
+ * @param shard_mask shard 수 - 1
+ * @param shard_bits log2(shard 수). id = (shard 안 인덱스 << shard_bits) | shard
+ * @param per_shard  shard 별 항목 수
+ * @param idle_ms    재사용 기준 미조회 시간(0: 재사용 안 함)
+ */
+struct rfid_epc_intern {
+    rfid_epc_intern_shard_t *shards;
+    uint32_t shard_mask;
+    uint32_t shard_bits;
+    uint32_t per_shard;
+    uint32_t idle_ms;
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms). 0이 되지 않게 1을 더한다.
+ */
+static uint64_t InternNowMs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL) + 1U;
+}
+
+/**
+ * @brief shard 에서 EPC 항목을 찾는다(잠금 상태에서 호출).
+ *
+ * @param[in]  s shard
+ * @param[in]  hash 해시
+ * @param[in]  epc EPC
+ * @param[in]  len EPC 바이트 수
+ * @param[out] out_slot 찾은 슬롯, 없으면 삽입할 빈 슬롯
+ *
+ * @return 항목 인덱스(없으면 RFID_EPC_ID_NONE)
+ */
+static uint32_t InternFind_(IN_ const rfid_epc_intern_shard_t *s
+                            , IN_ const uint64_t hash
+                            , IN_ const uint8_t *epc
+                            , IN_ const uint32_t len
+                            , OUT_ uint32_t *out_slot) {
+    uint32_t i = (uint32_t) hash & s->mask;
+    for (;;) {
+        const uint32_t v = s->slots[i];
+        if (0U == v) {
+            *out_slot = i;
+            return RFID_EPC_ID_NONE;
+        }
+        const rfid_epc_intern_entry_t *e = &s->entries[v - 1U];
+        if ((e->hash == hash) && (e->epc_len == len) && (0 == memcmp(e->epc, epc, len))) {
+            *out_slot = i;
+            return v - 1U;
+        }
+        i = (i + 1U) & s->mask;
+    }
+}
+
+/**
+ * @brief 해시 테이블에서 항목을 지운다(backward shift, tombstone 없음).
+ */
+static void InternUnindex_(IN_ rfid_epc_intern_shard_t *s, IN_ const uint32_t idx) {
+    RfidSlotUnindex_(s->slots, s->mask, s->entries, sizeof(rfid_epc_intern_entry_t), offsetof(rfid_epc_intern_entry_t, hash), idx, NULL, NULL);
+}
+
+/**
+ * @brief 조회 시각과 참조 비트를 남긴다(읽기 잠금 상태에서 호출, 값이 같으면 쓰지 않아 캐시 라인을 더럽히지 않는다).
+ */
+static void InternTouch_(IN_ rfid_epc_intern_entry_t *e, IN_ const uint64_t now) {
+    if (__atomic_load_n(&e->last_used_ms, __ATOMIC_RELAXED) != now)
+        __atomic_store_n(&e->last_used_ms, now, __ATOMIC_RELAXED);
+    if (0U == __atomic_load_n(&e->referenced, __ATOMIC_RELAXED))
+        __atomic_store_n(&e->referenced, (uint8_t) 1U, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 재사용할 항목을 CLOCK 방식으로 고른다(쓰기 잠금 상태에서 호출).
+ *
+ * 참조 비트가 선 항목은 비트만 내리고 넘어가고(second chance), 내려가 있으면서 idle_ms 이상 조회되지 않은 항목을 고른다.
+ * 한 번에 RFID_EPC_INTERN_SCAN_MAX 개까지만 보므로 못 찾으면 다음 삽입이 이어서 찾는다.
+ *
+ * @return 항목 인덱스(못 찾으면 RFID_EPC_ID_NONE)
+ */
+static uint32_t InternEvict_(IN_ const rfid_epc_intern_t *t, IN_ rfid_epc_intern_shard_t *s, IN_ const uint64_t now) {
+    for (uint32_t n = 0; n < RFID_EPC_INTERN_SCAN_MAX; ++n) {
+        const uint32_t idx = s->hand;
+        s->hand = (s->hand + 1U < s->used) ? (s->hand + 1U) : 0U;
+        rfid_epc_intern_entry_t *e = &s->entries[idx];
+        if (0U != __atomic_load_n(&e->referenced, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&e->referenced, (uint8_t) 0U, __ATOMIC_RELAXED);
+            continue;
+        }
+        const uint64_t last = __atomic_load_n(&e->last_used_ms, __ATOMIC_RELAXED);
+        if ((now >= last) && ((now - last) >= t->idle_ms))
+            return idx;
+    }
+    return RFID_EPC_ID_NONE;
+}
+
+/**
+ * @brief EPC 의 id 를 찾고, 없으면(insert != 0) 발급한다.
+ *
+ * @param[in] t 테이블
+ * @param[in] epc EPC
+ * @param[in] len EPC 바이트 수
+ * @param[in] now 현재 시각(ms, idle_ms 미사용 시 0)
+ * @param[in] insert 0이면 찾기만 한다
+ *
+ * @return id(없거나 용량 초과면 RFID_EPC_ID_NONE)
+ */
+static uint32_t InternGet_(IN_ rfid_epc_intern_t *t
+                           , IN_ const uint8_t *epc
+                           , IN_ const uint32_t len
+                           , IN_ const uint64_t now
+                           , IN_ const int insert) {
+    const uint64_t hash = RfidEpcHash_(epc, len);
+    const uint32_t shard = (uint32_t) (hash >> 40) & t->shard_mask;
+    rfid_epc_intern_shard_t *s = &t->shards[shard];
+
+    // 대부분은 이미 등록된 EPC 이므로 읽기 잠금으로 먼저 찾는다.
+    uint32_t slot = 0;
+    (void) pthread_rwlock_rdlock(&s->lock);
+    uint32_t idx = InternFind_(s, hash, epc, len, &slot);
+    if ((RFID_EPC_ID_NONE != idx) && (0U != t->idle_ms))
+        InternTouch_(&s->entries[idx], now);
+    (void) pthread_rwlock_unlock(&s->lock);
+    if (RFID_EPC_ID_NONE != idx)
+        return (idx << t->shard_bits) | shard;
+    if (0 == insert)
+        return RFID_EPC_ID_NONE;
+
+    (void) pthread_rwlock_wrlock(&s->lock);
+    // 잠금을 바꾸는 사이 다른 스레드가 발급했을 수 있다.
+    idx = InternFind_(s, hash, epc, len, &slot);
+    if (RFID_EPC_ID_NONE == idx) {
+        if (s->used < t->per_shard) {
+            idx = s->used++;
+        } else if (0U != t->idle_ms) {
+            idx = InternEvict_(t, s, now);
+            if (RFID_EPC_ID_NONE != idx) {
+                InternUnindex_(s, idx);
+                s->evicted++;
+                // backward shift 로 빈 슬롯 위치가 바뀌었을 수 있다.
+                (void) InternFind_(s, hash, epc, len, &slot);
+            }
+        }
+        if (RFID_EPC_ID_NONE == idx) {
+            s->table_full++;
+            (void) pthread_rwlock_unlock(&s->lock);
+            return RFID_EPC_ID_NONE;
+        }
+
+        rfid_epc_intern_entry_t *e = &s->entries[idx];
+        e->hash = hash;
+        e->epc_len = (uint8_t) len;
+        memcpy(e->epc, epc, len);
+        __atomic_store_n(&e->last_used_ms, now, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->referenced, (uint8_t) 0U, __ATOMIC_RELAXED);
+        s->slots[slot] = idx + 1U;
+        s->interned++;
+    } else if (0U != t->idle_ms) {
+        InternTouch_(&s->entries[idx], now);
+    }
+    (void) pthread_rwlock_unlock(&s->lock);
+    return (idx << t->shard_bits) | shard;
+}
+
+/**
+ * @brief 테이블 메모리를 해제한다.
+ */
+static void InternFree_(IN_ rfid_epc_intern_t *t) {
+    if (NULL != t->shards) {
+        for (uint32_t k = 0; k <= t->shard_mask; ++k) {
+            free(t->shards[k].entries);
+            free(t->shards[k].slots);
+            (void) pthread_rwlock_destroy(&t->shards[k].lock);
+        }
+        free(t->shards);
+    }
+    free(t);
+}
+
+/**
+ * @brief 테이블을 만든다.
+ * @param[in]  params 생성 파라미터
+ * @param[out] out_intern 생성된 테이블
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_create(IN_ const rfid_epc_intern_params_t *params, OUT_ rfid_epc_intern_t **out_intern) {
+    if (NULL == out_intern)
+        return RFID_RESULT_INVALID_ARG;
+    *out_intern = NULL;
+
+    rfid_epc_intern_params_t prm;
+    memset(&prm, 0, sizeof(prm));
+    if (NULL != params)
+        prm = *params;
+
+    const uint32_t shards = (0U != prm.shards) ? prm.shards : RFID_EPC_INTERN_SHARDS;
+    const uint32_t capacity = (0U != prm.capacity) ? prm.capacity : RFID_EPC_INTERN_CAPACITY;
+    if ((shards > RFID_EPC_INTERN_SHARDS_MAX) || (0U != (shards & (shards - 1U))) || (capacity > RFID_EPC_INTERN_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_epc_intern_t *t = (rfid_epc_intern_t *) calloc(1, sizeof(rfid_epc_intern_t));
+    if (NULL == t)
+        return RFID_RESULT_INTERNAL_ERROR;
+    t->shard_mask = shards - 1U;
+    while ((1U << t->shard_bits) < shards)
+        t->shard_bits++;
+    t->per_shard = (capacity + shards - 1U) / shards;
+    t->idle_ms = prm.idle_ms;
+
+    void *mem = NULL;
+    if (0 != posix_memalign(&mem, 64U, (size_t) shards * sizeof(rfid_epc_intern_shard_t))) {
+        free(t);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    memset(mem, 0, (size_t) shards * sizeof(rfid_epc_intern_shard_t));
+    t->shards = (rfid_epc_intern_shard_t *) mem;
+    for (uint32_t k = 0; k < shards; ++k)
+        (void) pthread_rwlock_init(&t->shards[k].lock, NULL);
+
+    // 해시 테이블은 shard 용량의 2배 이상인 2의 거듭제곱(적재율 50% 이하).
+    uint32_t table = 2U;
+    while (table < t->per_shard * 2U)
+        table <<= 1;
+    for (uint32_t k = 0; k < shards; ++k) {
+        rfid_epc_intern_shard_t *s = &t->shards[k];
+        s->entries = (rfid_epc_intern_entry_t *) calloc(t->per_shard, sizeof(rfid_epc_intern_entry_t));
+        s->slots = (uint32_t *) calloc(table, sizeof(uint32_t));
+        if ((NULL == s->entries) || (NULL == s->slots)) {
+            InternFree_(t);
+            return RFID_RESULT_INTERNAL_ERROR;
+        }
+        s->mask = table - 1U;
+    }
+
+    *out_intern = t;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 테이블을 해제한다.
+ * @param[in,out] inout_intern 해제할 테이블
+ */
+void rfid_epc_intern_destroy(INOUT_ rfid_epc_intern_t **inout_intern) {
+    if ((NULL == inout_intern) || (NULL == *inout_intern))
+        return;
+
+    InternFree_(*inout_intern);
+    *inout_intern = NULL;
+}
+
+/**
+ * @brief EPC 의 id 를 얻는다(없으면 발급).
+ * @param[in]  intern 테이블
+ * @param[in]  epc EPC
+ * @param[in]  epc_len EPC 바이트 수
+ * @param[out] out_id id
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_get(IN_ rfid_epc_intern_t *intern
+                                , IN_ const uint8_t *epc
+                                , IN_ const uint32_t epc_len
+                                , OUT_ uint32_t *out_id) {
+    if (NULL != out_id)
+        *out_id = RFID_EPC_ID_NONE;
+    if ((NULL == intern) || (NULL == epc) || (0U == epc_len) || (epc_len > RFID_EPC_MAX_BYTES) || (NULL == out_id))
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t now = (0U != intern->idle_ms) ? InternNowMs_() : 0U;
+    *out_id = InternGet_(intern, epc, epc_len, now, 1);
+    return (RFID_EPC_ID_NONE != *out_id) ? RFID_RESULT_OK : RFID_RESULT_INTERNAL_ERROR;
+}
+
+/**
+ * @brief 등록된 EPC 의 id 를 찾는다.
+ * @param[in]  intern 테이블
+ * @param[in]  epc EPC
+ * @param[in]  epc_len EPC 바이트 수
+ * @param[out] out_id id
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_find(IN_ rfid_epc_intern_t *intern
+                                 , IN_ const uint8_t *epc
+                                 , IN_ const uint32_t epc_len
+                                 , OUT_ uint32_t *out_id) {
+    if (NULL != out_id)
+        *out_id = RFID_EPC_ID_NONE;
+    if ((NULL == intern) || (NULL == epc) || (0U == epc_len) || (epc_len > RFID_EPC_MAX_BYTES) || (NULL == out_id))
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t now = (0U != intern->idle_ms) ? InternNowMs_() : 0U;
+    *out_id = InternGet_(intern, epc, epc_len, now, 0);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief id 가 가리키는 EPC 를 얻는다.
+ * @param[in]  intern 테이블
+ * @param[in]  id id
+ * @param[out] out_epc EPC 버퍼
+ * @param[out] out_len EPC 바이트 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_lookup(IN_ rfid_epc_intern_t *intern
+                                   , IN_ const uint32_t id
+                                   , OUT_ uint8_t *out_epc
+                                   , OUT_ uint32_t *out_len) {
+    if (NULL != out_len)
+        *out_len = 0U;
+    if ((NULL == intern) || (NULL == out_epc) || (NULL == out_len) || (RFID_EPC_ID_NONE == id))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_epc_intern_shard_t *s = &intern->shards[id & intern->shard_mask];
+    const uint32_t idx = id >> intern->shard_bits;
+    RFID_RESULT rc = RFID_RESULT_INVALID_ARG;
+    (void) pthread_rwlock_rdlock(&s->lock);
+    if (idx < s->used) {
+        const rfid_epc_intern_entry_t *e = &s->entries[idx];
+        memcpy(out_epc, e->epc, e->epc_len);
+        *out_len = e->epc_len;
+        rc = RFID_RESULT_OK;
+    }
+    (void) pthread_rwlock_unlock(&s->lock);
+    return rc;
+}
+
+/**
+ * @brief 태그 배열의 epc_id 를 채운다.
+ * @param[in]     intern 테이블
+ * @param[in,out] tags 태그 배열
+ * @param[in]     count 태그 개수
+ * @param[out]    out_assigned id 를 얻은 태그 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_tags(IN_ rfid_epc_intern_t *intern
+                                 , INOUT_ rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , OUT_ int *out_assigned) {
+    if (NULL != out_assigned)
+        *out_assigned = 0;
+    if ((NULL == intern) || (count < 0) || ((NULL == tags) && (count > 0)))
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t now = (0U != intern->idle_ms) ? InternNowMs_() : 0U;
+    int assigned = 0;
+    for (int i = 0; i < count; ++i) {
+        rfid_tag_t *tag = &tags[i];
+        if ((0U == tag->epc_len) || (tag->epc_len > RFID_EPC_MAX_BYTES)) {
+            tag->epc_id = RFID_EPC_ID_NONE;
+            continue;
+        }
+        tag->epc_id = InternGet_(intern, tag->epc_bytes, tag->epc_len, now, 1);
+        if (RFID_EPC_ID_NONE != tag->epc_id)
+            assigned++;
+    }
+    if (NULL != out_assigned)
+        *out_assigned = assigned;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 테이블 상태를 조회한다.
+ * @param[in]  intern 테이블
+ * @param[out] out_stat 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_intern_get_stats(IN_ rfid_epc_intern_t *intern, OUT_ rfid_epc_intern_stat_t *out_stat) {
+    if ((NULL == intern) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_epc_intern_stat_t st;
+    memset(&st, 0, sizeof(st));
+    for (uint32_t k = 0; k <= intern->shard_mask; ++k) {
+        rfid_epc_intern_shard_t *s = &intern->shards[k];
+        (void) pthread_rwlock_rdlock(&s->lock);
+        st.interned += s->interned;
+        st.evicted += s->evicted;
+        st.table_full += s->table_full;
+        st.count += s->used;
+        (void) pthread_rwlock_unlock(&s->lock);
+    }
+    st.capacity = intern->per_shard * (intern->shard_mask + 1U);
+    st.shards = intern->shard_mask + 1U;
+
+    *out_stat = st;
+    return RFID_RESULT_OK;
+}
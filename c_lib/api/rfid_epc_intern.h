@@ -0,0 +1,127 @@
+#ifndef RFID_EPC_INTERN_H_
+#define RFID_EPC_INTERN_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 바이너리 EPC ↔ uint32 id 변환 테이블(프로세스 단위). 구현부에서 정의하는 opaque 타입.
+ *
+ * - 상위 계층이 EPC hex 문자열 대신 정수 id 로 배열/맵을 만들 수 있게 EPC 마다 id 를 하나 준다.
+ *   id 는 (shard 안 인덱스 << log2(shards)) | shard 이다. 항상 0 ~ stat.capacity - 1 범위(capacity 를 shard 수의 배수로 올린 값)라
+ *   stat.capacity 크기의 평면 배열을 id 로 바로 인덱싱할 수 있다.
+ * - id 는 shard 안에서만 조밀하다. 발급 순서대로 0 부터 채워지지 않으며, EPC 1개만 등록해도 id 는 그 shard 번호가 될 수 있다.
+ * - EPC 해시로 나눈 shard 마다 읽기/쓰기 잠금과 선형 탐사 해시 테이블을 따로 둔다.
+ *   이미 등록된 EPC 조회는 shard 읽기 잠금만 잡으므로 여러 스레드가 동시에 조회해도 서로 막지 않는다.
+ * - 메모리는 생성 시 고정한다. idle_ms 를 주면 shard 가 가득 찼을 때 CLOCK(second chance) 방식으로
+ *   오래 조회되지 않은 id 를 골라 새 EPC 에 재사용한다(근사 LRU, 삽입 1건당 탐색 수 제한).
+ *   재사용된 id 는 다른 EPC 를 가리키므로 id 를 보관하는 하류 구조는 idle_ms 보다 오래 유지하지 않는다.
+ *   id 에는 세대 값이 없어 id 만으로는 재사용 전후를 구분할 수 없다. 오래 보관한 id 는 rfid_epc_intern_lookup 으로
+ *   EPC 를 다시 확인한다.
+ * - 모든 함수는 여러 스레드에서 동시에 호출할 수 있다(create/destroy 제외).
+ */
+typedef struct rfid_epc_intern rfid_epc_intern_t;
+
+/**
+ * @brief 테이블을 만든다.
+ *
+ * @param[in]  params 생성 파라미터(NULL이면 모두 기본값). 호출 중에만 참조한다.
+ * @param[out] out_intern 생성된 테이블
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류(shard 수가 2의 거듭제곱이 아님 등),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+RFID_RESULT rfid_epc_intern_create(IN_ const rfid_epc_intern_params_t *params, OUT_ rfid_epc_intern_t **out_intern);
+
+/**
+ * @brief 테이블을 해제한다. 성공 시 *inout_intern 을 NULL로 설정한다.
+ * @note 다른 스레드가 사용 중이지 않아야 한다.
+ * @param[in,out] inout_intern 해제할 테이블(NULL 허용)
+ */
+void rfid_epc_intern_destroy(INOUT_ rfid_epc_intern_t **inout_intern);
+
+/**
+ * @brief EPC 의 id 를 얻는다. 처음 보는 EPC 면 새 id 를 발급한다.
+ *
+ * @param[in]  intern 테이블
+ * @param[in]  epc EPC 바이트 배열(MSB first)
+ * @param[in]  epc_len EPC 바이트 수(1..RFID_EPC_MAX_BYTES)
+ * @param[out] out_id id(실패 시 RFID_EPC_ID_NONE)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_INTERNAL_ERROR: 용량 초과(table_full 로 집계)
+ */
+RFID_RESULT rfid_epc_intern_get(IN_ rfid_epc_intern_t *intern
+                                , IN_ const uint8_t *epc
+                                , IN_ const uint32_t epc_len
+                                , OUT_ uint32_t *out_id);
+
+/**
+ * @brief 등록된 EPC 의 id 를 찾는다(발급하지 않음).
+ *
+ * @param[in]  intern 테이블
+ * @param[in]  epc EPC 바이트 배열(MSB first)
+ * @param[in]  epc_len EPC 바이트 수
+ * @param[out] out_id id(등록되지 않았으면 RFID_EPC_ID_NONE)
+ *
+ * @return RFID_RESULT_OK: 성공(등록 여부와 무관),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_epc_intern_find(IN_ rfid_epc_intern_t *intern
+                                 , IN_ const uint8_t *epc
+                                 , IN_ const uint32_t epc_len
+                                 , OUT_ uint32_t *out_id);
+
+/**
+ * @brief id 가 가리키는 EPC 를 얻는다(역방향 조회).
+ *
+ * @param[in]  intern 테이블
+ * @param[in]  id id
+ * @param[out] out_epc EPC 버퍼(RFID_EPC_MAX_BYTES 이상)
+ * @param[out] out_len EPC 바이트 수
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 발급되지 않은 id
+ */
+RFID_RESULT rfid_epc_intern_lookup(IN_ rfid_epc_intern_t *intern
+                                   , IN_ const uint32_t id
+                                   , OUT_ uint8_t *out_epc
+                                   , OUT_ uint32_t *out_len);
+
+/**
+ * @brief 태그 배열의 epc_id 를 채운다(rfid_read() 결과용, 시계는 호출당 1회 읽음).
+ *
+ * @param[in]     intern 테이블
+ * @param[in,out] tags 태그 배열(epc_bytes/epc_len 을 읽고 epc_id 를 쓴다. 실패한 태그는 RFID_EPC_ID_NONE)
+ * @param[in]     count 태그 개수
+ * @param[out]    out_assigned id 를 얻은 태그 수(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_epc_intern_tags(IN_ rfid_epc_intern_t *intern
+                                 , INOUT_ rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , OUT_ int *out_assigned);
+
+/**
+ * @brief 테이블 상태를 조회한다.
+ *
+ * @param[in]  intern 테이블
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_epc_intern_get_stats(IN_ rfid_epc_intern_t *intern, OUT_ rfid_epc_intern_stat_t *out_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_EPC_INTERN_H_
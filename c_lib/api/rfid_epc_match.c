@@ -0,0 +1,571 @@
+// c_lib/api/rfid_epc_match.c
+
+#include "rfid_epc_match.h"
+#include "rfid_util_internal.h"
+
+#include <pthread.h>  // pthread_mutex_*
+#include <stdlib.h>   // malloc, calloc, realloc, free
+#include <string.h>   // memset, memcmp, memcpy, strlen
+
+// 내부 상수
+#define RFID_EPC_NIBBLES_MAX        (RFID_EPC_MAX_BYTES * 2)
+#define RFID_EPC_MATCH_FANOUT       (16U)          // 4bit(nibble) 단위 전이
+#define RFID_EPC_MATCH_MAX_STATES   (1U << 20)     // 컴파일 상태 수 한도(와일드카드 폭증 방지)
+#define RFID_EPC_MATCH_MEMO_INIT    (1024U)        // 상태 중복 제거 해시 테이블 초기 크기(2의 거듭제곱)
+
+/**
+ * @brief 컴파일된 규칙 집합(불변)
+ *
+ * @param next        상태별 16개 전이(state * 16 + nibble)
+ * @param accept      상태에 도달했을 때까지 일치한 규칙 id(RFID_EPC_RULE_NONE: 없음)
+ * @param leaf        1이면 더 진행 중인 규칙이 없어 분류가 확정된 상태
+ * @param state_count 상태 수
+ * @param refcount    참조 카운트
+ */
+struct rfid_epc_rules {
+    int32_t *next;
+    uint32_t *accept;
+    uint8_t *leaf;
+    uint32_t state_count;
+    int refcount;
+};
+
+/**
+ * @brief 런타임 교체 가능한 규칙 보관소
+ *
+ * @param lock    current 교체/획득 보호(스냅샷 획득 시 참조 카운트를 올리는 짧은 구간만 잠근다)
+ * @param current 현재 규칙 집합(NULL 허용)
+ */
+struct rfid_epc_matcher {
+    pthread_mutex_t lock;
+    rfid_epc_rules_t *current;
+};
+
+/**
+ * @brief nibble 단위로 펼친 규칙(컴파일 입력)
+ */
+typedef struct rfid_nib_rule {
+    uint8_t val[RFID_EPC_NIBBLES_MAX];
+    uint8_t msk[RFID_EPC_NIBBLES_MAX];
+    uint32_t len;
+    uint32_t bits;
+    uint32_t rule_id;
+} rfid_nib_rule_t;
+
+/**
+ * @brief 컴파일 중인 DFA 상태
+ *
+ * @param depth     처리한 nibble 수(leaf 상태는 공유를 위해 0으로 정규화)
+ * @param best      지금까지 일치한 규칙 인덱스(-1: 없음)
+ * @param alive_off 아직 비교 중인 규칙 인덱스 목록의 arena 오프셋
+ * @param alive_len 아직 비교 중인 규칙 수(0이면 leaf)
+ * @param hash      (depth, best, alive) 해시
+ */
+typedef struct rfid_build_state {
+    uint32_t depth;
+    int32_t best;
+    uint32_t alive_off;
+    uint32_t alive_len;
+    uint64_t hash;
+} rfid_build_state_t;
+
+/**
+ * @brief DFA 컴파일 작업 공간
+ */
+typedef struct rfid_builder {
+    const rfid_nib_rule_t *rules;
+    rfid_build_state_t *states;
+    int32_t *next;
+    uint32_t state_count;
+    uint32_t state_cap;
+    uint32_t *arena;
+    uint32_t arena_len;
+    uint32_t arena_cap;
+    int32_t *memo;
+    uint32_t memo_cap;
+} rfid_builder_t;
+
+/**
+ * @brief hex 문자 1개를 nibble 값으로 변환한다.
+ * @param c hex 문자
+ * @return 0..15, 잘못된 문자이면 -1
+ */
+static int HexNibble_(IN_ const char c) {
+    if ((c >= '0') && (c <= '9'))
+        return c - '0';
+    if ((c >= 'a') && (c <= 'f'))
+        return c - 'a' + 10;
+    if ((c >= 'A') && (c <= 'F'))
+        return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * @brief hex 문자열을 nibble 배열로 변환한다.
+ * @param[in]  hex hex 문자열
+ * @param[out] out nibble 배열(RFID_EPC_NIBBLES_MAX 이상)
+ * @param[out] out_len nibble 수
+ * @return 성공 1, 실패(빈 문자열/잘못된 문자/너무 김) 0
+ */
+static int ParseHexNibbles_(IN_ const char *hex, OUT_ uint8_t *out, OUT_ uint32_t *out_len) {
+    if ((NULL == hex) || ('\0' == hex[0]))
+        return 0;
+
+    const size_t n = strlen(hex);
+    if (n > RFID_EPC_NIBBLES_MAX)
+        return 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        const int v = HexNibble_(hex[i]);
+        if (v < 0)
+            return 0;
+        out[i] = (uint8_t) v;
+    }
+    *out_len = (uint32_t) n;
+    return 1;
+}
+
+/**
+ * @brief 사용자 규칙을 nibble 단위 (value, mask) 형태로 변환한다.
+ * @param[in]  src 사용자 규칙
+ * @param[out] dst 변환 결과
+ * @return 성공 1, 실패 0
+ */
+static int ExpandRule_(IN_ const rfid_epc_rule_t *src, OUT_ rfid_nib_rule_t *dst) {
+    uint32_t value_len = 0;
+    memset(dst, 0, sizeof(*dst));
+    if ((RFID_EPC_RULE_NONE == src->rule_id) || (0 == ParseHexNibbles_(src->value_hex, dst->val, &value_len)))
+        return 0;
+
+    const uint32_t max_bits = value_len * 4U;
+    const uint32_t bits = (src->bit_length > 0) ? (uint32_t) src->bit_length : max_bits;
+    if (bits > max_bits)
+        return 0;
+
+    dst->len = (bits + 3U) / 4U;
+    dst->bits = bits;
+    dst->rule_id = src->rule_id;
+    for (uint32_t i = 0; i < dst->len; ++i)
+        dst->msk[i] = 0x0F;
+    if (0U != (bits % 4U))
+        dst->msk[dst->len - 1U] = (uint8_t) ((0x0FU << (4U - (bits % 4U))) & 0x0FU);
+
+    if (NULL != src->mask_hex) {
+        uint8_t mask[RFID_EPC_NIBBLES_MAX];
+        uint32_t mask_len = 0;
+        if ((0 == ParseHexNibbles_(src->mask_hex, mask, &mask_len)) || (mask_len < dst->len))
+            return 0;
+        for (uint32_t i = 0; i < dst->len; ++i)
+            dst->msk[i] &= mask[i];
+    }
+
+    for (uint32_t i = 0; i < dst->len; ++i)
+        dst->val[i] &= dst->msk[i];
+    return 1;
+}
+
+/**
+ * @brief (depth, best, alive) 조합의 64비트 FNV-1a 해시를 계산한다.
+ */
+static uint64_t HashState_(IN_ const uint32_t depth
+                           , IN_ const int32_t best
+                           , IN_ const uint32_t *alive
+                           , IN_ const uint32_t alive_len) {
+    uint64_t h = RFID_FNV64_OFFSET;
+    h = (h ^ depth) * RFID_FNV64_PRIME;
+    h = (h ^ (uint32_t) best) * RFID_FNV64_PRIME;
+    for (uint32_t i = 0; i < alive_len; ++i)
+        h = (h ^ alive[i]) * RFID_FNV64_PRIME;
+    return h;
+}
+
+/**
+ * @brief 중복 제거 해시 테이블을 두 배로 늘리고 기존 상태를 다시 넣는다.
+ * @return 성공 1, 할당 실패 0
+ */
+static int GrowMemo_(IN_ rfid_builder_t *b) {
+    const uint32_t cap = (0U == b->memo_cap) ? RFID_EPC_MATCH_MEMO_INIT : b->memo_cap * 2U;
+    int32_t *memo = (int32_t *) malloc((size_t) cap * sizeof(int32_t));
+    if (NULL == memo)
+        return 0;
+    for (uint32_t i = 0; i < cap; ++i)
+        memo[i] = -1;
+
+    for (uint32_t s = 0; s < b->state_count; ++s) {
+        uint32_t slot = (uint32_t) b->states[s].hash & (cap - 1U);
+        while (memo[slot] >= 0)
+            slot = (slot + 1U) & (cap - 1U);
+        memo[slot] = (int32_t) s;
+    }
+
+    free(b->memo);
+    b->memo = memo;
+    b->memo_cap = cap;
+    return 1;
+}
+
+/**
+ * @brief 같은 상태가 있으면 그 번호를, 없으면 새 상태를 추가하고 번호를 반환한다.
+ *
+ * @param[in] b 작업 공간
+ * @param[in] depth 처리한 nibble 수
+ * @param[in] best 지금까지 일치한 규칙 인덱스(-1: 없음)
+ * @param[in] alive 아직 비교 중인 규칙 인덱스(오름차순)
+ * @param[in] alive_len alive 개수
+ *
+ * @return 상태 번호, 할당 실패/상태 수 한도 초과 시 -1
+ */
+static int32_t FindOrAddState_(IN_ rfid_builder_t *b
+                               , IN_ uint32_t depth
+                               , IN_ const int32_t best
+                               , IN_ const uint32_t *alive
+                               , IN_ const uint32_t alive_len) {
+    // leaf 상태는 깊이와 무관하게 결과가 같으므로 공유한다.
+    if (0U == alive_len)
+        depth = 0;
+
+    const uint64_t h = HashState_(depth, best, alive, alive_len);
+    uint32_t slot = (uint32_t) h & (b->memo_cap - 1U);
+    while (b->memo[slot] >= 0) {
+        const rfid_build_state_t *s = &b->states[b->memo[slot]];
+        if ((s->hash == h) && (s->depth == depth) && (s->best == best) && (s->alive_len == alive_len)
+            && (0 == memcmp(&b->arena[s->alive_off], alive, (size_t) alive_len * sizeof(uint32_t))))
+            return b->memo[slot];
+        slot = (slot + 1U) & (b->memo_cap - 1U);
+    }
+
+    if (b->state_count >= RFID_EPC_MATCH_MAX_STATES)
+        return -1;
+
+    if (b->state_count == b->state_cap) {
+        const uint32_t cap = b->state_cap * 2U;
+        rfid_build_state_t *states = (rfid_build_state_t *) realloc(b->states, (size_t) cap * sizeof(rfid_build_state_t));
+        if (NULL == states)
+            return -1;
+        b->states = states;
+        int32_t *next = (int32_t *) realloc(b->next, (size_t) cap * RFID_EPC_MATCH_FANOUT * sizeof(int32_t));
+        if (NULL == next)
+            return -1;
+        b->next = next;
+        b->state_cap = cap;
+    }
+
+    if (b->arena_len + alive_len > b->arena_cap) {
+        uint32_t cap = b->arena_cap;
+        while (b->arena_len + alive_len > cap)
+            cap *= 2U;
+        uint32_t *arena = (uint32_t *) realloc(b->arena, (size_t) cap * sizeof(uint32_t));
+        if (NULL == arena)
+            return -1;
+        b->arena = arena;
+        b->arena_cap = cap;
+    }
+
+    const uint32_t id = b->state_count++;
+    rfid_build_state_t *s = &b->states[id];
+    s->depth = depth;
+    s->best = best;
+    s->alive_off = b->arena_len;
+    s->alive_len = alive_len;
+    s->hash = h;
+    memcpy(&b->arena[b->arena_len], alive, (size_t) alive_len * sizeof(uint32_t));
+    b->arena_len += alive_len;
+
+    b->memo[slot] = (int32_t) id;
+    if ((b->state_count * 2U) > b->memo_cap) {
+        if (0 == GrowMemo_(b))
+            return -1;
+    }
+    return (int32_t) id;
+}
+
+/**
+ * @brief 컴파일 작업 공간을 해제한다.
+ */
+static void FreeBuilder_(IN_ rfid_builder_t *b) {
+    free(b->states);
+    free(b->next);
+    free(b->arena);
+    free(b->memo);
+    memset(b, 0, sizeof(*b));
+}
+
+/**
+ * @brief nibble 규칙 목록으로 DFA를 만든다(부분집합 구성).
+ *
+ * 상태 = (깊이, 지금까지의 최선 일치, 아직 비교 중인 규칙 집합). 같은 조합은 하나로 합친다.
+ * 규칙은 자신의 길이에 도달하는 전이에서 완료되며, 더 깊은 완료가 더 긴 일치이므로 best를 덮어쓴다.
+ *
+ * @param[in] b 작업 공간(rules 설정됨)
+ * @param[in] rule_count 규칙 수
+ * @return RFID_RESULT_OK / RFID_RESULT_INVALID_ARG(상태 수 한도 초과) / RFID_RESULT_INTERNAL_ERROR
+ */
+static RFID_RESULT BuildDfa_(IN_ rfid_builder_t *b, IN_ const uint32_t rule_count) {
+    b->state_cap = 64U;
+    b->arena_cap = (rule_count > 0U) ? rule_count * 2U : 16U;
+    b->states = (rfid_build_state_t *) malloc((size_t) b->state_cap * sizeof(rfid_build_state_t));
+    b->next = (int32_t *) malloc((size_t) b->state_cap * RFID_EPC_MATCH_FANOUT * sizeof(int32_t));
+    b->arena = (uint32_t *) malloc((size_t) b->arena_cap * sizeof(uint32_t));
+    uint32_t *tmp = (uint32_t *) malloc(((size_t) rule_count + 1U) * sizeof(uint32_t));
+    if ((NULL == b->states) || (NULL == b->next) || (NULL == b->arena) || (NULL == tmp) || (0 == GrowMemo_(b))) {
+        free(tmp);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    for (uint32_t i = 0; i < rule_count; ++i)
+        tmp[i] = i;
+    if (FindOrAddState_(b, 0, -1, tmp, rule_count) < 0) {
+        free(tmp);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    for (uint32_t s = 0; s < b->state_count; ++s) {
+        const rfid_build_state_t cur = b->states[s];
+        int32_t *next = &b->next[(size_t) s * RFID_EPC_MATCH_FANOUT];
+
+        if (0U == cur.alive_len) {
+            for (uint32_t v = 0; v < RFID_EPC_MATCH_FANOUT; ++v)
+                next[v] = (int32_t) s;
+            continue;
+        }
+
+        for (uint32_t v = 0; v < RFID_EPC_MATCH_FANOUT; ++v) {
+            // arena는 상태 추가 시 재할당될 수 있으므로 매번 다시 얻는다.
+            const uint32_t *alive = &b->arena[cur.alive_off];
+            int32_t best = cur.best;
+            uint32_t completed_bits = 0;
+            uint32_t n = 0;
+
+            for (uint32_t k = 0; k < cur.alive_len; ++k) {
+                const rfid_nib_rule_t *r = &b->rules[alive[k]];
+                if ((v & r->msk[cur.depth]) != r->val[cur.depth])
+                    continue;
+                if (r->len == cur.depth + 1U) {
+                    // 같은 nibble에서 끝나는 규칙끼리는 비트 수가 긴 쪽, 같으면 앞선 규칙(alive는 오름차순)
+                    if (r->bits > completed_bits) {
+                        best = (int32_t) alive[k];
+                        completed_bits = r->bits;
+                    }
+                }
+                else {
+                    tmp[n++] = alive[k];
+                }
+            }
+
+            const int32_t id = FindOrAddState_(b, cur.depth + 1U, best, tmp, n);
+            if (id < 0) {
+                free(tmp);
+                return (b->state_count >= RFID_EPC_MATCH_MAX_STATES) ? RFID_RESULT_INVALID_ARG : RFID_RESULT_INTERNAL_ERROR;
+            }
+            // FindOrAddState_()가 next를 재할당했을 수 있다.
+            next = &b->next[(size_t) s * RFID_EPC_MATCH_FANOUT];
+            next[v] = id;
+        }
+    }
+
+    free(tmp);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 규칙 집합을 컴파일한다.
+ *
+ * @param[in]  rules 규칙 배열
+ * @param[in]  rule_count 규칙 개수
+ * @param[out] out_rules 컴파일 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류/상태 수 한도 초과,
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+RFID_RESULT rfid_epc_rules_compile(IN_ const rfid_epc_rule_t *rules
+                                   , IN_ const int rule_count
+                                   , OUT_ rfid_epc_rules_t **out_rules) {
+    if ((NULL == out_rules) || (rule_count < 0) || ((rule_count > 0) && (NULL == rules)))
+        return RFID_RESULT_INVALID_ARG;
+    *out_rules = NULL;
+
+    rfid_nib_rule_t *nib = NULL;
+    if (rule_count > 0) {
+        nib = (rfid_nib_rule_t *) malloc((size_t) rule_count * sizeof(rfid_nib_rule_t));
+        if (NULL == nib)
+            return RFID_RESULT_INTERNAL_ERROR;
+        for (int i = 0; i < rule_count; ++i) {
+            if (0 == ExpandRule_(&rules[i], &nib[i])) {
+                free(nib);
+                return RFID_RESULT_INVALID_ARG;
+            }
+        }
+    }
+
+    rfid_builder_t b;
+    memset(&b, 0, sizeof(b));
+    b.rules = nib;
+
+    RFID_RESULT ret = BuildDfa_(&b, (uint32_t) rule_count);
+    if (RFID_RESULT_OK != ret) {
+        FreeBuilder_(&b);
+        free(nib);
+        return ret;
+    }
+
+    rfid_epc_rules_t *out = (rfid_epc_rules_t *) calloc(1, sizeof(*out));
+    if (NULL != out) {
+        out->next = (int32_t *) malloc((size_t) b.state_count * RFID_EPC_MATCH_FANOUT * sizeof(int32_t));
+        out->accept = (uint32_t *) malloc((size_t) b.state_count * sizeof(uint32_t));
+        out->leaf = (uint8_t *) malloc((size_t) b.state_count);
+    }
+    if ((NULL == out) || (NULL == out->next) || (NULL == out->accept) || (NULL == out->leaf)) {
+        if (NULL != out) {
+            free(out->next);
+            free(out->accept);
+            free(out->leaf);
+            free(out);
+        }
+        FreeBuilder_(&b);
+        free(nib);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    memcpy(out->next, b.next, (size_t) b.state_count * RFID_EPC_MATCH_FANOUT * sizeof(int32_t));
+    for (uint32_t s = 0; s < b.state_count; ++s) {
+        out->accept[s] = (b.states[s].best >= 0) ? nib[b.states[s].best].rule_id : RFID_EPC_RULE_NONE;
+        out->leaf[s] = (0U == b.states[s].alive_len) ? 1U : 0U;
+    }
+    out->state_count = b.state_count;
+    out->refcount = 1;
+
+    FreeBuilder_(&b);
+    free(nib);
+    *out_rules = out;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 규칙 집합의 참조 카운트를 올린다.
+ * @param[in] rules 규칙 집합(NULL 허용)
+ */
+void rfid_epc_rules_retain(IN_ rfid_epc_rules_t *rules) {
+    if (NULL != rules)
+        (void) __atomic_add_fetch(&rules->refcount, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 규칙 집합의 참조 카운트를 내리고, 0이 되면 해제한다.
+ * @param[in] rules 규칙 집합(NULL 허용)
+ */
+void rfid_epc_rules_release(IN_ rfid_epc_rules_t *rules) {
+    if (NULL == rules)
+        return;
+    if (0 != __atomic_sub_fetch(&rules->refcount, 1, __ATOMIC_ACQ_REL))
+        return;
+    free(rules->next);
+    free(rules->accept);
+    free(rules->leaf);
+    free(rules);
+}
+
+/**
+ * @brief 바이너리 EPC 1건을 분류한다.
+ *
+ * @param[in] rules 규칙 집합
+ * @param[in] epc EPC 바이트 배열
+ * @param[in] epc_len EPC 바이트 수
+ *
+ * @return 일치한 rule_id, 없으면 RFID_EPC_RULE_NONE
+ */
+uint32_t rfid_epc_rules_classify(IN_ const rfid_epc_rules_t *rules, IN_ const uint8_t *epc, IN_ const uint32_t epc_len) {
+    if ((NULL == rules) || ((NULL == epc) && (epc_len > 0U)))
+        return RFID_EPC_RULE_NONE;
+
+    const int32_t *next = rules->next;
+    const uint8_t *leaf = rules->leaf;
+    uint32_t s = 0;
+    for (uint32_t i = 0; (i < epc_len) && (0U == leaf[s]); ++i) {
+        const uint32_t byte = epc[i];
+        s = (uint32_t) next[s * RFID_EPC_MATCH_FANOUT + (byte >> 4)];
+        if (0U != leaf[s])
+            break;
+        s = (uint32_t) next[s * RFID_EPC_MATCH_FANOUT + (byte & 0x0FU)];
+    }
+    return rules->accept[s];
+}
+
+/**
+ * @brief 컴파일된 DFA 상태 수를 반환한다.
+ * @param[in] rules 규칙 집합
+ * @return 상태 수(NULL이면 0)
+ */
+uint32_t rfid_epc_rules_state_count(IN_ const rfid_epc_rules_t *rules) {
+    return (NULL != rules) ? rules->state_count : 0U;
+}
+
+/**
+ * @brief 규칙 보관소를 생성한다.
+ * @param[out] out_matcher 생성된 보관소
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_epc_matcher_create(OUT_ rfid_epc_matcher_t **out_matcher) {
+    if (NULL == out_matcher)
+        return RFID_RESULT_INVALID_ARG;
+    *out_matcher = NULL;
+
+    rfid_epc_matcher_t *m = (rfid_epc_matcher_t *) calloc(1, sizeof(*m));
+    if (NULL == m)
+        return RFID_RESULT_INTERNAL_ERROR;
+    if (0 != pthread_mutex_init(&m->lock, NULL)) {
+        free(m);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    *out_matcher = m;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 규칙 보관소를 해제한다.
+ * @param[in,out] inout_matcher 해제할 보관소
+ */
+void rfid_epc_matcher_destroy(INOUT_ rfid_epc_matcher_t **inout_matcher) {
+    if ((NULL == inout_matcher) || (NULL == *inout_matcher))
+        return;
+
+    rfid_epc_matcher_t *m = *inout_matcher;
+    rfid_epc_rules_release(m->current);
+    pthread_mutex_destroy(&m->lock);
+    free(m);
+    *inout_matcher = NULL;
+}
+
+/**
+ * @brief 보관소의 규칙 집합을 교체한다.
+ * @param[in] matcher 규칙 보관소
+ * @param[in] rules 새 규칙 집합(NULL 허용)
+ */
+void rfid_epc_matcher_swap(IN_ rfid_epc_matcher_t *matcher, IN_ rfid_epc_rules_t *rules) {
+    if (NULL == matcher)
+        return;
+
+    rfid_epc_rules_retain(rules);
+    pthread_mutex_lock(&matcher->lock);
+    rfid_epc_rules_t *old = matcher->current;
+    matcher->current = rules;
+    pthread_mutex_unlock(&matcher->lock);
+    rfid_epc_rules_release(old);
+}
+
+/**
+ * @brief 현재 규칙 집합의 스냅샷을 얻는다.
+ * @param[in] matcher 규칙 보관소
+ * @return 규칙 집합(참조 카운트 증가됨), 없으면 NULL
+ */
+rfid_epc_rules_t* rfid_epc_matcher_acquire(IN_ rfid_epc_matcher_t *matcher) {
+    if (NULL == matcher)
+        return NULL;
+
+    pthread_mutex_lock(&matcher->lock);
+    rfid_epc_rules_t *rules = matcher->current;
+    rfid_epc_rules_retain(rules);
+    pthread_mutex_unlock(&matcher->lock);
+    return rules;
+}
@@ -0,0 +1,109 @@
+#ifndef RFID_EPC_MATCH_H_
+#define RFID_EPC_MATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 컴파일된 EPC 규칙 집합(불변, 참조 카운트). 구현부에서 정의하는 opaque 타입.
+ *
+ * 규칙을 4bit(nibble) 단위 DFA로 컴파일해 두고, 태그 1건을 EPC 길이에 비례하는 시간(O(EPC nibble 수))에 분류한다.
+ * 컴파일 이후에는 읽기 전용이므로 여러 스레드에서 동시에 rfid_epc_rules_classify()를 호출해도 안전하다.
+ */
+typedef struct rfid_epc_rules rfid_epc_rules_t;
+
+/**
+ * @brief 런타임 교체가 가능한 규칙 집합 보관소. 구현부에서 정의하는 opaque 타입.
+ *
+ * - rfid_epc_matcher_swap()으로 새 규칙 집합을 원자적으로 교체한다.
+ * - rfid_epc_matcher_acquire()로 얻은 스냅샷은 교체 이후에도 release 전까지 유효하다.
+ */
+typedef struct rfid_epc_matcher rfid_epc_matcher_t;
+
+/**
+ * @brief 규칙 집합을 컴파일한다.
+ *
+ * - 여러 규칙이 일치하면 비교 비트 수(bit_length)가 가장 긴 규칙을, 같으면 배열에서 앞선 규칙을 고른다.
+ * - 성공 시 *out_rules 의 참조 카운트는 1이며, 사용 후 rfid_epc_rules_release()로 해제한다.
+ *
+ * @param[in]  rules 규칙 배열. rule_count > 0 이면 NULL 불가. 호출 중에만 참조한다.
+ * @param[in]  rule_count 규칙 개수(0 허용: 모든 태그가 불일치)
+ * @param[out] out_rules 컴파일 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 잘못된 hex/길이 또는 상태 수 한도 초과,
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+RFID_RESULT rfid_epc_rules_compile(IN_ const rfid_epc_rule_t *rules
+                                   , IN_ const int rule_count
+                                   , OUT_ rfid_epc_rules_t **out_rules);
+
+/**
+ * @brief 규칙 집합의 참조 카운트를 올린다.
+ * @param[in] rules 규칙 집합(NULL 허용)
+ */
+void rfid_epc_rules_retain(IN_ rfid_epc_rules_t *rules);
+
+/**
+ * @brief 규칙 집합의 참조 카운트를 내리고, 0이 되면 해제한다.
+ * @param[in] rules 규칙 집합(NULL 허용)
+ */
+void rfid_epc_rules_release(IN_ rfid_epc_rules_t *rules);
+
+/**
+ * @brief 바이너리 EPC 1건을 분류한다.
+ *
+ * @param[in] rules 규칙 집합(NULL이면 RFID_EPC_RULE_NONE)
+ * @param[in] epc EPC 바이트 배열(MSB first)
+ * @param[in] epc_len EPC 바이트 수
+ *
+ * @return 일치한 규칙의 rule_id, 없으면 RFID_EPC_RULE_NONE
+ */
+uint32_t rfid_epc_rules_classify(IN_ const rfid_epc_rules_t *rules, IN_ const uint8_t *epc, IN_ const uint32_t epc_len);
+
+/**
+ * @brief 컴파일된 DFA 상태 수를 반환한다(메모리 사용량 확인용).
+ * @param[in] rules 규칙 집합(NULL이면 0)
+ * @return 상태 수
+ */
+uint32_t rfid_epc_rules_state_count(IN_ const rfid_epc_rules_t *rules);
+
+/**
+ * @brief 규칙 보관소를 생성한다(초기 규칙 없음).
+ * @param[out] out_matcher 생성된 보관소
+ * @return RFID_RESULT_OK: 성공, RFID_RESULT_INVALID_ARG: 인자 오류, RFID_RESULT_INTERNAL_ERROR: 할당 실패
+ */
+RFID_RESULT rfid_epc_matcher_create(OUT_ rfid_epc_matcher_t **out_matcher);
+
+/**
+ * @brief 규칙 보관소를 해제한다. 성공 시 *inout_matcher 를 NULL로 설정한다.
+ * @param[in,out] inout_matcher 해제할 보관소(NULL 허용)
+ */
+void rfid_epc_matcher_destroy(INOUT_ rfid_epc_matcher_t **inout_matcher);
+
+/**
+ * @brief 보관소의 규칙 집합을 교체한다.
+ *
+ * - rules 에 대한 참조를 하나 가져가므로, 호출자는 자신의 참조를 따로 release 해야 한다.
+ * - 이전 규칙 집합은 마지막 스냅샷이 release 될 때 해제된다.
+ *
+ * @param[in] matcher 규칙 보관소
+ * @param[in] rules 새 규칙 집합(NULL이면 규칙 제거)
+ */
+void rfid_epc_matcher_swap(IN_ rfid_epc_matcher_t *matcher, IN_ rfid_epc_rules_t *rules);
+
+/**
+ * @brief 현재 규칙 집합의 스냅샷을 얻는다. 사용 후 rfid_epc_rules_release()로 반납한다.
+ * @param[in] matcher 규칙 보관소(NULL 허용)
+ * @return 규칙 집합(참조 카운트 증가됨), 규칙이 없으면 NULL
+ */
+rfid_epc_rules_t* rfid_epc_matcher_acquire(IN_ rfid_epc_matcher_t *matcher);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_EPC_MATCH_H_
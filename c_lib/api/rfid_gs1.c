@@ -0,0 +1,286 @@
+// c_lib/api/rfid_gs1.c
+
+#include "rfid_gs1.h"
+
+#include <string.h>  // memcpy
+
+// 내부 상수
+#define RFID_GS1_EPC_BYTES      (12U) // 96bit EPC
+#define RFID_GS1_PARTITIONS     (7)   // partition 0..6 (7은 예약)
+#define RFID_GS1_BODY_BITS      (82U) // header 8 + filter 3 + partition 3 이후 남은 비트 수
+#define RFID_GS1_SERIAL_BITS    (38U) // SGTIN-96/GRAI-96 serial 비트 수
+
+/**
+ * @brief (방식, partition) 별 필드 배치. 96bit 값에서 업체 코드/참조 필드의 LSB 위치와 mask.
+ *
+ * @param company_digits   업체 코드 자릿수
+ * @param reference_digits 참조 자릿수
+ * @param company_shift    업체 코드 LSB 위치
+ * @param reference_shift  참조 LSB 위치
+ * @param company_mask     업체 코드 mask
+ * @param reference_mask   참조 mask
+ */
+typedef struct rfid_gs1_layout {
+    uint8_t company_digits;
+    uint8_t reference_digits;
+    uint8_t company_shift;
+    uint8_t reference_shift;
+    uint64_t company_mask;
+    uint64_t reference_mask;
+} rfid_gs1_layout_t;
+
+// 업체 코드 비트/자릿수, 참조 비트/자릿수로 배치 항목을 만든다(업체 코드가 header/filter/partition 바로 뒤).
+#define RFID_GS1_LAYOUT(cp_bits, cp_digits, ref_bits, ref_digits) \
+    { (cp_digits), (ref_digits), \
+      (uint8_t) (RFID_GS1_BODY_BITS - (cp_bits)), (uint8_t) (RFID_GS1_BODY_BITS - (cp_bits) - (ref_bits)), \
+      (1ULL << (cp_bits)) - 1ULL, (1ULL << (ref_bits)) - 1ULL }
+
+// EPC Tag Data Standard partition 표(RFID_GS1_SCHEME - 1 순서)
+static const rfid_gs1_layout_t rfid_gs1_layouts_[4][RFID_GS1_PARTITIONS] = {
+    {   // SGTIN-96: 업체 코드 + 지시자/품목 참조 = 44bit, serial 38bit
+        RFID_GS1_LAYOUT(40, 12, 4, 1), RFID_GS1_LAYOUT(37, 11, 7, 2), RFID_GS1_LAYOUT(34, 10, 10, 3),
+        RFID_GS1_LAYOUT(30, 9, 14, 4), RFID_GS1_LAYOUT(27, 8, 17, 5), RFID_GS1_LAYOUT(24, 7, 20, 6),
+        RFID_GS1_LAYOUT(20, 6, 24, 7)
+    },
+    {   // SSCC-96: 업체 코드 + 확장/serial 참조 = 58bit, 나머지 24bit 미사용
+        RFID_GS1_LAYOUT(40, 12, 18, 5), RFID_GS1_LAYOUT(37, 11, 21, 6), RFID_GS1_LAYOUT(34, 10, 24, 7),
+        RFID_GS1_LAYOUT(30, 9, 28, 8), RFID_GS1_LAYOUT(27, 8, 31, 9), RFID_GS1_LAYOUT(24, 7, 34, 10),
+        RFID_GS1_LAYOUT(20, 6, 38, 11)
+    },
+    {   // GRAI-96: 업체 코드 + 자산 유형 = 44bit, serial 38bit
+        RFID_GS1_LAYOUT(40, 12, 4, 0), RFID_GS1_LAYOUT(37, 11, 7, 1), RFID_GS1_LAYOUT(34, 10, 10, 2),
+        RFID_GS1_LAYOUT(30, 9, 14, 3), RFID_GS1_LAYOUT(27, 8, 17, 4), RFID_GS1_LAYOUT(24, 7, 20, 5),
+        RFID_GS1_LAYOUT(20, 6, 24, 6)
+    },
+    {   // GIAI-96: 업체 코드 + 개별 자산 참조 = 82bit
+        RFID_GS1_LAYOUT(40, 12, 42, 13), RFID_GS1_LAYOUT(37, 11, 45, 14), RFID_GS1_LAYOUT(34, 10, 48, 15),
+        RFID_GS1_LAYOUT(30, 9, 52, 16), RFID_GS1_LAYOUT(27, 8, 55, 17), RFID_GS1_LAYOUT(24, 7, 58, 18),
+        RFID_GS1_LAYOUT(20, 6, 62, 19)
+    }
+};
+
+// 10^n (n = 0..19), 자릿수 범위 검사용
+static const uint64_t rfid_gs1_pow10_[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+    1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/**
+ * @brief EPC header 를 방식으로 바꾼다.
+ */
+static RFID_GS1_SCHEME Gs1SchemeOf_(IN_ const uint8_t header) {
+    switch (header) {
+        case 0x30: return RFID_GS1_SGTIN_96;
+        case 0x31: return RFID_GS1_SSCC_96;
+        case 0x33: return RFID_GS1_GRAI_96;
+        case 0x34: return RFID_GS1_GIAI_96;
+        default: return RFID_GS1_UNKNOWN;
+    }
+}
+
+/**
+ * @brief 96bit 값(hi: 상위 64bit, lo: 하위 32bit)에서 shift 위치의 필드를 꺼낸다.
+ */
+static uint64_t Gs1Field_(IN_ const uint64_t hi, IN_ const uint32_t lo, IN_ const uint32_t shift, IN_ const uint64_t mask) {
+    if (shift >= 32U)
+        return (hi >> (shift - 32U)) & mask;
+    return ((hi << (32U - shift)) | ((uint64_t) lo >> shift)) & mask;
+}
+
+/**
+ * @brief 96bit EPC 1건을 해석한다(길이 확인은 호출자 몫).
+ * @return 1: 해석함, 0: 해석하지 못함
+ */
+static int Gs1Decode_(IN_ const uint8_t *epc, OUT_ rfid_gs1_record_t *out) {
+    const uint64_t hi = ((uint64_t) epc[0] << 56) | ((uint64_t) epc[1] << 48) | ((uint64_t) epc[2] << 40)
+                        | ((uint64_t) epc[3] << 32) | ((uint64_t) epc[4] << 24) | ((uint64_t) epc[5] << 16)
+                        | ((uint64_t) epc[6] << 8) | (uint64_t) epc[7];
+    const uint32_t lo = ((uint32_t) epc[8] << 24) | ((uint32_t) epc[9] << 16) | ((uint32_t) epc[10] << 8) | (uint32_t) epc[11];
+
+    const RFID_GS1_SCHEME scheme = Gs1SchemeOf_(epc[0]);
+    const uint32_t partition = (uint32_t) (hi >> 50) & 7U;
+    out->header = epc[0];
+    out->filter = (uint8_t) ((hi >> 53) & 7U);
+    out->partition = (uint8_t) partition;
+    if ((RFID_GS1_UNKNOWN == scheme) || (partition >= (uint32_t) RFID_GS1_PARTITIONS)) {
+        out->scheme = RFID_GS1_UNKNOWN;
+        out->company_digits = 0U;
+        out->reference_digits = 0U;
+        out->company_prefix = 0U;
+        out->reference = 0U;
+        out->serial = 0U;
+        return 0;
+    }
+
+    const rfid_gs1_layout_t *l = &rfid_gs1_layouts_[scheme - 1][partition];
+    out->company_digits = l->company_digits;
+    out->reference_digits = l->reference_digits;
+    out->company_prefix = Gs1Field_(hi, lo, l->company_shift, l->company_mask);
+    out->reference = Gs1Field_(hi, lo, l->reference_shift, l->reference_mask);
+    out->serial = ((RFID_GS1_SGTIN_96 == scheme) || (RFID_GS1_GRAI_96 == scheme))
+                  ? (((hi & 0x3FU) << 32) | (uint64_t) lo)
+                  : 0U;
+
+    // 비트 폭이 자릿수보다 넓으므로 자릿수를 넘는 값은 규격 위반이다.
+    if ((out->company_prefix >= rfid_gs1_pow10_[l->company_digits])
+        || (out->reference >= rfid_gs1_pow10_[l->reference_digits])) {
+        out->scheme = RFID_GS1_UNKNOWN;
+        return 0;
+    }
+    out->scheme = (uint8_t) scheme;
+    return 1;
+}
+
+/**
+ * @brief EPC 1건을 해석한다.
+ * @param[in]  epc EPC 바이트 배열
+ * @param[in]  epc_len EPC 바이트 수
+ * @param[out] out_record 해석 결과
+ * @return 1: 해석함, 0: 해석하지 못함
+ */
+int rfid_gs1_decode(IN_ const uint8_t *epc, IN_ const uint32_t epc_len, OUT_ rfid_gs1_record_t *out_record) {
+    if (NULL == out_record)
+        return 0;
+    if ((NULL == epc) || (RFID_GS1_EPC_BYTES != epc_len)) {
+        memset(out_record, 0, sizeof(*out_record));
+        if ((NULL != epc) && (epc_len > 0U))
+            out_record->header = epc[0];
+        return 0;
+    }
+    return Gs1Decode_(epc, out_record);
+}
+
+/**
+ * @brief 같은 간격으로 놓인 96bit EPC 여러 건을 해석한다.
+ * @param[in]  epcs 첫 EPC 위치
+ * @param[in]  stride EPC 간격
+ * @param[in]  count EPC 개수
+ * @param[out] out_records 해석 결과
+ * @param[out] out_decoded 해석에 성공한 개수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_gs1_decode_batch(IN_ const uint8_t *epcs
+                                  , IN_ const size_t stride
+                                  , IN_ const int count
+                                  , OUT_ rfid_gs1_record_t *out_records
+                                  , OUT_ int *out_decoded) {
+    if (NULL != out_decoded)
+        *out_decoded = 0;
+    if ((count < 0) || (stride < RFID_GS1_EPC_BYTES) || ((count > 0) && ((NULL == epcs) || (NULL == out_records))))
+        return RFID_RESULT_INVALID_ARG;
+
+    int decoded = 0;
+    const uint8_t *p = epcs;
+    for (int i = 0; i < count; ++i) {
+        decoded += Gs1Decode_(p, &out_records[i]);
+        p += stride;
+    }
+    if (NULL != out_decoded)
+        *out_decoded = decoded;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief rfid_read() 결과 태그를 해석한다.
+ * @param[in]  tags 태그 배열
+ * @param[in]  count 태그 개수
+ * @param[out] out_records 해석 결과
+ * @param[out] out_decoded 해석에 성공한 개수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_gs1_decode_tags(IN_ const rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , OUT_ rfid_gs1_record_t *out_records
+                                 , OUT_ int *out_decoded) {
+    if (NULL != out_decoded)
+        *out_decoded = 0;
+    if ((count < 0) || ((count > 0) && ((NULL == tags) || (NULL == out_records))))
+        return RFID_RESULT_INVALID_ARG;
+
+    int decoded = 0;
+    for (int i = 0; i < count; ++i)
+        decoded += rfid_gs1_decode(tags[i].epc_bytes, tags[i].epc_len, &out_records[i]);
+    if (NULL != out_decoded)
+        *out_decoded = decoded;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 10진수를 쓴다.
+ *
+ * @param[out] p 출력 위치
+ * @param[in]  v 값
+ * @param[in]  width 최소 자릿수(앞을 0으로 채움). 0이면 값이 0이어도 아무것도 쓰지 않는다.
+ *
+ * @return 쓴 글자 수
+ */
+static size_t Gs1PutDecimal_(OUT_ char *p, IN_ uint64_t v, IN_ const uint32_t width) {
+    char tmp[20];
+    size_t n = 0;
+    while ((v > 0U) || (n < width)) {
+        tmp[n++] = (char) ('0' + (v % 10U));
+        v /= 10U;
+    }
+    for (size_t i = 0; i < n; ++i)
+        p[i] = tmp[n - 1U - i];
+    return n;
+}
+
+/**
+ * @brief 해석 결과를 EPC URN 문자열로 만든다.
+ * @param[in]  record 해석 결과
+ * @param[in]  tag_uri tag URI 여부
+ * @param[out] out_buf 출력 버퍼
+ * @param[in]  buf_size out_buf 크기
+ * @param[out] out_len 쓴 길이
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_gs1_format_urn(IN_ const rfid_gs1_record_t *record
+                                , IN_ const int tag_uri
+                                , OUT_ char *out_buf
+                                , IN_ const size_t buf_size
+                                , OUT_ size_t *out_len) {
+    if (NULL != out_len)
+        *out_len = 0U;
+    if ((NULL == record) || (NULL == out_buf) || (0U == buf_size))
+        return RFID_RESULT_INVALID_ARG;
+    out_buf[0] = '\0';
+
+    const char *prefix = NULL;
+    switch ((RFID_GS1_SCHEME) record->scheme) {
+        case RFID_GS1_SGTIN_96: prefix = (0 != tag_uri) ? "urn:epc:tag:sgtin-96:" : "urn:epc:id:sgtin:"; break;
+        case RFID_GS1_SSCC_96: prefix = (0 != tag_uri) ? "urn:epc:tag:sscc-96:" : "urn:epc:id:sscc:"; break;
+        case RFID_GS1_GRAI_96: prefix = (0 != tag_uri) ? "urn:epc:tag:grai-96:" : "urn:epc:id:grai:"; break;
+        case RFID_GS1_GIAI_96: prefix = (0 != tag_uri) ? "urn:epc:tag:giai-96:" : "urn:epc:id:giai:"; break;
+        default: return RFID_RESULT_INVALID_ARG;
+    }
+
+    // 가장 긴 결과도 RFID_GS1_URN_MAX 안에 들어가므로 임시 버퍼에 만든 뒤 길이를 확인하고 복사한다.
+    char tmp[RFID_GS1_URN_MAX];
+    size_t n = strlen(prefix);
+    memcpy(tmp, prefix, n);
+    if (0 != tag_uri) {
+        tmp[n++] = (char) ('0' + record->filter);
+        tmp[n++] = '.';
+    }
+    n += Gs1PutDecimal_(tmp + n, record->company_prefix, record->company_digits);
+    tmp[n++] = '.';
+    if (RFID_GS1_GIAI_96 == record->scheme)
+        n += Gs1PutDecimal_(tmp + n, record->reference, 1U);
+    else
+        n += Gs1PutDecimal_(tmp + n, record->reference, record->reference_digits);
+    if ((RFID_GS1_SGTIN_96 == record->scheme) || (RFID_GS1_GRAI_96 == record->scheme)) {
+        tmp[n++] = '.';
+        n += Gs1PutDecimal_(tmp + n, record->serial, 1U);
+    }
+
+    if (n + 1U > buf_size)
+        return RFID_RESULT_INVALID_ARG;
+    memcpy(out_buf, tmp, n);
+    out_buf[n] = '\0';
+    if (NULL != out_len)
+        *out_len = n;
+    return RFID_RESULT_OK;
+}
@@ -0,0 +1,97 @@
+#ifndef RFID_GS1_H_
+#define RFID_GS1_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>  // size_t
+
+#include "rfid_types.h"
+
+/**
+ * @brief 바이너리 EPC 를 GS1 필드(header/filter/partition/업체 코드/참조/serial)로 해석한다.
+ *
+ * - 지원 방식: SGTIN-96, SSCC-96, GRAI-96, GIAI-96 (EPC Tag Data Standard).
+ * - 96bit EPC 를 정수 하나로 읽은 뒤 (방식, partition) 별로 미리 계산한 shift/mask 표로 필드를 꺼내므로
+ *   태그 1건이 분기 몇 번과 shift 몇 번으로 끝난다. hex 문자열을 거치지 않는다.
+ * - 상태가 없으므로 여러 스레드에서 동시에 호출해도 된다.
+ */
+
+/**
+ * @brief EPC 1건을 해석한다.
+ *
+ * - 해석할 수 없으면(길이가 12 bytes 가 아님, 지원하지 않는 header, partition 7, 자릿수 초과 값)
+ *   scheme 이 RFID_GS1_UNKNOWN 이고 header 만 채운다.
+ *
+ * @param[in]  epc EPC 바이트 배열(MSB first)
+ * @param[in]  epc_len EPC 바이트 수
+ * @param[out] out_record 해석 결과
+ *
+ * @return 1: GS1 방식으로 해석함, 0: 해석하지 못함(out_record 가 NULL 이면 항상 0)
+ */
+int rfid_gs1_decode(IN_ const uint8_t *epc, IN_ const uint32_t epc_len, OUT_ rfid_gs1_record_t *out_record);
+
+/**
+ * @brief 같은 간격으로 놓인 96bit EPC 여러 건을 해석한다.
+ *
+ * - i 번째 EPC 는 epcs + i * stride 부터 12 bytes 이다. 12 bytes 로 빽빽하게 담은 배열이면 stride 는 12,
+ *   rfid_tag_t 배열이면 tags[0].epc_bytes 와 sizeof(rfid_tag_t) 를 넘길 수 있다(epc_len 은 보지 않는다).
+ *
+ * @param[in]  epcs 첫 EPC 위치
+ * @param[in]  stride EPC 간격(bytes, 12 이상)
+ * @param[in]  count EPC 개수
+ * @param[out] out_records 해석 결과(count 개)
+ * @param[out] out_decoded 해석에 성공한 개수(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_gs1_decode_batch(IN_ const uint8_t *epcs
+                                  , IN_ const size_t stride
+                                  , IN_ const int count
+                                  , OUT_ rfid_gs1_record_t *out_records
+                                  , OUT_ int *out_decoded);
+
+/**
+ * @brief rfid_read() 결과 태그를 해석한다(태그마다 epc_bytes/epc_len 사용).
+ *
+ * @param[in]  tags 태그 배열
+ * @param[in]  count 태그 개수
+ * @param[out] out_records 해석 결과(count 개)
+ * @param[out] out_decoded 해석에 성공한 개수(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_gs1_decode_tags(IN_ const rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , OUT_ rfid_gs1_record_t *out_records
+                                 , OUT_ int *out_decoded);
+
+/**
+ * @brief 해석 결과를 EPC URN 문자열로 만든다.
+ *
+ * - pure identity: "urn:epc:id:sgtin:0614141.812345.6789"
+ * - tag URI(tag_uri != 0): "urn:epc:tag:sgtin-96:3.0614141.812345.6789" (filter 포함)
+ *
+ * @param[in]  record 해석 결과(scheme 이 RFID_GS1_UNKNOWN 이면 실패)
+ * @param[in]  tag_uri 0이면 pure identity URN, 그 외 tag URI
+ * @param[out] out_buf 출력 버퍼(NUL 종료). RFID_GS1_URN_MAX 이상이면 항상 충분하다.
+ * @param[in]  buf_size out_buf 크기
+ * @param[out] out_len 쓴 길이(NUL 제외, NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류, 해석하지 못한 record 또는 버퍼 부족
+ */
+RFID_RESULT rfid_gs1_format_urn(IN_ const rfid_gs1_record_t *record
+                                , IN_ const int tag_uri
+                                , OUT_ char *out_buf
+                                , IN_ const size_t buf_size
+                                , OUT_ size_t *out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_GS1_H_
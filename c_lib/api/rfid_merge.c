@@ -0,0 +1,483 @@
+// c_lib/api/rfid_merge.c
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime, posix_memalign
+
+#include "rfid_merge.h"
+#include "rfid_util_internal.h"
+
+#include <pthread.h>  // pthread_mutex_*
+#include <stddef.h>   // offsetof
+#include <stdlib.h>   // calloc, free, posix_memalign
+#include <string.h>   // memcpy, memcmp, memset
+#include <time.h>     // clock_gettime
+
+// 내부 상수
+#define RFID_MERGE_WINDOW_MS     (1000U)       // 중복 제거 창 기본값
+#define RFID_MERGE_CAPACITY      (65536U)      // 창 용량 기본값
+#define RFID_MERGE_CAPACITY_MAX  (1U << 24)
+#define RFID_MERGE_SHARDS        (64U)         // shard 수 기본값
+#define RFID_MERGE_SHARDS_MAX    (4096U)
+#define RFID_MERGE_NONE          (0xFFFFFFFFU) // 목록 끝/빈 항목
+
+/**
+ * @brief 창 항목(EPC 1개)
+ *
+ * @param hash          EPC 해시
+ * @param first_seen_ms 창을 연 read 시각
+ * @param last_seen_ms  창 안의 마지막 read 시각
+ * @param close_us      창이 닫히는 단조 시각(us, 병합 지연 기준)
+ * @param readers       읽은 리더 비트(reader_id % 64)
+ * @param next          창 목록의 다음 항목(더 늦게 연 창), 빈 항목이면 free 목록의 다음 항목
+ * @param reads         창 안의 read 수
+ * @param reader_id     RSSI 가 가장 높았던 리더
+ * @param antenna       RSSI 가 가장 높았던 안테나
+ * @param rssi          창 안의 최대 RSSI
+ * @param epc_len       EPC 바이트 수
+ * @param epc           바이너리 EPC
+ */
+typedef struct rfid_merge_entry {
+    uint64_t hash;
+    uint64_t first_seen_ms;
+    uint64_t last_seen_ms;
+    uint64_t close_us;
+    uint64_t readers;
+    uint32_t next;
+    uint32_t reads;
+    uint16_t reader_id;
+    uint8_t antenna;
+    int8_t rssi;
+    uint8_t epc_len;
+    uint8_t epc[RFID_EPC_MAX_BYTES];
+} rfid_merge_entry_t;
+
+/**
+ * @brief shard(잠금 단위). 캐시 라인 단위로 정렬해 이웃 shard 와 라인을 나누지 않는다.
+ *
+ * @param lock       shard 잠금(아래 필드 전부를 보호)
+ * @param entries    창 항목 배열
+ * @param slots      EPC → 항목 인덱스 + 1 선형 탐사 해시 테이블(0: 빈 슬롯)
+ * @param mask       slots 크기 - 1
+ * @param free_head  빈 항목 목록
+ * @param head       가장 먼저 연 창(창 길이가 같으므로 가장 먼저 닫힌다)
+ * @param tail       가장 나중에 연 창
+ * @param active     열린 창 수
+ * @param reads      입력 read 수
+ * @param windows    연 창 수
+ * @param events     내보낸 이벤트 수
+ * @param table_full 용량 초과로 버린 read 수
+ * @param contended  잠금을 바로 얻지 못한 횟수
+ * @param push_hist  push 지연(ns) 히스토그램
+ * @param merge_hist 병합 지연(us) 히스토그램
+ */
+typedef struct rfid_merge_shard {
+    pthread_mutex_t lock;
+    rfid_merge_entry_t *entries;
+    uint32_t *slots;
+    uint32_t mask;
+    uint32_t free_head;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t active;
+    uint64_t reads;
+    uint64_t windows;
+    uint64_t events;
+    uint64_t table_full;
+    uint64_t contended;
+    uint64_t push_hist[RFID_HIST_BUCKETS];
+    uint64_t merge_hist[RFID_HIST_BUCKETS];
+} __attribute__((aligned(64))) rfid_merge_shard_t;
+
+/**
+ * @brief 리더 간 병합 단계
+ *
+ * @param shards      shard 배열
+ * @param shard_mask  shard 수 - 1
+ * @param window_ms   중복 제거 창
+ * @param capacity    창 용량(shard 별 용량 합)
+ * @param poll_cursor 다음 poll 의 시작 shard(원자적 증가)
+ */
+struct rfid_merge {
+    rfid_merge_shard_t *shards;
+    uint32_t shard_mask;
+    uint32_t window_ms;
+    uint32_t capacity;
+    uint32_t poll_cursor;
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t MergeNowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms). 0이 되지 않게 1을 더한다.
+ */
+static uint64_t MergeNowMs_(void) {
+    return (MergeNowNs_() / 1000000ULL) + 1U;
+}
+
+/**
+ * @brief shard 를 잠근다. 바로 얻지 못하면 contended 로 집계한다.
+ */
+static void MergeLock_(IN_ rfid_merge_shard_t *s) {
+    if (0 == pthread_mutex_trylock(&s->lock))
+        return;
+    (void) pthread_mutex_lock(&s->lock);
+    s->contended++;
+}
+
+/**
+ * @brief shard 에서 EPC 항목을 찾는다.
+ *
+ * @param[in]  s shard
+ * @param[in]  hash 해시
+ * @param[in]  epc EPC
+ * @param[in]  len EPC 바이트 수
+ * @param[out] out_slot 찾은 슬롯, 없으면 삽입할 빈 슬롯
+ *
+ * @return 항목 인덱스(없으면 RFID_MERGE_NONE)
+ */
+static uint32_t MergeFind_(IN_ const rfid_merge_shard_t *s
+                           , IN_ const uint64_t hash
+                           , IN_ const uint8_t *epc
+                           , IN_ const uint32_t len
+                           , OUT_ uint32_t *out_slot) {
+    uint32_t i = (uint32_t) hash & s->mask;
+    for (;;) {
+        const uint32_t v = s->slots[i];
+        if (0U == v) {
+            *out_slot = i;
+            return RFID_MERGE_NONE;
+        }
+        const rfid_merge_entry_t *e = &s->entries[v - 1U];
+        if ((e->hash == hash) && (e->epc_len == len) && (0 == memcmp(e->epc, epc, len))) {
+            *out_slot = i;
+            return v - 1U;
+        }
+        i = (i + 1U) & s->mask;
+    }
+}
+
+/**
+ * @brief 해시 테이블에서 항목을 지운다(backward shift, tombstone 없음).
+ */
+static void MergeUnindex_(IN_ rfid_merge_shard_t *s, IN_ const uint32_t idx) {
+    RfidSlotUnindex_(s->slots, s->mask, s->entries, sizeof(rfid_merge_entry_t), offsetof(rfid_merge_entry_t, hash), idx, NULL, NULL);
+}
+
+/**
+ * @brief read 1건을 shard 에 반영한다(shard 잠금 상태에서 호출).
+ *
+ * @param[in] m 병합 단계
+ * @param[in] s shard
+ * @param[in] hash EPC 해시
+ * @param[in] tag 태그
+ * @param[in] len EPC 바이트 수
+ * @param[in] reader_id 리더 id
+ * @param[in] now 현재 시각(ms)
+ * @param[in] now_ns 현재 단조 시각(ns)
+ */
+static void MergeAdd_(IN_ const rfid_merge_t *m
+                      , IN_ rfid_merge_shard_t *s
+                      , IN_ const uint64_t hash
+                      , IN_ const rfid_tag_t *tag
+                      , IN_ const uint32_t len
+                      , IN_ const uint16_t reader_id
+                      , IN_ const uint64_t now
+                      , IN_ const uint64_t now_ns) {
+    const uint32_t reads = (0U != tag->readcnt) ? tag->readcnt : 1U;
+    const int rssi = (tag->rssi < -128) ? -128 : ((tag->rssi > 127) ? 127 : tag->rssi);
+    s->reads += reads;
+
+    uint32_t slot = 0;
+    uint32_t idx = MergeFind_(s, hash, tag->epc_bytes, len, &slot);
+    if (RFID_MERGE_NONE == idx) {
+        if (RFID_MERGE_NONE == s->free_head) {
+            s->table_full += reads;
+            return;
+        }
+        idx = s->free_head;
+        rfid_merge_entry_t *e = &s->entries[idx];
+        s->free_head = e->next;
+        e->hash = hash;
+        e->first_seen_ms = now;
+        e->last_seen_ms = now;
+        e->close_us = (now_ns / 1000U) + ((uint64_t) m->window_ms * 1000U);
+        e->readers = 0U;
+        e->next = RFID_MERGE_NONE;
+        e->reads = 0U;
+        e->reader_id = reader_id;
+        e->antenna = (uint8_t) tag->antenna;
+        e->rssi = (int8_t) rssi;
+        e->epc_len = (uint8_t) len;
+        memcpy(e->epc, tag->epc_bytes, len);
+        s->slots[slot] = idx + 1U;
+
+        if (RFID_MERGE_NONE == s->tail)
+            s->head = idx;
+        else
+            s->entries[s->tail].next = idx;
+        s->tail = idx;
+        s->active++;
+        s->windows++;
+    } else if (rssi > s->entries[idx].rssi) {
+        // 더 강하게 읽은 리더/안테나로 귀속을 옮긴다(같은 RSSI 면 먼저 읽은 쪽 유지).
+        s->entries[idx].reader_id = reader_id;
+        s->entries[idx].antenna = (uint8_t) tag->antenna;
+        s->entries[idx].rssi = (int8_t) rssi;
+    }
+
+    rfid_merge_entry_t *e = &s->entries[idx];
+    // 리더 스레드 간 now_ms 가 어긋나도 last_seen_ms 가 뒤로 가지 않게 한다.
+    if (now > e->last_seen_ms)
+        e->last_seen_ms = now;
+    e->reads += reads;
+    e->readers |= 1ULL << (reader_id % 64U);
+}
+
+/**
+ * @brief 병합 단계 메모리를 해제한다.
+ */
+static void MergeFree_(IN_ rfid_merge_t *m) {
+    if (NULL != m->shards) {
+        for (uint32_t k = 0; k <= m->shard_mask; ++k) {
+            free(m->shards[k].entries);
+            free(m->shards[k].slots);
+            (void) pthread_mutex_destroy(&m->shards[k].lock);
+        }
+        free(m->shards);
+    }
+    free(m);
+}
+
+/**
+ * @brief 병합 단계를 만든다.
+ * @param[in]  params 생성 파라미터
+ * @param[out] out_merge 생성된 병합 단계
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_merge_create(IN_ const rfid_merge_params_t *params, OUT_ rfid_merge_t **out_merge) {
+    if (NULL == out_merge)
+        return RFID_RESULT_INVALID_ARG;
+    *out_merge = NULL;
+
+    rfid_merge_params_t prm;
+    memset(&prm, 0, sizeof(prm));
+    if (NULL != params)
+        prm = *params;
+
+    const uint32_t shards = (0U != prm.shards) ? prm.shards : RFID_MERGE_SHARDS;
+    const uint32_t capacity = (0U != prm.capacity) ? prm.capacity : RFID_MERGE_CAPACITY;
+    if ((shards > RFID_MERGE_SHARDS_MAX) || (0U != (shards & (shards - 1U))) || (capacity > RFID_MERGE_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_merge_t *m = (rfid_merge_t *) calloc(1, sizeof(rfid_merge_t));
+    if (NULL == m)
+        return RFID_RESULT_INTERNAL_ERROR;
+    m->shard_mask = shards - 1U;
+    m->window_ms = (0U != prm.window_ms) ? prm.window_ms : RFID_MERGE_WINDOW_MS;
+
+    void *mem = NULL;
+    if (0 != posix_memalign(&mem, 64U, (size_t) shards * sizeof(rfid_merge_shard_t))) {
+        free(m);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    memset(mem, 0, (size_t) shards * sizeof(rfid_merge_shard_t));
+    m->shards = (rfid_merge_shard_t *) mem;
+    for (uint32_t k = 0; k < shards; ++k)
+        (void) pthread_mutex_init(&m->shards[k].lock, NULL);
+
+    // shard 별 용량은 올림 나눗셈, 해시 테이블은 용량의 2배 이상인 2의 거듭제곱(적재율 50% 이하).
+    const uint32_t per_shard = (capacity + shards - 1U) / shards;
+    uint32_t table = 2U;
+    while (table < per_shard * 2U)
+        table <<= 1;
+    for (uint32_t k = 0; k < shards; ++k) {
+        rfid_merge_shard_t *s = &m->shards[k];
+        s->entries = (rfid_merge_entry_t *) calloc(per_shard, sizeof(rfid_merge_entry_t));
+        s->slots = (uint32_t *) calloc(table, sizeof(uint32_t));
+        if ((NULL == s->entries) || (NULL == s->slots)) {
+            MergeFree_(m);
+            return RFID_RESULT_INTERNAL_ERROR;
+        }
+        s->mask = table - 1U;
+        for (uint32_t i = 0; i < per_shard; ++i)
+            s->entries[i].next = (i + 1U < per_shard) ? (i + 1U) : RFID_MERGE_NONE;
+        s->free_head = 0U;
+        s->head = RFID_MERGE_NONE;
+        s->tail = RFID_MERGE_NONE;
+    }
+    m->capacity = per_shard * shards;
+
+    *out_merge = m;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 병합 단계를 해제한다.
+ * @param[in,out] inout_merge 해제할 병합 단계
+ */
+void rfid_merge_destroy(INOUT_ rfid_merge_t **inout_merge) {
+    if ((NULL == inout_merge) || (NULL == *inout_merge))
+        return;
+
+    MergeFree_(*inout_merge);
+    *inout_merge = NULL;
+}
+
+/**
+ * @brief 한 리더의 read 결과를 넣는다.
+ * @param[in] merge 병합 단계
+ * @param[in] reader_id 리더 id
+ * @param[in] tags 태그 배열
+ * @param[in] count 태그 개수
+ * @param[in] now_ms 현재 시각
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_merge_push(IN_ rfid_merge_t *merge
+                            , IN_ const uint16_t reader_id
+                            , IN_ const rfid_tag_t *tags
+                            , IN_ const int count
+                            , IN_ const uint64_t now_ms) {
+    if ((NULL == merge) || (count < 0) || ((NULL == tags) && (count > 0)))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_merge_t *m = merge;
+    const uint64_t now = (0U != now_ms) ? now_ms : MergeNowMs_();
+    for (int t = 0; t < count; ++t) {
+        const rfid_tag_t *tag = &tags[t];
+        const uint32_t len = (tag->epc_len <= RFID_EPC_MAX_BYTES) ? tag->epc_len : RFID_EPC_MAX_BYTES;
+        if (0U == len)
+            continue;
+
+        // 해시는 잠금 밖에서 계산하고, 잠금 구간은 항목 1개 갱신만 한다.
+        const uint64_t hash = RfidEpcHash_(tag->epc_bytes, len);
+        rfid_merge_shard_t *s = &m->shards[(uint32_t) (hash >> 40) & m->shard_mask];
+        const uint64_t t0 = MergeNowNs_();
+        MergeLock_(s);
+        MergeAdd_(m, s, hash, tag, len, reader_id, now, t0);
+        s->push_hist[RfidHistIndex_(MergeNowNs_() - t0)]++;
+        (void) pthread_mutex_unlock(&s->lock);
+    }
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief now_ms 기준으로 닫힌 창을 이벤트로 꺼낸다.
+ * @param[in]  merge 병합 단계
+ * @param[in]  now_ms 현재 시각
+ * @param[out] out_events 이벤트 버퍼
+ * @param[in]  capacity out_events 용량
+ * @param[out] out_count 꺼낸 이벤트 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_merge_poll(IN_ rfid_merge_t *merge
+                            , IN_ const uint64_t now_ms
+                            , OUT_ rfid_merge_event_t *out_events
+                            , IN_ const int capacity
+                            , OUT_ int *out_count) {
+    if (NULL != out_count)
+        *out_count = 0;
+    if ((NULL == merge) || (NULL == out_events) || (capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_merge_t *m = merge;
+    const uint64_t now = (0U != now_ms) ? now_ms : MergeNowMs_();
+    const uint64_t now_us = MergeNowNs_() / 1000U;
+    const uint32_t start = __atomic_fetch_add(&m->poll_cursor, 1U, __ATOMIC_RELAXED);
+    int n = 0;
+    for (uint32_t k = 0; (k <= m->shard_mask) && (n < capacity); ++k) {
+        rfid_merge_shard_t *s = &m->shards[(start + k) & m->shard_mask];
+        MergeLock_(s);
+        while ((RFID_MERGE_NONE != s->head) && (n < capacity)) {
+            const uint32_t idx = s->head;
+            const rfid_merge_entry_t *e = &s->entries[idx];
+            if ((UINT64_MAX != now) && ((now < e->first_seen_ms) || ((now - e->first_seen_ms) < m->window_ms)))
+                break;
+
+            rfid_merge_event_t *ev = &out_events[n++];
+            ev->first_seen_ms = e->first_seen_ms;
+            ev->last_seen_ms = e->last_seen_ms;
+            ev->reads = e->reads;
+            ev->reader_id = e->reader_id;
+            ev->antenna = e->antenna;
+            ev->rssi = e->rssi;
+            ev->reader_count = (uint8_t) __builtin_popcountll(e->readers);
+            ev->epc_len = e->epc_len;
+            memcpy(ev->epc, e->epc, e->epc_len);
+            if (e->epc_len < RFID_EPC_MAX_BYTES)
+                memset(ev->epc + e->epc_len, 0, RFID_EPC_MAX_BYTES - e->epc_len);
+            s->merge_hist[RfidHistIndex_((now_us > e->close_us) ? (now_us - e->close_us) : 0U)]++;
+
+            MergeUnindex_(s, idx);
+            s->head = e->next;
+            if (RFID_MERGE_NONE == s->head)
+                s->tail = RFID_MERGE_NONE;
+            s->entries[idx].next = s->free_head;
+            s->free_head = idx;
+            s->active--;
+            s->events++;
+        }
+        (void) pthread_mutex_unlock(&s->lock);
+    }
+
+    *out_count = n;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 병합 단계 상태를 조회한다.
+ * @param[in]  merge 병합 단계
+ * @param[out] out_stat 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_merge_get_stats(IN_ rfid_merge_t *merge, OUT_ rfid_merge_stat_t *out_stat) {
+    if ((NULL == merge) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_merge_t *m = merge;
+    rfid_merge_stat_t st;
+    memset(&st, 0, sizeof(st));
+    uint64_t push_hist[RFID_HIST_BUCKETS];
+    uint64_t merge_hist[RFID_HIST_BUCKETS];
+    memset(push_hist, 0, sizeof(push_hist));
+    memset(merge_hist, 0, sizeof(merge_hist));
+    uint64_t push_total = 0;
+    uint64_t merge_total = 0;
+
+    // shard 를 하나씩 잠그므로 전체가 한 시점의 값은 아니다(조회 중에도 push/poll 이 멈추지 않음).
+    for (uint32_t k = 0; k <= m->shard_mask; ++k) {
+        rfid_merge_shard_t *s = &m->shards[k];
+        (void) pthread_mutex_lock(&s->lock);
+        st.reads += s->reads;
+        st.windows += s->windows;
+        st.events += s->events;
+        st.table_full += s->table_full;
+        st.contended += s->contended;
+        st.active += s->active;
+        for (uint32_t i = 0; i < RFID_HIST_BUCKETS; ++i) {
+            push_hist[i] += s->push_hist[i];
+            merge_hist[i] += s->merge_hist[i];
+            push_total += s->push_hist[i];
+            merge_total += s->merge_hist[i];
+        }
+        (void) pthread_mutex_unlock(&s->lock);
+    }
+    st.capacity = m->capacity;
+    st.shards = m->shard_mask + 1U;
+    st.push_p50_ns = RfidHistPercentile_(push_hist, push_total, 500U);
+    st.push_p99_ns = RfidHistPercentile_(push_hist, push_total, 990U);
+    st.push_p999_ns = RfidHistPercentile_(push_hist, push_total, 999U);
+    st.push_max_ns = RfidHistPercentile_(push_hist, push_total, 1000U);
+    st.merge_p50_us = RfidHistPercentile_(merge_hist, merge_total, 500U);
+    st.merge_p99_us = RfidHistPercentile_(merge_hist, merge_total, 990U);
+    st.merge_p999_us = RfidHistPercentile_(merge_hist, merge_total, 999U);
+    st.merge_max_us = RfidHistPercentile_(merge_hist, merge_total, 1000U);
+
+    *out_stat = st;
+    return RFID_RESULT_OK;
+}
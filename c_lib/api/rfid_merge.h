@@ -0,0 +1,104 @@
+#ifndef RFID_MERGE_H_
+#define RFID_MERGE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 여러 리더(ctx)의 read 를 합치는 병합 단계. 구현부에서 정의하는 opaque 타입.
+ *
+ * - 같은 EPC 를 여러 리더/안테나가 읽어도 window_ms 창마다 이벤트 1개만 낸다.
+ *   창은 해당 EPC 의 첫 read 시각에 열리고 window_ms 뒤에 닫힌다(고정 창).
+ * - 이벤트의 reader_id/antenna 는 창 안에서 RSSI 가 가장 높았던 read 를 따른다(같으면 먼저 읽은 쪽).
+ * - EPC 해시로 나눈 shard 마다 잠금/해시 테이블/창 목록을 따로 두므로 전역 잠금이 없다.
+ *   서로 다른 리더 스레드의 push 는 같은 shard 에 들어갈 때만 경합한다.
+ * - 창은 열린 순서로 shard 목록에 쌓이고 poll 은 목록 앞에서 닫힌 창만 꺼내므로
+ *   push 1건과 이벤트 1건이 추적 수와 무관하게 O(1)이다.
+ * - push 지연(잠금 대기 포함)과 병합 지연(창이 닫힌 뒤 ~ 이벤트 반환)을 shard 별 로그-선형 히스토그램으로 집계한다.
+ * - push/poll/get_stats 는 여러 스레드에서 동시에 호출할 수 있다.
+ */
+typedef struct rfid_merge rfid_merge_t;
+
+/**
+ * @brief 병합 단계를 만든다.
+ *
+ * @param[in]  params 생성 파라미터(NULL이면 모두 기본값). 호출 중에만 참조한다.
+ * @param[out] out_merge 생성된 병합 단계
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류(shard 수가 2의 거듭제곱이 아님 등),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+RFID_RESULT rfid_merge_create(IN_ const rfid_merge_params_t *params, OUT_ rfid_merge_t **out_merge);
+
+/**
+ * @brief 병합 단계를 해제한다. 성공 시 *inout_merge 를 NULL로 설정한다.
+ * @note 다른 스레드가 사용 중이지 않아야 한다. 닫히지 않은 창은 버린다.
+ * @param[in,out] inout_merge 해제할 병합 단계(NULL 허용)
+ */
+void rfid_merge_destroy(INOUT_ rfid_merge_t **inout_merge);
+
+/**
+ * @brief 한 리더의 read 결과를 넣는다.
+ *
+ * - 열린 창이 없는 EPC 는 now_ms 에 창을 연다. 창이 닫혔지만 아직 poll 하지 않은 EPC 의 read 는 그 창에 합친다.
+ * - 모든 리더가 같은 시계(CLOCK_MONOTONIC ms)를 써야 한다. 스레드 간 now_ms 가 어긋나면 그만큼 이벤트가 늦어질 수 있다.
+ *   창을 연 시각보다 작은 now_ms 는 경과 0으로 보고, last_seen_ms 는 뒤로 가지 않는다.
+ * - 용량이 차면 새 EPC 의 read 는 버린다(table_full 로 집계).
+ *
+ * @param[in] merge 병합 단계
+ * @param[in] reader_id 리더 id(이벤트에 기록, reader_count 는 reader_id % 64 로 센다)
+ * @param[in] tags 태그 배열(NULL 허용)
+ * @param[in] count 태그 개수
+ * @param[in] now_ms 현재 시각(ms). 0이면 CLOCK_MONOTONIC 을 사용한다.
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_merge_push(IN_ rfid_merge_t *merge
+                            , IN_ const uint16_t reader_id
+                            , IN_ const rfid_tag_t *tags
+                            , IN_ const int count
+                            , IN_ const uint64_t now_ms);
+
+/**
+ * @brief now_ms 기준으로 닫힌 창을 이벤트로 꺼낸다.
+ *
+ * - out_events 가 가득 차면(*out_count == capacity) 남은 창은 다음 호출로 미룬다.
+ *   호출마다 시작 shard 를 바꾸므로 특정 shard 가 계속 밀리지 않는다.
+ * - now_ms 가 UINT64_MAX 이면 모든 창을 닫는다(종료 시 flush).
+ *
+ * @param[in]  merge 병합 단계
+ * @param[in]  now_ms 현재 시각(ms). 0이면 CLOCK_MONOTONIC 을 사용한다.
+ * @param[out] out_events 이벤트 버퍼
+ * @param[in]  capacity out_events 용량(> 0)
+ * @param[out] out_count 꺼낸 이벤트 수
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_merge_poll(IN_ rfid_merge_t *merge
+                            , IN_ const uint64_t now_ms
+                            , OUT_ rfid_merge_event_t *out_events
+                            , IN_ const int capacity
+                            , OUT_ int *out_count);
+
+/**
+ * @brief 병합 단계 상태와 지연 백분위를 조회한다.
+ *
+ * @param[in]  merge 병합 단계
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_merge_get_stats(IN_ rfid_merge_t *merge, OUT_ rfid_merge_stat_t *out_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_MERGE_H_
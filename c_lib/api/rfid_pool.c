@@ -0,0 +1,793 @@
+// c_lib/api/rfid_pool.c
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime, posix_memalign, sysconf
+
+#include "rfid_pool.h"
+#include "rfid_util_internal.h"
+
+#include <pthread.h>  // pthread_*
+#include <stdlib.h>   // calloc, free, posix_memalign
+#include <string.h>   // memcpy, memset, strlen
+#include <time.h>     // clock_gettime, nanosleep
+#include <unistd.h>   // sysconf
+
+// 내부 상수
+#define RFID_POOL_WORKERS_MAX       (64U)
+#define RFID_POOL_LANES             (64U)         // lane 수 기본값
+#define RFID_POOL_LANES_MAX         (4096U)
+#define RFID_POOL_LANE_CAPACITY     (256U)        // lane 별 대기 태그 수 기본값
+#define RFID_POOL_LANE_CAPACITY_MAX (65536U)
+#define RFID_POOL_BATCH             (64U)         // stage 호출 1회 최대 태그 수 기본값
+#define RFID_POOL_BATCH_MAX         (4096U)
+#define RFID_POOL_BLOCK_TIMEOUT_MS  (10U)         // BLOCK 정책 최대 대기 기본값
+#define RFID_POOL_IDLE_WAIT_MS      (50U)         // 깨우기 신호를 놓쳐도 이 시간 안에 deque 를 다시 본다
+#define RFID_POOL_NONE              (0xFFFFFFFFU) // 꺼낼 lane 없음
+
+/**
+ * @brief lane(EPC 친화 단위). 한 번에 한 작업 스레드만 처리하므로 같은 EPC 의 순서가 유지된다.
+ *
+ * @param lock           lane 잠금(아래 필드 전부를 보호)
+ * @param space          자리가 났음을 알리는 조건 변수(BLOCK 정책)
+ * @param items          대기 태그 ring(lane_capacity)
+ * @param hashes         items 와 같은 위치의 EPC 해시(COALESCE 정책에서만 할당)
+ * @param head           가장 오래된 대기 태그 위치
+ * @param count          대기 태그 수
+ * @param scheduled      1이면 deque 에 들어 있거나 처리 중(다시 넣지 않는다)
+ * @param waiters        space 를 기다리는 submit 스레드 수
+ * @param submitted      받은 태그 수
+ * @param dropped_newest 버린 새 태그 수
+ * @param dropped_oldest 버린 대기 태그 수
+ * @param coalesced      합친 태그 수
+ * @param blocked        기다린 태그 수
+ * @param block_timeouts 기다려도 자리가 나지 않은 태그 수
+ * @param block_wait_ns  기다린 시간 합(ns)
+ */
+typedef struct rfid_pool_lane {
+    pthread_mutex_t lock;
+    pthread_cond_t space;
+    rfid_pool_item_t *items;
+    uint64_t *hashes;
+    uint32_t head;
+    uint32_t count;
+    uint32_t scheduled;
+    uint32_t waiters;
+    uint64_t submitted;
+    uint64_t dropped_newest;
+    uint64_t dropped_oldest;
+    uint64_t coalesced;
+    uint64_t blocked;
+    uint64_t block_timeouts;
+    uint64_t block_wait_ns;
+} __attribute__((aligned(64))) rfid_pool_lane_t;
+
+/**
+ * @brief 작업 스레드 1개의 stage 별 집계(그 작업 스레드만 쓰고 get_stats 는 원자적으로 읽는다)
+ *
+ * @param items_in  stage 에 넘긴 태그 수
+ * @param items_out stage 가 남긴 태그 수
+ * @param calls     호출 수
+ * @param busy_ns   실행 시간 합(ns)
+ * @param hist      대기 시간(us) 히스토그램
+ */
+typedef struct rfid_pool_counter {
+    uint64_t items_in;
+    uint64_t items_out;
+    uint64_t calls;
+    uint64_t busy_ns;
+    uint64_t hist[RFID_HIST_BUCKETS];
+} rfid_pool_counter_t;
+
+/**
+ * @brief 작업 스레드. 캐시 라인 단위로 정렬해 이웃 작업 스레드와 라인을 나누지 않는다.
+ *
+ * @param lock      deque 잠금
+ * @param deque     처리할 lane 인덱스 ring(크기 = lane 수, lane 은 한 deque 에만 들어가므로 넘치지 않는다)
+ * @param top       앞(자기 자신이 꺼내는 쪽)
+ * @param bottom    뒤(넣는 쪽, 다른 작업 스레드가 훔치는 쪽)
+ * @param pool      소속 풀
+ * @param index     작업 스레드 번호
+ * @param thread    스레드 핸들
+ * @param started   스레드 시작 여부
+ * @param buf       처리 중인 batch
+ * @param counters  stage 별 집계
+ * @param batches   처리한 batch 수
+ * @param steals    훔쳐 온 lane 수
+ * @param processed 처리한 태그 수
+ * @param rx_hist   프레임 수신(tag.rx_us) → 꺼낼 때까지(us) 히스토그램
+ */
+typedef struct rfid_pool_worker {
+    pthread_mutex_t lock;
+    uint32_t *deque;
+    uint32_t top;
+    uint32_t bottom;
+    struct rfid_pool *pool;
+    uint32_t index;
+    pthread_t thread;
+    int started;
+    rfid_pool_item_t *buf;
+    rfid_pool_counter_t *counters;
+    uint64_t batches;
+    uint64_t steals;
+    uint64_t processed;
+    uint64_t rx_hist[RFID_HIST_BUCKETS];
+} __attribute__((aligned(64))) rfid_pool_worker_t;
+
+/**
+ * @brief 태그 후처리 작업 풀
+ *
+ * @param workers       작업 스레드 배열
+ * @param worker_count  작업 스레드 수
+ * @param lanes         lane 배열
+ * @param lane_mask     lane 수 - 1
+ * @param lane_capacity lane 별 대기 태그 수
+ * @param batch         stage 호출 1회 최대 태그 수
+ * @param policy        backpressure 정책
+ * @param block_timeout_ms BLOCK 정책 최대 대기 시간(submit 호출 1회 기준)
+ * @param stages        stage 목록(name 은 names 를 가리킨다)
+ * @param names         stage 이름 사본
+ * @param stage_count   stage 수
+ * @param idle_lock     잠든 작업 스레드 깨우기 잠금
+ * @param idle_cond     잠든 작업 스레드 깨우기 조건 변수
+ * @param idle          잠들려는/잠든 작업 스레드 수(원자적 접근)
+ * @param queued        deque 에 들어 있는 lane 수(원자적 접근)
+ * @param pending       대기/처리 중 태그 수(원자적 접근)
+ * @param stop          1이면 남은 lane 을 비운 뒤 작업 스레드 종료(원자적 접근)
+ */
+struct rfid_pool {
+    rfid_pool_worker_t *workers;
+    uint32_t worker_count;
+    rfid_pool_lane_t *lanes;
+    uint32_t lane_mask;
+    uint32_t lane_capacity;
+    uint32_t batch;
+    RFID_POOL_POLICY policy;
+    uint32_t block_timeout_ms;
+    rfid_pool_stage_t stages[RFID_POOL_STAGE_MAX];
+    char names[RFID_POOL_STAGE_MAX][RFID_POOL_STAGE_NAME_MAX];
+    uint32_t stage_count;
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    uint32_t idle;
+    uint32_t queued;
+    uint32_t pending;
+    uint32_t stop;
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t PoolNowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief 작업 스레드 전용 집계 값을 더한다(쓰는 쪽은 하나, get_stats 가 찢어진 값을 읽지 않게 원자적으로 저장).
+ */
+static void PoolAdd_(IN_ uint64_t *p, IN_ const uint64_t v) {
+    __atomic_store_n(p, __atomic_load_n(p, __ATOMIC_RELAXED) + v, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief lane 을 작업 스레드 deque 뒤에 넣고, 잠든 작업 스레드가 있으면 하나 깨운다.
+ */
+static void PoolPush_(IN_ rfid_pool_t *pool, IN_ rfid_pool_worker_t *w, IN_ const uint32_t lane) {
+    // queued 증가와 idle 확인은 작업 스레드의 idle 증가/queued 확인과 짝을 이루므로 둘 중 하나는 반드시 상대를 본다.
+    // deque 에 넣기 전에 올려 두어 꺼낸 쪽의 감소가 먼저 일어나지 않게 한다.
+    (void) __atomic_add_fetch(&pool->queued, 1U, __ATOMIC_SEQ_CST);
+    (void) pthread_mutex_lock(&w->lock);
+    w->deque[w->bottom & pool->lane_mask] = lane;
+    w->bottom++;
+    (void) pthread_mutex_unlock(&w->lock);
+
+    if (0U != __atomic_load_n(&pool->idle, __ATOMIC_SEQ_CST)) {
+        (void) pthread_mutex_lock(&pool->idle_lock);
+        (void) pthread_cond_signal(&pool->idle_cond);
+        (void) pthread_mutex_unlock(&pool->idle_lock);
+    }
+}
+
+/**
+ * @brief 자기 deque 앞에서 lane 을 꺼낸다(먼저 들어온 lane 부터, lane 간 공정성).
+ *
+ * @return lane 인덱스(없으면 RFID_POOL_NONE)
+ */
+static uint32_t PoolPop_(IN_ const rfid_pool_t *pool, IN_ rfid_pool_worker_t *w) {
+    uint32_t lane = RFID_POOL_NONE;
+    (void) pthread_mutex_lock(&w->lock);
+    if (w->top != w->bottom) {
+        lane = w->deque[w->top & pool->lane_mask];
+        w->top++;
+    }
+    (void) pthread_mutex_unlock(&w->lock);
+    return lane;
+}
+
+/**
+ * @brief 다른 작업 스레드 deque 뒤에서 lane 을 훔친다.
+ *
+ * @return lane 인덱스(없으면 RFID_POOL_NONE)
+ */
+static uint32_t PoolSteal_(IN_ const rfid_pool_t *pool, IN_ rfid_pool_worker_t *victim) {
+    uint32_t lane = RFID_POOL_NONE;
+    (void) pthread_mutex_lock(&victim->lock);
+    if (victim->top != victim->bottom) {
+        victim->bottom--;
+        lane = victim->deque[victim->bottom & pool->lane_mask];
+    }
+    (void) pthread_mutex_unlock(&victim->lock);
+    return lane;
+}
+
+/**
+ * @brief lane 의 batch 하나를 꺼내 모든 stage 를 실행한다.
+ *
+ * lane 은 scheduled 상태로 이 작업 스레드만 처리하므로, stage 실행 중 들어온 태그는 다음 batch 로 순서대로 이어진다.
+ * 남은 태그가 있으면 lane 을 자기 deque 뒤에 다시 넣어 다른 lane 에 차례를 넘긴다(다른 작업 스레드가 훔칠 수 있다).
+ */
+static void PoolProcess_(IN_ rfid_pool_t *pool, IN_ rfid_pool_worker_t *w, IN_ const uint32_t lane_idx) {
+    rfid_pool_lane_t *lane = &pool->lanes[lane_idx];
+
+    (void) pthread_mutex_lock(&lane->lock);
+    const uint32_t n = (lane->count < pool->batch) ? lane->count : pool->batch;
+    const uint32_t first = ((pool->lane_capacity - lane->head) < n) ? (pool->lane_capacity - lane->head) : n;
+    memcpy(w->buf, &lane->items[lane->head], (size_t) first * sizeof(rfid_pool_item_t));
+    if (first < n)
+        memcpy(&w->buf[first], lane->items, (size_t) (n - first) * sizeof(rfid_pool_item_t));
+    lane->head = (lane->head + n) % pool->lane_capacity;
+    lane->count -= n;
+    if (0U != lane->waiters)
+        (void) pthread_cond_broadcast(&lane->space);
+    (void) pthread_mutex_unlock(&lane->lock);
+
+    const uint64_t deq_us = PoolNowNs_() / 1000U;
+    for (uint32_t i = 0; i < n; ++i) {
+        const uint64_t rx = w->buf[i].tag.rx_us;
+        if (0U != rx)
+            PoolAdd_(&w->rx_hist[RfidHistIndex_((deq_us > rx) ? (deq_us - rx) : 0U)], 1U);
+    }
+
+    uint32_t cnt = n;
+    for (uint32_t k = 0; (k < pool->stage_count) && (cnt > 0U); ++k) {
+        rfid_pool_counter_t *c = &w->counters[k];
+        const uint64_t t0 = PoolNowNs_();
+        const uint64_t t0_us = t0 / 1000U;
+        for (uint32_t i = 0; i < cnt; ++i) {
+            const uint64_t sub = w->buf[i].submit_us;
+            PoolAdd_(&c->hist[RfidHistIndex_((t0_us > sub) ? (t0_us - sub) : 0U)], 1U);
+        }
+
+        int out = pool->stages[k].fn(pool->stages[k].user, w->buf, (int) cnt);
+        if (out < 0)
+            out = 0;
+        if ((uint32_t) out > cnt)
+            out = (int) cnt;
+
+        PoolAdd_(&c->busy_ns, PoolNowNs_() - t0);
+        PoolAdd_(&c->items_in, cnt);
+        PoolAdd_(&c->items_out, (uint64_t) out);
+        PoolAdd_(&c->calls, 1U);
+        cnt = (uint32_t) out;
+    }
+    PoolAdd_(&w->batches, 1U);
+    PoolAdd_(&w->processed, n);
+    (void) __atomic_sub_fetch(&pool->pending, n, __ATOMIC_RELEASE);
+
+    (void) pthread_mutex_lock(&lane->lock);
+    if (0U != lane->count)
+        PoolPush_(pool, w, lane_idx);
+    else
+        lane->scheduled = 0U;
+    (void) pthread_mutex_unlock(&lane->lock);
+}
+
+/**
+ * @brief 작업 스레드 본체. 자기 deque → 다른 deque 훔치기 → 잠들기 순으로 반복한다.
+ */
+static void *PoolWorker_(void *arg) {
+    rfid_pool_worker_t *w = (rfid_pool_worker_t *) arg;
+    rfid_pool_t *pool = w->pool;
+
+    for (;;) {
+        uint32_t lane = PoolPop_(pool, w);
+        for (uint32_t k = 1U; (RFID_POOL_NONE == lane) && (k < pool->worker_count); ++k) {
+            lane = PoolSteal_(pool, &pool->workers[(w->index + k) % pool->worker_count]);
+            if (RFID_POOL_NONE != lane)
+                PoolAdd_(&w->steals, 1U);
+        }
+        if (RFID_POOL_NONE != lane) {
+            (void) __atomic_sub_fetch(&pool->queued, 1U, __ATOMIC_SEQ_CST);
+            PoolProcess_(pool, w, lane);
+            continue;
+        }
+
+        // 처리 중인 lane 은 처리하는 작업 스레드가 스스로 다시 넣고 꺼내므로 deque 가 비면 멈춰도 된다.
+        if (0U != __atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE))
+            break;
+
+        (void) pthread_mutex_lock(&pool->idle_lock);
+        (void) __atomic_add_fetch(&pool->idle, 1U, __ATOMIC_SEQ_CST);
+        if ((0U == __atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST)) && (0U == __atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE))) {
+            struct timespec until;
+            (void) clock_gettime(CLOCK_MONOTONIC, &until);
+            until.tv_nsec += (long) RFID_POOL_IDLE_WAIT_MS * 1000000L;
+            if (until.tv_nsec >= 1000000000L) {
+                until.tv_sec += 1;
+                until.tv_nsec -= 1000000000L;
+            }
+            (void) pthread_cond_timedwait(&pool->idle_cond, &pool->idle_lock, &until);
+        }
+        (void) __atomic_sub_fetch(&pool->idle, 1U, __ATOMIC_SEQ_CST);
+        (void) pthread_mutex_unlock(&pool->idle_lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 작업 스레드를 멈추고(남은 lane 은 비운 뒤) 풀 메모리를 해제한다.
+ */
+static void PoolFree_(IN_ rfid_pool_t *pool) {
+    __atomic_store_n(&pool->stop, 1U, __ATOMIC_RELEASE);
+    (void) pthread_mutex_lock(&pool->idle_lock);
+    (void) pthread_cond_broadcast(&pool->idle_cond);
+    (void) pthread_mutex_unlock(&pool->idle_lock);
+
+    if (NULL != pool->workers) {
+        for (uint32_t i = 0; i < pool->worker_count; ++i) {
+            if (0 != pool->workers[i].started)
+                (void) pthread_join(pool->workers[i].thread, NULL);
+        }
+        for (uint32_t i = 0; i < pool->worker_count; ++i) {
+            free(pool->workers[i].deque);
+            free(pool->workers[i].buf);
+            free(pool->workers[i].counters);
+            (void) pthread_mutex_destroy(&pool->workers[i].lock);
+        }
+        free(pool->workers);
+    }
+    if (NULL != pool->lanes) {
+        for (uint32_t i = 0; i <= pool->lane_mask; ++i) {
+            free(pool->lanes[i].items);
+            free(pool->lanes[i].hashes);
+            (void) pthread_cond_destroy(&pool->lanes[i].space);
+            (void) pthread_mutex_destroy(&pool->lanes[i].lock);
+        }
+        free(pool->lanes);
+    }
+    (void) pthread_cond_destroy(&pool->idle_cond);
+    (void) pthread_mutex_destroy(&pool->idle_lock);
+    free(pool);
+}
+
+/**
+ * @brief 풀을 만들고 작업 스레드를 시작한다.
+ * @param[in]  params 생성 파라미터
+ * @param[in]  stages stage 배열
+ * @param[in]  stage_count stage 수
+ * @param[out] out_pool 생성된 풀
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_pool_create(IN_ const rfid_pool_params_t *params
+                             , IN_ const rfid_pool_stage_t *stages
+                             , IN_ const int stage_count
+                             , OUT_ rfid_pool_t **out_pool) {
+    if (NULL == out_pool)
+        return RFID_RESULT_INVALID_ARG;
+    *out_pool = NULL;
+
+    if ((NULL == stages) || (stage_count <= 0) || (stage_count > RFID_POOL_STAGE_MAX))
+        return RFID_RESULT_INVALID_ARG;
+    for (int k = 0; k < stage_count; ++k) {
+        if (NULL == stages[k].fn)
+            return RFID_RESULT_INVALID_ARG;
+    }
+
+    rfid_pool_params_t prm;
+    memset(&prm, 0, sizeof(prm));
+    if (NULL != params)
+        prm = *params;
+
+    uint32_t workers = prm.workers;
+    if (0U == workers) {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = (online > 0) ? (uint32_t) online : 1U;
+        if (workers > RFID_POOL_WORKERS_MAX)
+            workers = RFID_POOL_WORKERS_MAX;
+    }
+    const uint32_t lanes = (0U != prm.lanes) ? prm.lanes : RFID_POOL_LANES;
+    const uint32_t batch = (0U != prm.batch) ? prm.batch : RFID_POOL_BATCH;
+    if ((workers > RFID_POOL_WORKERS_MAX) || (lanes > RFID_POOL_LANES_MAX) || (0U != (lanes & (lanes - 1U)))
+        || (batch > RFID_POOL_BATCH_MAX) || ((uint32_t) prm.policy > (uint32_t) RFID_POOL_POLICY_COALESCE))
+        return RFID_RESULT_INVALID_ARG;
+
+    // 메모리 상한을 주면 lane 용량을 거기서 정한다(COALESCE 는 레코드마다 해시 8바이트가 더 든다).
+    const uint64_t record_bytes = sizeof(rfid_pool_item_t) + ((RFID_POOL_POLICY_COALESCE == prm.policy) ? sizeof(uint64_t) : 0U);
+    uint64_t lane_capacity = (0U != prm.lane_capacity) ? prm.lane_capacity : RFID_POOL_LANE_CAPACITY;
+    if (0U != prm.memory_limit_bytes)
+        lane_capacity = prm.memory_limit_bytes / ((uint64_t) lanes * record_bytes);
+    if ((0U == lane_capacity) || (lane_capacity > RFID_POOL_LANE_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_pool_t *pool = (rfid_pool_t *) calloc(1, sizeof(rfid_pool_t));
+    if (NULL == pool)
+        return RFID_RESULT_INTERNAL_ERROR;
+    pool->worker_count = workers;
+    pool->lane_mask = lanes - 1U;
+    pool->lane_capacity = (uint32_t) lane_capacity;
+    pool->batch = batch;
+    pool->policy = prm.policy;
+    pool->block_timeout_ms = (0U != prm.block_timeout_ms) ? prm.block_timeout_ms : RFID_POOL_BLOCK_TIMEOUT_MS;
+    pool->stage_count = (uint32_t) stage_count;
+    for (int k = 0; k < stage_count; ++k) {
+        pool->stages[k] = stages[k];
+        if (NULL != stages[k].name) {
+            size_t len = strlen(stages[k].name);
+            if (len >= RFID_POOL_STAGE_NAME_MAX)
+                len = RFID_POOL_STAGE_NAME_MAX - 1U;
+            memcpy(pool->names[k], stages[k].name, len);
+        }
+        pool->stages[k].name = pool->names[k];
+    }
+
+    // 잠금/조건 변수를 먼저 모두 초기화해 두면 도중에 실패해도 PoolFree_ 로 정리할 수 있다.
+    pthread_condattr_t cattr;
+    int ok = (0 == pthread_condattr_init(&cattr)) ? 1 : 0;
+    if (0 != ok) {
+        (void) pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+        ok = (0 == pthread_cond_init(&pool->idle_cond, &cattr)) ? 1 : 0;
+        if (0 == ok)
+            (void) pthread_condattr_destroy(&cattr);
+    }
+    if (0 == ok) {
+        free(pool);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    (void) pthread_mutex_init(&pool->idle_lock, NULL);
+
+    void *mem = NULL;
+    if (0 == posix_memalign(&mem, 64U, (size_t) lanes * sizeof(rfid_pool_lane_t))) {
+        memset(mem, 0, (size_t) lanes * sizeof(rfid_pool_lane_t));
+        pool->lanes = (rfid_pool_lane_t *) mem;
+        for (uint32_t i = 0; i < lanes; ++i) {
+            (void) pthread_mutex_init(&pool->lanes[i].lock, NULL);
+            (void) pthread_cond_init(&pool->lanes[i].space, &cattr);
+        }
+    }
+    (void) pthread_condattr_destroy(&cattr);
+    mem = NULL;
+    if ((NULL != pool->lanes) && (0 == posix_memalign(&mem, 64U, (size_t) workers * sizeof(rfid_pool_worker_t)))) {
+        memset(mem, 0, (size_t) workers * sizeof(rfid_pool_worker_t));
+        pool->workers = (rfid_pool_worker_t *) mem;
+        for (uint32_t i = 0; i < workers; ++i)
+            (void) pthread_mutex_init(&pool->workers[i].lock, NULL);
+    }
+    if (NULL == pool->workers) {
+        PoolFree_(pool);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    ok = 1;
+    for (uint32_t i = 0; (0 != ok) && (i < lanes); ++i) {
+        pool->lanes[i].items = (rfid_pool_item_t *) calloc((size_t) lane_capacity, sizeof(rfid_pool_item_t));
+        ok = (NULL != pool->lanes[i].items) ? 1 : 0;
+        if ((0 != ok) && (RFID_POOL_POLICY_COALESCE == pool->policy)) {
+            pool->lanes[i].hashes = (uint64_t *) calloc((size_t) lane_capacity, sizeof(uint64_t));
+            ok = (NULL != pool->lanes[i].hashes) ? 1 : 0;
+        }
+    }
+    for (uint32_t i = 0; (0 != ok) && (i < workers); ++i) {
+        rfid_pool_worker_t *w = &pool->workers[i];
+        w->pool = pool;
+        w->index = i;
+        w->deque = (uint32_t *) calloc(lanes, sizeof(uint32_t));
+        w->buf = (rfid_pool_item_t *) calloc(batch, sizeof(rfid_pool_item_t));
+        w->counters = (rfid_pool_counter_t *) calloc((size_t) stage_count, sizeof(rfid_pool_counter_t));
+        ok = ((NULL != w->deque) && (NULL != w->buf) && (NULL != w->counters)) ? 1 : 0;
+    }
+    for (uint32_t i = 0; (0 != ok) && (i < workers); ++i) {
+        ok = (0 == pthread_create(&pool->workers[i].thread, NULL, PoolWorker_, &pool->workers[i])) ? 1 : 0;
+        pool->workers[i].started = ok;
+    }
+    if (0 == ok) {
+        PoolFree_(pool);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    *out_pool = pool;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 풀을 해제한다.
+ * @param[in,out] inout_pool 해제할 풀
+ */
+void rfid_pool_destroy(INOUT_ rfid_pool_t **inout_pool) {
+    if ((NULL == inout_pool) || (NULL == *inout_pool))
+        return;
+
+    PoolFree_(*inout_pool);
+    *inout_pool = NULL;
+}
+
+/**
+ * @brief lane 에 대기 중인 같은 EPC 레코드를 찾는다(COALESCE, lane 잠금 상태에서 호출).
+ *
+ * @return ring 위치(없으면 RFID_POOL_NONE)
+ */
+static uint32_t PoolFindPending_(IN_ const rfid_pool_t *pool
+                                 , IN_ const rfid_pool_lane_t *lane
+                                 , IN_ const uint64_t hash
+                                 , IN_ const rfid_tag_t *tag
+                                 , IN_ const uint32_t len) {
+    for (uint32_t i = 0; i < lane->count; ++i) {
+        const uint32_t pos = (lane->head + i) % pool->lane_capacity;
+        if (lane->hashes[pos] != hash)
+            continue;
+        const rfid_tag_t *t = &lane->items[pos].tag;
+        if ((t->epc_len == len) && (0 == memcmp(t->epc_bytes, tag->epc_bytes, len)))
+            return pos;
+    }
+    return RFID_POOL_NONE;
+}
+
+/**
+ * @brief 대기 레코드에 같은 EPC 의 새 태그를 합친다(readcnt 합, RSSI 최대인 read 의 리더/안테나, 마지막 ts).
+ */
+static void PoolCoalesce_(INOUT_ rfid_pool_item_t *item, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tag) {
+    item->tag.readcnt += tag->readcnt;
+    if (tag->rssi > item->tag.rssi) {
+        item->tag.rssi = tag->rssi;
+        item->tag.antenna = tag->antenna;
+        item->reader_id = reader_id;
+    }
+    if (tag->ts > item->tag.ts)
+        item->tag.ts = tag->ts;
+    item->merged++;
+}
+
+/**
+ * @brief lane 에 자리가 날 때까지 기다린다(BLOCK, lane 잠금 상태에서 호출).
+ *
+ * @param[in] pool 풀
+ * @param[in] lane lane
+ * @param[in] deadline 대기 마감 시각(CLOCK_MONOTONIC)
+ *
+ * @return 1: 자리 있음, 0: 시간 초과
+ */
+static int PoolWaitSpace_(IN_ const rfid_pool_t *pool, IN_ rfid_pool_lane_t *lane, IN_ const struct timespec *deadline) {
+    const uint64_t t0 = PoolNowNs_();
+    lane->blocked++;
+    lane->waiters++;
+    int rc = 0;
+    while ((lane->count >= pool->lane_capacity) && (0 == rc))
+        rc = pthread_cond_timedwait(&lane->space, &lane->lock, deadline);
+    lane->waiters--;
+    lane->block_wait_ns += PoolNowNs_() - t0;
+    return (lane->count < pool->lane_capacity) ? 1 : 0;
+}
+
+/**
+ * @brief read 결과를 풀에 넣는다.
+ * @param[in]  pool 풀
+ * @param[in]  reader_id 리더 id
+ * @param[in]  tags 태그 배열
+ * @param[in]  count 태그 개수
+ * @param[out] out_accepted 받은 태그 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_pool_submit(IN_ rfid_pool_t *pool
+                             , IN_ const uint16_t reader_id
+                             , IN_ const rfid_tag_t *tags
+                             , IN_ const int count
+                             , OUT_ int *out_accepted) {
+    if (NULL != out_accepted)
+        *out_accepted = 0;
+    if ((NULL == pool) || (count < 0) || ((NULL == tags) && (count > 0)))
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t now_us = PoolNowNs_() / 1000U;
+    // BLOCK 정책의 대기 한도는 호출 1회 전체에 적용한다(태그마다 기다리면 read 스레드가 그만큼 더 멈춘다).
+    struct timespec deadline = {0, 0};
+    int have_deadline = 0;
+    int accepted = 0;
+    for (int i = 0; i < count; ++i) {
+        const rfid_tag_t *tag = &tags[i];
+        const uint32_t len = (tag->epc_len > RFID_EPC_MAX_BYTES) ? RFID_EPC_MAX_BYTES : tag->epc_len;
+        const uint64_t hash = RfidEpcHash_(tag->epc_bytes, len);
+        const uint32_t lane_idx = (uint32_t) (hash >> 40) & pool->lane_mask;
+        rfid_pool_lane_t *lane = &pool->lanes[lane_idx];
+
+        (void) pthread_mutex_lock(&lane->lock);
+        if (RFID_POOL_POLICY_COALESCE == pool->policy) {
+            const uint32_t pos = PoolFindPending_(pool, lane, hash, tag, len);
+            if (RFID_POOL_NONE != pos) {
+                PoolCoalesce_(&lane->items[pos], reader_id, tag);
+                lane->coalesced++;
+                lane->submitted++;
+                (void) pthread_mutex_unlock(&lane->lock);
+                accepted++;
+                continue;
+            }
+        }
+
+        int has_space = (lane->count < pool->lane_capacity) ? 1 : 0;
+        if ((0 == has_space) && (RFID_POOL_POLICY_DROP_OLDEST == pool->policy)) {
+            // 가장 오래된 대기 태그 자리를 새 태그가 이어받으므로 pending 은 그대로다.
+            lane->head = (lane->head + 1U) % pool->lane_capacity;
+            lane->count--;
+            lane->dropped_oldest++;
+            (void) __atomic_sub_fetch(&pool->pending, 1U, __ATOMIC_RELAXED);
+            has_space = 1;
+        } else if ((0 == has_space) && (RFID_POOL_POLICY_BLOCK == pool->policy)) {
+            if (0 == have_deadline) {
+                (void) clock_gettime(CLOCK_MONOTONIC, &deadline);
+                deadline.tv_sec += (time_t) (pool->block_timeout_ms / 1000U);
+                deadline.tv_nsec += (long) (pool->block_timeout_ms % 1000U) * 1000000L;
+                if (deadline.tv_nsec >= 1000000000L) {
+                    deadline.tv_sec += 1;
+                    deadline.tv_nsec -= 1000000000L;
+                }
+                have_deadline = 1;
+            }
+            has_space = PoolWaitSpace_(pool, lane, &deadline);
+            if (0 == has_space)
+                lane->block_timeouts++;
+        }
+        if (0 == has_space) {
+            lane->dropped_newest++;
+            (void) pthread_mutex_unlock(&lane->lock);
+            continue;
+        }
+
+        const uint32_t pos = (lane->head + lane->count) % pool->lane_capacity;
+        rfid_pool_item_t *item = &lane->items[pos];
+        item->submit_us = now_us;
+        item->reader_id = reader_id;
+        item->merged = 0U;
+        memcpy(&item->tag, tag, sizeof(*tag));
+        if (NULL != lane->hashes)
+            lane->hashes[pos] = hash;
+        lane->count++;
+        lane->submitted++;
+        // 작업 스레드는 lane 잠금을 잡고 꺼내므로 잠금 안에서 올리면 pending 이 먼저 줄지 않는다.
+        (void) __atomic_add_fetch(&pool->pending, 1U, __ATOMIC_RELAXED);
+        if (0U == lane->scheduled) {
+            lane->scheduled = 1U;
+            PoolPush_(pool, &pool->workers[lane_idx % pool->worker_count], lane_idx);
+        }
+        (void) pthread_mutex_unlock(&lane->lock);
+        accepted++;
+    }
+
+    if (NULL != out_accepted)
+        *out_accepted = accepted;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 대기 중인 태그가 모두 처리될 때까지 기다린다.
+ * @param[in]  pool 풀
+ * @param[in]  timeout_ms 최대 대기 시간(ms)
+ * @param[out] out_pending 남은 태그 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_pool_drain(IN_ rfid_pool_t *pool, IN_ const uint32_t timeout_ms, OUT_ uint32_t *out_pending) {
+    if (NULL != out_pending)
+        *out_pending = 0U;
+    if (NULL == pool)
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t deadline = PoolNowNs_() + ((uint64_t) timeout_ms * 1000000ULL);
+    uint32_t pending = __atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE);
+    while ((0U != pending) && (PoolNowNs_() < deadline)) {
+        const struct timespec nap = {0, 200000L};
+        (void) nanosleep(&nap, NULL);
+        pending = __atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE);
+    }
+
+    if (NULL != out_pending)
+        *out_pending = pending;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 풀 상태와 stage 별 상태를 조회한다.
+ * @param[in]  pool 풀
+ * @param[out] out_stat 풀 상태
+ * @param[out] out_stages stage 별 상태 배열
+ * @param[in]  stage_capacity out_stages 길이
+ * @param[out] out_stage_count 채운 stage 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_pool_get_stats(IN_ rfid_pool_t *pool
+                                , OUT_ rfid_pool_stat_t *out_stat
+                                , OUT_ rfid_pool_stage_stat_t *out_stages
+                                , IN_ const int stage_capacity
+                                , OUT_ int *out_stage_count) {
+    if (NULL != out_stage_count)
+        *out_stage_count = 0;
+    if ((NULL == pool) || ((NULL != out_stages) && (stage_capacity < 0)))
+        return RFID_RESULT_INVALID_ARG;
+
+    if (NULL != out_stat) {
+        rfid_pool_stat_t st;
+        memset(&st, 0, sizeof(st));
+        for (uint32_t i = 0; i <= pool->lane_mask; ++i) {
+            rfid_pool_lane_t *lane = &pool->lanes[i];
+            (void) pthread_mutex_lock(&lane->lock);
+            st.submitted += lane->submitted;
+            st.dropped_newest += lane->dropped_newest;
+            st.dropped_oldest += lane->dropped_oldest;
+            st.coalesced += lane->coalesced;
+            st.blocked += lane->blocked;
+            st.block_timeouts += lane->block_timeouts;
+            st.block_wait_us += lane->block_wait_ns / 1000U;
+            (void) pthread_mutex_unlock(&lane->lock);
+        }
+        uint64_t rx_hist[RFID_HIST_BUCKETS];
+        uint64_t rx_total = 0;
+        memset(rx_hist, 0, sizeof(rx_hist));
+        for (uint32_t i = 0; i < pool->worker_count; ++i) {
+            const rfid_pool_worker_t *w = &pool->workers[i];
+            st.processed += __atomic_load_n(&w->processed, __ATOMIC_RELAXED);
+            st.batches += __atomic_load_n(&w->batches, __ATOMIC_RELAXED);
+            st.steals += __atomic_load_n(&w->steals, __ATOMIC_RELAXED);
+            for (uint32_t b = 0; b < RFID_HIST_BUCKETS; ++b) {
+                const uint64_t v = __atomic_load_n(&w->rx_hist[b], __ATOMIC_RELAXED);
+                rx_hist[b] += v;
+                rx_total += v;
+            }
+        }
+        st.rx_p50_us = RfidHistPercentile_(rx_hist, rx_total, 500U);
+        st.rx_p99_us = RfidHistPercentile_(rx_hist, rx_total, 990U);
+        st.rx_p999_us = RfidHistPercentile_(rx_hist, rx_total, 999U);
+        st.rx_max_us = RfidHistPercentile_(rx_hist, rx_total, 1000U);
+        st.dropped = st.dropped_newest + st.dropped_oldest;
+        st.memory_bytes = (uint64_t) (pool->lane_mask + 1U) * pool->lane_capacity
+                          * (sizeof(rfid_pool_item_t) + ((RFID_POOL_POLICY_COALESCE == pool->policy) ? sizeof(uint64_t) : 0U));
+        st.pending = __atomic_load_n(&pool->pending, __ATOMIC_RELAXED);
+        st.workers = pool->worker_count;
+        st.lanes = pool->lane_mask + 1U;
+        st.lane_capacity = pool->lane_capacity;
+        st.stages = pool->stage_count;
+        st.policy = pool->policy;
+        *out_stat = st;
+    }
+
+    if (NULL == out_stages)
+        return RFID_RESULT_OK;
+
+    const uint32_t n = ((uint32_t) stage_capacity < pool->stage_count) ? (uint32_t) stage_capacity : pool->stage_count;
+    uint64_t hist[RFID_HIST_BUCKETS];
+    for (uint32_t k = 0; k < n; ++k) {
+        rfid_pool_stage_stat_t *dst = &out_stages[k];
+        memset(dst, 0, sizeof(*dst));
+        memcpy(dst->name, pool->names[k], sizeof(dst->name));
+        memset(hist, 0, sizeof(hist));
+        uint64_t total = 0;
+        uint64_t busy_ns = 0;
+        for (uint32_t i = 0; i < pool->worker_count; ++i) {
+            const rfid_pool_counter_t *c = &pool->workers[i].counters[k];
+            dst->items_in += __atomic_load_n(&c->items_in, __ATOMIC_RELAXED);
+            dst->items_out += __atomic_load_n(&c->items_out, __ATOMIC_RELAXED);
+            dst->calls += __atomic_load_n(&c->calls, __ATOMIC_RELAXED);
+            busy_ns += __atomic_load_n(&c->busy_ns, __ATOMIC_RELAXED);
+            for (uint32_t b = 0; b < RFID_HIST_BUCKETS; ++b) {
+                const uint64_t v = __atomic_load_n(&c->hist[b], __ATOMIC_RELAXED);
+                hist[b] += v;
+                total += v;
+            }
+        }
+        dst->busy_us = busy_ns / 1000U;
+        dst->items_per_sec = (0U != busy_ns) ? ((double) dst->items_in * 1e9 / (double) busy_ns) : 0.0;
+        dst->queue_p50_us = RfidHistPercentile_(hist, total, 500U);
+        dst->queue_p99_us = RfidHistPercentile_(hist, total, 990U);
+        dst->queue_p999_us = RfidHistPercentile_(hist, total, 999U);
+        dst->queue_max_us = RfidHistPercentile_(hist, total, 1000U);
+    }
+
+    if (NULL != out_stage_count)
+        *out_stage_count = (int) n;
+    return RFID_RESULT_OK;
+}
@@ -0,0 +1,125 @@
+#ifndef RFID_POOL_H_
+#define RFID_POOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 태그 후처리 stage 함수.
+ *
+ * - items 를 고쳐 쓸 수 있다. 걸러낼 태그는 빼고 남길 태그를 items 앞쪽으로 모은 뒤 그 개수를 반환한다.
+ *   count 를 그대로 반환하면 모두 다음 stage 로 넘긴다. 0을 반환하면 이 batch 의 나머지 stage 는 호출하지 않는다.
+ * - 여러 작업 스레드에서 동시에 호출된다. 같은 EPC 의 태그는 넣은 순서대로 한 스레드에서만 처리한다.
+ *
+ * @param[in]     user 등록 시 넘긴 사용자 값
+ * @param[in,out] items 태그 batch(같은 lane, 넣은 순서)
+ * @param[in]     count 태그 수
+ *
+ * @return 남긴 태그 수(0..count, 범위를 벗어나면 잘라서 쓴다)
+ */
+typedef int (*rfid_pool_stage_fn)(void *user, rfid_pool_item_t *items, int count);
+
+/**
+ * @brief 후처리 stage 등록 정보
+ */
+typedef struct rfid_pool_stage {
+    const char *name; // stage 이름(통계용, NULL 허용, RFID_POOL_STAGE_NAME_MAX - 1 자까지 복사)
+    rfid_pool_stage_fn fn; // stage 함수
+    void *user; // fn 에 넘길 사용자 값
+} rfid_pool_stage_t;
+
+/**
+ * @brief 태그 후처리 작업 풀. 구현부에서 정의하는 opaque 타입.
+ *
+ * - rfid_read() 스레드는 태그를 lane 큐에 복사만 하고 돌아가며, 필터/해석/존재 감지/sink 같은 stage 는 작업 스레드가 실행한다.
+ * - EPC 해시로 태그를 lane 에 나눈다. lane 은 한 번에 한 작업 스레드만 처리하므로 같은 EPC 의 순서가 유지된다.
+ * - 처리할 태그가 생긴 lane 은 담당 작업 스레드의 deque 에 들어간다. 자기 deque 는 앞에서(FIFO) 꺼내고,
+ *   비어 있으면 다른 작업 스레드의 deque 뒤에서 lane 을 훔쳐 온다(work stealing). 느린 stage 가 있어도 다른 lane 은 계속 흐른다.
+ * - stage 별로 대기 시간(넣은 뒤 stage 시작까지) 백분위와 실행 시간 기준 처리율을 집계한다.
+ * - 대기 메모리는 생성 시 고정한다(lane 수 * lane 용량). lane 이 가득 차면 policy 에 따라
+ *   새 태그 버림/오래된 태그 버림/제한 시간 대기/같은 EPC 합치기를 하고 정책별 카운터로 집계한다.
+ *   BLOCK 도 block_timeout_ms 를 넘겨 기다리지 않으므로 느린 stage 가 read 스레드를 오래 막지 않는다.
+ * - submit/drain/get_stats 는 여러 스레드에서 동시에 호출할 수 있다.
+ */
+typedef struct rfid_pool rfid_pool_t;
+
+/**
+ * @brief 풀을 만들고 작업 스레드를 시작한다.
+ *
+ * @param[in]  params 생성 파라미터(NULL이면 모두 기본값). 호출 중에만 참조한다.
+ * @param[in]  stages stage 배열(실행 순서). 풀이 복사한다(user 가 가리키는 대상은 풀이 해제될 때까지 유지).
+ * @param[in]  stage_count stage 수(1..RFID_POOL_STAGE_MAX)
+ * @param[out] out_pool 생성된 풀
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류(lane 수가 2의 거듭제곱이 아님, fn 이 NULL 등),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당/스레드 생성 실패
+ */
+RFID_RESULT rfid_pool_create(IN_ const rfid_pool_params_t *params
+                             , IN_ const rfid_pool_stage_t *stages
+                             , IN_ const int stage_count
+                             , OUT_ rfid_pool_t **out_pool);
+
+/**
+ * @brief 대기 중인 태그를 모두 처리한 뒤 작업 스레드를 멈추고 풀을 해제한다. 성공 시 *inout_pool 을 NULL로 설정한다.
+ * @note 다른 스레드가 submit 중이지 않아야 한다.
+ * @param[in,out] inout_pool 해제할 풀(NULL 허용)
+ */
+void rfid_pool_destroy(INOUT_ rfid_pool_t **inout_pool);
+
+/**
+ * @brief 한 리더의 read 결과를 풀에 넣는다(복사 후 반환, BLOCK 정책은 호출 1회에 최대 block_timeout_ms 대기).
+ *
+ * @param[in]  pool 풀
+ * @param[in]  reader_id 리더 id(rfid_pool_item_t.reader_id)
+ * @param[in]  tags 태그 배열(NULL 허용)
+ * @param[in]  count 태그 개수
+ * @param[out] out_accepted 받은 태그 수(NULL 허용, 합친 태그 포함. 나머지는 dropped_newest 로 집계)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_pool_submit(IN_ rfid_pool_t *pool
+                             , IN_ const uint16_t reader_id
+                             , IN_ const rfid_tag_t *tags
+                             , IN_ const int count
+                             , OUT_ int *out_accepted);
+
+/**
+ * @brief 대기 중인 태그가 모두 처리될 때까지 기다린다.
+ *
+ * @param[in]  pool 풀
+ * @param[in]  timeout_ms 최대 대기 시간(ms)
+ * @param[out] out_pending 반환 시점에 남은 태그 수(NULL 허용, 0이면 모두 처리)
+ *
+ * @return RFID_RESULT_OK: 성공(시간 초과 포함, out_pending 으로 구분),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_pool_drain(IN_ rfid_pool_t *pool, IN_ const uint32_t timeout_ms, OUT_ uint32_t *out_pending);
+
+/**
+ * @brief 풀 상태와 stage 별 상태를 조회한다.
+ *
+ * @param[in]  pool 풀
+ * @param[out] out_stat 풀 상태(NULL 허용)
+ * @param[out] out_stages stage 별 상태 배열(NULL 허용)
+ * @param[in]  stage_capacity out_stages 길이
+ * @param[out] out_stage_count 채운 stage 수(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_pool_get_stats(IN_ rfid_pool_t *pool
+                                , OUT_ rfid_pool_stat_t *out_stat
+                                , OUT_ rfid_pool_stage_stat_t *out_stages
+                                , IN_ const int stage_capacity
+                                , OUT_ int *out_stage_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_POOL_H_
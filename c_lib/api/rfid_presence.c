@@ -0,0 +1,883 @@
+// c_lib/api/rfid_presence.c
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+
+#include "rfid_presence.h"
+#include "rfid_util_internal.h"
+
+#include <fcntl.h>    // open
+#include <stddef.h>   // offsetof
+#include <stdlib.h>   // calloc, free, posix_memalign
+#include <string.h>   // memcpy, memcmp
+#include <sys/mman.h> // mmap, msync
+#include <sys/stat.h> // fstat
+#include <time.h>     // clock_gettime
+#include <unistd.h>   // close, ftruncate
+
+// 내부 상수
+#define RFID_PRESENCE_CAPACITY      (262144U)     // 추적 용량 기본값
+#define RFID_PRESENCE_CAPACITY_MAX  (1U << 24)
+#define RFID_PRESENCE_HOLDOFF_MS    (5000U)       // PRESENT 최소 간격 기본값
+#define RFID_PRESENCE_DEPART_MS     (3000U)       // DEPART 기준 미검출 시간 기본값
+#define RFID_PRESENCE_NONE          (0xFFFFFFFFU) // 목록 끝/빈 항목
+#define RFID_PRESENCE_RSSI_NONE     (-128)        // 직전 이벤트 이후 read 없음
+#define RFID_PRESENCE_PAGE          (4096U)       // 스냅샷 단위(변경 추적/복사/체크섬)
+#define RFID_PRESENCE_SNAP_MAGIC    "RFIDPSNP"
+#define RFID_PRESENCE_SNAP_VERSION  (1U)
+#define RFID_PRESENCE_SNAP_INTERVAL (5000U)       // 스냅샷 주기 기본값
+#define RFID_PRESENCE_SNAP_MAX_AGE  (60000U)      // 복원할 스냅샷 최대 나이 기본값
+#define RFID_PRESENCE_IDENTITY_MAX  (128)         // 스냅샷 소유자(리더 URI 등) 최대 길이
+
+/**
+ * @brief 추적 항목((EPC, zone) 1개)
+ *
+ * @param hash          (EPC, zone) 해시
+ * @param first_seen_ms zone 에 나타난 시각
+ * @param last_seen_ms  마지막으로 읽은 시각
+ * @param last_event_ms 마지막 ARRIVE/PRESENT 시각
+ * @param prev          zone 목록의 이전 항목(더 오래 전에 읽음)
+ * @param next          zone 목록의 다음 항목, 빈 항목이면 free 목록의 다음 항목
+ * @param reads         직전 이벤트 이후 read 수
+ * @param zone          zone 인덱스(0: 기본 zone)
+ * @param antenna       마지막으로 읽은 안테나
+ * @param rssi          직전 이벤트 이후 최대 RSSI
+ * @param epc_len       EPC 바이트 수
+ * @param epc           바이너리 EPC
+ */
+typedef struct rfid_presence_entry {
+    uint64_t hash;
+    uint64_t first_seen_ms;
+    uint64_t last_seen_ms;
+    uint64_t last_event_ms;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t reads;
+    uint8_t zone;
+    uint8_t antenna;
+    int8_t rssi;
+    uint8_t epc_len;
+    uint8_t epc[RFID_EPC_MAX_BYTES];
+} rfid_presence_entry_t;
+
+/**
+ * @brief zone 상태
+ *
+ * @param zone_id    이벤트에 기록할 zone id
+ * @param holdoff_ms PRESENT 최소 간격
+ * @param depart_ms  DEPART 기준 미검출 시간
+ * @param head       가장 오래 전에 읽은 항목(DEPART 후보)
+ * @param tail       가장 최근에 읽은 항목
+ */
+typedef struct rfid_presence_zone_state {
+    int32_t zone_id;
+    uint32_t holdoff_ms;
+    uint32_t depart_ms;
+    uint32_t head;
+    uint32_t tail;
+} rfid_presence_zone_state_t;
+
+/**
+ * @brief 스냅샷 슬롯 기술자(파일 헤더 안)
+ *
+ * @param seq       스냅샷 번호(0: 없음/기록 중)
+ * @param wall_ms   기록 시각(epoch ms)
+ * @param engine_ms 기록 시점 엔진 시각(마지막 update 의 now)
+ * @param checksum  슬롯 전체 페이지 체크섬 합
+ */
+typedef struct rfid_presence_snap_desc {
+    uint64_t seq;
+    uint64_t wall_ms;
+    uint64_t engine_ms;
+    uint64_t checksum;
+} rfid_presence_snap_desc_t;
+
+/**
+ * @brief 스냅샷 파일 헤더(첫 페이지)
+ *
+ * 파일 = 헤더 페이지 + 슬롯 2개. 슬롯 = 메타 페이지 + 엔진 arena(항목 배열 + 해시 테이블) 페이지 그대로.
+ * 두 슬롯에 번갈아 기록하므로 기록 중 죽어도 다른 슬롯이 남는다.
+ *
+ * @param magic       RFID_PRESENCE_SNAP_MAGIC
+ * @param version     RFID_PRESENCE_SNAP_VERSION
+ * @param page_size   RFID_PRESENCE_PAGE
+ * @param layout_hash 용량/항목 크기/zone 구성 해시(다르면 복원하지 않음)
+ * @param slot_bytes  슬롯 크기
+ * @param identity    스냅샷 소유자(리더 URI 등)
+ * @param desc        슬롯 기술자
+ */
+typedef struct rfid_presence_snap_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t page_size;
+    uint64_t layout_hash;
+    uint64_t slot_bytes;
+    char identity[RFID_PRESENCE_IDENTITY_MAX];
+    rfid_presence_snap_desc_t desc[2];
+} rfid_presence_snap_header_t;
+
+/**
+ * @brief 스냅샷 슬롯 메타 페이지(arena 밖 엔진 상태)
+ */
+typedef struct rfid_presence_snap_meta {
+    uint32_t free_head;
+    uint32_t unused_head;
+    uint32_t tracked;
+    uint32_t head[RFID_PRESENCE_ZONE_MAX + 1];
+    uint32_t tail[RFID_PRESENCE_ZONE_MAX + 1];
+} rfid_presence_snap_meta_t;
+
+/**
+ * @brief 태그 존재 감지 엔진
+ *
+ * @param entries   추적 항목 배열(capacity 개, arena 앞쪽)
+ * @param slots     (EPC, zone) → 항목 인덱스 + 1 선형 탐사 해시 테이블(0: 빈 슬롯, arena 뒤쪽)
+ * @param mask      slots 크기 - 1
+ * @param free_head 해제된 빈 항목 목록
+ * @param unused_head 한 번도 쓰지 않은 첫 항목(이후 항목도 모두 미사용, 0으로 남아 스냅샷 비교가 싸다)
+ * @param ant_zone  안테나 번호 → zone 인덱스
+ * @param zones     zone 상태(0: 기본 zone)
+ * @param zone_count zones 유효 개수(기본 zone 포함)
+ * @param stat      누적 상태
+ * @param arena     entries + slots 를 담은 페이지 정렬 메모리(스냅샷에 그대로 복사)
+ * @param arena_pages arena 페이지 수
+ * @param last_now_ms 마지막 update 시각
+ * @param layout_hash 스냅샷 호환성 해시
+ * @param snap_fd   스냅샷 파일(-1: 사용 안 함)
+ * @param snap_map  스냅샷 파일 매핑
+ * @param snap_len  스냅샷 파일 크기
+ * @param snap_slot_bytes 슬롯 크기
+ * @param snap_dirty 슬롯별 변경 페이지 비트맵(마지막으로 그 슬롯에 기록한 뒤 바뀐 arena 페이지)
+ * @param snap_sum  슬롯별 arena 페이지 체크섬
+ * @param snap_total 슬롯별 arena 페이지 체크섬 합
+ * @param snap_seq  마지막 스냅샷 번호
+ * @param snap_last_ms 마지막 스냅샷 시각(엔진 시각)
+ * @param snap_interval_ms 스냅샷 주기
+ * @param snap_max_age_ms 복원할 스냅샷 최대 나이
+ * @param identity  스냅샷 소유자
+ */
+struct rfid_presence {
+    rfid_presence_entry_t *entries;
+    uint32_t *slots;
+    uint32_t mask;
+    uint32_t free_head;
+    uint32_t unused_head;
+    uint8_t ant_zone[RFID_ANTENNA_MAX + 1];
+    rfid_presence_zone_state_t zones[RFID_PRESENCE_ZONE_MAX + 1];
+    int zone_count;
+    rfid_presence_stat_t stat;
+    uint8_t *arena;
+    size_t arena_pages;
+    uint64_t last_now_ms;
+    uint64_t layout_hash;
+    int snap_fd;
+    uint8_t *snap_map;
+    size_t snap_len;
+    size_t snap_slot_bytes;
+    uint64_t *snap_dirty[2];
+    uint64_t *snap_sum[2];
+    uint64_t snap_total[2];
+    uint64_t snap_seq;
+    uint64_t snap_last_ms;
+    uint32_t snap_interval_ms;
+    uint32_t snap_max_age_ms;
+    char identity[RFID_PRESENCE_IDENTITY_MAX];
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms, 0이 되지 않도록 1부터)
+ */
+static uint64_t PresenceNowMs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL) + 1U;
+}
+
+/**
+ * @brief 벽시계 기준 현재 시각(epoch ms)
+ */
+static uint64_t PresenceWallMs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_REALTIME, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL);
+}
+
+/**
+ * @brief since 이후 경과 시간(ms). now_ms 가 뒤로 가면(호출자 시계 혼용, 복원 직후 등) 0으로 본다.
+ */
+static uint64_t PresenceElapsed_(IN_ const uint64_t now, IN_ const uint64_t since) {
+    return (now > since) ? (now - since) : 0U;
+}
+
+/**
+ * @brief arena 의 [addr, addr + len) 이 걸친 페이지를 두 슬롯 모두 변경으로 표시한다(스냅샷 미사용 시 무시).
+ */
+static void PresenceTouch_(IN_ rfid_presence_t *p, IN_ const void *addr, IN_ const size_t len) {
+    if (NULL == p->snap_map)
+        return;
+    const size_t off = (size_t) ((const uint8_t *) addr - p->arena);
+    for (size_t pg = off / RFID_PRESENCE_PAGE; pg <= (off + len - 1U) / RFID_PRESENCE_PAGE; ++pg) {
+        p->snap_dirty[0][pg / 64U] |= 1ULL << (pg % 64U);
+        p->snap_dirty[1][pg / 64U] |= 1ULL << (pg % 64U);
+    }
+}
+
+/**
+ * @brief 스냅샷 페이지 체크섬(페이지 번호를 섞어 자리 바뀜도 검출)
+ */
+static uint64_t PresencePageSum_(IN_ const uint8_t *page, IN_ const uint64_t index) {
+    const uint64_t *w = (const uint64_t *) (const void *) page;
+    uint64_t h = (index + 1U) * 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = 0; i < RFID_PRESENCE_PAGE / sizeof(uint64_t); ++i) {
+        h ^= w[i];
+        h = ((h << 27) | (h >> 37)) * 0xFF51AFD7ED558CCDULL;
+    }
+    return h ^ (h >> 33);
+}
+
+/**
+ * @brief (EPC, zone) 해시(FNV-1a + 섞기)
+ */
+static uint64_t PresenceHash_(IN_ const uint8_t *epc, IN_ const uint32_t len, IN_ const uint8_t zone) {
+    return RfidHashMix_(RfidFnv1a_(epc, len) ^ (((uint64_t) zone + 1U) * 0x9E3779B97F4A7C15ULL));
+}
+
+/**
+ * @brief (EPC, zone) 항목을 찾는다.
+ *
+ * @param[in]  p 엔진
+ * @param[in]  hash 해시
+ * @param[in]  epc EPC
+ * @param[in]  len EPC 바이트 수
+ * @param[in]  zone zone 인덱스
+ * @param[out] out_slot 찾은 슬롯, 없으면 삽입할 빈 슬롯
+ *
+ * @return 항목 인덱스(없으면 RFID_PRESENCE_NONE)
+ */
+static uint32_t PresenceFind_(IN_ const rfid_presence_t *p
+                              , IN_ const uint64_t hash
+                              , IN_ const uint8_t *epc
+                              , IN_ const uint32_t len
+                              , IN_ const uint8_t zone
+                              , OUT_ uint32_t *out_slot) {
+    uint32_t i = (uint32_t) hash & p->mask;
+    for (;;) {
+        const uint32_t v = p->slots[i];
+        if (0U == v) {
+            *out_slot = i;
+            return RFID_PRESENCE_NONE;
+        }
+        const rfid_presence_entry_t *e = &p->entries[v - 1U];
+        if ((e->hash == hash) && (e->zone == zone) && (e->epc_len == len) && (0 == memcmp(e->epc, epc, len))) {
+            *out_slot = i;
+            return v - 1U;
+        }
+        i = (i + 1U) & p->mask;
+    }
+}
+
+/**
+ * @brief 바뀐 슬롯을 스냅샷 dirty 로 표시한다(RfidSlotUnindex_ 콜백).
+ */
+static void PresenceSlotTouch_(IN_ void *user, IN_ const uint32_t *slot) {
+    PresenceTouch_((rfid_presence_t *) user, slot, sizeof(uint32_t));
+}
+
+/**
+ * @brief 해시 테이블에서 항목을 지운다(backward shift, tombstone 없음).
+ */
+static void PresenceUnindex_(IN_ rfid_presence_t *p, IN_ const uint32_t idx) {
+    RfidSlotUnindex_(p->slots, p->mask, p->entries, sizeof(rfid_presence_entry_t), offsetof(rfid_presence_entry_t, hash), idx, PresenceSlotTouch_, p);
+}
+
+/**
+ * @brief zone 목록에서 항목을 뗀다.
+ */
+static void PresenceUnlink_(IN_ rfid_presence_t *p, IN_ const uint32_t idx) {
+    rfid_presence_entry_t *e = &p->entries[idx];
+    rfid_presence_zone_state_t *z = &p->zones[e->zone];
+    if (RFID_PRESENCE_NONE != e->prev) {
+        p->entries[e->prev].next = e->next;
+        PresenceTouch_(p, &p->entries[e->prev], sizeof(*e));
+    } else {
+        z->head = e->next;
+    }
+    if (RFID_PRESENCE_NONE != e->next) {
+        p->entries[e->next].prev = e->prev;
+        PresenceTouch_(p, &p->entries[e->next], sizeof(*e));
+    } else {
+        z->tail = e->prev;
+    }
+    e->prev = RFID_PRESENCE_NONE;
+    e->next = RFID_PRESENCE_NONE;
+    PresenceTouch_(p, e, sizeof(*e));
+}
+
+/**
+ * @brief zone 목록 끝(가장 최근)에 항목을 붙인다.
+ */
+static void PresenceAppend_(IN_ rfid_presence_t *p, IN_ const uint32_t idx) {
+    rfid_presence_entry_t *e = &p->entries[idx];
+    rfid_presence_zone_state_t *z = &p->zones[e->zone];
+    e->prev = z->tail;
+    e->next = RFID_PRESENCE_NONE;
+    PresenceTouch_(p, e, sizeof(*e));
+    if (RFID_PRESENCE_NONE != z->tail) {
+        p->entries[z->tail].next = idx;
+        PresenceTouch_(p, &p->entries[z->tail], sizeof(*e));
+    } else {
+        z->head = idx;
+    }
+    z->tail = idx;
+}
+
+/**
+ * @brief 항목으로 이벤트를 채우고 이벤트 구간 누적값을 초기화한다.
+ */
+static void PresenceEmit_(IN_ const rfid_presence_t *p
+                          , INOUT_ rfid_presence_entry_t *e
+                          , IN_ const RFID_PRESENCE_EVENT type
+                          , IN_ const uint64_t ts_ms
+                          , OUT_ rfid_presence_event_t *ev) {
+    ev->ts_ms = ts_ms;
+    ev->first_seen_ms = e->first_seen_ms;
+    ev->reads = e->reads;
+    ev->zone_id = p->zones[e->zone].zone_id;
+    ev->type = (uint8_t) type;
+    ev->antenna = e->antenna;
+    ev->rssi = e->rssi;
+    ev->epc_len = e->epc_len;
+    memcpy(ev->epc, e->epc, e->epc_len);
+    if (e->epc_len < RFID_EPC_MAX_BYTES)
+        memset(ev->epc + e->epc_len, 0, RFID_EPC_MAX_BYTES - e->epc_len);
+
+    e->reads = 0U;
+    e->rssi = RFID_PRESENCE_RSSI_NONE;
+}
+
+/**
+ * @brief 스냅샷 슬롯 시작 주소
+ */
+static uint8_t* PresenceSnapSlot_(IN_ const rfid_presence_t *p, IN_ const int k) {
+    return p->snap_map + RFID_PRESENCE_PAGE + (size_t) k * p->snap_slot_bytes;
+}
+
+/**
+ * @brief 현재 엔진 상태를 다음 슬롯에 기록한다.
+ *
+ * 그 슬롯에 마지막으로 기록한 뒤 바뀐 arena 페이지와 메타 페이지만 복사하고, 체크섬은 바뀐 페이지만 다시 계산한다.
+ * 디스크 반영은 msync(MS_ASYNC)로 커널에 맡기므로 read 스레드를 I/O로 막지 않는다(sync 가 0이 아니면 MS_SYNC).
+ */
+static void PresenceSnapWrite_(IN_ rfid_presence_t *p, IN_ const int sync) {
+    const int k = (int) ((p->snap_seq + 1U) & 1U);
+    rfid_presence_snap_header_t *hdr = (rfid_presence_snap_header_t *) (void *) p->snap_map;
+    uint8_t *slot = PresenceSnapSlot_(p, k);
+
+    // 기록하는 동안 이 슬롯은 무효로 둔다(중간에 죽으면 다른 슬롯에서 복원).
+    __atomic_store_n(&hdr->desc[k].seq, 0U, __ATOMIC_RELEASE);
+
+    uint64_t copied = 0;
+    const size_t words = (p->arena_pages + 63U) / 64U;
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t bits = p->snap_dirty[k][w];
+        p->snap_dirty[k][w] = 0U;
+        while (0U != bits) {
+            const size_t pg = w * 64U + (size_t) __builtin_ctzll(bits);
+            bits &= bits - 1U;
+            const uint8_t *src = p->arena + pg * RFID_PRESENCE_PAGE;
+            memcpy(slot + (pg + 1U) * RFID_PRESENCE_PAGE, src, RFID_PRESENCE_PAGE);
+            const uint64_t sum = PresencePageSum_(src, pg + 1U);
+            p->snap_total[k] += sum - p->snap_sum[k][pg];
+            p->snap_sum[k][pg] = sum;
+            copied++;
+        }
+    }
+
+    rfid_presence_snap_meta_t meta;
+    memset(&meta, 0, sizeof(meta));
+    meta.free_head = p->free_head;
+    meta.unused_head = p->unused_head;
+    meta.tracked = p->stat.tracked;
+    for (int z = 0; z < p->zone_count; ++z) {
+        meta.head[z] = p->zones[z].head;
+        meta.tail[z] = p->zones[z].tail;
+    }
+    memset(slot, 0, RFID_PRESENCE_PAGE);
+    memcpy(slot, &meta, sizeof(meta));
+
+    hdr->desc[k].wall_ms = PresenceWallMs_();
+    hdr->desc[k].engine_ms = p->last_now_ms;
+    hdr->desc[k].checksum = p->snap_total[k] + PresencePageSum_(slot, 0U);
+    memcpy(hdr->identity, p->identity, sizeof(hdr->identity));
+    p->snap_seq++;
+    __atomic_store_n(&hdr->desc[k].seq, p->snap_seq, __ATOMIC_RELEASE);
+    (void) msync(p->snap_map, p->snap_len, (0 != sync) ? MS_SYNC : MS_ASYNC);
+
+    p->stat.snapshots++;
+    p->stat.snapshot_pages += copied + 1U;
+}
+
+/**
+ * @brief 슬롯 k 의 arena 페이지 체크섬을 파일에서 다시 계산하고, 지금 arena 와 다른 페이지만 변경으로 표시한다.
+ * @note 생성/복원 시 한 번만 수행하므로(크기에 비례) 이후 기록은 실제로 바뀐 페이지만 복사한다.
+ */
+static void PresenceSnapReconcile_(IN_ rfid_presence_t *p, IN_ const int k) {
+    const uint8_t *slot = PresenceSnapSlot_(p, k);
+    uint64_t total = 0;
+    for (size_t pg = 0; pg < p->arena_pages; ++pg) {
+        const uint8_t *page = slot + (pg + 1U) * RFID_PRESENCE_PAGE;
+        p->snap_sum[k][pg] = PresencePageSum_(page, pg + 1U);
+        total += p->snap_sum[k][pg];
+        if (0 != memcmp(page, p->arena + pg * RFID_PRESENCE_PAGE, RFID_PRESENCE_PAGE))
+            p->snap_dirty[k][pg / 64U] |= 1ULL << (pg % 64U);
+        else
+            p->snap_dirty[k][pg / 64U] &= ~(1ULL << (pg % 64U));
+    }
+    p->snap_total[k] = total;
+}
+
+/**
+ * @brief 스냅샷 파일을 열어 매핑한다. 호환되는 기존 파일은 복원을 위해 그대로 두고, 아니면 새로 만든다.
+ * @return RFID_RESULT 결과 코드
+ */
+static RFID_RESULT PresenceSnapOpen_(IN_ rfid_presence_t *p, IN_ const char *path) {
+    const size_t words = (p->arena_pages + 63U) / 64U;
+    p->snap_slot_bytes = (p->arena_pages + 1U) * RFID_PRESENCE_PAGE;
+    p->snap_len = RFID_PRESENCE_PAGE + 2U * p->snap_slot_bytes;
+    for (int k = 0; k < 2; ++k) {
+        p->snap_dirty[k] = (uint64_t *) calloc(words, sizeof(uint64_t));
+        p->snap_sum[k] = (uint64_t *) calloc(p->arena_pages, sizeof(uint64_t));
+        if ((NULL == p->snap_dirty[k]) || (NULL == p->snap_sum[k]))
+            return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    p->snap_fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (p->snap_fd < 0)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    struct stat st;
+    int keep = ((0 == fstat(p->snap_fd, &st)) && ((size_t) st.st_size == p->snap_len)) ? 1 : 0;
+    if ((0 == keep) && ((0 != ftruncate(p->snap_fd, 0)) || (0 != ftruncate(p->snap_fd, (off_t) p->snap_len))))
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    void *map = mmap(NULL, p->snap_len, PROT_READ | PROT_WRITE, MAP_SHARED, p->snap_fd, 0);
+    if (MAP_FAILED == map)
+        return RFID_RESULT_INTERNAL_ERROR;
+    p->snap_map = (uint8_t *) map;
+
+    rfid_presence_snap_header_t *hdr = (rfid_presence_snap_header_t *) map;
+    if ((0 != memcmp(hdr->magic, RFID_PRESENCE_SNAP_MAGIC, sizeof(hdr->magic)))
+        || (RFID_PRESENCE_SNAP_VERSION != hdr->version) || (RFID_PRESENCE_PAGE != hdr->page_size)
+        || (p->layout_hash != hdr->layout_hash) || (p->snap_slot_bytes != hdr->slot_bytes))
+        keep = 0;
+    if (0 == keep) {
+        memset(hdr, 0, RFID_PRESENCE_PAGE);
+        memcpy(hdr->magic, RFID_PRESENCE_SNAP_MAGIC, sizeof(hdr->magic));
+        hdr->version = RFID_PRESENCE_SNAP_VERSION;
+        hdr->page_size = RFID_PRESENCE_PAGE;
+        hdr->layout_hash = p->layout_hash;
+        hdr->slot_bytes = p->snap_slot_bytes;
+    }
+    p->snap_seq = (hdr->desc[0].seq > hdr->desc[1].seq) ? hdr->desc[0].seq : hdr->desc[1].seq;
+    for (int k = 0; k < 2; ++k)
+        PresenceSnapReconcile_(p, k);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 엔진 메모리와 스냅샷 매핑을 해제한다.
+ */
+static void PresenceFree_(IN_ rfid_presence_t *p) {
+    if (NULL != p->snap_map)
+        (void) munmap(p->snap_map, p->snap_len);
+    if (p->snap_fd >= 0)
+        (void) close(p->snap_fd);
+    for (int k = 0; k < 2; ++k) {
+        free(p->snap_dirty[k]);
+        free(p->snap_sum[k]);
+    }
+    free(p->arena);
+    free(p);
+}
+
+/**
+ * @brief 엔진을 만든다.
+ * @param[in]  params 생성 파라미터
+ * @param[out] out_presence 생성된 엔진
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_presence_create(IN_ const rfid_presence_params_t *params, OUT_ rfid_presence_t **out_presence) {
+    if (NULL == out_presence)
+        return RFID_RESULT_INVALID_ARG;
+    *out_presence = NULL;
+
+    rfid_presence_params_t def;
+    memset(&def, 0, sizeof(def));
+    const rfid_presence_params_t *prm = (NULL != params) ? params : &def;
+    if ((prm->zone_count < 0) || (prm->zone_count > RFID_PRESENCE_ZONE_MAX)
+        || ((prm->zone_count > 0) && (NULL == prm->zones)) || (prm->capacity > RFID_PRESENCE_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_presence_t *p = (rfid_presence_t *) calloc(1, sizeof(*p));
+    if (NULL == p)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    const uint32_t holdoff = (0U != prm->holdoff_ms) ? prm->holdoff_ms : RFID_PRESENCE_HOLDOFF_MS;
+    const uint32_t depart = (0U != prm->depart_ms) ? prm->depart_ms : RFID_PRESENCE_DEPART_MS;
+    p->zones[0].zone_id = 0;
+    p->zones[0].holdoff_ms = holdoff;
+    p->zones[0].depart_ms = depart;
+    for (int z = 0; z < prm->zone_count; ++z) {
+        const rfid_presence_zone_t *src = &prm->zones[z];
+        if ((src->antenna_count < 0) || ((src->antenna_count > 0) && (NULL == src->antennas))) {
+            free(p);
+            return RFID_RESULT_INVALID_ARG;
+        }
+        rfid_presence_zone_state_t *dst = &p->zones[z + 1];
+        dst->zone_id = src->zone_id;
+        dst->holdoff_ms = (0U != src->holdoff_ms) ? src->holdoff_ms : holdoff;
+        dst->depart_ms = (0U != src->depart_ms) ? src->depart_ms : depart;
+        for (int a = 0; a < src->antenna_count; ++a) {
+            const int ant = src->antennas[a];
+            if ((ant <= 0) || (ant > RFID_ANTENNA_MAX)) {
+                free(p);
+                return RFID_RESULT_INVALID_ARG;
+            }
+            if (0U == p->ant_zone[ant])
+                p->ant_zone[ant] = (uint8_t) (z + 1);
+        }
+    }
+    p->zone_count = prm->zone_count + 1;
+    for (int z = 0; z < p->zone_count; ++z) {
+        p->zones[z].head = RFID_PRESENCE_NONE;
+        p->zones[z].tail = RFID_PRESENCE_NONE;
+    }
+
+    // 해시 테이블 적재율을 1/2 이하로 유지한다.
+    const uint32_t capacity = (0U != prm->capacity) ? prm->capacity : RFID_PRESENCE_CAPACITY;
+    uint32_t slots = 2U;
+    while (slots < capacity * 2U)
+        slots <<= 1;
+
+    // 항목 배열과 해시 테이블을 페이지 정렬된 한 덩어리(arena)에 두어 스냅샷을 페이지 단위로 복사한다.
+    const size_t entries_bytes = ((size_t) capacity * sizeof(rfid_presence_entry_t) + RFID_PRESENCE_PAGE - 1U)
+                                 / RFID_PRESENCE_PAGE * RFID_PRESENCE_PAGE;
+    const size_t slots_bytes = ((size_t) slots * sizeof(uint32_t) + RFID_PRESENCE_PAGE - 1U)
+                               / RFID_PRESENCE_PAGE * RFID_PRESENCE_PAGE;
+    void *arena = NULL;
+    if (0 != posix_memalign(&arena, RFID_PRESENCE_PAGE, entries_bytes + slots_bytes)) {
+        free(p);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    memset(arena, 0, entries_bytes + slots_bytes);
+    p->arena = (uint8_t *) arena;
+    p->arena_pages = (entries_bytes + slots_bytes) / RFID_PRESENCE_PAGE;
+    p->entries = (rfid_presence_entry_t *) arena;
+    p->slots = (uint32_t *) (void *) (p->arena + entries_bytes);
+    p->mask = slots - 1U;
+    p->free_head = RFID_PRESENCE_NONE;
+    p->unused_head = 0U;
+    p->stat.capacity = capacity;
+    p->snap_fd = -1;
+
+    if ((NULL != prm->snapshot_path) && ('\0' != prm->snapshot_path[0])) {
+        // 용량/항목 형식/zone 구성이 같아야 스냅샷을 그대로 쓸 수 있다.
+        uint64_t h = PresenceHash_(p->ant_zone, (uint32_t) sizeof(p->ant_zone), (uint8_t) p->zone_count);
+        h ^= ((uint64_t) capacity << 32) ^ ((uint64_t) sizeof(rfid_presence_entry_t) << 8) ^ RFID_PRESENCE_SNAP_VERSION;
+        for (int z = 0; z < p->zone_count; ++z)
+            h = (h ^ (uint64_t) (uint32_t) p->zones[z].zone_id) * 0x100000001B3ULL;
+        p->layout_hash = h;
+        p->snap_interval_ms = (0U != prm->snapshot_interval_ms) ? prm->snapshot_interval_ms : RFID_PRESENCE_SNAP_INTERVAL;
+        p->snap_max_age_ms = (0U != prm->snapshot_max_age_ms) ? prm->snapshot_max_age_ms : RFID_PRESENCE_SNAP_MAX_AGE;
+        const RFID_RESULT rc = PresenceSnapOpen_(p, prm->snapshot_path);
+        if (RFID_RESULT_OK != rc) {
+            PresenceFree_(p);
+            return rc;
+        }
+    }
+
+    *out_presence = p;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 엔진을 해제한다.
+ * @param[in,out] inout_presence 해제할 엔진
+ */
+void rfid_presence_destroy(INOUT_ rfid_presence_t **inout_presence) {
+    if ((NULL == inout_presence) || (NULL == *inout_presence))
+        return;
+
+    rfid_presence_t *p = *inout_presence;
+    // 정상 종료 시 마지막 상태를 디스크까지 기록한다.
+    if ((NULL != p->snap_map) && (0U != p->last_now_ms))
+        PresenceSnapWrite_(p, 1);
+    PresenceFree_(p);
+    *inout_presence = NULL;
+}
+
+/**
+ * @brief 슬롯 k 가 유효하면 arena 페이지 체크섬을 다시 계산해 둔다.
+ * @return 1: 체크섬 일치, 0: 불일치(기록 중 종료 등)
+ */
+static int PresenceSnapVerify_(IN_ rfid_presence_t *p, IN_ const int k) {
+    const rfid_presence_snap_header_t *hdr = (const rfid_presence_snap_header_t *) (const void *) p->snap_map;
+    const uint8_t *slot = PresenceSnapSlot_(p, k);
+    uint64_t total = 0;
+    for (size_t pg = 0; pg < p->arena_pages; ++pg) {
+        p->snap_sum[k][pg] = PresencePageSum_(slot + (pg + 1U) * RFID_PRESENCE_PAGE, pg + 1U);
+        total += p->snap_sum[k][pg];
+    }
+    p->snap_total[k] = total;
+    return ((total + PresencePageSum_(slot, 0U)) == hdr->desc[k].checksum) ? 1 : 0;
+}
+
+/**
+ * @brief 스냅샷에서 추적 상태를 복원한다.
+ * @param[in]  presence 엔진
+ * @param[in]  identity 스냅샷 소유자
+ * @param[in]  now_ms 현재 시각
+ * @param[out] out_restored 복원한 (EPC, zone) 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_presence_restore(IN_ rfid_presence_t *presence
+                                  , IN_ const char *identity
+                                  , IN_ const uint64_t now_ms
+                                  , OUT_ uint32_t *out_restored) {
+    if (NULL != out_restored)
+        *out_restored = 0U;
+    if ((NULL == presence) || (NULL == out_restored))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_presence_t *p = presence;
+    if ((0U != p->stat.reads) || (0U != p->stat.tracked))
+        return RFID_RESULT_INVALID_ARG;
+    if (NULL == p->snap_map)
+        return RFID_RESULT_OK;
+
+    const rfid_presence_snap_header_t *hdr = (const rfid_presence_snap_header_t *) (const void *) p->snap_map;
+    const char *id = (NULL != identity) ? identity : "";
+    const int foreign = (('\0' != hdr->identity[0]) && ('\0' != id[0])
+                         && (0 != strncmp(hdr->identity, id, sizeof(hdr->identity)))) ? 1 : 0;
+    memset(p->identity, 0, sizeof(p->identity));
+    strncpy(p->identity, id, sizeof(p->identity) - 1U);
+    if (0 != foreign)
+        return RFID_RESULT_OK;
+
+    // 최신 슬롯부터 본다. 너무 오래됐거나 체크섬이 맞지 않으면 다음 슬롯.
+    const uint64_t wall = PresenceWallMs_();
+    const uint64_t now = (0U != now_ms) ? now_ms : PresenceNowMs_();
+    const int first = (hdr->desc[1].seq > hdr->desc[0].seq) ? 1 : 0;
+    for (int i = 0; i < 2; ++i) {
+        const int k = (0 == i) ? first : (1 - first);
+        const rfid_presence_snap_desc_t d = hdr->desc[k];
+        if ((0U == d.seq) || (0U == d.engine_ms) || (wall < d.wall_ms) || ((wall - d.wall_ms) > p->snap_max_age_ms))
+            continue;
+        if (0 == PresenceSnapVerify_(p, k))
+            continue;
+
+        const uint8_t *slot = PresenceSnapSlot_(p, k);
+        memcpy(p->arena, slot + RFID_PRESENCE_PAGE, p->arena_pages * RFID_PRESENCE_PAGE);
+        rfid_presence_snap_meta_t meta;
+        memcpy(&meta, slot, sizeof(meta));
+        p->free_head = meta.free_head;
+        p->unused_head = meta.unused_head;
+        for (int z = 0; z < p->zone_count; ++z) {
+            p->zones[z].head = meta.head[z];
+            p->zones[z].tail = meta.tail[z];
+        }
+        // 슬롯 k 는 지금 arena 와 같고, 다른 슬롯은 달라진 페이지만 표시한다.
+        // 아래 시각 보정으로 바뀌는 페이지는 두 슬롯 모두 다시 변경으로 표시된다.
+        memset(p->snap_dirty[k], 0, (p->arena_pages + 63U) / 64U * sizeof(uint64_t));
+        PresenceSnapReconcile_(p, 1 - k);
+
+        // 항목 시각을 현재 엔진 시각 기준으로 옮긴다(중단된 동안 흐른 벽시계 시간만큼 과거로).
+        const uint64_t elapsed = wall - d.wall_ms;
+        const uint64_t base = (now > elapsed) ? (now - elapsed) : 1U;
+        for (int z = 0; z < p->zone_count; ++z) {
+            for (uint32_t idx = p->zones[z].head; RFID_PRESENCE_NONE != idx; idx = p->entries[idx].next) {
+                rfid_presence_entry_t *e = &p->entries[idx];
+                const uint64_t first_age = d.engine_ms - e->first_seen_ms;
+                const uint64_t seen_age = d.engine_ms - e->last_seen_ms;
+                const uint64_t event_age = d.engine_ms - e->last_event_ms;
+                e->first_seen_ms = (base > first_age) ? (base - first_age) : 1U;
+                e->last_seen_ms = (base > seen_age) ? (base - seen_age) : 1U;
+                e->last_event_ms = (base > event_age) ? (base - event_age) : 1U;
+                PresenceTouch_(p, e, sizeof(*e));
+            }
+        }
+        p->stat.tracked = meta.tracked;
+        p->stat.restored = meta.tracked;
+        p->last_now_ms = base;
+        *out_restored = meta.tracked;
+        return RFID_RESULT_OK;
+    }
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 스냅샷을 바로 기록한다.
+ * @param[in] presence 엔진
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_presence_snapshot(IN_ rfid_presence_t *presence) {
+    if ((NULL == presence) || (NULL == presence->snap_map))
+        return RFID_RESULT_INVALID_ARG;
+
+    PresenceSnapWrite_(presence, 1);
+    presence->snap_last_ms = presence->last_now_ms;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief read 1건을 반영한다.
+ * @return 1: 이벤트 1개를 만듦, 0: 이벤트 없음
+ */
+static int PresenceObserve_(IN_ rfid_presence_t *p
+                            , IN_ const rfid_tag_t *tag
+                            , IN_ const uint64_t now
+                            , IN_ const int can_emit
+                            , OUT_ rfid_presence_event_t *ev) {
+    const uint32_t readcnt = (0U != tag->readcnt) ? tag->readcnt : 1U;
+    const int ant = ((tag->antenna > 0) && (tag->antenna <= RFID_ANTENNA_MAX)) ? tag->antenna : 0;
+    const uint8_t zone = p->ant_zone[ant];
+    const uint32_t len = (tag->epc_len > RFID_EPC_MAX_BYTES) ? RFID_EPC_MAX_BYTES : tag->epc_len;
+    const int8_t rssi = (int8_t) ((tag->rssi < -127) ? -127 : ((tag->rssi > 127) ? 127 : tag->rssi));
+    const uint64_t hash = PresenceHash_(tag->epc_bytes, len, zone);
+    p->stat.reads += readcnt;
+
+    uint32_t slot = 0;
+    const uint32_t idx = PresenceFind_(p, hash, tag->epc_bytes, len, zone, &slot);
+    if (RFID_PRESENCE_NONE == idx) {
+        if ((RFID_PRESENCE_NONE == p->free_head) && (p->unused_head >= p->stat.capacity)) {
+            p->stat.table_full += readcnt;
+            return 0;
+        }
+        // ARRIVE 를 낼 자리가 없으면 추적을 시작하지 않는다(다음 read 에서 다시 ARRIVE).
+        if (0 == can_emit) {
+            p->stat.deferred++;
+            return 0;
+        }
+
+        const uint32_t n = (RFID_PRESENCE_NONE != p->free_head) ? p->free_head : p->unused_head++;
+        rfid_presence_entry_t *e = &p->entries[n];
+        if (n == p->free_head)
+            p->free_head = e->next;
+        e->hash = hash;
+        e->first_seen_ms = now;
+        e->last_seen_ms = now;
+        e->last_event_ms = now;
+        e->reads = readcnt;
+        e->zone = zone;
+        e->antenna = (uint8_t) ant;
+        e->rssi = rssi;
+        e->epc_len = (uint8_t) len;
+        memcpy(e->epc, tag->epc_bytes, len);
+        p->slots[slot] = n + 1U;
+        PresenceTouch_(p, &p->slots[slot], sizeof(uint32_t));
+        PresenceAppend_(p, n);
+        p->stat.tracked++;
+        p->stat.arrivals++;
+        PresenceEmit_(p, e, RFID_PRESENCE_ARRIVE, now, ev);
+        return 1;
+    }
+
+    rfid_presence_entry_t *e = &p->entries[idx];
+    PresenceTouch_(p, e, sizeof(*e));
+    e->reads += readcnt;
+    e->antenna = (uint8_t) ant;
+    if (rssi > e->rssi)
+        e->rssi = rssi;
+    e->last_seen_ms = now;
+    if (p->zones[zone].tail != idx) {
+        PresenceUnlink_(p, idx);
+        PresenceAppend_(p, idx);
+    }
+
+    if (PresenceElapsed_(now, e->last_event_ms) < p->zones[zone].holdoff_ms)
+        return 0;
+    if (0 == can_emit) {
+        p->stat.deferred++;
+        return 0;
+    }
+    e->last_event_ms = now;
+    p->stat.presents++;
+    PresenceEmit_(p, e, RFID_PRESENCE_PRESENT, now, ev);
+    return 1;
+}
+
+/**
+ * @brief read 결과를 반영하고 이벤트를 만든다.
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_presence_update(IN_ rfid_presence_t *presence
+                                 , IN_ const rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , IN_ const uint64_t now_ms
+                                 , OUT_ rfid_presence_event_t *out_events
+                                 , IN_ const int event_capacity
+                                 , OUT_ int *out_count) {
+    if (NULL != out_count)
+        *out_count = 0;
+    if ((NULL == presence) || (NULL == out_count) || (count < 0) || ((count > 0) && (NULL == tags))
+        || (event_capacity < 0) || ((event_capacity > 0) && (NULL == out_events)))
+        return RFID_RESULT_INVALID_ARG;
+
+    rfid_presence_t *p = presence;
+    const uint64_t now = (0U != now_ms) ? now_ms : PresenceNowMs_();
+    int n = 0;
+
+    for (int i = 0; i < count; ++i) {
+        rfid_presence_event_t *ev = (n < event_capacity) ? &out_events[n] : NULL;
+        n += PresenceObserve_(p, &tags[i], now, (NULL != ev) ? 1 : 0, ev);
+    }
+
+    // zone 목록은 마지막 read 시각 순이므로 앞에서부터 기한이 지난 항목만 보면 된다.
+    for (int z = 0; z < p->zone_count; ++z) {
+        rfid_presence_zone_state_t *zs = &p->zones[z];
+        while (RFID_PRESENCE_NONE != zs->head) {
+            const uint32_t idx = zs->head;
+            rfid_presence_entry_t *e = &p->entries[idx];
+            if (PresenceElapsed_(now, e->last_seen_ms) < zs->depart_ms)
+                break;
+            if (n >= event_capacity) {
+                p->stat.deferred++;
+                break;
+            }
+            PresenceEmit_(p, e, RFID_PRESENCE_DEPART, e->last_seen_ms, &out_events[n++]);
+            PresenceUnlink_(p, idx);
+            PresenceUnindex_(p, idx);
+            PresenceTouch_(p, e, sizeof(*e));
+            e->next = p->free_head;
+            p->free_head = idx;
+            p->stat.tracked--;
+            p->stat.departures++;
+        }
+    }
+
+    p->last_now_ms = now;
+    if (NULL != p->snap_map) {
+        if (0U == p->snap_last_ms)
+            p->snap_last_ms = now;
+        if (PresenceElapsed_(now, p->snap_last_ms) >= p->snap_interval_ms) {
+            PresenceSnapWrite_(p, 0);
+            p->snap_last_ms = now;
+        }
+    }
+
+    *out_count = n;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 엔진 상태를 조회한다.
+ * @param[in]  presence 엔진
+ * @param[out] out_stat 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_presence_get_stats(IN_ const rfid_presence_t *presence, OUT_ rfid_presence_stat_t *out_stat) {
+    if ((NULL == presence) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    *out_stat = presence->stat;
+    return RFID_RESULT_OK;
+}
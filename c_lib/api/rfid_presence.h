@@ -0,0 +1,118 @@
+#ifndef RFID_PRESENCE_H_
+#define RFID_PRESENCE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 태그 존재 감지 엔진. 구현부에서 정의하는 opaque 타입.
+ *
+ * - rfid_read() 결과를 넣으면 (바이너리 EPC, zone) 별로 ARRIVE → PRESENT(holdoff_ms 간격) → DEPART 이벤트만 낸다.
+ * - 안테나를 zone 으로 묶고 zone 마다 holdoff/depart 시간을 따로 둔다.
+ * - 추적 항목은 고정 용량 해시 테이블과 zone 별 최근 read 순 목록으로 관리하므로
+ *   read 1건과 DEPART 판정이 추적 수와 무관하게 O(1)이다.
+ * - snapshot_path 를 주면 추적 상태를 파일에 주기적으로 기록하고(rfid_presence_update 안에서 snapshot_interval_ms 마다),
+ *   재시작 후 rfid_presence_restore()로 다시 올려 가짜 ARRIVE 없이 이어간다.
+ *   파일은 엔진 메모리를 페이지 그대로 담은 두 슬롯(번갈아 기록, 페이지 체크섬)이라 복원은 파싱 없이 크기에 비례한다.
+ *   기록은 지난번 이후 바뀐 페이지만 복사하고 디스크 반영은 커널에 맡긴다(MS_ASYNC).
+ * - 스레드 안전하지 않다. 한 엔진은 한 스레드(보통 read 스레드)에서만 사용한다.
+ */
+typedef struct rfid_presence rfid_presence_t;
+
+/**
+ * @brief 엔진을 만든다.
+ *
+ * @param[in]  params 생성 파라미터(NULL이면 모두 기본값). 호출 중에만 참조한다.
+ * @param[out] out_presence 생성된 엔진
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류(zone 수/안테나 번호 범위 등),
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 또는 스냅샷 파일 열기/매핑 실패
+ */
+RFID_RESULT rfid_presence_create(IN_ const rfid_presence_params_t *params, OUT_ rfid_presence_t **out_presence);
+
+/**
+ * @brief 엔진을 해제한다. 성공 시 *inout_presence 를 NULL로 설정한다.
+ * @note 스냅샷을 쓰는 엔진은 마지막 상태를 기록(MS_SYNC)한 뒤 해제한다.
+ * @param[in,out] inout_presence 해제할 엔진(NULL 허용)
+ */
+void rfid_presence_destroy(INOUT_ rfid_presence_t **inout_presence);
+
+/**
+ * @brief read 결과를 반영하고 이벤트를 만든다.
+ *
+ * - tags 로 ARRIVE/PRESENT 를 판정한 뒤, now_ms 기준으로 depart_ms 가 지난 항목을 DEPART 로 내보낸다.
+ *   read 가 없을 때도 주기적으로(tags=NULL, count=0) 호출해야 DEPART 가 나간다.
+ * - out_events 가 가득 차면 남은 이벤트는 버리지 않고 다음 호출로 미룬다(deferred 로 집계).
+ *
+ * @param[in]  presence 엔진
+ * @param[in]  tags 태그 배열(NULL 허용)
+ * @param[in]  count 태그 개수
+ * @param[in]  now_ms 현재 시각(ms, 단조 증가). 0이면 CLOCK_MONOTONIC 을 사용한다.
+ *                    이전 호출보다 작으면 그 사이 경과 시간을 0으로 본다(holdoff/depart 판정이 늦어질 뿐 앞당겨지지 않는다).
+ * @param[out] out_events 이벤트 버퍼
+ * @param[in]  event_capacity out_events 용량
+ * @param[out] out_count 만든 이벤트 수
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_presence_update(IN_ rfid_presence_t *presence
+                                 , IN_ const rfid_tag_t *tags
+                                 , IN_ const int count
+                                 , IN_ const uint64_t now_ms
+                                 , OUT_ rfid_presence_event_t *out_events
+                                 , IN_ const int event_capacity
+                                 , OUT_ int *out_count);
+
+/**
+ * @brief 스냅샷에서 추적 상태를 복원한다. 첫 rfid_presence_update 전에만 호출할 수 있다.
+ *
+ * - 최신 슬롯부터 나이(snapshot_max_age_ms 이하)와 체크섬을 확인해 맞는 슬롯을 그대로 올린다.
+ * - 항목 시각은 중단된 동안 흐른 벽시계 시간을 반영해 현재 엔진 시각 기준으로 옮긴다.
+ *   그 사이 depart_ms 가 지난 항목은 다음 update 에서 DEPART 로 나간다.
+ * - 스냅샷 소유자(identity)가 둘 다 비어 있지 않고 다르면 복원하지 않는다. identity 는 이후 기록에 사용된다.
+ * - 스냅샷을 쓰지 않는 엔진이거나 맞는 슬롯이 없으면 아무것도 하지 않고 성공한다.
+ *
+ * @param[in]  presence 엔진
+ * @param[in]  identity 스냅샷 소유자(리더 URI 등, NULL 허용)
+ * @param[in]  now_ms 현재 시각(ms). 0이면 CLOCK_MONOTONIC 을 사용한다.
+ * @param[out] out_restored 복원한 (EPC, zone) 수
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 이미 update 한 엔진
+ */
+RFID_RESULT rfid_presence_restore(IN_ rfid_presence_t *presence
+                                  , IN_ const char *identity
+                                  , IN_ const uint64_t now_ms
+                                  , OUT_ uint32_t *out_restored);
+
+/**
+ * @brief 스냅샷을 바로 기록하고 디스크 반영(MS_SYNC)까지 기다린다.
+ *
+ * @param[in] presence 엔진
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 스냅샷을 쓰지 않는 엔진
+ */
+RFID_RESULT rfid_presence_snapshot(IN_ rfid_presence_t *presence);
+
+/**
+ * @brief 엔진 상태를 조회한다.
+ *
+ * @param[in]  presence 엔진
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_presence_get_stats(IN_ const rfid_presence_t *presence, OUT_ rfid_presence_stat_t *out_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_PRESENCE_H_
@@ -0,0 +1,506 @@
+// c_lib/api/rfid_tag_bus.c
+
+#define _GNU_SOURCE  // syscall
+
+#include "rfid_tag_bus.h"
+#include "rfid_tag_log.h"
+
+#include <errno.h>        // errno, ENOENT, EINTR
+#include <fcntl.h>        // O_* 상수
+#include <limits.h>       // INT_MAX
+#include <linux/futex.h>  // FUTEX_WAIT, FUTEX_WAKE
+#include <pthread.h>      // pthread_mutex_*
+#include <stdio.h>        // snprintf
+#include <stdlib.h>       // calloc, free
+#include <string.h>       // memcpy, memcmp, memset
+#include <sys/mman.h>     // shm_open, shm_unlink, mmap, munmap
+#include <sys/stat.h>     // fstat
+#include <sys/syscall.h>  // SYS_futex
+#include <time.h>         // clock_gettime
+#include <unistd.h>       // close, ftruncate, getpid, syscall
+
+// 내부 상수
+#define RFID_TAG_BUS_MAGIC          "RFIDBUS1"
+#define RFID_TAG_BUS_VERSION        (1U)
+#define RFID_TAG_BUS_HEADER_SIZE    (256U)        // 헤더 영역(캐시 라인 단위로 필드 분리)
+#define RFID_TAG_BUS_CAPACITY       (65536U)      // 링 용량 기본값(레코드 수, 4 MiB)
+#define RFID_TAG_BUS_CAPACITY_MAX   (1U << 24)
+#define RFID_TAG_BUS_NAME_MAX       (64)
+
+/**
+ * @brief 공유 메모리 헤더(발행자/구독자 공통 배치)
+ *
+ * head, futex/waiters 는 서로 다른 캐시 라인에 두어 발행자 쓰기와 구독자 대기 등록이 부딪히지 않게 한다.
+ *
+ * @param capacity  링 용량(2의 거듭제곱)
+ * @param closed    1이면 발행자가 버스를 닫음
+ * @param head      마지막으로 발행한 레코드 seq(0이면 없음). seq 의 슬롯은 seq & (capacity - 1).
+ * @param futex     발행마다 증가하는 futex 대기 값
+ * @param waiters   futex 에서 대기 중인 구독자 수(0이면 발행자가 wake 시스템 호출을 생략)
+ */
+typedef struct rfid_tag_bus_shm {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t capacity;
+    uint32_t closed;
+    uint64_t publisher_pid;
+    uint8_t pad0[32];
+    uint64_t head;
+    uint8_t pad1[56];
+    uint32_t futex;
+    uint32_t waiters;
+    uint8_t pad2[56];
+} rfid_tag_bus_shm_t;
+
+/**
+ * @brief 발행자
+ */
+struct rfid_tag_bus {
+    char name[RFID_TAG_BUS_NAME_MAX];
+    rfid_tag_bus_shm_t *shm;
+    rfid_tag_log_record_t *slots;
+    size_t len;
+    uint64_t mask;
+    pthread_mutex_t lock;
+};
+
+/**
+ * @brief 구독자
+ *
+ * @param next       다음에 읽을 seq
+ * @param peek_first 마지막 peek 구간의 첫 seq
+ * @param peek_count 마지막 peek 구간의 레코드 수
+ */
+struct rfid_tag_bus_sub {
+    rfid_tag_bus_shm_t *shm;
+    rfid_tag_log_record_t *slots;
+    size_t len;
+    uint64_t mask;
+    uint64_t next;
+    uint64_t peek_first;
+    int peek_count;
+};
+
+/**
+ * @brief 공유 메모리 이름을 "/name" 형태로 만든다.
+ * @return 성공 0, 잘못된 이름 -1
+ */
+static int TagBusName_(IN_ const char *name, OUT_ char *out, IN_ const size_t size) {
+    if ((NULL == name) || ('\0' == name[0]))
+        return -1;
+    const char *base = ('/' == name[0]) ? name + 1 : name;
+    if (('\0' == base[0]) || (NULL != strchr(base, '/')))
+        return -1;
+    const int n = snprintf(out, size, "/%s", base);
+    return ((n < 0) || ((size_t) n >= size)) ? -1 : 0;
+}
+
+/**
+ * @brief 링 전체 매핑 크기
+ */
+static size_t TagBusLen_(IN_ const uint32_t capacity) {
+    return (size_t) RFID_TAG_BUS_HEADER_SIZE + (size_t) capacity * sizeof(rfid_tag_log_record_t);
+}
+
+/**
+ * @brief 헤더가 이 버전의 태그 버스인지 확인한다.
+ */
+static int TagBusValid_(IN_ const rfid_tag_bus_shm_t *shm, IN_ const size_t len) {
+    if ((len < RFID_TAG_BUS_HEADER_SIZE)
+        || (0 != memcmp(shm->magic, RFID_TAG_BUS_MAGIC, sizeof(shm->magic)))
+        || (RFID_TAG_BUS_VERSION != shm->version)
+        || (sizeof(rfid_tag_log_record_t) != shm->record_size)
+        || (0U == shm->capacity)
+        || (0U != (shm->capacity & (shm->capacity - 1U))))
+        return 0;
+    return (TagBusLen_(shm->capacity) <= len) ? 1 : 0;
+}
+
+/**
+ * @brief 대기 중인 구독자를 깨운다(대기자가 없으면 시스템 호출 생략).
+ */
+static void TagBusWake_(IN_ rfid_tag_bus_shm_t *shm) {
+    __atomic_add_fetch(&shm->futex, 1U, __ATOMIC_SEQ_CST);
+    if (0U != __atomic_load_n(&shm->waiters, __ATOMIC_SEQ_CST))
+        (void) syscall(SYS_futex, &shm->futex, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * @brief 태그 버스를 만든다.
+ * @param[in]  name 공유 메모리 이름
+ * @param[in]  capacity 링 용량
+ * @param[out] out_bus 생성된 버스
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_bus_create(IN_ const char *name, IN_ const uint32_t capacity, OUT_ rfid_tag_bus_t **out_bus) {
+    if (NULL == out_bus)
+        return RFID_RESULT_INVALID_ARG;
+    *out_bus = NULL;
+
+    char shm_name[RFID_TAG_BUS_NAME_MAX];
+    if ((0 != TagBusName_(name, shm_name, sizeof(shm_name))) || (capacity > RFID_TAG_BUS_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+
+    uint32_t cap = 1U;
+    while (cap < ((0U != capacity) ? capacity : RFID_TAG_BUS_CAPACITY))
+        cap <<= 1;
+    const size_t len = TagBusLen_(cap);
+
+    int fd = shm_open(shm_name, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    // 같은 용량의 기존 버스(발행자 재시작)는 이어 쓰고, 형식이 다르면 이름을 새 객체로 바꾼다.
+    // 기존 매핑을 가진 구독자가 크기 변경으로 SIGBUS 를 받지 않도록 기존 객체는 자르지 않는다.
+    struct stat st;
+    int reuse = 0;
+    if ((0 == fstat(fd, &st)) && ((size_t) st.st_size == len)) {
+        void *probe = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (MAP_FAILED != probe) {
+            const rfid_tag_bus_shm_t *old = (const rfid_tag_bus_shm_t *) probe;
+            reuse = ((0 != TagBusValid_(old, len)) && (cap == old->capacity)) ? 1 : 0;
+            (void) munmap(probe, len);
+        }
+    }
+    if ((0 == reuse) && (0 == fstat(fd, &st)) && (0 != st.st_size)) {
+        (void) close(fd);
+        (void) shm_unlink(shm_name);
+        fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd < 0)
+            return RFID_RESULT_INTERNAL_ERROR;
+    }
+    if ((0 == reuse) && (0 != ftruncate(fd, (off_t) len))) {
+        (void) close(fd);
+        (void) shm_unlink(shm_name);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    void *map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void) close(fd);
+    if (MAP_FAILED == map) {
+        if (0 == reuse)
+            (void) shm_unlink(shm_name);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    rfid_tag_bus_t *bus = (rfid_tag_bus_t *) calloc(1, sizeof(*bus));
+    if ((NULL == bus) || (0 != pthread_mutex_init(&bus->lock, NULL))) {
+        free(bus);
+        (void) munmap(map, len);
+        if (0 == reuse)
+            (void) shm_unlink(shm_name);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    rfid_tag_bus_shm_t *shm = (rfid_tag_bus_shm_t *) map;
+    if (0 == reuse) {
+        // 새 객체는 0으로 채워져 있다(슬롯 seq 0 = 미기록). magic 은 마지막에 써서 구독자가 반쯤 만든 헤더를 보지 않게 한다.
+        shm->version = RFID_TAG_BUS_VERSION;
+        shm->record_size = (uint32_t) sizeof(rfid_tag_log_record_t);
+        shm->capacity = cap;
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        memcpy(shm->magic, RFID_TAG_BUS_MAGIC, sizeof(shm->magic));
+    }
+    shm->publisher_pid = (uint64_t) getpid();
+    __atomic_store_n(&shm->closed, 0U, __ATOMIC_RELEASE);
+
+    memcpy(bus->name, shm_name, sizeof(shm_name));
+    bus->shm = shm;
+    bus->slots = (rfid_tag_log_record_t *) ((uint8_t *) map + RFID_TAG_BUS_HEADER_SIZE);
+    bus->len = len;
+    bus->mask = (uint64_t) cap - 1U;
+    *out_bus = bus;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 버스를 닫는다.
+ * @param[in,out] inout_bus 닫을 버스
+ */
+void rfid_tag_bus_destroy(INOUT_ rfid_tag_bus_t **inout_bus) {
+    if ((NULL == inout_bus) || (NULL == *inout_bus))
+        return;
+
+    rfid_tag_bus_t *bus = *inout_bus;
+    __atomic_store_n(&bus->shm->closed, 1U, __ATOMIC_RELEASE);
+    TagBusWake_(bus->shm);
+    (void) munmap(bus->shm, bus->len);
+    (void) shm_unlink(bus->name);
+    pthread_mutex_destroy(&bus->lock);
+    free(bus);
+    *inout_bus = NULL;
+}
+
+/**
+ * @brief 태그를 발행한다.
+ *
+ * 슬롯마다 seqlock 순서로 쓴다: seq 를 0으로 내리고 → 내용 기록 → seq 를 새 값으로 공개.
+ * 구독자는 읽기 전후 seq 를 비교해 읽는 도중 덮어쓰인 레코드를 걸러낸다.
+ *
+ * @param[in] bus 태그 버스
+ * @param[in] reader_id 리더 id
+ * @param[in] tags 태그 배열
+ * @param[in] count 태그 개수
+ * @return 발행한 태그 수
+ */
+int rfid_tag_bus_publish(IN_ rfid_tag_bus_t *bus, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tags, IN_ const int count) {
+    if ((NULL == bus) || (NULL == tags) || (count <= 0))
+        return 0;
+
+    pthread_mutex_lock(&bus->lock);
+    const uint64_t head = __atomic_load_n(&bus->shm->head, __ATOMIC_RELAXED);
+    for (int i = 0; i < count; ++i) {
+        const uint64_t seq = head + 1U + (uint64_t) i;
+        rfid_tag_log_record_t *slot = &bus->slots[seq & bus->mask];
+        __atomic_store_n(&slot->seq, 0U, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        rfid_tag_log_record_fill(slot, reader_id, &tags[i]);
+        __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&bus->shm->head, head + (uint64_t) count, __ATOMIC_RELEASE);
+    TagBusWake_(bus->shm);
+    pthread_mutex_unlock(&bus->lock);
+    return count;
+}
+
+/**
+ * @brief 태그 버스를 구독한다.
+ * @param[in]  name 공유 메모리 이름
+ * @param[in]  from_oldest 1이면 가장 오래된 레코드부터
+ * @param[out] out_sub 생성된 구독자
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_bus_subscribe(IN_ const char *name, IN_ const int from_oldest, OUT_ rfid_tag_bus_sub_t **out_sub) {
+    if (NULL == out_sub)
+        return RFID_RESULT_INVALID_ARG;
+    *out_sub = NULL;
+
+    char shm_name[RFID_TAG_BUS_NAME_MAX];
+    if (0 != TagBusName_(name, shm_name, sizeof(shm_name)))
+        return RFID_RESULT_INVALID_ARG;
+
+    // futex 대기 등록(waiters)을 위해 쓰기 권한으로 매핑한다.
+    const int fd = shm_open(shm_name, O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0)
+        return (ENOENT == errno) ? RFID_RESULT_NOT_INITIALIZED : RFID_RESULT_INTERNAL_ERROR;
+
+    struct stat st;
+    if ((0 != fstat(fd, &st)) || ((size_t) st.st_size < RFID_TAG_BUS_HEADER_SIZE)) {
+        (void) close(fd);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+    const size_t len = (size_t) st.st_size;
+    void *map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void) close(fd);
+    if (MAP_FAILED == map)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    rfid_tag_bus_shm_t *shm = (rfid_tag_bus_shm_t *) map;
+    if (0 == TagBusValid_(shm, len)) {
+        (void) munmap(map, len);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    rfid_tag_bus_sub_t *sub = (rfid_tag_bus_sub_t *) calloc(1, sizeof(*sub));
+    if (NULL == sub) {
+        (void) munmap(map, len);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    const uint64_t head = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+    const uint64_t cap = shm->capacity;
+    sub->shm = shm;
+    sub->slots = (rfid_tag_log_record_t *) ((uint8_t *) map + RFID_TAG_BUS_HEADER_SIZE);
+    sub->len = len;
+    sub->mask = cap - 1U;
+    sub->next = (0 == from_oldest) ? (head + 1U) : ((head > cap) ? (head - cap + 1U) : 1U);
+    *out_sub = sub;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 구독을 해제한다.
+ * @param[in,out] inout_sub 해제할 구독자
+ */
+void rfid_tag_bus_unsubscribe(INOUT_ rfid_tag_bus_sub_t **inout_sub) {
+    if ((NULL == inout_sub) || (NULL == *inout_sub))
+        return;
+
+    rfid_tag_bus_sub_t *sub = *inout_sub;
+    (void) munmap(sub->shm, sub->len);
+    free(sub);
+    *inout_sub = NULL;
+}
+
+/**
+ * @brief 새 레코드가 생길 때까지 기다린다.
+ *
+ * @param[in] sub 구독자
+ * @param[in] timeout_ms 최대 대기 시간(ms, 음수: 무기한)
+ * @param[out] out_head 현재 head
+ *
+ * @return RFID_RESULT_OK: 새 레코드 있음 또는 timeout(*out_head < next),
+ *         RFID_RESULT_NOT_INITIALIZED: 버스가 닫혔고 새 레코드 없음
+ */
+static RFID_RESULT TagBusWait_(IN_ rfid_tag_bus_sub_t *sub, IN_ const int timeout_ms, OUT_ uint64_t *out_head) {
+    rfid_tag_bus_shm_t *shm = sub->shm;
+    struct timespec t0;
+    (void) clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    for (;;) {
+        // futex 값을 먼저 읽고 head 를 확인해야, 그 사이 발행된 레코드가 있으면 FUTEX_WAIT 가 바로 돌아온다.
+        const uint32_t v = __atomic_load_n(&shm->futex, __ATOMIC_SEQ_CST);
+        *out_head = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+        if (*out_head >= sub->next)
+            return RFID_RESULT_OK;
+        if (0U != __atomic_load_n(&shm->closed, __ATOMIC_ACQUIRE))
+            return RFID_RESULT_NOT_INITIALIZED;
+        if (0 == timeout_ms)
+            return RFID_RESULT_OK;
+
+        struct timespec rel;
+        struct timespec *prel = NULL;
+        if (timeout_ms > 0) {
+            struct timespec now;
+            (void) clock_gettime(CLOCK_MONOTONIC, &now);
+            const int64_t elapsed_ns = ((int64_t) (now.tv_sec - t0.tv_sec) * 1000000000LL) + (int64_t) (now.tv_nsec - t0.tv_nsec);
+            const int64_t left_ns = (int64_t) timeout_ms * 1000000LL - elapsed_ns;
+            if (left_ns <= 0)
+                return RFID_RESULT_OK;
+            rel.tv_sec = (time_t) (left_ns / 1000000000LL);
+            rel.tv_nsec = (long) (left_ns % 1000000000LL);
+            prel = &rel;
+        }
+
+        __atomic_add_fetch(&shm->waiters, 1U, __ATOMIC_SEQ_CST);
+        (void) syscall(SYS_futex, &shm->futex, FUTEX_WAIT, v, prel, NULL, 0);
+        __atomic_sub_fetch(&shm->waiters, 1U, __ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * @brief 발행자가 링을 한 바퀴 넘게 앞서 갔으면 읽기 위치를 가장 오래된 유효 레코드로 옮긴다.
+ * @return 건너뛴(잃은) 레코드 수
+ */
+static uint64_t TagBusSkipOverrun_(IN_ rfid_tag_bus_sub_t *sub, IN_ const uint64_t head) {
+    const uint64_t cap = sub->mask + 1U;
+    const uint64_t oldest = (head > cap) ? (head - cap + 1U) : 1U;
+    if (sub->next >= oldest)
+        return 0;
+    const uint64_t lost = oldest - sub->next;
+    sub->next = oldest;
+    return lost;
+}
+
+/**
+ * @brief 새 레코드를 복사해 가져온다.
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_bus_read(IN_ rfid_tag_bus_sub_t *sub
+                              , OUT_ rfid_tag_log_record_t *out_records
+                              , IN_ const int capacity
+                              , IN_ const int timeout_ms
+                              , OUT_ int *out_count
+                              , OUT_ uint64_t *out_lost) {
+    if (NULL != out_lost)
+        *out_lost = 0;
+    if ((NULL == sub) || (NULL == out_records) || (capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+    *out_count = 0;
+
+    uint64_t head = 0;
+    const RFID_RESULT rc = TagBusWait_(sub, timeout_ms, &head);
+    if ((RFID_RESULT_OK != rc) || (head < sub->next))
+        return rc;
+
+    uint64_t lost = TagBusSkipOverrun_(sub, head);
+    int n = 0;
+    while ((n < capacity) && (sub->next <= head)) {
+        const rfid_tag_log_record_t *slot = &sub->slots[sub->next & sub->mask];
+        const uint64_t s1 = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if (s1 == sub->next) {
+            memcpy(&out_records[n], slot, sizeof(*slot));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == s1) {
+                n++;
+                sub->next++;
+                continue;
+            }
+        }
+        // 읽는 도중 덮어쓰였다: 최신 head 기준으로 다시 맞춘다.
+        head = __atomic_load_n(&sub->shm->head, __ATOMIC_ACQUIRE);
+        const uint64_t skipped = TagBusSkipOverrun_(sub, head + 1U);
+        lost += (0U != skipped) ? skipped : 1U;
+        if (0U == skipped)
+            sub->next++;
+    }
+
+    *out_count = n;
+    if (NULL != out_lost)
+        *out_lost = lost;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 새 레코드를 공유 메모리에서 직접 참조한다.
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_bus_peek(IN_ rfid_tag_bus_sub_t *sub
+                              , IN_ const int timeout_ms
+                              , OUT_ const rfid_tag_log_record_t **out_records
+                              , OUT_ int *out_count
+                              , OUT_ uint64_t *out_lost) {
+    if (NULL != out_lost)
+        *out_lost = 0;
+    if ((NULL == sub) || (NULL == out_records) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+    *out_records = NULL;
+    *out_count = 0;
+    sub->peek_count = 0;
+
+    uint64_t head = 0;
+    const RFID_RESULT rc = TagBusWait_(sub, timeout_ms, &head);
+    if ((RFID_RESULT_OK != rc) || (head < sub->next))
+        return rc;
+
+    const uint64_t lost = TagBusSkipOverrun_(sub, head);
+    const uint64_t start = sub->next & sub->mask;
+    uint64_t n = head - sub->next + 1U;
+    if (n > (sub->mask + 1U - start))
+        n = sub->mask + 1U - start;
+    if (n > (uint64_t) INT_MAX)
+        n = (uint64_t) INT_MAX;
+
+    sub->peek_first = sub->next;
+    sub->peek_count = (int) n;
+    *out_records = &sub->slots[start];
+    *out_count = (int) n;
+    if (NULL != out_lost)
+        *out_lost = lost;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief peek 한 레코드를 소비한다.
+ *
+ * 발행자는 seq 순서로 슬롯을 덮어쓰며 덮어쓰기 전에 seq 를 0으로 내리므로,
+ * 구간의 첫 슬롯 seq 가 그대로이면 구간 전체가 처리 동안 온전했다.
+ *
+ * @param[in] sub 구독자
+ * @param[in] count 소비한 레코드 수
+ * @return 1: 온전함, 0: 처리 중 덮어쓰였음
+ */
+int rfid_tag_bus_release(IN_ rfid_tag_bus_sub_t *sub, IN_ const int count) {
+    if ((NULL == sub) || (count <= 0) || (0 == sub->peek_count))
+        return 1;
+
+    const int n = (count > sub->peek_count) ? sub->peek_count : count;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    const rfid_tag_log_record_t *first = &sub->slots[sub->peek_first & sub->mask];
+    const int intact = (__atomic_load_n(&first->seq, __ATOMIC_RELAXED) == sub->peek_first) ? 1 : 0;
+
+    sub->next = sub->peek_first + (uint64_t) n;
+    sub->peek_count = 0;
+    return intact;
+}
@@ -0,0 +1,132 @@
+#ifndef RFID_TAG_BUS_H_
+#define RFID_TAG_BUS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 공유 메모리 태그 버스 발행자. 구현부에서 정의하는 opaque 타입.
+ *
+ * - POSIX 공유 메모리(/dev/shm/<name>)에 태그 레코드(rfid_tag_log_record_t) 링을 만들고 발행한다.
+ * - 구독자는 각자 자기 위치(seq)만 들고 같은 링을 직접 읽는다. 중개 프로세스나 구독자별 복사본이 없고,
+ *   발행자는 구독자를 기다리지 않는다(느린 구독자는 overrun 으로 잃은 레코드 수를 보고받는다).
+ * - 새 레코드는 futex(프로세스 공유)로 대기 중인 구독자에게 알린다. 대기자가 없으면 시스템 호출을 하지 않는다.
+ * - 발행자가 비정상 종료 후 같은 이름/용량으로 다시 만들면 링과 seq 를 이어 받아 구독자가 그대로 동작한다.
+ */
+typedef struct rfid_tag_bus rfid_tag_bus_t;
+
+/**
+ * @brief 공유 메모리 태그 버스 구독자. 구현부에서 정의하는 opaque 타입.
+ */
+typedef struct rfid_tag_bus_sub rfid_tag_bus_sub_t;
+
+/**
+ * @brief 태그 버스를 만든다(발행자).
+ *
+ * @param[in]  name 공유 메모리 이름("/" 없이도 가능, 예: "rfid_tags")
+ * @param[in]  capacity 링 용량(레코드 수, 2의 거듭제곱으로 올림, 0이면 65536)
+ * @param[out] out_bus 생성된 버스
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_INTERNAL_ERROR: 공유 메모리 생성/매핑 실패
+ */
+RFID_RESULT rfid_tag_bus_create(IN_ const char *name, IN_ const uint32_t capacity, OUT_ rfid_tag_bus_t **out_bus);
+
+/**
+ * @brief 버스를 닫고 공유 메모리 이름을 지운다. 구독자에게는 닫힘(RFID_RESULT_NOT_INITIALIZED)으로 알린다.
+ * @param[in,out] inout_bus 닫을 버스(NULL 허용). 성공 시 NULL로 설정한다.
+ */
+void rfid_tag_bus_destroy(INOUT_ rfid_tag_bus_t **inout_bus);
+
+/**
+ * @brief 태그를 발행한다(막히지 않음). 같은 프로세스의 여러 스레드에서 호출해도 안전하다.
+ *
+ * @param[in] bus 태그 버스
+ * @param[in] reader_id 레코드에 기록할 리더 id
+ * @param[in] tags 태그 배열
+ * @param[in] count 태그 개수
+ *
+ * @return 발행한 태그 수(인자 오류 시 0)
+ */
+int rfid_tag_bus_publish(IN_ rfid_tag_bus_t *bus, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tags, IN_ const int count);
+
+/**
+ * @brief 태그 버스를 구독한다.
+ *
+ * @param[in]  name 공유 메모리 이름(rfid_tag_bus_create 와 같은 값)
+ * @param[in]  from_oldest 1이면 링에 남아 있는 가장 오래된 레코드부터, 0이면 이후 발행분부터 읽는다.
+ * @param[out] out_sub 생성된 구독자
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 버스 형식 아님,
+ *         RFID_RESULT_NOT_INITIALIZED: 발행자가 아직 버스를 만들지 않음,
+ *         RFID_RESULT_INTERNAL_ERROR: 매핑/할당 실패
+ */
+RFID_RESULT rfid_tag_bus_subscribe(IN_ const char *name, IN_ const int from_oldest, OUT_ rfid_tag_bus_sub_t **out_sub);
+
+/**
+ * @brief 구독을 해제한다.
+ * @param[in,out] inout_sub 해제할 구독자(NULL 허용). 성공 시 NULL로 설정한다.
+ */
+void rfid_tag_bus_unsubscribe(INOUT_ rfid_tag_bus_sub_t **inout_sub);
+
+/**
+ * @brief 새 레코드를 복사해 가져온다. 없으면 timeout_ms 까지 futex 로 기다린다.
+ *
+ * @param[in]  sub 구독자
+ * @param[out] out_records 레코드 버퍼
+ * @param[in]  capacity out_records 용량(> 0)
+ * @param[in]  timeout_ms 최대 대기 시간(ms). 0이면 기다리지 않고, 음수이면 무기한 기다린다.
+ * @param[out] out_count 가져온 레코드 수(timeout 이면 0)
+ * @param[out] out_lost 이번 호출에서 확인한 overrun 손실 레코드 수(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공(timeout 포함),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 발행자가 버스를 닫았고 남은 레코드가 없음
+ */
+RFID_RESULT rfid_tag_bus_read(IN_ rfid_tag_bus_sub_t *sub
+                              , OUT_ rfid_tag_log_record_t *out_records
+                              , IN_ const int capacity
+                              , IN_ const int timeout_ms
+                              , OUT_ int *out_count
+                              , OUT_ uint64_t *out_lost);
+
+/**
+ * @brief 새 레코드를 복사 없이 공유 메모리에서 직접 참조한다(링 끝에서 끊긴 연속 구간).
+ *
+ * - 처리 후 rfid_tag_bus_release()로 넘긴다. 그 사이 발행자가 링을 한 바퀴 돌아 덮어썼는지는 release 가 알려준다.
+ * - 대기/닫힘 동작은 rfid_tag_bus_read()와 같다.
+ *
+ * @param[in]  sub 구독자
+ * @param[in]  timeout_ms 최대 대기 시간(ms). 0이면 기다리지 않고, 음수이면 무기한 기다린다.
+ * @param[out] out_records 레코드 시작 주소(없으면 NULL)
+ * @param[out] out_count 레코드 수
+ * @param[out] out_lost overrun 손실 레코드 수(NULL 허용)
+ *
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_bus_peek(IN_ rfid_tag_bus_sub_t *sub
+                              , IN_ const int timeout_ms
+                              , OUT_ const rfid_tag_log_record_t **out_records
+                              , OUT_ int *out_count
+                              , OUT_ uint64_t *out_lost);
+
+/**
+ * @brief rfid_tag_bus_peek()로 참조한 레코드 중 앞쪽 count 개를 소비한다.
+ *
+ * @param[in] sub 구독자
+ * @param[in] count 소비한 레코드 수(peek 의 out_count 이하)
+ *
+ * @return 1: 참조하는 동안 덮어쓰이지 않음, 0: 처리 중 덮어쓰였음(해당 레코드 내용은 믿을 수 없음)
+ */
+int rfid_tag_bus_release(IN_ rfid_tag_bus_sub_t *sub, IN_ const int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_TAG_BUS_H_
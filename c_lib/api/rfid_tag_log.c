@@ -0,0 +1,760 @@
+// c_lib/api/rfid_tag_log.c
+
+#define _GNU_SOURCE  // fallocate
+
+#include "rfid_tag_log.h"
+
+#include <dirent.h>     // opendir, readdir
+#include <errno.h>      // errno, EEXIST
+#include <fcntl.h>      // open, fallocate
+#include <limits.h>     // PATH_MAX
+#include <pthread.h>    // pthread_*
+#include <stdio.h>      // snprintf
+#include <stdlib.h>     // calloc, free, strtoull
+#include <string.h>     // memcpy, memcmp, memset, strchr, strcmp, strlen, strncmp
+#include <sys/mman.h>   // mmap, msync, munmap
+#include <sys/stat.h>   // mkdir, fstat
+#include <time.h>       // clock_gettime
+#include <unistd.h>     // close, ftruncate, unlink
+
+// 내부 상수
+#define RFID_TAG_LOG_HEADER_SIZE        (4096U)       // 레코드가 페이지 경계에서 시작하도록 헤더 영역을 한 페이지로 둔다
+#define RFID_TAG_LOG_SEGMENT_DEFAULT    (262144U)     // 세그먼트당 레코드 수 기본값(16 MiB)
+#define RFID_TAG_LOG_QUEUE_DEFAULT      (131072U)     // 큐 용량 기본값(100k tags/s 에서 약 1.3초 분량)
+#define RFID_TAG_LOG_QUEUE_MAX          (1U << 24)    // 큐 용량 상한(1 GiB)
+#define RFID_TAG_LOG_SYNC_DEFAULT_MS    (500U)        // msync 주기 기본값
+#define RFID_TAG_LOG_IDLE_MS            (2)           // 큐가 비었을 때 writer 대기 시간
+#define RFID_TAG_LOG_PREFIX_MAX         (64)
+#define RFID_TAG_LOG_SUFFIX             ".rtl"
+
+/**
+ * @brief 쓰기용으로 매핑한 세그먼트
+ *
+ * @param fd     파일 디스크립터(-1: 없음)
+ * @param map    매핑 시작 주소(헤더 포함)
+ * @param len    매핑 길이(bytes)
+ * @param index  세그먼트 번호
+ * @param used   기록한 레코드 수
+ * @param synced msync 를 마친 레코드 수
+ */
+typedef struct rfid_tag_log_file {
+    int fd;
+    uint8_t *map;
+    size_t len;
+    uint64_t index;
+    uint32_t used;
+    uint32_t synced;
+} rfid_tag_log_file_t;
+
+/**
+ * @brief 태그 로그
+ *
+ * 큐는 단일 소비자(writer 스레드) 링 버퍼다. 생산자끼리는 push_lock 으로 직렬화하고(레코드 복사 구간만),
+ * 생산자와 writer 는 head/tail 원자 변수로만 동기화하므로 writer 가 msync 로 막혀 있어도 append 는 기다리지 않는다.
+ *
+ * @param queue       레코드 큐(qmask + 1 개)
+ * @param head        생산자 위치(push_lock 아래에서 증가, release 로 공개)
+ * @param tail        writer 위치(writer 만 증가, release 로 공개)
+ * @param done        msync 까지 마친 큐 위치(lock 보호)
+ * @param flush_req   flush 요청 큐 위치(lock 보호)
+ * @param cur         현재 기록 중인 세그먼트(writer 전용)
+ * @param spare       미리 만들어 둔 다음 세그먼트(writer 전용)
+ * @param oldest      보관 중인 가장 오래된 세그먼트 번호(writer 전용)
+ * @param next_index  다음에 만들 세그먼트 번호(writer 전용)
+ * @param next_seq    다음 레코드 seq(writer 전용)
+ */
+struct rfid_tag_log {
+    char dir[PATH_MAX];
+    char prefix[RFID_TAG_LOG_PREFIX_MAX];
+    uint32_t seg_records;
+    uint32_t sync_ms;
+    uint32_t max_segments;
+
+    rfid_tag_log_record_t *queue;
+    uint32_t qmask;
+    uint64_t head;
+    uint64_t tail;
+    pthread_mutex_t push_lock;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int stop;
+    uint64_t done;
+    uint64_t flush_req;
+
+    rfid_tag_log_file_t cur;
+    rfid_tag_log_file_t spare;
+    uint64_t oldest;
+    uint64_t next_index;
+    uint64_t next_seq;
+
+    uint64_t appended;
+    uint64_t dropped;
+    uint64_t written;
+    uint64_t synced;
+    uint64_t lost;
+    uint64_t cur_index;
+    uint32_t segments_opened;
+    uint32_t queue_peak;
+    uint32_t sync_count;
+    uint32_t sync_max_us;
+    int last_errno;
+};
+
+/**
+ * @brief 읽기 전용 세그먼트 매핑
+ */
+struct rfid_tag_log_segment {
+    const uint8_t *map;
+    size_t len;
+    uint64_t count;
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(us)
+ */
+static uint64_t TagLogNowUs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000ULL) + ((uint64_t) ts.tv_nsec / 1000ULL);
+}
+
+/**
+ * @brief 벽시계 기준 현재 시각(epoch ms)
+ */
+static uint64_t TagLogWallMs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_REALTIME, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL);
+}
+
+/**
+ * @brief 세그먼트 파일 경로를 만든다.
+ * @return 성공 0, 경로가 너무 길면 -1
+ */
+static int TagLogPath_(IN_ const rfid_tag_log_t *log, IN_ const uint64_t index, OUT_ char *out_path, IN_ const size_t size) {
+    const int n = snprintf(out_path, size, "%s/%s-%010llu" RFID_TAG_LOG_SUFFIX, log->dir, log->prefix, (unsigned long long) index);
+    return ((n < 0) || ((size_t) n >= size)) ? -1 : 0;
+}
+
+/**
+ * @brief 파일 이름이 이 로그의 세그먼트이면 번호를 꺼낸다.
+ * @return 세그먼트이면 1
+ */
+static int TagLogParseName_(IN_ const rfid_tag_log_t *log, IN_ const char *name, OUT_ uint64_t *out_index) {
+    const size_t plen = strlen(log->prefix);
+    if ((0 != strncmp(name, log->prefix, plen)) || ('-' != name[plen]))
+        return 0;
+
+    const char *digits = name + plen + 1;
+    char *end = NULL;
+    errno = 0;
+    const unsigned long long v = strtoull(digits, &end, 10);
+    if ((0 != errno) || (end != digits + 10) || (0 != strcmp(end, RFID_TAG_LOG_SUFFIX)))
+        return 0;
+
+    *out_index = (uint64_t) v;
+    return 1;
+}
+
+/**
+ * @brief 쓰기 세그먼트를 닫는다(truncate_used 이면 기록한 크기로 잘라낸다).
+ */
+static void TagLogFileClose_(IN_ rfid_tag_log_file_t *f, IN_ const int truncate_used) {
+    if (NULL != f->map)
+        (void) munmap(f->map, f->len);
+    if (f->fd >= 0) {
+        if (0 != truncate_used)
+            (void) ftruncate(f->fd, (off_t) RFID_TAG_LOG_HEADER_SIZE + (off_t) f->used * (off_t) sizeof(rfid_tag_log_record_t));
+        (void) close(f->fd);
+    }
+    memset(f, 0, sizeof(*f));
+    f->fd = -1;
+}
+
+/**
+ * @brief 다음 번호의 세그먼트 파일을 만들어 미리 할당하고 매핑한다.
+ *
+ * fallocate()로 블록을 먼저 잡아 두어 기록 중 파일 확장(메타데이터 갱신)이 일어나지 않게 한다.
+ * fallocate 를 지원하지 않는 파일시스템(vfat 등)에서는 ftruncate 로 크기만 잡는다
+ * (posix_fallocate 처럼 0을 직접 써서 writer 를 오래 막지 않기 위함).
+ *
+ * @return 성공 0, 실패 -1(last_errno 기록)
+ */
+static int TagLogFileCreate_(IN_ rfid_tag_log_t *log, OUT_ rfid_tag_log_file_t *f) {
+    memset(f, 0, sizeof(*f));
+    f->fd = -1;
+
+    char path[PATH_MAX];
+    if (0 != TagLogPath_(log, log->next_index, path, sizeof(path))) {
+        __atomic_store_n(&log->last_errno, ENAMETOOLONG, __ATOMIC_RELAXED);
+        return -1;
+    }
+
+    const size_t len = (size_t) RFID_TAG_LOG_HEADER_SIZE + (size_t) log->seg_records * sizeof(rfid_tag_log_record_t);
+    const int fd = open(path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        __atomic_store_n(&log->last_errno, errno, __ATOMIC_RELAXED);
+        return -1;
+    }
+    if ((0 != fallocate(fd, 0, 0, (off_t) len)) && (0 != ftruncate(fd, (off_t) len))) {
+        __atomic_store_n(&log->last_errno, errno, __ATOMIC_RELAXED);
+        (void) close(fd);
+        (void) unlink(path);
+        return -1;
+    }
+
+    void *map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == map) {
+        __atomic_store_n(&log->last_errno, errno, __ATOMIC_RELAXED);
+        (void) close(fd);
+        (void) unlink(path);
+        return -1;
+    }
+
+    rfid_tag_log_header_t *hdr = (rfid_tag_log_header_t *) map;
+    memcpy(hdr->magic, RFID_TAG_LOG_MAGIC, sizeof(hdr->magic));
+    hdr->version = RFID_TAG_LOG_VERSION;
+    hdr->header_size = RFID_TAG_LOG_HEADER_SIZE;
+    hdr->record_size = (uint32_t) sizeof(rfid_tag_log_record_t);
+    hdr->record_capacity = log->seg_records;
+    hdr->segment_index = log->next_index;
+
+    f->fd = fd;
+    f->map = (uint8_t *) map;
+    f->len = len;
+    f->index = log->next_index;
+    log->next_index++;
+    return 0;
+}
+
+/**
+ * @brief 현재 세그먼트에서 아직 msync 하지 않은 레코드를 영속화하고 헤더의 committed 를 갱신한다.
+ */
+static void TagLogFileSync_(IN_ rfid_tag_log_t *log, IN_ rfid_tag_log_file_t *f) {
+    if ((NULL == f->map) || (f->synced == f->used))
+        return;
+
+    const uint64_t t0 = TagLogNowUs_();
+    const size_t rec = sizeof(rfid_tag_log_record_t);
+    const size_t page = (size_t) RFID_TAG_LOG_HEADER_SIZE;
+    const size_t begin = ((size_t) RFID_TAG_LOG_HEADER_SIZE + (size_t) f->synced * rec) & ~(page - 1U);
+    const size_t end = (size_t) RFID_TAG_LOG_HEADER_SIZE + (size_t) f->used * rec;
+
+    // 레코드를 먼저 영속화한 뒤 committed 를 올려, 헤더가 가리키는 레코드는 항상 디스크에 있게 한다.
+    if (0 != msync(f->map + begin, end - begin, MS_SYNC))
+        __atomic_store_n(&log->last_errno, errno, __ATOMIC_RELAXED);
+    ((rfid_tag_log_header_t *) f->map)->committed = f->used;
+    if (0 != msync(f->map, page, MS_SYNC))
+        __atomic_store_n(&log->last_errno, errno, __ATOMIC_RELAXED);
+
+    __atomic_add_fetch(&log->synced, (uint64_t) (f->used - f->synced), __ATOMIC_RELAXED);
+    f->synced = f->used;
+
+    const uint64_t us = TagLogNowUs_() - t0;
+    __atomic_add_fetch(&log->sync_count, 1U, __ATOMIC_RELAXED);
+    if (us > (uint64_t) __atomic_load_n(&log->sync_max_us, __ATOMIC_RELAXED))
+        __atomic_store_n(&log->sync_max_us, (uint32_t) ((us > 0xFFFFFFFFULL) ? 0xFFFFFFFFULL : us), __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 보관 개수를 넘는 오래된 세그먼트를 지운다.
+ */
+static void TagLogRetain_(IN_ rfid_tag_log_t *log) {
+    if ((0U == log->max_segments) || (NULL == log->cur.map))
+        return;
+
+    char path[PATH_MAX];
+    while ((log->cur.index >= log->oldest) && ((log->cur.index - log->oldest + 1U) > log->max_segments)) {
+        if (0 == TagLogPath_(log, log->oldest, path, sizeof(path)))
+            (void) unlink(path);
+        log->oldest++;
+    }
+}
+
+/**
+ * @brief 미리 만든 세그먼트로 넘어간다(없으면 새로 만든다). 이어서 다음 예비 세그먼트를 만든다.
+ * @return 성공 0, 실패 -1
+ */
+static int TagLogRotate_(IN_ rfid_tag_log_t *log) {
+    if (NULL != log->cur.map) {
+        TagLogFileSync_(log, &log->cur);
+        TagLogFileClose_(&log->cur, 0);
+    }
+
+    if (NULL != log->spare.map) {
+        log->cur = log->spare;
+        memset(&log->spare, 0, sizeof(log->spare));
+        log->spare.fd = -1;
+    } else if (0 != TagLogFileCreate_(log, &log->cur)) {
+        return -1;
+    }
+
+    rfid_tag_log_header_t *hdr = (rfid_tag_log_header_t *) log->cur.map;
+    hdr->first_seq = log->next_seq;
+    hdr->created_ms = TagLogWallMs_();
+    __atomic_store_n(&log->cur_index, log->cur.index, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&log->segments_opened, 1U, __ATOMIC_RELAXED);
+
+    TagLogRetain_(log);
+
+    // 예비 세그먼트 실패는 다음 교체 때 다시 시도한다.
+    (void) TagLogFileCreate_(log, &log->spare);
+    return 0;
+}
+
+/**
+ * @brief 큐의 레코드를 세그먼트로 옮긴다.
+ * @param[in] log 태그 로그
+ * @param[in] head 옮길 끝 위치
+ */
+static void TagLogDrain_(IN_ rfid_tag_log_t *log, IN_ const uint64_t head) {
+    uint64_t tail = log->tail;
+    while (tail != head) {
+        if ((NULL == log->cur.map) || (log->cur.used >= log->seg_records)) {
+            if (0 != TagLogRotate_(log)) {
+                __atomic_add_fetch(&log->lost, head - tail, __ATOMIC_RELAXED);
+                tail = head;
+                break;
+            }
+        }
+
+        rfid_tag_log_record_t *dst = (rfid_tag_log_record_t *) (log->cur.map + RFID_TAG_LOG_HEADER_SIZE);
+        const uint64_t room = (uint64_t) (log->seg_records - log->cur.used);
+        const uint64_t n = ((head - tail) < room) ? (head - tail) : room;
+        for (uint64_t i = 0; i < n; ++i) {
+            rfid_tag_log_record_t *r = &dst[log->cur.used++];
+            memcpy(r, &log->queue[(tail + i) & log->qmask], sizeof(*r));
+            r->seq = log->next_seq++;
+        }
+        tail += n;
+        __atomic_add_fetch(&log->written, n, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&log->tail, tail, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief writer 스레드: 큐 비우기, 주기적 msync, flush 요청 처리
+ */
+static void* TagLogWriter_(IN_ void *arg) {
+    rfid_tag_log_t *log = (rfid_tag_log_t *) arg;
+    uint64_t last_sync = TagLogNowUs_();
+
+    for (;;) {
+        const uint64_t head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+        if (head != log->tail)
+            TagLogDrain_(log, head);
+
+        pthread_mutex_lock(&log->lock);
+        const int stop = log->stop;
+        const int flushing = (log->flush_req > log->done) ? 1 : 0;
+        pthread_mutex_unlock(&log->lock);
+
+        const uint64_t now = TagLogNowUs_();
+        if ((0 != stop) || (0 != flushing) || ((now - last_sync) >= (uint64_t) log->sync_ms * 1000U)) {
+            // stop/flush 는 요청 시점 이후 들어온 레코드까지 비운 뒤 영속화한다.
+            const uint64_t h = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+            if (h != log->tail)
+                TagLogDrain_(log, h);
+            TagLogFileSync_(log, &log->cur);
+            last_sync = now;
+
+            pthread_mutex_lock(&log->lock);
+            log->done = log->tail;
+            pthread_cond_broadcast(&log->cond);
+            pthread_mutex_unlock(&log->lock);
+
+            if ((0 != stop) && (__atomic_load_n(&log->head, __ATOMIC_ACQUIRE) == log->tail))
+                break;
+        }
+
+        if (__atomic_load_n(&log->head, __ATOMIC_ACQUIRE) != log->tail)
+            continue;
+
+        struct timespec until;
+        (void) clock_gettime(CLOCK_MONOTONIC, &until);
+        until.tv_nsec += (long) RFID_TAG_LOG_IDLE_MS * 1000000L;
+        if (until.tv_nsec >= 1000000000L) {
+            until.tv_sec += 1;
+            until.tv_nsec -= 1000000000L;
+        }
+        pthread_mutex_lock(&log->lock);
+        if ((0 == log->stop) && (log->flush_req <= log->done))
+            (void) pthread_cond_timedwait(&log->cond, &log->lock, &until);
+        pthread_mutex_unlock(&log->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 디렉터리의 기존 세그먼트를 찾아 번호와 seq 를 이어 받는다.
+ */
+static void TagLogScanDir_(IN_ rfid_tag_log_t *log) {
+    DIR *d = opendir(log->dir);
+    if (NULL == d)
+        return;
+
+    int found = 0;
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    const struct dirent *e;
+    while (NULL != (e = readdir(d))) {
+        uint64_t index = 0;
+        if (0 == TagLogParseName_(log, e->d_name, &index))
+            continue;
+        if ((0 == found) || (index < lo))
+            lo = index;
+        if ((0 == found) || (index > hi))
+            hi = index;
+        found = 1;
+    }
+    (void) closedir(d);
+    if (0 == found)
+        return;
+
+    log->oldest = lo;
+    log->next_index = hi + 1U;
+
+    char path[PATH_MAX];
+    rfid_tag_log_segment_t *seg = NULL;
+    if ((0 == TagLogPath_(log, hi, path, sizeof(path))) && (RFID_RESULT_OK == rfid_tag_log_segment_map(path, &seg))) {
+        uint64_t count = 0;
+        (void) rfid_tag_log_segment_records(seg, &count);
+        const uint64_t first = rfid_tag_log_segment_header(seg)->first_seq;
+        if ((first + count) > log->next_seq)
+            log->next_seq = first + count;
+        rfid_tag_log_segment_unmap(&seg);
+    }
+}
+
+/**
+ * @brief 태그 로그를 연다.
+ * @param[in]  params 열기 파라미터
+ * @param[out] out_log 생성된 로그
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_log_open(IN_ const rfid_tag_log_params_t *params, OUT_ rfid_tag_log_t **out_log) {
+    if (NULL == out_log)
+        return RFID_RESULT_INVALID_ARG;
+    *out_log = NULL;
+
+    if ((NULL == params) || (NULL == params->dir) || ('\0' == params->dir[0]))
+        return RFID_RESULT_INVALID_ARG;
+
+    const char *prefix = (NULL != params->prefix) ? params->prefix : "tags";
+    if (('\0' == prefix[0]) || (strlen(prefix) >= RFID_TAG_LOG_PREFIX_MAX) || (NULL != strchr(prefix, '/')))
+        return RFID_RESULT_INVALID_ARG;
+    if (strlen(params->dir) >= PATH_MAX)
+        return RFID_RESULT_INVALID_ARG;
+
+    uint32_t qcap = (0U != params->queue_records) ? params->queue_records : RFID_TAG_LOG_QUEUE_DEFAULT;
+    if (qcap > RFID_TAG_LOG_QUEUE_MAX)
+        return RFID_RESULT_INVALID_ARG;
+    uint32_t pow2 = 1U;
+    while (pow2 < qcap)
+        pow2 <<= 1;
+    qcap = pow2;
+
+    if ((0 != mkdir(params->dir, 0755)) && (EEXIST != errno))
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    rfid_tag_log_t *log = (rfid_tag_log_t *) calloc(1, sizeof(*log));
+    if (NULL == log)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    memcpy(log->dir, params->dir, strlen(params->dir) + 1U);
+    memcpy(log->prefix, prefix, strlen(prefix) + 1U);
+    log->seg_records = (0U != params->segment_records) ? params->segment_records : RFID_TAG_LOG_SEGMENT_DEFAULT;
+    log->sync_ms = (0U != params->sync_interval_ms) ? params->sync_interval_ms : RFID_TAG_LOG_SYNC_DEFAULT_MS;
+    log->max_segments = params->max_segments;
+    log->qmask = qcap - 1U;
+    log->cur.fd = -1;
+    log->spare.fd = -1;
+    log->next_seq = 1U;
+
+    log->queue = (rfid_tag_log_record_t *) calloc(qcap, sizeof(rfid_tag_log_record_t));
+    if (NULL == log->queue) {
+        free(log);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    TagLogScanDir_(log);
+
+    // 첫 세그먼트는 바로 만들어 디렉터리 쓰기 권한/공간 문제를 open 에서 드러낸다.
+    if (0 != TagLogFileCreate_(log, &log->spare)) {
+        free(log->queue);
+        free(log);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    pthread_condattr_t cattr;
+    int ok = (0 == pthread_condattr_init(&cattr)) ? 1 : 0;
+    if (0 != ok) {
+        (void) pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+        ok = (0 == pthread_cond_init(&log->cond, &cattr)) ? 1 : 0;
+        (void) pthread_condattr_destroy(&cattr);
+    }
+    if ((0 != ok) && (0 != pthread_mutex_init(&log->lock, NULL))) {
+        pthread_cond_destroy(&log->cond);
+        ok = 0;
+    }
+    if ((0 != ok) && (0 != pthread_mutex_init(&log->push_lock, NULL))) {
+        pthread_mutex_destroy(&log->lock);
+        pthread_cond_destroy(&log->cond);
+        ok = 0;
+    }
+    if ((0 != ok) && (0 != pthread_create(&log->thread, NULL, TagLogWriter_, log))) {
+        pthread_mutex_destroy(&log->push_lock);
+        pthread_mutex_destroy(&log->lock);
+        pthread_cond_destroy(&log->cond);
+        ok = 0;
+    }
+    if (0 == ok) {
+        char path[PATH_MAX];
+        if (0 == TagLogPath_(log, log->spare.index, path, sizeof(path)))
+            (void) unlink(path);
+        TagLogFileClose_(&log->spare, 0);
+        free(log->queue);
+        free(log);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    *out_log = log;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 태그 로그를 닫는다.
+ * @param[in,out] inout_log 닫을 로그
+ */
+void rfid_tag_log_close(INOUT_ rfid_tag_log_t **inout_log) {
+    if ((NULL == inout_log) || (NULL == *inout_log))
+        return;
+
+    rfid_tag_log_t *log = *inout_log;
+    pthread_mutex_lock(&log->lock);
+    log->stop = 1;
+    pthread_cond_broadcast(&log->cond);
+    pthread_mutex_unlock(&log->lock);
+    (void) pthread_join(log->thread, NULL);
+
+    // 기록이 없는 세그먼트(예비 포함)는 남기지 않는다.
+    char path[PATH_MAX];
+    if ((NULL != log->cur.map) && (0U == log->cur.used) && (0 == TagLogPath_(log, log->cur.index, path, sizeof(path))))
+        (void) unlink(path);
+    TagLogFileClose_(&log->cur, 1);
+    if ((NULL != log->spare.map) && (0 == TagLogPath_(log, log->spare.index, path, sizeof(path))))
+        (void) unlink(path);
+    TagLogFileClose_(&log->spare, 0);
+
+    pthread_mutex_destroy(&log->push_lock);
+    pthread_mutex_destroy(&log->lock);
+    pthread_cond_destroy(&log->cond);
+    free(log->queue);
+    free(log);
+    *inout_log = NULL;
+}
+
+/**
+ * @brief 태그 1건으로 레코드를 채운다.
+ * @param[out] rec 레코드
+ * @param[in]  reader_id 리더 id
+ * @param[in]  tag 태그
+ */
+void rfid_tag_log_record_fill(OUT_ rfid_tag_log_record_t *rec, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tag) {
+    const uint32_t len = (tag->epc_len > RFID_TAG_LOG_EPC_BYTES) ? RFID_TAG_LOG_EPC_BYTES : tag->epc_len;
+
+    rec->ts = tag->ts;
+    rec->seq = 0;
+    rec->reader_id = reader_id;
+    rec->antenna = (uint8_t) ((tag->antenna < 0) ? 0 : ((tag->antenna > 255) ? 255 : tag->antenna));
+    rec->rssi = (int8_t) ((tag->rssi < -128) ? -128 : ((tag->rssi > 127) ? 127 : tag->rssi));
+    rec->epc_len = (uint8_t) len;
+    rec->flags = (tag->epc_len > RFID_TAG_LOG_EPC_BYTES) ? RFID_TAG_LOG_FLAG_TRUNCATED : 0U;
+    rec->readcnt = (uint16_t) ((tag->readcnt > 0xFFFFU) ? 0xFFFFU : tag->readcnt);
+    rec->rule_id = tag->rule_id;
+    memcpy(rec->epc, tag->epc_bytes, len);
+    memset(rec->epc + len, 0, RFID_TAG_LOG_EPC_BYTES - len);
+}
+
+/**
+ * @brief 태그를 로그 큐에 넣는다.
+ * @param[in] log 태그 로그
+ * @param[in] reader_id 리더 id
+ * @param[in] tags 태그 배열
+ * @param[in] count 태그 개수
+ * @return 큐에 넣은 태그 수
+ */
+int rfid_tag_log_append(IN_ rfid_tag_log_t *log, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tags, IN_ const int count) {
+    if ((NULL == log) || (NULL == tags) || (count <= 0))
+        return 0;
+
+    pthread_mutex_lock(&log->push_lock);
+    const uint64_t head = log->head;
+    const uint64_t used = head - __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+    const uint64_t room = (uint64_t) log->qmask + 1U - used;
+    const uint32_t n = ((uint64_t) count < room) ? (uint32_t) count : (uint32_t) room;
+
+    for (uint32_t i = 0; i < n; ++i)
+        rfid_tag_log_record_fill(&log->queue[(head + i) & log->qmask], reader_id, &tags[i]);
+    __atomic_store_n(&log->head, head + n, __ATOMIC_RELEASE);
+    if ((uint32_t) (used + n) > log->queue_peak)
+        __atomic_store_n(&log->queue_peak, (uint32_t) (used + n), __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&log->push_lock);
+
+    __atomic_add_fetch(&log->appended, (uint64_t) n, __ATOMIC_RELAXED);
+    if (n < (uint32_t) count)
+        __atomic_add_fetch(&log->dropped, (uint64_t) ((uint32_t) count - n), __ATOMIC_RELAXED);
+    return (int) n;
+}
+
+/**
+ * @brief 큐에 넣은 레코드가 영속화될 때까지 기다린다.
+ * @param[in] log 태그 로그
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_log_flush(IN_ rfid_tag_log_t *log) {
+    if (NULL == log)
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint64_t target = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+    pthread_mutex_lock(&log->lock);
+    if (target > log->flush_req)
+        log->flush_req = target;
+    pthread_cond_broadcast(&log->cond);
+    while (log->done < target)
+        pthread_cond_wait(&log->cond, &log->lock);
+    pthread_mutex_unlock(&log->lock);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 태그 로그 상태를 조회한다.
+ * @param[in]  log 태그 로그
+ * @param[out] out_stat 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_log_get_stats(IN_ rfid_tag_log_t *log, OUT_ rfid_tag_log_stat_t *out_stat) {
+    if ((NULL == log) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    memset(out_stat, 0, sizeof(*out_stat));
+    out_stat->appended = __atomic_load_n(&log->appended, __ATOMIC_RELAXED);
+    out_stat->dropped = __atomic_load_n(&log->dropped, __ATOMIC_RELAXED);
+    out_stat->written = __atomic_load_n(&log->written, __ATOMIC_RELAXED);
+    out_stat->synced = __atomic_load_n(&log->synced, __ATOMIC_RELAXED);
+    out_stat->lost = __atomic_load_n(&log->lost, __ATOMIC_RELAXED);
+    out_stat->segment_index = __atomic_load_n(&log->cur_index, __ATOMIC_RELAXED);
+    out_stat->segments_opened = __atomic_load_n(&log->segments_opened, __ATOMIC_RELAXED);
+    out_stat->queue_used = (uint32_t) (__atomic_load_n(&log->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE));
+    out_stat->queue_peak = __atomic_load_n(&log->queue_peak, __ATOMIC_RELAXED);
+    out_stat->queue_capacity = log->qmask + 1U;
+    out_stat->sync_count = __atomic_load_n(&log->sync_count, __ATOMIC_RELAXED);
+    out_stat->sync_max_us = __atomic_load_n(&log->sync_max_us, __ATOMIC_RELAXED);
+    out_stat->last_errno = __atomic_load_n(&log->last_errno, __ATOMIC_RELAXED);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 세그먼트 파일을 읽기 전용으로 매핑한다.
+ * @param[in]  path 세그먼트 파일 경로
+ * @param[out] out_seg 매핑 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_tag_log_segment_map(IN_ const char *path, OUT_ rfid_tag_log_segment_t **out_seg) {
+    if (NULL == out_seg)
+        return RFID_RESULT_INVALID_ARG;
+    *out_seg = NULL;
+    if (NULL == path)
+        return RFID_RESULT_INVALID_ARG;
+
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    struct stat st;
+    if ((0 != fstat(fd, &st)) || ((size_t) st.st_size < sizeof(rfid_tag_log_header_t))) {
+        (void) close(fd);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    const size_t len = (size_t) st.st_size;
+    void *map = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+    (void) close(fd);
+    if (MAP_FAILED == map)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    const rfid_tag_log_header_t *hdr = (const rfid_tag_log_header_t *) map;
+    if ((0 != memcmp(hdr->magic, RFID_TAG_LOG_MAGIC, sizeof(hdr->magic)))
+        || (RFID_TAG_LOG_VERSION != hdr->version)
+        || (sizeof(rfid_tag_log_record_t) != hdr->record_size)
+        || (hdr->header_size < sizeof(rfid_tag_log_header_t))
+        || (hdr->header_size > len)) {
+        (void) munmap(map, len);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    rfid_tag_log_segment_t *seg = (rfid_tag_log_segment_t *) calloc(1, sizeof(*seg));
+    if (NULL == seg) {
+        (void) munmap(map, len);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+
+    // close 로 잘린 세그먼트는 파일 크기가, 기록 중인 세그먼트는 committed 와 seq 연속성이 유효 범위를 정한다.
+    uint64_t slots = (uint64_t) (len - hdr->header_size) / sizeof(rfid_tag_log_record_t);
+    if (slots > hdr->record_capacity)
+        slots = hdr->record_capacity;
+    const rfid_tag_log_record_t *recs = (const rfid_tag_log_record_t *) ((const uint8_t *) map + hdr->header_size);
+    uint64_t count = (hdr->committed < slots) ? hdr->committed : slots;
+    while ((count < slots) && (0U != recs[count].seq) && (recs[count].seq == hdr->first_seq + count))
+        count++;
+
+    (void) madvise(map, len, MADV_SEQUENTIAL);
+    seg->map = (const uint8_t *) map;
+    seg->len = len;
+    seg->count = count;
+    *out_seg = seg;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 세그먼트 매핑을 해제한다.
+ * @param[in,out] inout_seg 해제할 세그먼트
+ */
+void rfid_tag_log_segment_unmap(INOUT_ rfid_tag_log_segment_t **inout_seg) {
+    if ((NULL == inout_seg) || (NULL == *inout_seg))
+        return;
+
+    rfid_tag_log_segment_t *seg = *inout_seg;
+    (void) munmap((void *) seg->map, seg->len);
+    free(seg);
+    *inout_seg = NULL;
+}
+
+/**
+ * @brief 세그먼트 헤더를 반환한다.
+ * @param[in] seg 세그먼트
+ * @return 헤더
+ */
+const rfid_tag_log_header_t* rfid_tag_log_segment_header(IN_ const rfid_tag_log_segment_t *seg) {
+    return (NULL != seg) ? (const rfid_tag_log_header_t *) seg->map : NULL;
+}
+
+/**
+ * @brief 세그먼트의 유효 레코드 배열을 반환한다.
+ * @param[in]  seg 세그먼트
+ * @param[out] out_count 유효 레코드 수
+ * @return 레코드 배열
+ */
+const rfid_tag_log_record_t* rfid_tag_log_segment_records(IN_ const rfid_tag_log_segment_t *seg, OUT_ uint64_t *out_count) {
+    if (NULL != out_count)
+        *out_count = 0;
+    if ((NULL == seg) || (0U == seg->count))
+        return NULL;
+
+    if (NULL != out_count)
+        *out_count = seg->count;
+    const rfid_tag_log_header_t *hdr = (const rfid_tag_log_header_t *) seg->map;
+    return (const rfid_tag_log_record_t *) (seg->map + hdr->header_size);
+}
@@ -0,0 +1,132 @@
+#ifndef RFID_TAG_LOG_H_
+#define RFID_TAG_LOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief mmap 기반 append-only 바이너리 태그 로그. 구현부에서 정의하는 opaque 타입.
+ *
+ * - 태그를 고정 크기 레코드(rfid_tag_log_record_t)로 미리 할당한 세그먼트 파일에 기록한다.
+ * - rfid_tag_log_append()는 레코드를 메모리 큐에 복사만 하고 바로 반환한다.
+ *   mmap 기록, 주기적 msync, 세그먼트 교체/삭제는 로그 전용 writer 스레드가 수행하므로 read 스레드는 I/O로 막히지 않는다.
+ * - 큐가 가득 차면 새 레코드를 버리고 dropped 로 센다(기다리지 않음).
+ * - 세그먼트 파일 이름: <dir>/<prefix>-<segment_index 10자리>.rtl
+ */
+typedef struct rfid_tag_log rfid_tag_log_t;
+
+/**
+ * @brief 읽기 전용으로 매핑한 세그먼트 파일. 구현부에서 정의하는 opaque 타입.
+ */
+typedef struct rfid_tag_log_segment rfid_tag_log_segment_t;
+
+/**
+ * @brief 태그 1건으로 레코드를 채운다(seq 는 0, EPC가 길면 잘라서 RFID_TAG_LOG_FLAG_TRUNCATED 표시).
+ *
+ * 태그 로그와 공유 메모리 태그 버스가 같은 레코드 형식을 쓴다.
+ *
+ * @param[out] rec 레코드
+ * @param[in]  reader_id 레코드에 기록할 리더 id
+ * @param[in]  tag 태그
+ */
+void rfid_tag_log_record_fill(OUT_ rfid_tag_log_record_t *rec, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tag);
+
+/**
+ * @brief 태그 로그를 연다. 디렉터리의 기존 세그먼트는 보존하고 다음 번호부터 새 세그먼트를 만든다.
+ *
+ * @param[in]  params 열기 파라미터(dir 필수). 호출 중에만 참조한다.
+ * @param[out] out_log 생성된 로그
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_INTERNAL_ERROR: 디렉터리/세그먼트 생성, 메모리 할당, 스레드 생성 실패
+ */
+RFID_RESULT rfid_tag_log_open(IN_ const rfid_tag_log_params_t *params, OUT_ rfid_tag_log_t **out_log);
+
+/**
+ * @brief 큐에 남은 레코드를 모두 기록하고 msync 한 뒤 로그를 닫는다. 성공 시 *inout_log 를 NULL로 설정한다.
+ * @note 마지막 세그먼트는 기록한 크기로 잘라낸다.
+ * @param[in,out] inout_log 닫을 로그(NULL 허용)
+ */
+void rfid_tag_log_close(INOUT_ rfid_tag_log_t **inout_log);
+
+/**
+ * @brief 태그를 로그 큐에 넣는다(막히지 않음). 여러 스레드에서 호출해도 안전하다.
+ *
+ * @param[in] log 태그 로그
+ * @param[in] reader_id 레코드에 기록할 리더 id
+ * @param[in] tags 태그 배열
+ * @param[in] count 태그 개수
+ *
+ * @return 큐에 넣은 태그 수(큐가 가득 차면 count 보다 작다, 인자 오류 시 0)
+ */
+int rfid_tag_log_append(IN_ rfid_tag_log_t *log, IN_ const uint16_t reader_id, IN_ const rfid_tag_t *tags, IN_ const int count);
+
+/**
+ * @brief 호출 시점까지 큐에 넣은 레코드가 기록되고 msync 될 때까지 기다린다.
+ *
+ * @param[in] log 태그 로그
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_tag_log_flush(IN_ rfid_tag_log_t *log);
+
+/**
+ * @brief 태그 로그 상태를 조회한다.
+ *
+ * @param[in]  log 태그 로그
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_tag_log_get_stats(IN_ rfid_tag_log_t *log, OUT_ rfid_tag_log_stat_t *out_stat);
+
+/**
+ * @brief 세그먼트 파일을 읽기 전용으로 매핑한다(기록 중인 세그먼트도 가능).
+ *
+ * @param[in]  path 세그먼트 파일 경로
+ * @param[out] out_seg 매핑 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 세그먼트 형식 아님,
+ *         RFID_RESULT_INTERNAL_ERROR: 열기/매핑 실패
+ */
+RFID_RESULT rfid_tag_log_segment_map(IN_ const char *path, OUT_ rfid_tag_log_segment_t **out_seg);
+
+/**
+ * @brief 매핑을 해제한다. 성공 시 *inout_seg 를 NULL로 설정한다.
+ * @param[in,out] inout_seg 해제할 세그먼트(NULL 허용)
+ */
+void rfid_tag_log_segment_unmap(INOUT_ rfid_tag_log_segment_t **inout_seg);
+
+/**
+ * @brief 세그먼트 헤더를 반환한다.
+ * @param[in] seg 세그먼트
+ * @return 헤더(seg 가 NULL이면 NULL)
+ */
+const rfid_tag_log_header_t* rfid_tag_log_segment_header(IN_ const rfid_tag_log_segment_t *seg);
+
+/**
+ * @brief 세그먼트의 유효 레코드 배열을 반환한다.
+ *
+ * - committed 까지는 그대로 유효로 보고, 그 뒤는 seq 가 이어지는 동안만 유효로 본다
+ *   (비정상 종료로 일부 페이지만 기록된 경우 앞쪽의 연속 구간만 반환).
+ * - 반환 포인터는 unmap 전까지 유효하다.
+ *
+ * @param[in]  seg 세그먼트
+ * @param[out] out_count 유효 레코드 수
+ *
+ * @return 레코드 배열(없으면 NULL, *out_count = 0)
+ */
+const rfid_tag_log_record_t* rfid_tag_log_segment_records(IN_ const rfid_tag_log_segment_t *seg, OUT_ uint64_t *out_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_TAG_LOG_H_
@@ -0,0 +1,395 @@
+// c_lib/api/rfid_timer_wheel.c
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+
+#include "rfid_timer_wheel.h"
+
+#include <stdlib.h>   // calloc, free
+#include <time.h>     // clock_gettime
+
+// 내부 상수
+#define RFID_TW_CAPACITY        (262144U)       // 타이머 용량 기본값
+#define RFID_TW_CAPACITY_MAX    (1U << 26)
+#define RFID_TW_BITS            (8)             // 단계당 비트 수
+#define RFID_TW_SLOTS           (1 << RFID_TW_BITS) // 단계당 슬롯 수
+#define RFID_TW_LEVELS          (64 / RFID_TW_BITS) // 64비트 시각 전체를 덮는 단계 수
+#define RFID_TW_WORDS           (RFID_TW_SLOTS / 64) // 단계당 점유 비트맵 워드 수
+#define RFID_TW_OVERDUE         ((uint32_t) (RFID_TW_LEVELS * RFID_TW_SLOTS)) // 이미 만료된 타이머 목록
+#define RFID_TW_NONE            (0xFFFFFFFFU)   // 목록 끝/빈 타이머
+
+/**
+ * @brief 타이머 1개
+ *
+ * @param deadline_ms 만료 시각
+ * @param user_data   등록 시 넘긴 값
+ * @param prev        같은 슬롯 목록의 이전 타이머
+ * @param next        같은 슬롯 목록의 다음 타이머, 빈 타이머이면 free 목록의 다음 타이머
+ * @param gen         id 세대(해제할 때마다 증가)
+ * @param slot        들어 있는 목록(단계 * 256 + 슬롯, RFID_TW_OVERDUE, 빈 타이머는 RFID_TW_NONE)
+ */
+typedef struct rfid_timer_node {
+    uint64_t deadline_ms;
+    uint64_t user_data;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t gen;
+    uint32_t slot;
+} rfid_timer_node_t;
+
+/**
+ * @brief 타이밍 휠
+ *
+ * 단계 L 에는 now 와 처음 달라지는 8비트 자리(상위부터)가 L 인 타이머를 그 자리 값 슬롯에 둔다.
+ * 따라서 단계 L 의 슬롯 s 에 든 타이머는 모두 같은 시각((now 상위 자리) | s << 8L)에 하위 단계로 옮겨지고,
+ * 점유 슬롯은 항상 now 의 해당 자리보다 크다. 가장 낮은 점유 단계의 가장 작은 슬롯이 다음 처리 시각이다.
+ *
+ * @param nodes     타이머 배열(capacity 개)
+ * @param heads     슬롯별 목록 머리(단계 * 256 + 슬롯, 마지막은 overdue 목록)
+ * @param occupied  단계별 점유 슬롯 비트맵
+ * @param free_head 빈 타이머 목록
+ * @param now_ms    휠의 현재 시각
+ * @param stat      누적 상태
+ */
+struct rfid_timer_wheel {
+    rfid_timer_node_t *nodes;
+    uint32_t heads[RFID_TW_LEVELS * RFID_TW_SLOTS + 1];
+    uint64_t occupied[RFID_TW_LEVELS][RFID_TW_WORDS];
+    uint32_t free_head;
+    uint64_t now_ms;
+    rfid_timer_wheel_stat_t stat;
+};
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms, 0이 되지 않도록 1부터)
+ * @return 현재 시각(ms)
+ */
+uint64_t rfid_timer_wheel_now_ms(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL) + 1U;
+}
+
+/**
+ * @brief 타이머 인덱스와 세대로 id 를 만든다.
+ */
+static rfid_timer_id_t TimerMakeId_(IN_ const uint32_t idx, IN_ const uint32_t gen) {
+    return ((uint64_t) gen << 32) | (uint64_t) (idx + 1U);
+}
+
+/**
+ * @brief id 에 해당하는 등록 중 타이머 인덱스를 구한다.
+ * @return 타이머 인덱스(없거나 이미 해제됐으면 RFID_TW_NONE)
+ */
+static uint32_t TimerFromId_(IN_ const rfid_timer_wheel_t *w, IN_ const rfid_timer_id_t id) {
+    const uint32_t low = (uint32_t) (id & 0xFFFFFFFFULL);
+    if ((0U == low) || (low > w->stat.capacity))
+        return RFID_TW_NONE;
+
+    const uint32_t idx = low - 1U;
+    const rfid_timer_node_t *n = &w->nodes[idx];
+    if ((n->gen != (uint32_t) (id >> 32)) || (RFID_TW_NONE == n->slot))
+        return RFID_TW_NONE;
+    return idx;
+}
+
+/**
+ * @brief 타이머를 목록 머리에 넣는다.
+ */
+static void TimerPush_(IN_ rfid_timer_wheel_t *w, IN_ const uint32_t idx, IN_ const uint32_t slot) {
+    rfid_timer_node_t *n = &w->nodes[idx];
+    const uint32_t head = w->heads[slot];
+    n->slot = slot;
+    n->prev = RFID_TW_NONE;
+    n->next = head;
+    if (RFID_TW_NONE != head)
+        w->nodes[head].prev = idx;
+    w->heads[slot] = idx;
+    if (slot < RFID_TW_OVERDUE)
+        w->occupied[slot / RFID_TW_SLOTS][(slot % RFID_TW_SLOTS) / 64U] |= 1ULL << (slot % 64U);
+}
+
+/**
+ * @brief 타이머를 들어 있는 목록에서 뺀다.
+ */
+static void TimerUnlink_(IN_ rfid_timer_wheel_t *w, IN_ const uint32_t idx) {
+    rfid_timer_node_t *n = &w->nodes[idx];
+    const uint32_t slot = n->slot;
+    if (RFID_TW_NONE != n->prev)
+        w->nodes[n->prev].next = n->next;
+    else
+        w->heads[slot] = n->next;
+    if (RFID_TW_NONE != n->next)
+        w->nodes[n->next].prev = n->prev;
+    if ((RFID_TW_NONE == w->heads[slot]) && (slot < RFID_TW_OVERDUE))
+        w->occupied[slot / RFID_TW_SLOTS][(slot % RFID_TW_SLOTS) / 64U] &= ~(1ULL << (slot % 64U));
+    n->slot = RFID_TW_NONE;
+}
+
+/**
+ * @brief 현재 시각 기준으로 타이머를 알맞은 단계/슬롯에 넣는다(지난 시각이면 overdue 목록).
+ */
+static void TimerPlace_(IN_ rfid_timer_wheel_t *w, IN_ const uint32_t idx) {
+    const uint64_t deadline = w->nodes[idx].deadline_ms;
+    if (deadline <= w->now_ms) {
+        TimerPush_(w, idx, RFID_TW_OVERDUE);
+        return;
+    }
+
+    // now 와 처음 달라지는 자리가 단계를 정한다.
+    const int level = (63 - __builtin_clzll(deadline ^ w->now_ms)) / RFID_TW_BITS;
+    const uint32_t slot = (uint32_t) ((deadline >> (level * RFID_TW_BITS)) & (RFID_TW_SLOTS - 1));
+    TimerPush_(w, idx, (uint32_t) level * RFID_TW_SLOTS + slot);
+}
+
+/**
+ * @brief 타이머를 해제해 free 목록에 돌려준다(목록에서는 이미 빠진 상태).
+ */
+static void TimerFree_(IN_ rfid_timer_wheel_t *w, IN_ const uint32_t idx) {
+    rfid_timer_node_t *n = &w->nodes[idx];
+    n->gen++;
+    if (0U == n->gen)
+        n->gen = 1U;
+    n->slot = RFID_TW_NONE;
+    n->next = w->free_head;
+    w->free_head = idx;
+    w->stat.active--;
+}
+
+/**
+ * @brief 가장 이른 점유 슬롯을 찾는다.
+ * @param[out] out_level 단계
+ * @param[out] out_slot 슬롯
+ * @return 1: 있음, 0: 휠이 비어 있음(overdue 제외)
+ */
+static int TimerNextSlot_(IN_ const rfid_timer_wheel_t *w, OUT_ int *out_level, OUT_ uint32_t *out_slot) {
+    for (int level = 0; level < RFID_TW_LEVELS; ++level) {
+        for (int word = 0; word < RFID_TW_WORDS; ++word) {
+            const uint64_t bits = w->occupied[level][word];
+            if (0U != bits) {
+                *out_level = level;
+                *out_slot = (uint32_t) (word * 64 + __builtin_ctzll(bits));
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 휠을 만든다.
+ * @param[in]  capacity 최대 타이머 수
+ * @param[in]  start_ms 시작 시각
+ * @param[out] out_wheel 생성된 휠
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_create(IN_ const uint32_t capacity, IN_ const uint64_t start_ms, OUT_ rfid_timer_wheel_t **out_wheel) {
+    if ((NULL == out_wheel) || (capacity > RFID_TW_CAPACITY_MAX))
+        return RFID_RESULT_INVALID_ARG;
+    *out_wheel = NULL;
+
+    rfid_timer_wheel_t *w = (rfid_timer_wheel_t *) calloc(1, sizeof(*w));
+    if (NULL == w)
+        return RFID_RESULT_INTERNAL_ERROR;
+
+    const uint32_t cap = (0U != capacity) ? capacity : RFID_TW_CAPACITY;
+    w->nodes = (rfid_timer_node_t *) calloc(cap, sizeof(rfid_timer_node_t));
+    if (NULL == w->nodes) {
+        free(w);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    for (uint32_t i = 0; i < cap; ++i) {
+        w->nodes[i].gen = 1U;
+        w->nodes[i].slot = RFID_TW_NONE;
+        w->nodes[i].next = (i + 1U < cap) ? (i + 1U) : RFID_TW_NONE;
+    }
+    for (uint32_t s = 0; s <= RFID_TW_OVERDUE; ++s)
+        w->heads[s] = RFID_TW_NONE;
+    w->free_head = 0U;
+    w->now_ms = (0U != start_ms) ? start_ms : rfid_timer_wheel_now_ms();
+    w->stat.now_ms = w->now_ms;
+    w->stat.capacity = cap;
+
+    *out_wheel = w;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 휠을 해제한다.
+ * @param[in,out] inout_wheel 해제할 휠
+ */
+void rfid_timer_wheel_destroy(INOUT_ rfid_timer_wheel_t **inout_wheel) {
+    if ((NULL == inout_wheel) || (NULL == *inout_wheel))
+        return;
+
+    rfid_timer_wheel_t *w = *inout_wheel;
+    free(w->nodes);
+    free(w);
+    *inout_wheel = NULL;
+}
+
+/**
+ * @brief 타이머 등록
+ * @param[in]  wheel 휠
+ * @param[in]  deadline_ms 만료 시각
+ * @param[in]  user_data 만료 시 돌려받을 값
+ * @param[out] out_id 타이머 id
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_schedule(IN_ rfid_timer_wheel_t *wheel
+                                      , IN_ const uint64_t deadline_ms
+                                      , IN_ const uint64_t user_data
+                                      , OUT_ rfid_timer_id_t *out_id) {
+    if ((NULL == wheel) || (NULL == out_id))
+        return RFID_RESULT_INVALID_ARG;
+    *out_id = 0U;
+
+    const uint32_t idx = wheel->free_head;
+    if (RFID_TW_NONE == idx) {
+        wheel->stat.table_full++;
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    rfid_timer_node_t *n = &wheel->nodes[idx];
+    wheel->free_head = n->next;
+    n->deadline_ms = deadline_ms;
+    n->user_data = user_data;
+    TimerPlace_(wheel, idx);
+
+    wheel->stat.active++;
+    wheel->stat.scheduled++;
+    *out_id = TimerMakeId_(idx, n->gen);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 타이머 만료 시각 변경
+ * @param[in] wheel 휠
+ * @param[in] id 타이머 id
+ * @param[in] deadline_ms 새 만료 시각
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_reschedule(IN_ rfid_timer_wheel_t *wheel, IN_ const rfid_timer_id_t id, IN_ const uint64_t deadline_ms) {
+    if (NULL == wheel)
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint32_t idx = TimerFromId_(wheel, id);
+    if (RFID_TW_NONE == idx)
+        return RFID_RESULT_INVALID_ARG;
+
+    TimerUnlink_(wheel, idx);
+    wheel->nodes[idx].deadline_ms = deadline_ms;
+    TimerPlace_(wheel, idx);
+    wheel->stat.scheduled++;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 타이머 취소
+ * @param[in] wheel 휠
+ * @param[in] id 타이머 id
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_cancel(IN_ rfid_timer_wheel_t *wheel, IN_ const rfid_timer_id_t id) {
+    if (NULL == wheel)
+        return RFID_RESULT_INVALID_ARG;
+
+    const uint32_t idx = TimerFromId_(wheel, id);
+    if (RFID_TW_NONE == idx)
+        return RFID_RESULT_INVALID_ARG;
+
+    TimerUnlink_(wheel, idx);
+    TimerFree_(wheel, idx);
+    wheel->stat.cancelled++;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 휠 시각 진행 및 만료 타이머 꺼내기
+ * @param[in]  wheel 휠
+ * @param[in]  now_ms 현재 시각
+ * @param[out] out_expiry 만료 버퍼
+ * @param[in]  capacity out_expiry 용량
+ * @param[out] out_count 꺼낸 만료 수
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_advance(IN_ rfid_timer_wheel_t *wheel
+                                     , IN_ const uint64_t now_ms
+                                     , OUT_ rfid_timer_expiry_t *out_expiry
+                                     , IN_ const int capacity
+                                     , OUT_ int *out_count) {
+    if ((NULL == wheel) || (NULL == out_expiry) || (capacity <= 0) || (NULL == out_count))
+        return RFID_RESULT_INVALID_ARG;
+    *out_count = 0;
+
+    rfid_timer_wheel_t *w = wheel;
+    const uint64_t target = (0U != now_ms) ? now_ms : rfid_timer_wheel_now_ms();
+    int n = 0;
+
+    for (;;) {
+        // 이미 만료 시각이 지난 타이머(지난 호출에서 버퍼가 가득 찼던 분 포함)부터 꺼낸다.
+        while ((n < capacity) && (RFID_TW_NONE != w->heads[RFID_TW_OVERDUE])) {
+            const uint32_t idx = w->heads[RFID_TW_OVERDUE];
+            const rfid_timer_node_t *node = &w->nodes[idx];
+            rfid_timer_expiry_t *e = &out_expiry[n++];
+            e->id = TimerMakeId_(idx, node->gen);
+            e->user_data = node->user_data;
+            e->deadline_ms = node->deadline_ms;
+            TimerUnlink_(w, idx);
+            TimerFree_(w, idx);
+            w->stat.expired++;
+        }
+        if (n >= capacity)
+            break;
+
+        int level = 0;
+        uint32_t slot = 0;
+        if (0 == TimerNextSlot_(w, &level, &slot)) {
+            if (target > w->now_ms)
+                w->now_ms = target;
+            break;
+        }
+
+        // 슬롯 처리 시각: now 의 상위 자리는 그대로, 해당 자리는 slot, 하위 자리는 0
+        const int shift = level * RFID_TW_BITS;
+        const uint64_t upper = (shift + RFID_TW_BITS < 64)
+                                   ? ((w->now_ms >> (shift + RFID_TW_BITS)) << (shift + RFID_TW_BITS))
+                                   : 0U;
+        const uint64_t when = upper | ((uint64_t) slot << shift);
+        if (when > target) {
+            if (target > w->now_ms)
+                w->now_ms = target;
+            break;
+        }
+        w->now_ms = when;
+
+        // 슬롯 전체를 떼어 내 다시 배치한다. 만료 시각이 된 타이머는 overdue 목록으로 가서 위에서 꺼낸다.
+        const uint32_t list_slot = (uint32_t) level * RFID_TW_SLOTS + slot;
+        uint32_t idx = w->heads[list_slot];
+        w->heads[list_slot] = RFID_TW_NONE;
+        w->occupied[level][slot / 64U] &= ~(1ULL << (slot % 64U));
+        while (RFID_TW_NONE != idx) {
+            const uint32_t next = w->nodes[idx].next;
+            TimerPlace_(w, idx);
+            if (level > 0)
+                w->stat.cascaded++;
+            idx = next;
+        }
+    }
+
+    w->stat.now_ms = w->now_ms;
+    *out_count = n;
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief 휠 상태 조회
+ * @param[in]  wheel 휠
+ * @param[out] out_stat 결과
+ * @return RFID_RESULT 결과 코드
+ */
+RFID_RESULT rfid_timer_wheel_get_stats(IN_ const rfid_timer_wheel_t *wheel, OUT_ rfid_timer_wheel_stat_t *out_stat) {
+    if ((NULL == wheel) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+
+    *out_stat = wheel->stat;
+    return RFID_RESULT_OK;
+}
@@ -0,0 +1,129 @@
+#ifndef RFID_TIMER_WHEEL_H_
+#define RFID_TIMER_WHEEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rfid_types.h"
+
+/**
+ * @brief 계층형 타이밍 휠(ms 해상도). 구현부에서 정의하는 opaque 타입.
+ *
+ * - 태그별 만료 시각(DEPART, TTL 캐시, 재보고 제한 등)을 전체 태그 순회 없이 처리한다.
+ * - 등록/재등록/취소는 O(1), advance 는 만료 수(및 타이머당 최대 단계 수만큼의 이동)에 비례한다.
+ *   빈 구간은 단계별 점유 비트맵으로 건너뛰므로 오래 호출하지 않아도 비용이 늘지 않는다.
+ * - 상위 단계 슬롯은 경계 시각에 한꺼번에 하위 단계로 옮기므로 그 tick 의 advance 는 슬롯에 든 타이머 수만큼 길어진다.
+ *   단계 1 경계는 256 ms, 단계 2 경계는 65536 ms 마다 온다. 만료 시각이 1분 안팎에 몰려 있으면 단계 2 경계 tick 에
+ *   등록된 타이머 대부분을 한 번에 옮긴다(최악: 활성 타이머 전체, 타이머당 수십 ns). 예: 1M 개면 그 tick 이 약 70 ms 걸린다.
+ *   advance 는 이 작업을 나누지 않으므로, tick 지연 상한이 중요한 스레드에서는 활성 타이머 수를 그 상한에 맞춰 제한한다.
+ *   타이머 1개가 옮겨지는 횟수는 (만료까지 남은 시간의 단계 수 - 1) 이하이며 stat.cascaded 로 집계한다.
+ * - 시각은 rfid_timer_wheel_now_ms() 와 같은 CLOCK_MONOTONIC 기준 ms 를 쓴다.
+ * - 타이머 용량은 생성 시 고정한다(실행 중 메모리 할당 없음).
+ * - 스레드 안전하지 않다. 한 휠은 한 스레드(보통 read 스레드)에서만 사용한다.
+ */
+typedef struct rfid_timer_wheel rfid_timer_wheel_t;
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms). 0이 되지 않는다.
+ * @return 현재 시각(ms)
+ */
+uint64_t rfid_timer_wheel_now_ms(void);
+
+/**
+ * @brief 휠을 만든다.
+ *
+ * @param[in]  capacity 최대 타이머 수(0이면 262144, 최대 1<<26)
+ * @param[in]  start_ms 휠의 시작 시각(ms). 0이면 rfid_timer_wheel_now_ms()
+ * @param[out] out_wheel 생성된 휠
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당 실패
+ */
+RFID_RESULT rfid_timer_wheel_create(IN_ const uint32_t capacity, IN_ const uint64_t start_ms, OUT_ rfid_timer_wheel_t **out_wheel);
+
+/**
+ * @brief 휠을 해제한다. 성공 시 *inout_wheel 을 NULL로 설정한다.
+ * @param[in,out] inout_wheel 해제할 휠(NULL 허용)
+ */
+void rfid_timer_wheel_destroy(INOUT_ rfid_timer_wheel_t **inout_wheel);
+
+/**
+ * @brief 타이머를 등록한다. 이미 지난 시각이면 다음 advance 에서 바로 만료된다.
+ *
+ * @param[in]  wheel 휠
+ * @param[in]  deadline_ms 만료 시각(ms)
+ * @param[in]  user_data 만료 시 돌려받을 값
+ * @param[out] out_id 타이머 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_INTERNAL_ERROR: 용량 초과(table_full 로 집계)
+ */
+RFID_RESULT rfid_timer_wheel_schedule(IN_ rfid_timer_wheel_t *wheel
+                                      , IN_ const uint64_t deadline_ms
+                                      , IN_ const uint64_t user_data
+                                      , OUT_ rfid_timer_id_t *out_id);
+
+/**
+ * @brief 등록된 타이머의 만료 시각을 바꾼다(id 유지). 태그를 다시 읽을 때마다 호출하는 용도.
+ *
+ * @param[in] wheel 휠
+ * @param[in] id 타이머 id
+ * @param[in] deadline_ms 새 만료 시각(ms)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 이미 만료/취소된 id
+ */
+RFID_RESULT rfid_timer_wheel_reschedule(IN_ rfid_timer_wheel_t *wheel, IN_ const rfid_timer_id_t id, IN_ const uint64_t deadline_ms);
+
+/**
+ * @brief 타이머를 취소한다.
+ *
+ * @param[in] wheel 휠
+ * @param[in] id 타이머 id
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류 또는 이미 만료/취소된 id
+ */
+RFID_RESULT rfid_timer_wheel_cancel(IN_ rfid_timer_wheel_t *wheel, IN_ const rfid_timer_id_t id);
+
+/**
+ * @brief 휠 시각을 now_ms 까지 진행하고 만료된 타이머를 꺼낸다. 꺼낸 타이머는 해제된다.
+ *
+ * - 만료 순서는 시각 순이며 같은 ms 안에서는 정해지지 않는다.
+ * - out_expiry 가 가득 차면(*out_count == capacity) 남은 만료분은 버리지 않고 남겨 두므로 같은 now_ms 로 다시 호출한다.
+ * - now_ms 가 휠의 현재 시각보다 작으면 시각을 되돌리지 않는다.
+ *
+ * @param[in]  wheel 휠
+ * @param[in]  now_ms 현재 시각(ms). 0이면 rfid_timer_wheel_now_ms()
+ * @param[out] out_expiry 만료 버퍼
+ * @param[in]  capacity out_expiry 용량(> 0)
+ * @param[out] out_count 꺼낸 만료 수
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_timer_wheel_advance(IN_ rfid_timer_wheel_t *wheel
+                                     , IN_ const uint64_t now_ms
+                                     , OUT_ rfid_timer_expiry_t *out_expiry
+                                     , IN_ const int capacity
+                                     , OUT_ int *out_count);
+
+/**
+ * @brief 휠 상태를 조회한다.
+ *
+ * @param[in]  wheel 휠
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류
+ */
+RFID_RESULT rfid_timer_wheel_get_stats(IN_ const rfid_timer_wheel_t *wheel, OUT_ rfid_timer_wheel_stat_t *out_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RFID_TIMER_WHEEL_H_
@@ -0,0 +1,227 @@
+// c_lib/api/rfid_trace.c
+
+#include "rfid_api.h"
+#include "rfid_api_internal.h"
+
+#include <string.h>   // memset
+
+// 지연 추적 상수
+#define RFID_TRACE_AIR_RX                (0U)     // 구간: 모듈 read → 프레임 수신
+#define RFID_TRACE_RX_PARSE              (1U)     // 구간: 프레임 수신 → 결과 태그 변환
+#define RFID_TRACE_PARSE_DELIVER         (2U)     // 구간: 결과 태그 변환 → 하류 전달
+#define RFID_TRACE_AIR_DELIVER           (3U)     // 구간: 모듈 read → 하류 전달
+#define RFID_TRACE_DRIFT_WINDOW_US       (10000000ULL) // 시계 빠르기 추정 창(모듈 시각 us)
+#define RFID_TRACE_DRIFT_ALPHA           (0.125)  // 창마다 구한 빠르기의 평활 계수
+#define RFID_TRACE_DRIFT_MAX             (1e-3)   // 이보다 큰 빠르기(1000 ppm)는 잡음으로 보고 자른다
+
+/**
+ * @brief 히스토그램 백분위 값을 구한다(기록하는 스레드가 쓰는 중에 읽으므로 칸마다 원자적으로 읽는다).
+ *
+ * @param[in] hist 히스토그램
+ * @param[in] permille 백분위(천분율, 1000이면 최대값)
+ *
+ * @return 백분위 값(칸 상한, uint32 로 포화. 기록이 없으면 0)
+ */
+uint32_t RfidLatHistPercentile_(IN_ const uint64_t *hist, IN_ const uint32_t permille) {
+    uint64_t snap[RFID_HIST_BUCKETS];
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < RFID_HIST_BUCKETS; ++i) {
+        snap[i] = __atomic_load_n(&hist[i], __ATOMIC_RELAXED);
+        total += snap[i];
+    }
+    return RfidHistPercentile_(snap, total, permille);
+}
+
+/**
+ * @brief 지연 구간 히스토그램에 값을 더한다(여러 스레드가 조회하므로 원자적으로 더한다).
+ */
+static void TraceRecord_(IN_ rfid_trace_t *tr, IN_ const uint32_t stage, IN_ const uint64_t from_us, IN_ const uint64_t to_us) {
+    __atomic_fetch_add(&tr->hist[stage][RfidHistIndex_((to_us > from_us) ? (to_us - from_us) : 0U)], 1U, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 스트림 구간의 모듈 시계 빠르기를 추정한다.
+ *
+ * - 모듈 시각 창(RFID_TRACE_DRIFT_WINDOW_US)마다 (수신 시각 - 모듈 시각) 최솟값을 구한다. 최솟값은 링크 대기가 가장 짧은 프레임이라
+ *   두 창의 최솟값 기울기가 호스트 시계 대비 모듈 시계 빠르기다. 창마다 구한 값을 평활해 쓰고, 구간 기준도 이 최솟값에 다시 맞춘다.
+ *
+ * @param[in] tr 추적 상태
+ * @param[in] d 구간 시작부터의 모듈 시각(us)
+ * @param[in] resid 수신 시각 - 모듈 시각(us)
+ */
+static void TraceDrift_(IN_ rfid_trace_t *tr, IN_ const uint64_t d, IN_ const int64_t resid) {
+    if (0 == tr->win_valid) {
+        tr->win_start = d;
+        tr->win_min = resid;
+        tr->win_min_d = d;
+        tr->win_valid = 1;
+        return;
+    }
+    if (resid < tr->win_min) {
+        tr->win_min = resid;
+        tr->win_min_d = d;
+    }
+    if ((d - tr->win_start) < RFID_TRACE_DRIFT_WINDOW_US)
+        return;
+
+    if ((0 != tr->prev_valid) && (tr->win_min_d > tr->prev_min_d)) {
+        double slope = (double) (tr->win_min - tr->prev_min) / (double) (tr->win_min_d - tr->prev_min_d);
+        if (slope > RFID_TRACE_DRIFT_MAX)
+            slope = RFID_TRACE_DRIFT_MAX;
+        else if (slope < -RFID_TRACE_DRIFT_MAX)
+            slope = -RFID_TRACE_DRIFT_MAX;
+        tr->drift += (slope - tr->drift) * RFID_TRACE_DRIFT_ALPHA;
+        __atomic_store_n(&tr->drift_ppb, (int64_t) (tr->drift * 1e9), __ATOMIC_RELAXED);
+    }
+    // 하한 기준은 당기기만 하므로 창마다 이 창의 최솟값에 다시 맞춘다(빠르기 보정 전 어긋남이 남지 않게).
+    tr->epoch_us = (uint64_t) (tr->win_min - (int64_t) ((double) tr->win_min_d * tr->drift));
+    tr->prev_min = tr->win_min;
+    tr->prev_min_d = tr->win_min_d;
+    tr->prev_valid = 1;
+    tr->win_valid = 0;
+}
+
+/**
+ * @brief 모듈 태그 시각(dspMicros, search 시작부터의 us)을 호스트 단조 시각으로 옮긴다.
+ *
+ * - 새 search 명령을 보낸 뒤 첫 태그면 송신 시각을 모듈 시각 0 으로 잡는다(동기 read, 태그 버퍼 순서는 모듈 시각 순이 아니다).
+ * - 그 밖에는(스트림) 모듈 시각이 되돌아갈 때 새 구간을 잡고, 태그는 읽힌 뒤에야 받으므로
+ *   (수신 시각 - 모듈 시각) 하한을 기준으로 삼아 빠르기 보정과 함께 계속 맞춘다.
+ * - 32비트 모듈 시각이 넘치면(약 71분) 상위 비트를 늘린다.
+ *
+ * @param[in] tr 추적 상태
+ * @param[in] dsp 모듈 시각(us)
+ * @param[in] rx_us 프레임 수신 시각(us)
+ *
+ * @return 모듈이 태그를 읽은 호스트 단조 시각(us, rx_us 이하)
+ */
+static uint64_t TraceAirUs_(IN_ rfid_trace_t *tr, IN_ const uint32_t dsp, IN_ const uint64_t rx_us) {
+    int fresh = 0;
+    if ((0U != tr->search_tx_us) && (tr->epoch_seq != tr->search_seq)) {
+        tr->epoch_seq = tr->search_seq;
+        tr->epoch_us = tr->search_tx_us;
+        tr->epoch_fixed = 1;
+        fresh = 1;
+    }
+    else if ((0 == tr->epoch_valid) || ((0 == tr->epoch_fixed) && (dsp < tr->dsp_last) && ((tr->dsp_last - dsp) < 0x80000000U))) {
+        tr->epoch_us = (rx_us > dsp) ? (rx_us - dsp) : 0U;
+        tr->epoch_fixed = 0;
+        fresh = 1;
+    }
+    else if ((0 == tr->epoch_fixed) && (dsp < tr->dsp_last)) {
+        tr->dsp_high += 0x100000000ULL;
+    }
+    if (0 != fresh) {
+        tr->epoch_valid = 1;
+        tr->dsp_high = 0U;
+        tr->win_valid = 0;
+        tr->prev_valid = 0;
+        __atomic_fetch_add(&tr->epochs, 1U, __ATOMIC_RELAXED);
+    }
+    tr->dsp_last = dsp;
+
+    const uint64_t d = tr->dsp_high + dsp;
+    const int64_t corr = (int64_t) ((double) d * tr->drift);
+    uint64_t air = (uint64_t) ((int64_t) (tr->epoch_us + d) + corr);
+    if (0 == tr->epoch_fixed) {
+        TraceDrift_(tr, d, (int64_t) rx_us - (int64_t) d);
+        // 하한을 넘은 태그가 오면 기준을 당긴다.
+        if (air > rx_us) {
+            tr->epoch_us -= (air - rx_us);
+            air = rx_us;
+        }
+    }
+    else if (air > rx_us) {
+        air = rx_us;
+    }
+    return air;
+}
+
+/**
+ * @brief 모듈 시각 기준을 버린다. 다음 태그부터 수신 하한으로 새 구간을 잡는다(스트림 시작/재연결 시).
+ */
+void RfidTraceRestart_(IN_ rfid_trace_t *tr) {
+    tr->epoch_valid = 0;
+    tr->epoch_fixed = 0;
+    tr->epoch_seq = tr->search_seq;
+}
+
+/**
+ * @brief 결과 태그에 수신/변환/모듈 read 시각을 채우고 수신 쪽 구간을 기록한다.
+ *
+ * @param[in]     tr 추적 상태
+ * @param[in]     trd SDK 태그 응답
+ * @param[in]     meta 응답에 있는 metadata
+ * @param[in,out] dst 결과 태그
+ */
+void RfidTraceTag_(IN_ rfid_trace_t *tr, IN_ const TMR_TagReadData *trd, IN_ const uint16_t meta, INOUT_ rfid_tag_t *dst) {
+    dst->parse_us = LinkNowUs_();
+    dst->rx_us = tr->rx_us;
+    if (0U != dst->rx_us)
+        TraceRecord_(tr, RFID_TRACE_RX_PARSE, dst->rx_us, dst->parse_us);
+
+    if ((0U == dst->rx_us) || (0 == (meta & TMR_TRD_METADATA_FLAG_TIMESTAMP))) {
+        __atomic_fetch_add(&tr->untimed, 1U, __ATOMIC_RELAXED);
+        return;
+    }
+    dst->air_us = TraceAirUs_(tr, trd->dspMicros, dst->rx_us);
+    TraceRecord_(tr, RFID_TRACE_AIR_RX, dst->air_us, dst->rx_us);
+}
+
+/**
+ * @brief 하류 전달 시각으로 전달 쪽 구간을 기록한다.
+ *
+ * @param[in] tr 추적 상태
+ * @param[in] tags 전달할 결과 태그
+ * @param[in] count 태그 수
+ */
+void RfidTraceDeliver_(IN_ rfid_trace_t *tr, IN_ const rfid_tag_t *tags, IN_ const int count) {
+    const uint64_t now = LinkNowUs_();
+    for (int i = 0; i < count; ++i) {
+        if (0U != tags[i].parse_us)
+            TraceRecord_(tr, RFID_TRACE_PARSE_DELIVER, tags[i].parse_us, now);
+        if (0U != tags[i].air_us)
+            TraceRecord_(tr, RFID_TRACE_AIR_DELIVER, tags[i].air_us, now);
+    }
+}
+
+/**
+ * @brief 구간 히스토그램을 조회용 분포로 옮긴다.
+ */
+static void TraceDist_(IN_ const uint64_t *hist, OUT_ rfid_latency_dist_t *out) {
+    out->count = 0U;
+    for (uint32_t i = 0; i < RFID_HIST_BUCKETS; ++i)
+        out->count += __atomic_load_n(&hist[i], __ATOMIC_RELAXED);
+    out->p50_us = RfidLatHistPercentile_(hist, 500U);
+    out->p99_us = RfidLatHistPercentile_(hist, 990U);
+    out->p999_us = RfidLatHistPercentile_(hist, 999U);
+    out->max_us = RfidLatHistPercentile_(hist, 1000U);
+}
+
+/**
+ * @brief 태그 지연 구간 분포를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stat 결과
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_get_latency_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_latency_stat_t *out_stat) {
+    if ((NULL == ctx) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    memset(out_stat, 0, sizeof(*out_stat));
+    const rfid_trace_t *tr = &ctx->trace;
+    TraceDist_(tr->hist[RFID_TRACE_AIR_RX], &out_stat->air_to_rx);
+    TraceDist_(tr->hist[RFID_TRACE_RX_PARSE], &out_stat->rx_to_parse);
+    TraceDist_(tr->hist[RFID_TRACE_PARSE_DELIVER], &out_stat->parse_to_deliver);
+    TraceDist_(tr->hist[RFID_TRACE_AIR_DELIVER], &out_stat->air_to_deliver);
+    out_stat->untimed = __atomic_load_n(&tr->untimed, __ATOMIC_RELAXED);
+    out_stat->epochs = __atomic_load_n(&tr->epochs, __ATOMIC_RELAXED);
+    out_stat->drift_ppm = (double) __atomic_load_n(&tr->drift_ppb, __ATOMIC_RELAXED) / 1000.0;
+    return RFID_RESULT_OK;
+}
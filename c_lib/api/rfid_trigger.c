@@ -0,0 +1,472 @@
+// c_lib/api/rfid_trigger.c
+
+#include "rfid_api.h"
+#include "rfid_api_internal.h"
+
+#include <pthread.h>  // pthread_create, pthread_join
+#include <stdlib.h>   // calloc, free
+#include <string.h>   // memcpy, memset
+
+// trigger read 상수
+#define RFID_TRIG_DEFAULT_DEBOUNCE_MS    (10U)
+#define RFID_TRIG_DEFAULT_POLL_MS        (5U)
+#define RFID_TRIG_DEFAULT_READ_MS        (50U)
+#define RFID_TRIG_DEFAULT_BOTH_HOLD_MS   (1000U)
+#define RFID_TRIG_DEFAULT_CAPACITY       (256U)
+#define RFID_TRIG_GPI_MAX                (16U)    // GPI 조회 1회로 받는 입력 핀 수 상한
+
+/**
+ * @brief GPI trigger read 상태. trigger 스레드가 GPI 를 조회하고 조건을 만족하는 동안 read 사이클을 돈다.
+ *
+ * @param ctx        소유 컨텍스트(trigger 스레드 인자. ctx->trigger 는 stop 중 먼저 NULL 이 된다)
+ * @param params     시작 파라미터(pins/antennas 는 아래 복사본을 가리킨다)
+ * @param pins       감시 핀 번호 복사본
+ * @param antennas   read plan 안테나 복사본
+ * @param thread     trigger 스레드
+ * @param tags       read 사이클 결과 버퍼(tag_capacity 개)
+ * @param mask       감시 핀 bit 마스크(bit i: pins[i])
+ * @param stable     debounce 된 핀 값
+ * @param pending    마지막으로 조회한 핀 값
+ * @param pending_us 핀이 pending 값이 된 단조 시각(us)
+ * @param active     1이면 읽는 중
+ * @param session_t0 이번 read 를 시작한 trigger 의 단조 시각(us)
+ * @param release_us 조건이 풀려 있어도 이 시각까지는 읽는다(us)
+ * @param start_wait 1이면 이번 read 의 첫 사이클 시작 전
+ * @param tag_wait   1이면 이번 read 의 첫 태그 전달 전
+ * @param session_tags 이번 read 로 전달한 태그 수
+ * @param start_hist trigger → 첫 사이클 시작 지연 히스토그램(us)
+ * @param tag_hist   trigger → 첫 태그 전달 지연 히스토그램(us)
+ * @param stat       상태 카운터(지연 백분위는 조회 시 계산)
+ */
+struct rfid_trigger {
+    rfid_ctx_t *ctx;
+    rfid_trigger_params_t params;
+    int pins[RFID_TRIGGER_PIN_MAX];
+    int antennas[RFID_ANTENNA_MAX];
+    pthread_t thread;
+    rfid_tag_t *tags;
+    uint32_t mask;
+    uint32_t stable;
+    uint32_t pending;
+    uint64_t pending_us[RFID_TRIGGER_PIN_MAX];
+    int active;
+    uint64_t session_t0;
+    uint64_t release_us;
+    int start_wait;
+    int tag_wait;
+    uint64_t session_tags;
+    uint64_t start_hist[RFID_HIST_BUCKETS];
+    uint64_t tag_hist[RFID_HIST_BUCKETS];
+    rfid_trigger_stat_t stat;
+};
+
+/**
+ * @brief 모듈 GPI 입력 값을 조회해 감시 핀 bit 로 옮긴다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  t trigger 상태
+ * @param[out] out_high high 인 감시 핀 bit
+ * @param[out] out_found 입력 목록에 있던 감시 핀 bit(출력으로 설정된 핀은 빠진다)
+ *
+ * @return TMR 상태
+ */
+static TMR_Status TrigSample_(IN_ rfid_ctx_t *ctx, IN_ const rfid_trigger_t *t, OUT_ uint32_t *out_high, OUT_ uint32_t *out_found) {
+    TMR_GpioPin gpi[RFID_TRIG_GPI_MAX];
+    uint8_t n = (uint8_t) RFID_TRIG_GPI_MAX;
+    *out_high = 0U;
+    *out_found = 0U;
+
+    const TMR_Status st = TMR_gpiGet(&ctx->reader, &n, gpi);
+    if (TMR_SUCCESS != st)
+        return st;
+
+    for (int i = 0; i < t->params.pin_count; ++i) {
+        for (uint8_t j = 0; j < n; ++j) {
+            if ((int) gpi[j].id != t->pins[i])
+                continue;
+            *out_found |= (1U << i);
+            if (gpi[j].high)
+                *out_high |= (1U << i);
+            break;
+        }
+    }
+    return TMR_SUCCESS;
+}
+
+/**
+ * @brief 시작 조건을 만족한 핀 변화를 반영한다(읽는 중이 아니면 read 를 시작한다).
+ *
+ * @param[in] t trigger 상태
+ * @param[in] t0_us 새 핀 값을 처음 본 단조 시각(us)
+ * @param[in] now_us 현재 단조 시각(us)
+ */
+static void TrigFire_(IN_ rfid_trigger_t *t, IN_ const uint64_t t0_us, IN_ const uint64_t now_us) {
+    AutoAdd_(&t->stat.triggers, 1U);
+    const uint64_t release = now_us + ((uint64_t) t->params.hold_ms * 1000U);
+    if (release > t->release_us)
+        t->release_us = release;
+    if (0 != t->active)
+        return;
+
+    t->active = 1;
+    t->session_t0 = t0_us;
+    t->start_wait = 1;
+    t->tag_wait = 1;
+    t->session_tags = 0U;
+    AutoAdd_(&t->stat.sessions, 1U);
+    __atomic_store_n(&t->stat.active, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 조회한 핀 값을 debounce 하고 확정된 변화가 시작 조건이면 read 를 시작한다.
+ *
+ * - 핀 값이 바뀐 뒤 debounce_ms 동안 같은 값이 조회되어야 변화로 인정한다.
+ * - 인정 전에 되돌아간 변화는 bounces 로 집계한다.
+ */
+static void TrigDebounce_(IN_ rfid_trigger_t *t, IN_ const uint32_t high, IN_ const uint64_t now_us) {
+    const uint64_t debounce_us = (uint64_t) t->params.debounce_ms * 1000U;
+    for (int i = 0; i < t->params.pin_count; ++i) {
+        const uint32_t bit = 1U << i;
+        if ((high & bit) != (t->pending & bit)) {
+            if ((t->pending & bit) != (t->stable & bit))
+                AutoAdd_(&t->stat.bounces, 1U);
+            t->pending = (t->pending & ~bit) | (high & bit);
+            t->pending_us[i] = now_us;
+        }
+        if (((t->pending & bit) == (t->stable & bit)) || ((now_us - t->pending_us[i]) < debounce_us))
+            continue;
+
+        t->stable = (t->stable & ~bit) | (t->pending & bit);
+        const int rising = (0U != (t->stable & bit)) ? 1 : 0;
+        if ((RFID_TRIGGER_EDGE_BOTH == t->params.edge)
+            || ((RFID_TRIGGER_EDGE_RISING == t->params.edge) && (0 != rising))
+            || ((RFID_TRIGGER_EDGE_FALLING == t->params.edge) && (0 == rising)))
+            TrigFire_(t, t->pending_us[i], now_us);
+    }
+    __atomic_store_n(&t->stat.gpi_state, t->stable, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 조건이 풀린 뒤 hold_ms 가 지났거나 max_ms 를 넘긴 read 를 끝낸다.
+ * @note RISING/FALLING 은 감시 핀 중 하나라도 시작 쪽 값에 머무는 동안 조건이 유지된다. BOTH 는 변화 뒤 hold_ms 만 읽는다.
+ */
+static void TrigUpdate_(IN_ rfid_trigger_t *t, IN_ const uint64_t now_us) {
+    if (0 == t->active)
+        return;
+
+    int asserted = 0;
+    if (RFID_TRIGGER_EDGE_RISING == t->params.edge)
+        asserted = (0U != (t->stable & t->mask)) ? 1 : 0;
+    else if (RFID_TRIGGER_EDGE_FALLING == t->params.edge)
+        asserted = (0U != (~t->stable & t->mask)) ? 1 : 0;
+    if (0 != asserted)
+        t->release_us = now_us + ((uint64_t) t->params.hold_ms * 1000U);
+
+    const int expired = ((t->params.max_ms > 0U) && ((now_us - t->session_t0) >= ((uint64_t) t->params.max_ms * 1000U))) ? 1 : 0;
+    if ((0 == expired) && ((0 != asserted) || (now_us < t->release_us)))
+        return;
+
+    t->active = 0;
+    t->release_us = 0U;
+    if (0U == t->session_tags)
+        AutoAdd_(&t->stat.empty_sessions, 1U);
+    __atomic_store_n(&t->stat.active, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief read 사이클을 1회 돌고 결과를 콜백에 넘긴다(하류 전달은 ReadCycle_ 가 한다). 첫 사이클/첫 태그 지연을 기록한다.
+ */
+static void TrigCycle_(IN_ rfid_ctx_t *ctx, IN_ rfid_trigger_t *t) {
+    if (0 != t->start_wait) {
+        const uint64_t now = LinkNowUs_();
+        AutoAdd_(&t->start_hist[RfidHistIndex_((now > t->session_t0) ? (now - t->session_t0) : 0U)], 1U);
+        t->start_wait = 0;
+    }
+
+    int n = 0;
+    uint32_t st = TMR_SUCCESS;
+    StateLock_(ctx);
+    if (0U != __atomic_load_n(&ctx->trig_stop, __ATOMIC_ACQUIRE)) {
+        StateUnlock_(ctx);
+        return;
+    }
+    const RFID_RESULT ret = RfidReadCycle_(ctx
+                                       , t->params.antennas
+                                       , t->params.antenna_count
+                                       , (int) t->params.read_ms
+                                       , t->tags
+                                       , (int) t->params.tag_capacity
+                                       , &n
+                                       , &st
+                                       , NULL);
+    StateUnlock_(ctx);
+    AutoAdd_(&t->stat.cycles, 1U);
+    if (RFID_RESULT_OK != ret) {
+        AutoAdd_(&t->stat.read_errors, 1U);
+        __atomic_store_n(&t->stat.last_status, st, __ATOMIC_RELAXED);
+        // 링크 오류가 이어져도 GPI 조회 간격보다 빠르게 돌지 않는다.
+        AutoSleep_(&ctx->trig_stop, t->params.poll_ms);
+        return;
+    }
+    if (n <= 0)
+        return;
+
+    if (0 != t->tag_wait) {
+        const uint64_t now = LinkNowUs_();
+        AutoAdd_(&t->tag_hist[RfidHistIndex_((now > t->session_t0) ? (now - t->session_t0) : 0U)], 1U);
+        t->tag_wait = 0;
+    }
+    t->session_tags += (uint64_t) n;
+    AutoAdd_(&t->stat.tags, (uint64_t) n);
+    if (NULL != t->params.on_tags)
+        t->params.on_tags(t->params.user, t->tags, n);
+}
+
+/**
+ * @brief trigger 스레드. GPI 를 조회해 debounce 하고, 조건을 만족하는 동안 read 사이클을 돈다.
+ * @note read 사이클 사이에도 GPI 를 조회하므로 조건이 풀린 뒤 최대 read_ms + hold_ms 안에 멈춘다.
+ */
+static void* TrigThread_(IN_ void *arg) {
+    rfid_trigger_t *t = (rfid_trigger_t *) arg;
+    rfid_ctx_t *ctx = t->ctx;
+
+    while (0U == __atomic_load_n(&ctx->trig_stop, __ATOMIC_ACQUIRE)) {
+        uint32_t high = 0U;
+        uint32_t found = 0U;
+        StateLock_(ctx);
+        // 잠금을 기다리는 동안 stop 이 게시됐으면 GPI 조회/read 사이클을 더 하지 않고 끝낸다.
+        if (0U != __atomic_load_n(&ctx->trig_stop, __ATOMIC_ACQUIRE)) {
+            StateUnlock_(ctx);
+            break;
+        }
+        const TMR_Status st = TrigSample_(ctx, t, &high, &found);
+        StateUnlock_(ctx);
+        const uint64_t now = LinkNowUs_();
+        AutoAdd_(&t->stat.polls, 1U);
+        if (TMR_SUCCESS == st) {
+            TrigDebounce_(t, high, now);
+        }
+        else {
+            // 조회 실패 시 마지막 핀 값을 유지한다(읽는 중이면 계속 읽는다).
+            AutoAdd_(&t->stat.gpi_errors, 1U);
+            __atomic_store_n(&t->stat.last_status, (uint32_t) st, __ATOMIC_RELAXED);
+        }
+        TrigUpdate_(t, now);
+
+        if (0 != t->active)
+            TrigCycle_(ctx, t);
+        else
+            AutoSleep_(&ctx->trig_stop, t->params.poll_ms);
+    }
+    return NULL;
+}
+
+/**
+ * @brief trigger 스레드를 멈추고 trigger 상태를 해제한다(진행 중인 read 사이클은 끝까지 돈다).
+ * @note stop 요청은 잠금보다 먼저 게시해 trigger 스레드가 지금 사이클을 마치면 다시 잠그지 않게 한다.
+ *       포인터를 먼저 NULL 로 게시하므로, 잠금을 잡고 읽는 get_stats 는 해제 중인 상태를 보지 않는다.
+ */
+void RfidTrigShutdown_(IN_ rfid_ctx_t *ctx) {
+    __atomic_store_n(&ctx->trig_stop, 1U, __ATOMIC_RELEASE);
+    StateLock_(ctx);
+    rfid_trigger_t *t = ctx->trigger;
+    ctx->trigger = NULL;
+    StateUnlock_(ctx);
+    if (NULL == t)
+        return;
+
+    (void) pthread_join(t->thread, NULL);
+
+    free(t->tags);
+    free(t);
+}
+
+/**
+ * @brief GPI trigger read 를 시작한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[in]  params 시작 파라미터(핀 필요, 가중치 read plan 목록이 없으면 안테나 필요)
+ * @param[out] out_status TMR 상태 코드 출력 포인터(NULL 허용)
+ * @param[out] out_errstr 상태 문자열 출력 포인터(NULL 허용)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류(모듈 입력 핀 목록에 없는 핀 포함),
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화,
+ *         RFID_RESULT_BUSY: 이미 trigger/autonomous read 실행 중,
+ *         RFID_RESULT_READ_FAIL: GPI 조회 실패,
+ *         RFID_RESULT_INTERNAL_ERROR: 메모리 할당/스레드 생성 실패
+ */
+RFID_RESULT rfid_trigger_start(IN_ rfid_ctx_t *ctx
+                               , IN_ const rfid_trigger_params_t *params
+                               , OUT_ uint32_t *out_status
+                               , OUT_ const char **out_errstr) {
+    SetOutStatusAndErr_(out_status, out_errstr, TMR_SUCCESS);
+
+    if ((NULL == ctx) || (NULL == params)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (1 != ctx->initialized) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_NOT_INITIALIZED;
+    }
+
+    if (0 != AutoActive_(ctx)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_BUSY;
+    }
+
+    rfid_trigger_params_t p = *params;
+    if ((NULL == p.pins) || (p.pin_count <= 0) || (p.pin_count > RFID_TRIGGER_PIN_MAX)
+        || ((RFID_TRIGGER_EDGE_RISING != p.edge) && (RFID_TRIGGER_EDGE_FALLING != p.edge) && (RFID_TRIGGER_EDGE_BOTH != p.edge))
+        || ((0 == ctx->plans.count)
+            && ((NULL == p.antennas) || (p.antenna_count <= 0) || (p.antenna_count > RFID_ANTENNA_MAX)))
+        || (p.read_ms > (uint32_t) INT32_MAX) || (p.tag_capacity > (uint32_t) INT32_MAX)) {
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+
+    if (0U == p.debounce_ms)
+        p.debounce_ms = RFID_TRIG_DEFAULT_DEBOUNCE_MS;
+    if (0U == p.poll_ms)
+        p.poll_ms = RFID_TRIG_DEFAULT_POLL_MS;
+    if (0U == p.read_ms)
+        p.read_ms = RFID_TRIG_DEFAULT_READ_MS;
+    if ((0U == p.hold_ms) && (RFID_TRIGGER_EDGE_BOTH == p.edge))
+        p.hold_ms = RFID_TRIG_DEFAULT_BOTH_HOLD_MS;
+    if (0U == p.tag_capacity)
+        p.tag_capacity = RFID_TRIG_DEFAULT_CAPACITY;
+
+    rfid_trigger_t *t = (rfid_trigger_t *) calloc(1, sizeof(*t));
+    if (NULL != t)
+        t->tags = (rfid_tag_t *) calloc(p.tag_capacity, sizeof(rfid_tag_t));
+    if ((NULL == t) || (NULL == t->tags)) {
+        if (NULL != t)
+            free(t);
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    memcpy(t->pins, p.pins, (size_t) p.pin_count * sizeof(int));
+    p.pins = t->pins;
+    if (0 == ctx->plans.count) {
+        memcpy(t->antennas, p.antennas, (size_t) p.antenna_count * sizeof(int));
+        p.antennas = t->antennas;
+    }
+    else {
+        p.antennas = NULL;
+        p.antenna_count = 0;
+    }
+    t->ctx = ctx;
+    t->params = p;
+    t->mask = (1U << p.pin_count) - 1U;
+
+    // 핀이 입력으로 보이는지 확인하고 시작 값을 정한다.
+    // RISING/FALLING 은 시작 쪽 반대 값에서 출발해, 이미 조건을 만족하는 핀도 debounce 뒤 read 를 시작한다.
+    uint32_t high = 0U;
+    uint32_t found = 0U;
+    const TMR_Status st = TrigSample_(ctx, t, &high, &found);
+    SetOutStatusAndErr_(out_status, out_errstr, st);
+    if ((TMR_SUCCESS != st) || (found != t->mask)) {
+        free(t->tags);
+        free(t);
+        if (TMR_SUCCESS != st)
+            return RFID_RESULT_READ_FAIL;
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INVALID_ARG;
+    }
+    const uint64_t now = LinkNowUs_();
+    if (RFID_TRIGGER_EDGE_RISING == p.edge)
+        t->stable = 0U;
+    else if (RFID_TRIGGER_EDGE_FALLING == p.edge)
+        t->stable = t->mask;
+    else
+        t->stable = high;
+    t->pending = t->stable;
+    for (int i = 0; i < p.pin_count; ++i)
+        t->pending_us[i] = now;
+    TrigDebounce_(t, high, now);
+    t->stat.running = 1;
+
+    __atomic_store_n(&ctx->trig_stop, 0U, __ATOMIC_RELEASE);
+    StateLock_(ctx);
+    ctx->trigger = t;
+    StateUnlock_(ctx);
+    if (0 != pthread_create(&t->thread, NULL, TrigThread_, t)) {
+        StateLock_(ctx);
+        ctx->trigger = NULL;
+        StateUnlock_(ctx);
+        free(t->tags);
+        free(t);
+        SetOutStatusAndErr_(out_status, out_errstr, -1);
+        return RFID_RESULT_INTERNAL_ERROR;
+    }
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief GPI trigger read 를 멈춘다.
+ *
+ * @param[in] ctx RFID 컨텍스트
+ *
+ * @return RFID_RESULT_OK: 성공(실행 중이 아니었던 경우 포함),
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_trigger_stop(IN_ rfid_ctx_t *ctx) {
+    if (NULL == ctx)
+        return RFID_RESULT_INVALID_ARG;
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    RfidTrigShutdown_(ctx);
+    return RFID_RESULT_OK;
+}
+
+/**
+ * @brief GPI trigger read 상태를 조회한다.
+ *
+ * @param[in]  ctx RFID 컨텍스트
+ * @param[out] out_stat 결과(실행 중이 아니면 running=0 이고 나머지는 0)
+ *
+ * @return RFID_RESULT_OK: 성공,
+ *         RFID_RESULT_INVALID_ARG: 인자 오류,
+ *         RFID_RESULT_NOT_INITIALIZED: 미초기화
+ */
+RFID_RESULT rfid_trigger_get_stats(IN_ const rfid_ctx_t *ctx, OUT_ rfid_trigger_stat_t *out_stat) {
+    if ((NULL == ctx) || (NULL == out_stat))
+        return RFID_RESULT_INVALID_ARG;
+    if (1 != ctx->initialized)
+        return RFID_RESULT_NOT_INITIALIZED;
+
+    memset(out_stat, 0, sizeof(*out_stat));
+    StateLock_(ctx);
+    const rfid_trigger_t *t = ctx->trigger;
+    if (NULL == t) {
+        StateUnlock_(ctx);
+        return RFID_RESULT_OK;
+    }
+
+    out_stat->polls = __atomic_load_n(&t->stat.polls, __ATOMIC_RELAXED);
+    out_stat->gpi_errors = __atomic_load_n(&t->stat.gpi_errors, __ATOMIC_RELAXED);
+    out_stat->bounces = __atomic_load_n(&t->stat.bounces, __ATOMIC_RELAXED);
+    out_stat->triggers = __atomic_load_n(&t->stat.triggers, __ATOMIC_RELAXED);
+    out_stat->sessions = __atomic_load_n(&t->stat.sessions, __ATOMIC_RELAXED);
+    out_stat->empty_sessions = __atomic_load_n(&t->stat.empty_sessions, __ATOMIC_RELAXED);
+    out_stat->cycles = __atomic_load_n(&t->stat.cycles, __ATOMIC_RELAXED);
+    out_stat->read_errors = __atomic_load_n(&t->stat.read_errors, __ATOMIC_RELAXED);
+    out_stat->tags = __atomic_load_n(&t->stat.tags, __ATOMIC_RELAXED);
+    out_stat->last_status = __atomic_load_n(&t->stat.last_status, __ATOMIC_RELAXED);
+    out_stat->gpi_state = __atomic_load_n(&t->stat.gpi_state, __ATOMIC_RELAXED);
+    out_stat->active = __atomic_load_n(&t->stat.active, __ATOMIC_RELAXED);
+    out_stat->running = 1;
+
+    out_stat->start_p50_us = RfidLatHistPercentile_(t->start_hist, 500U);
+    out_stat->start_p99_us = RfidLatHistPercentile_(t->start_hist, 990U);
+    out_stat->start_max_us = RfidLatHistPercentile_(t->start_hist, 1000U);
+    out_stat->first_tag_p50_us = RfidLatHistPercentile_(t->tag_hist, 500U);
+    out_stat->first_tag_p99_us = RfidLatHistPercentile_(t->tag_hist, 990U);
+    out_stat->first_tag_max_us = RfidLatHistPercentile_(t->tag_hist, 1000U);
+    StateUnlock_(ctx);
+    return RFID_RESULT_OK;
+}
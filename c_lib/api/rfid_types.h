@@ -24,6 +24,48 @@ extern "C" {
 // EPC 문자열 최대 길이(여유 포함). MercuryAPI는 EPC를 bytes로도 제공하므로 래퍼에서 문자열로 변환해 저장합니다.
 #define RFID_EPC_MAX_LEN (128)
 
+// 바이너리 EPC 최대 길이(bytes). MercuryAPI TMR_MAX_EPC_BYTE_COUNT와 같다.
+#define RFID_EPC_MAX_BYTES (62)
+
+// EPC 규칙 엔진에서 일치하는 규칙이 없을 때의 rule id
+#define RFID_EPC_RULE_NONE (0xFFFFFFFFu)
+
+// EPC intern 테이블에 등록되지 않은 태그의 id
+#define RFID_EPC_ID_NONE (0xFFFFFFFFu)
+
+// GS1 EPC URN 문자열 최대 크기(NUL 포함). rfid_gs1_format_urn 출력 버퍼로 충분하다.
+#define RFID_GS1_URN_MAX (64)
+
+// 한 컨텍스트에서 사용할 수 있는 최대 안테나 수
+#define RFID_ANTENNA_MAX (16)
+
+// 리더 측 Gen2 Select 필터 최대 개수(모듈 multi-select 지원 한도)
+#define RFID_SELECT_MAX (3)
+
+// 가중치 read plan 목록 최대 개수
+#define RFID_PLAN_MAX (8)
+
+// inventory 중 태그마다 함께 읽는 메모리(embedded read) 최대 길이(words). rfid_tag_t.data 크기를 정한다.
+#define RFID_TAG_DATA_MAX_WORDS (32)
+
+// embedded read 결과 최대 길이(bytes)
+#define RFID_TAG_DATA_MAX_BYTES (RFID_TAG_DATA_MAX_WORDS * 2)
+
+// 태그 로그 레코드에 담는 EPC 최대 길이(bytes). 더 긴 EPC는 잘라서 기록하고 RFID_TAG_LOG_FLAG_TRUNCATED 를 표시한다.
+#define RFID_TAG_LOG_EPC_BYTES (36)
+
+// 태그 로그 세그먼트 파일 식별자(헤더 magic, 8바이트)
+#define RFID_TAG_LOG_MAGIC "RFIDTLG1"
+
+// 태그 로그 세그먼트 형식 버전
+#define RFID_TAG_LOG_VERSION (1)
+
+// 태그 로그 레코드 flags: EPC가 RFID_TAG_LOG_EPC_BYTES 보다 길어 잘림
+#define RFID_TAG_LOG_FLAG_TRUNCATED (0x01)
+
+// 태그 존재 감지 엔진의 최대 zone 수(기본 zone 제외)
+#define RFID_PRESENCE_ZONE_MAX (16)
+
 /**
  * @brief RFID API 공통 결과 코드
  */
@@ -36,7 +78,9 @@ typedef enum RFID_RESULT {
     RFID_RESULT_REGION_FAIL, // region 설정/조회 실패
     RFID_RESULT_PLAN_FAIL, // read plan 설정 실패
     RFID_RESULT_READ_FAIL, // read 수행 실패
-    RFID_RESULT_INTERNAL_ERROR // 그 외 내부 오류
+    RFID_RESULT_INTERNAL_ERROR, // 그 외 내부 오류
+    RFID_RESULT_WRITE_FAIL, // 태그 쓰기/검증/잠금 실패
+    RFID_RESULT_BUSY // autonomous/trigger read 실행 중이라 리더 명령을 보낼 수 없음
 } RFID_RESULT;
 
 
@@ -210,6 +254,180 @@ typedef enum RFID_REGION {
     RFID_REGION_EU // EU
 } RFID_REGION;
 
+/**
+ * @brief 안테나별 적응형 dwell 스케줄러 설정
+ * @note 0으로 채우면 비활성(기존처럼 모든 안테나가 read 시간을 균등 분배)
+ */
+typedef struct rfid_dwell_params {
+    int enable; // 0이면 비활성
+    int update_cycles; // 가중치 재계산 주기(rfid_read 호출 횟수), 0 이하이면 기본값 사용
+    int min_share_pct; // 안테나당 최소 점유율(%), 0 이하이면 기본값 사용
+    int max_share_pct; // 안테나당 최대 점유율(%), 0 이하이면 기본값 사용
+} rfid_dwell_params_t;
+
+/**
+ * @brief Gen2 파라미터 튜닝 모드
+ */
+typedef enum RFID_GEN2_TUNE_MODE {
+    RFID_GEN2_TUNE_OFF = 0, // 모듈 기본값 유지(설정하지 않음)
+    RFID_GEN2_TUNE_AUTO, // 관측된 태그 모집단에 맞춰 자동 선택
+    RFID_GEN2_TUNE_MANUAL // 사용자가 지정한 값으로 고정
+} RFID_GEN2_TUNE_MODE;
+
+/**
+ * @brief Gen2 inventory target
+ */
+typedef enum RFID_GEN2_TARGET {
+    RFID_GEN2_TARGET_A = 0, // A 상태 태그만
+    RFID_GEN2_TARGET_B, // B 상태 태그만
+    RFID_GEN2_TARGET_AB, // A -> B 번갈아(대규모 모집단용 A/B flipping)
+    RFID_GEN2_TARGET_BA // B -> A 번갈아
+} RFID_GEN2_TARGET;
+
+/**
+ * @brief Gen2 링크 프로파일(BLF / Tari / 태그 인코딩 묶음)
+ */
+typedef enum RFID_GEN2_LINK_PROFILE {
+    RFID_GEN2_LINK_KEEP = 0, // 모듈 설정 유지
+    RFID_GEN2_LINK_HIGH_SPEED, // BLF 640kHz, FM0, Tari 6.25us (소수 태그, 간섭 적은 환경)
+    RFID_GEN2_LINK_BALANCED, // BLF 250kHz, Miller M4, Tari 25us
+    RFID_GEN2_LINK_DENSE // BLF 250kHz, Miller M8, Tari 25us (대량 태그, 다수 리더 환경)
+} RFID_GEN2_LINK_PROFILE;
+
+/**
+ * @brief Gen2 inventory 파라미터 묶음
+ */
+typedef struct rfid_gen2_settings {
+    int q; // 0..15 이면 static Q, -1 이면 dynamic Q
+    int session; // 0..3 (S0..S3)
+    RFID_GEN2_TARGET target; // inventory target
+    RFID_GEN2_LINK_PROFILE link; // 링크 프로파일
+} rfid_gen2_settings_t;
+
+/**
+ * @brief Gen2 튜닝 설정
+ * @note 0으로 채우면 비활성(모듈 기본값 유지)
+ */
+typedef struct rfid_gen2_tune_params {
+    RFID_GEN2_TUNE_MODE mode; // 튜닝 모드
+    int eval_cycles; // AUTO 재평가 주기(rfid_read 호출 횟수), 0 이하이면 기본값 사용
+    rfid_gen2_settings_t manual; // MANUAL 모드에서 고정할 값
+} rfid_gen2_tune_params_t;
+
+/**
+ * @brief 안테나별 read power 자동 제어 목표
+ */
+typedef enum RFID_POWER_CTRL_MODE {
+    RFID_POWER_CTRL_OFF = 0, // 자동 제어 안 함(고정 전력)
+    RFID_POWER_CTRL_READ_RATE, // 안테나별 read rate(reads/s)를 목표값에 맞춘다
+    RFID_POWER_CTRL_RSSI_BAND // 안테나별 평균 RSSI를 [low, high] 구간에 맞춘다
+} RFID_POWER_CTRL_MODE;
+
+/**
+ * @brief 다른 구역(zone)에 속한 것으로 알려진 태그
+ * @note 이 태그가 home_antenna 가 아닌 안테나에서 읽히면 해당 안테나의 전력이 과하다고 판단한다.
+ */
+typedef struct rfid_foreign_tag {
+    const char *epc; // EPC hex 문자열
+    int home_antenna; // 이 태그가 읽혀야 하는 안테나 번호, 0이면 이 리더의 어느 안테나에도 속하지 않음
+} rfid_foreign_tag_t;
+
+/**
+ * @brief 안테나별 read power 폐루프 제어 설정
+ * @note 0으로 채우면 비활성
+ */
+typedef struct rfid_power_ctrl_params {
+    RFID_POWER_CTRL_MODE mode; // 제어 목표
+    int min_cdbm; // 하한(cdBm), 0 이하이면 기본값 사용
+    int max_cdbm; // 상한(cdBm), 0 이하이면 기본값 사용
+    int step_cdbm; // 1회 최대 조정 폭(cdBm), 0 이하이면 기본값 사용
+    int update_cycles; // 조정 주기(rfid_read 호출 횟수), 0 이하이면 기본값 사용
+    int deadband_pct; // READ_RATE 모드 불감대(목표 대비 %), 0 이하이면 기본값 사용
+    int target_reads_per_sec; // READ_RATE 모드 목표 read rate(reads/s)
+    int rssi_low_dbm; // RSSI_BAND 모드 하한(dBm)
+    int rssi_high_dbm; // RSSI_BAND 모드 상한(dBm)
+    const rfid_foreign_tag_t *foreign_tags; // 다른 구역 태그 목록(NULL 허용). init 중에만 참조한다.
+    int foreign_count; // foreign_tags 개수
+} rfid_power_ctrl_params_t;
+
+/**
+ * @brief Gen2 메모리 뱅크
+ */
+typedef enum RFID_GEN2_BANK {
+    RFID_GEN2_BANK_EPC = 0, // EPC 뱅크(CRC 16bit + PC 16bit 뒤, bit 32부터 EPC)
+    RFID_GEN2_BANK_TID, // TID 뱅크
+    RFID_GEN2_BANK_USER // USER 뱅크
+} RFID_GEN2_BANK;
+
+/**
+ * @brief 여러 Select 필터의 결합 방식
+ */
+typedef enum RFID_SELECT_COMBINE {
+    RFID_SELECT_ANY = 0, // 하나라도 일치하면 통과(OR)
+    RFID_SELECT_ALL // 모두 일치해야 통과(AND)
+} RFID_SELECT_COMBINE;
+
+/**
+ * @brief 리더 측 Gen2 Select 필터(일치하지 않는 태그는 singulation 되지 않는다)
+ */
+typedef struct rfid_select_filter {
+    RFID_GEN2_BANK bank; // 비교할 메모리 뱅크
+    uint32_t bit_pointer; // 비교 시작 비트 위치. EPC 접두사는 32(0x20)부터
+    const char *mask_hex; // 비교 값(hex 문자열, MSB first)
+    int mask_bits; // 비교 비트 수, 0 이하이면 mask_hex 길이 * 4
+    int invert; // 1이면 일치하지 않는 태그를 통과
+} rfid_select_filter_t;
+
+/**
+ * @brief 가중치 read plan 목록의 항목 1개(SDK multi read plan 의 하위 plan)
+ * @note 하위 plan 의 Select 필터가 없으면 전역 Select 필터(select_filters)를 사용한다.
+ */
+typedef struct rfid_plan_entry {
+    const int *antennas; // 안테나 목록
+    int antenna_count; // 안테나 개수(1..RFID_ANTENNA_MAX)
+    int weight; // read 시간 가중치(> 0). 하위 plan 은 전체 read 시간의 weight / 합계 만큼 수행
+    const rfid_select_filter_t *select_filters; // 이 plan 전용 Select 필터(NULL 허용)
+    int select_count; // select_filters 개수(0..RFID_SELECT_MAX)
+    RFID_SELECT_COMBINE select_combine; // select_count > 1 일 때 결합 방식
+} rfid_plan_entry_t;
+
+/**
+ * @brief inventory 중 태그마다 메모리 뱅크 일부를 함께 읽는 설정(embedded read)
+ * @note read plan 에 Gen2 ReadData tagop 을 붙이므로 태그별 추가 air round 없이 inventory 한 번으로 끝난다.
+ *       결과는 rfid_tag_t.data 에 담기며, 해당 태그에서 읽기에 실패하면 data_len 이 0이다.
+ */
+typedef struct rfid_embedded_read {
+    int enable; // 0이면 비활성
+    RFID_GEN2_BANK bank; // 읽을 메모리 뱅크(TID 는 보통 word 0부터 6 words)
+    uint32_t word_address; // 시작 위치(word)
+    int word_count; // 읽을 길이(1..RFID_TAG_DATA_MAX_WORDS words)
+} rfid_embedded_read_t;
+
+/**
+ * @brief 태그 응답에 포함할 metadata(비트 조합). rfid_tag_t 의 해당 필드에 대응한다.
+ * @note 요청하지 않은 필드는 rfid_tag_t 에서 기본값으로 채워진다
+ *       (readcnt: 1, rssi/antenna: 0, ts: 해당 read 사이클 시작 시각).
+ */
+typedef enum RFID_TAG_META {
+    RFID_TAG_META_DEFAULT   = 0x00, // SDK 기본값(모든 metadata) 유지
+    RFID_TAG_META_READCOUNT = 0x01, // rfid_tag_t.readcnt
+    RFID_TAG_META_RSSI      = 0x02, // rfid_tag_t.rssi
+    RFID_TAG_META_ANTENNA   = 0x04, // rfid_tag_t.antenna
+    RFID_TAG_META_TIMESTAMP = 0x08, // rfid_tag_t.ts (태그별 모듈 시각)
+    RFID_TAG_META_ALL       = 0x0F  // 래퍼가 사용하는 필드 전부(SDK 전용 필드는 제외)
+} RFID_TAG_META;
+
+/**
+ * @brief 시리얼 링크 baud 자동 협상 설정
+ * @note 0으로 채우면 비활성(SDK가 probe한 baud 그대로 사용). TCP 등 baud 개념이 없는 transport에서는 무시된다.
+ */
+typedef struct rfid_baud_params {
+    int enable; // 0이면 비활성
+    uint32_t max_rate; // 시도할 최대 baud, 0이면 지원 최대(921600)
+    int probe_count; // baud 1단계 검증에 쓰는 version 왕복 횟수, 0 이하이면 기본값 사용
+    int fallback_errors; // 연속 통신 오류가 이 횟수에 도달하면 한 단계 낮춘다, 0 이하이면 기본값 사용
+} rfid_baud_params_t;
+
 /**
  * @brief init()에 필요한 파라미터 묶음
  */
@@ -221,6 +439,18 @@ typedef struct rfid_init_params {
     int antenna_count; // 안테나 개수
     int plan_timeout_ms; // read plan timeout(ms), 필요 시 0 허용
     int write_power_cdbm; // 송신 전력(cdBm), 필요 시 0 허용
+    rfid_dwell_params_t dwell; // 적응형 dwell 스케줄러(0이면 비활성)
+    rfid_gen2_tune_params_t gen2; // Gen2 Q/session/target/링크 튜닝(0이면 비활성)
+    const int *antenna_power_cdbm; // 안테나별 read power(cdBm), antennas와 같은 길이. NULL이면 write_power_cdbm 공통 적용
+    rfid_power_ctrl_params_t power_ctrl; // 안테나별 read power 폐루프 제어(0이면 비활성)
+    const rfid_select_filter_t *select_filters; // 리더 측 Select 필터(NULL 허용). init 중에만 참조한다.
+    int select_count; // select_filters 개수(0..RFID_SELECT_MAX)
+    RFID_SELECT_COMBINE select_combine; // select_count > 1 일 때 결합 방식
+    rfid_baud_params_t baud; // 시리얼 baud 자동 협상(0이면 비활성)
+    uint32_t tag_metadata; // 태그 응답 metadata(RFID_TAG_META_* 조합), 0이면 SDK 기본값(전체)
+    const rfid_plan_entry_t *plans; // 가중치 read plan 목록(NULL 허용). 지정하면 antennas 대신 사용하며 init 중에만 참조한다.
+    int plan_count; // plans 개수(0..RFID_PLAN_MAX)
+    rfid_embedded_read_t embedded_read; // 태그별 메모리 embedded read(0이면 비활성)
 } rfid_init_params_t;
 
 /**
@@ -232,8 +462,729 @@ typedef struct rfid_tag {
     uint32_t readcnt; // 읽힌 횟수(ReadCount)
     int antenna; // 수신 안테나 번호
     uint64_t ts; // 타임스탬프(ms/us 정책은 구현에서 정의)
+    uint8_t epc_bytes[RFID_EPC_MAX_BYTES]; // 바이너리 EPC(MSB first)
+    uint32_t epc_len; // epc_bytes 유효 바이트 수
+    uint32_t rule_id; // EPC 규칙 엔진 분류 결과(규칙 미사용/불일치 시 RFID_EPC_RULE_NONE)
+    uint8_t data[RFID_TAG_DATA_MAX_BYTES]; // embedded read 결과(MSB first)
+    uint32_t data_len; // data 유효 바이트 수(embedded read 비활성 또는 태그에서 읽기 실패 시 0)
+    uint32_t epc_id; // EPC intern id(intern 테이블 미연결 또는 용량 초과 시 RFID_EPC_ID_NONE)
+    uint64_t air_us; // 모듈이 태그를 읽은 시각을 호스트 단조 시계로 옮긴 값(us, 0이면 모름)
+    uint64_t rx_us; // 태그가 실린 응답 프레임을 받은 호스트 단조 시각(us, 시리얼 리더가 아니면 0)
+    uint64_t parse_us; // SDK 응답을 결과 태그로 옮긴 호스트 단조 시각(us)
 } rfid_tag_t;
 
+/**
+ * @brief EPC 접두사/마스크 규칙(규칙 엔진 입력)
+ */
+typedef struct rfid_epc_rule {
+    const char *value_hex; // 비교 값(hex, EPC 첫 비트부터 MSB first)
+    const char *mask_hex; // 비교 마스크(hex, 1인 비트만 비교). NULL이면 bit_length 만큼 접두사 비교
+    int bit_length; // 비교 비트 수, 0 이하이면 value_hex 길이 * 4
+    uint32_t rule_id; // 일치 시 반환할 id(RFID_EPC_RULE_NONE 사용 불가)
+} rfid_epc_rule_t;
+
+/**
+ * @brief 안테나별 dwell 스케줄러 상태(통계 조회용)
+ */
+typedef struct rfid_dwell_stat {
+    int antenna; // 안테나 번호
+    int share_permille; // 현재 read 시간 점유율(‰)
+    uint32_t new_tags; // 직전 평가 구간에서 새로 발견한 태그 수
+    uint32_t dwell_ms; // 직전 평가 구간 누적 dwell 시간(ms)
+    double yield_per_sec; // 평활화된 신규 태그 발견율(tags/s)
+} rfid_dwell_stat_t;
+
+/**
+ * @brief 안테나별 read power 제어 상태(통계 조회용)
+ */
+typedef struct rfid_power_stat {
+    int antenna; // 안테나 번호
+    int power_cdbm; // 현재 read power(cdBm)
+    double reads_per_sec; // 평활화된 read rate(reads/s)
+    double rssi_avg; // 평활화된 평균 RSSI(dBm)
+    uint32_t foreign_reads; // 누적 다른 구역 태그 read 수
+    uint32_t adjustments; // 누적 전력 조정 횟수
+    int last_step_cdbm; // 마지막 조정 폭(cdBm, 음수: 감소)
+} rfid_power_stat_t;
+
+/**
+ * @brief Gen2 튜닝 상태(조회용)
+ */
+typedef struct rfid_gen2_status {
+    RFID_GEN2_TUNE_MODE mode; // 현재 튜닝 모드
+    rfid_gen2_settings_t settings; // 현재 모듈에 적용된 값
+    double population_estimate; // 추정 태그 모집단 크기
+    double tags_per_sec; // 직전 평가 구간의 태그 처리량(tags/s)
+    uint32_t last_apply_status; // 마지막 파라미터 적용 TMR 상태 코드
+} rfid_gen2_status_t;
+
+/**
+ * @brief 시리얼 링크 상태(조회용)
+ */
+typedef struct rfid_link_stat {
+    uint32_t baud_rate; // 현재 baud(baud 개념이 없는 transport이면 0)
+    uint32_t connect_rate; // 연결 시 SDK가 probe한 baud
+    uint32_t verified_max_rate; // 검증을 통과한 최고 baud
+    double probe_rtt_us; // 현재 baud에서 측정한 version 왕복 평균 시간(us)
+    uint64_t tx_bytes; // 누적 송신 바이트
+    uint64_t rx_bytes; // 누적 수신 바이트
+    double bytes_per_sec; // 평활화된 rfid_read() 구간 링크 처리량(송신+수신, bytes/s)
+    double utilization_pct; // bytes_per_sec 를 현재 baud 용량(10 bit/byte) 대비 백분율로 환산한 값
+    uint32_t comm_errors; // 누적 rfid_read() 통신 오류 수
+    uint32_t fallbacks; // 런타임 baud 하향 횟수
+} rfid_link_stat_t;
+
+/**
+ * @brief 안테나별 read 카운터(조회용)
+ */
+typedef struct rfid_antenna_counters {
+    int antenna; // 안테나 번호(0: metadata 에 안테나가 없는 태그)
+    uint64_t reads; // 누적 read 수(태그 readcnt 합)
+    uint64_t unique_tags; // 누적 고유 태그 수(rfid_read() 1회 안에서 중복 제거한 태그 수의 합)
+    double reads_per_sec; // 평활화된 read 사이클 기준 reads/s
+    double unique_per_sec; // 평활화된 read 사이클 기준 고유 tags/s
+} rfid_antenna_counters_t;
+
+/**
+ * @brief 리더 상태 카운터 스냅샷(조회용)
+ *
+ * - 링크 프레임/바이트/오류 카운터는 시리얼 transport 일 때만 센다(TCP 등은 0).
+ * - 누적 값은 rfid_init 이후 단조 증가한다.
+ */
+typedef struct rfid_counters {
+    uint64_t uptime_ms; // rfid_init 이후 경과 시간(ms)
+    uint64_t tx_frames; // 송신 프레임 수
+    uint64_t tx_bytes; // 송신 바이트 수
+    uint64_t rx_frames; // 수신 프레임 수(CRC 오류 프레임 포함)
+    uint64_t rx_bytes; // 수신 바이트 수
+    uint64_t crc_errors; // 수신 프레임 CRC 오류 수
+    uint64_t soh_resyncs; // SOH(0xFF) 앞의 잡음 바이트를 버리고 프레임 경계를 다시 찾은 횟수
+    uint64_t discarded_bytes; // 프레임 경계를 찾으며 버린 바이트 수
+    uint64_t timeouts; // transport 수신 timeout 수
+    uint64_t read_cycles; // rfid_read() 호출 수
+    uint64_t read_errors; // 모듈 read 실패(TMR_read/TMR_getNextTag) 수
+    uint64_t buffer_overflows; // 모듈 태그 버퍼 넘침(TAG_ID_BUFFER_FULL/BUFFER_OVERFLOW) 수
+    uint64_t overflow_tags; // 결과 버퍼(tag_capacity) 초과로 반환하지 못한 태그 수
+    uint32_t queue_depth; // 직전 read 사이클에서 모듈 태그 버퍼에 쌓인 태그 수
+    uint32_t queue_peak; // queue_depth 최대값
+    int antenna_count; // antennas 유효 개수(read 가 있었던 안테나만)
+    rfid_antenna_counters_t antennas[RFID_ANTENNA_MAX + 1]; // 안테나 번호 오름차순
+} rfid_counters_t;
+
+/**
+ * @brief 가중치 read plan 항목별 상태(조회용)
+ */
+typedef struct rfid_plan_stat {
+    int weight; // 현재 가중치
+    int share_permille; // read 시간 점유율(‰)
+    uint64_t tags; // 누적 태그 수(안테나/필터로 이 plan 에 귀속된 태그)
+    uint64_t airtime_ms; // 누적 추정 read 시간(ms)
+    double yield_per_sec; // tags / airtime(tags/s)
+} rfid_plan_stat_t;
+
+/**
+ * @brief 조기 종료 read(rfid_read_until) 조건
+ * @note stop_count 와 expected_epcs 를 함께 지정하면 먼저 충족된 조건에서 종료한다.
+ */
+typedef struct rfid_early_exit {
+    int stop_count; // 고유 태그 N개를 찾으면 종료(0이면 미사용)
+    const char *const *expected_epcs; // 모두 찾으면 종료할 EPC 목록(hex 문자열, NULL 허용)
+    int expected_count; // expected_epcs 개수
+    int fast_search; // 1이면 모듈 fast search 사용(발견한 태그를 다시 응답시키지 않음)
+} rfid_early_exit_t;
+
+/**
+ * @brief 조기 종료 read 종료 사유
+ */
+typedef enum RFID_EARLY_EXIT_REASON {
+    RFID_EARLY_EXIT_TIMEOUT = 0, // read_timeout_ms 안에 조건을 충족하지 못함
+    RFID_EARLY_EXIT_COUNT = 1, // stop_count 개 고유 태그 발견
+    RFID_EARLY_EXIT_EXPECTED = 2, // expected_epcs 전부 발견
+    RFID_EARLY_EXIT_CAPACITY = 3 // 결과 버퍼가 가득 참
+} RFID_EARLY_EXIT_REASON;
+
+/**
+ * @brief 조기 종료 read 결과 보고
+ */
+typedef struct rfid_early_exit_report {
+    RFID_EARLY_EXIT_REASON reason; // 종료 사유
+    uint32_t latency_us; // 호출 시작부터 종료까지 경과 시간(us)
+    uint32_t reads; // 수행한 read 사이클 수
+    int unique_tags; // 발견한 고유 태그 수
+    int expected_found; // 발견한 expected_epcs 수
+} rfid_early_exit_report_t;
+
+/**
+ * @brief Gen2 Lock 명령의 mask/action 비트(rfid_commission_job_t.lock_mask/lock_action)
+ * @note *_PERM 비트는 되돌릴 수 없다(permalock).
+ */
+typedef enum RFID_GEN2_LOCK {
+    RFID_GEN2_LOCK_USER_PERM   = 0x001, // USER 뱅크 permalock
+    RFID_GEN2_LOCK_USER        = 0x002, // USER 뱅크 쓰기 잠금
+    RFID_GEN2_LOCK_TID_PERM    = 0x004, // TID 뱅크 permalock
+    RFID_GEN2_LOCK_TID         = 0x008, // TID 뱅크 쓰기 잠금
+    RFID_GEN2_LOCK_EPC_PERM    = 0x010, // EPC 뱅크 permalock
+    RFID_GEN2_LOCK_EPC         = 0x020, // EPC 뱅크 쓰기 잠금
+    RFID_GEN2_LOCK_ACCESS_PERM = 0x040, // access password permalock
+    RFID_GEN2_LOCK_ACCESS      = 0x080, // access password 읽기/쓰기 잠금
+    RFID_GEN2_LOCK_KILL_PERM   = 0x100, // kill password permalock
+    RFID_GEN2_LOCK_KILL        = 0x200  // kill password 읽기/쓰기 잠금
+} RFID_GEN2_LOCK;
+
+/**
+ * @brief 태그 발행(commissioning) 작업 1건: 대상 태그에 EPC 를 쓰고 읽어 확인한 뒤 필요하면 잠근다.
+ */
+typedef struct rfid_commission_job {
+    const rfid_select_filter_t *target; // 대상 태그 Select 필터(NULL이면 필드에 있는 태그). 호출 중에만 참조한다.
+    const char *epc; // 쓸 EPC(hex 문자열, 4의 배수 자릿수, 최대 RFID_EPC_MAX_BYTES bytes)
+    uint16_t lock_mask; // 바꿀 lock 비트(RFID_GEN2_LOCK_* 조합, 0이면 lock 생략)
+    uint16_t lock_action; // lock_mask 중 설정할 비트(나머지 mask 비트는 해제)
+    uint32_t access_password; // 대상 태그 access password(0이면 없음)
+} rfid_commission_job_t;
+
+/**
+ * @brief 태그 발행 실행 파라미터
+ * @note 0으로 채우면 모두 기본값.
+ */
+typedef struct rfid_commission_params {
+    int antenna; // 태그 명령에 쓸 안테나(0이면 현재 설정 유지)
+    int max_attempts; // 작업당 최대 시도 수(0 이하이면 3)
+    int op_timeout_ms; // 태그 명령 1회 timeout(ms, 0 이하이면 현재 설정 유지). 호출이 끝나면 원래 값으로 되돌린다.
+} rfid_commission_params_t;
+
+/**
+ * @brief 태그 발행 작업이 멈춘 단계
+ */
+typedef enum RFID_COMMISSION_STAGE {
+    RFID_COMMISSION_DONE = 0, // 모든 단계 성공
+    RFID_COMMISSION_WRITE, // EPC 쓰기 실패(대상 태그 없음/응답 없음 포함)
+    RFID_COMMISSION_VERIFY, // 쓴 뒤 읽은 EPC 불일치
+    RFID_COMMISSION_LOCK // lock 실패
+} RFID_COMMISSION_STAGE;
+
+/**
+ * @brief 태그 발행 작업별 결과
+ */
+typedef struct rfid_commission_result {
+    RFID_RESULT result; // OK: 성공, WRITE_FAIL: 재시도 후에도 실패, INVALID_ARG: 작업 인자 오류
+    RFID_COMMISSION_STAGE stage; // 실패한 단계(성공 시 RFID_COMMISSION_DONE)
+    uint32_t status; // 마지막 태그 명령의 TMR 상태 코드
+    int attempts; // 수행한 시도 수(첫 시도 포함)
+    uint32_t latency_us; // 작업 시작부터 끝까지 경과 시간(us)
+} rfid_commission_result_t;
+
+/**
+ * @brief 태그 발행 호출 1회 요약
+ */
+typedef struct rfid_commission_stat {
+    int jobs; // 실행한 작업 수
+    int succeeded; // 성공한 작업 수
+    int failed; // 실패한 작업 수
+    uint32_t retries; // 재시도 수(모든 작업 합계)
+    uint64_t elapsed_us; // 전체 경과 시간(us)
+    uint32_t max_latency_us; // 가장 오래 걸린 작업(us)
+    double tags_per_min; // 성공한 작업 기준 처리량(tags/min)
+} rfid_commission_stat_t;
+
+/**
+ * @brief 태그 로그 열기 파라미터
+ * @note 0 이하/0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_tag_log_params {
+    const char *dir; // 세그먼트 파일 디렉터리(없으면 생성). open 중에만 참조한다.
+    const char *prefix; // 세그먼트 파일 이름 접두사(NULL이면 "tags")
+    uint32_t segment_records; // 세그먼트당 레코드 수(기본 262144 = 16 MiB)
+    uint32_t queue_records; // 기록 대기 큐 용량(레코드 수, 2의 거듭제곱으로 올림, 기본 131072)
+    uint32_t sync_interval_ms; // 주기적 msync 간격(ms, 기본 500)
+    uint32_t max_segments; // 보관할 최대 세그먼트 수(0이면 삭제하지 않음)
+} rfid_tag_log_params_t;
+
+/**
+ * @brief 태그 로그 세그먼트 파일 헤더(파일 첫 페이지, 호스트 byte order)
+ *
+ * 헤더 뒤 header_size 오프셋부터 rfid_tag_log_record_t 가 record_capacity 개 이어진다.
+ */
+typedef struct rfid_tag_log_header {
+    char magic[8]; // RFID_TAG_LOG_MAGIC
+    uint32_t version; // RFID_TAG_LOG_VERSION
+    uint32_t header_size; // 첫 레코드 오프셋(bytes)
+    uint32_t record_size; // sizeof(rfid_tag_log_record_t)
+    uint32_t record_capacity; // 세그먼트 레코드 수
+    uint64_t segment_index; // 세그먼트 번호(파일 이름과 같음)
+    uint64_t first_seq; // 첫 레코드의 seq
+    uint64_t created_ms; // 세그먼트 생성 시각(epoch ms)
+    uint64_t committed; // msync 로 영속화를 마친 레코드 수(이후 레코드는 seq 로 유효성 판단)
+} rfid_tag_log_header_t;
+
+/**
+ * @brief 태그 로그 레코드(고정 64바이트, 캐시 라인 1개)
+ */
+typedef struct rfid_tag_log_record {
+    uint64_t ts; // 태그 타임스탬프(ms, rfid_tag_t.ts)
+    uint64_t seq; // 로그 전체 일련번호(1부터). 0이면 기록되지 않은 슬롯.
+    uint16_t reader_id; // 기록한 리더 id
+    uint8_t antenna; // 안테나 번호
+    int8_t rssi; // RSSI(dBm)
+    uint8_t epc_len; // epc 유효 바이트 수
+    uint8_t flags; // RFID_TAG_LOG_FLAG_* 조합
+    uint16_t readcnt; // read count(65535 에서 포화)
+    uint32_t rule_id; // EPC 규칙 분류 결과
+    uint8_t epc[RFID_TAG_LOG_EPC_BYTES]; // 바이너리 EPC(MSB first)
+} rfid_tag_log_record_t;
+
+/**
+ * @brief 태그 로그 상태(조회용)
+ */
+typedef struct rfid_tag_log_stat {
+    uint64_t appended; // 큐에 넣은 레코드 수
+    uint64_t dropped; // 큐가 가득 차 버린 레코드 수
+    uint64_t written; // 세그먼트에 기록한 레코드 수
+    uint64_t synced; // msync 로 영속화를 마친 레코드 수
+    uint64_t lost; // 세그먼트 생성/매핑 실패로 기록하지 못한 레코드 수
+    uint64_t segment_index; // 현재 세그먼트 번호
+    uint32_t segments_opened; // 이번 open 이후 만든 세그먼트 수
+    uint32_t queue_used; // 현재 큐 사용량(레코드 수)
+    uint32_t queue_peak; // 큐 최대 사용량(레코드 수)
+    uint32_t queue_capacity; // 큐 용량(레코드 수)
+    uint32_t sync_count; // msync 횟수
+    uint32_t sync_max_us; // msync 1회 최대 소요 시간(us)
+    int last_errno; // 마지막 I/O 오류 errno(0이면 없음)
+} rfid_tag_log_stat_t;
+
+/**
+ * @brief 태그 존재 감지 zone(안테나 묶음) 설정
+ * @note 0 값은 rfid_presence_params_t 의 값을 따른다.
+ */
+typedef struct rfid_presence_zone {
+    int zone_id; // 이벤트에 기록할 zone id
+    const int *antennas; // zone 에 속한 안테나 번호 목록(다른 zone 과 겹치면 앞선 zone)
+    int antenna_count; // antennas 개수
+    uint32_t holdoff_ms; // PRESENT 이벤트 최소 간격(ms)
+    uint32_t depart_ms; // 이 시간 동안 안 읽히면 DEPART(ms)
+} rfid_presence_zone_t;
+
+/**
+ * @brief 태그 존재 감지 엔진 생성 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_presence_params {
+    uint32_t capacity; // 추적할 최대 (EPC, zone) 수(기본 262144)
+    uint32_t holdoff_ms; // zone 미지정 안테나의 PRESENT 최소 간격(ms, 기본 5000)
+    uint32_t depart_ms; // zone 미지정 안테나의 DEPART 기준 미검출 시간(ms, 기본 3000)
+    const rfid_presence_zone_t *zones; // zone 목록(NULL 허용). create 중에만 참조한다.
+    int zone_count; // zones 개수(0..RFID_PRESENCE_ZONE_MAX)
+    const char *snapshot_path; // 추적 상태 스냅샷 파일(NULL/빈 문자열이면 사용 안 함). create 중에만 참조한다.
+    uint32_t snapshot_interval_ms; // 스냅샷 주기(ms, 기본 5000)
+    uint32_t snapshot_max_age_ms; // 복원할 스냅샷의 최대 나이(ms, 기본 60000)
+} rfid_presence_params_t;
+
+/**
+ * @brief 태그 존재 이벤트 종류
+ */
+typedef enum RFID_PRESENCE_EVENT {
+    RFID_PRESENCE_ARRIVE = 1, // zone 에 처음 나타남
+    RFID_PRESENCE_PRESENT = 2, // 계속 있음(holdoff_ms 마다 최대 1회)
+    RFID_PRESENCE_DEPART = 3 // depart_ms 동안 안 읽혀 사라짐
+} RFID_PRESENCE_EVENT;
+
+/**
+ * @brief 태그 존재 이벤트(고정 크기)
+ */
+typedef struct rfid_presence_event {
+    uint64_t ts_ms; // 이벤트 시각(ARRIVE/PRESENT: 읽은 시각, DEPART: 마지막으로 읽은 시각)
+    uint64_t first_seen_ms; // zone 에 나타난 시각
+    uint32_t reads; // 직전 이벤트 이후 read 수(readcnt 합)
+    int32_t zone_id; // zone id(zone 미지정 안테나는 0)
+    uint8_t type; // RFID_PRESENCE_EVENT
+    uint8_t antenna; // 마지막으로 읽은 안테나
+    int8_t rssi; // 직전 이벤트 이후 최대 RSSI
+    uint8_t epc_len; // epc 유효 바이트 수
+    uint8_t epc[RFID_EPC_MAX_BYTES]; // 바이너리 EPC(MSB first)
+} rfid_presence_event_t;
+
+/**
+ * @brief 태그 존재 감지 엔진 상태(조회용)
+ */
+typedef struct rfid_presence_stat {
+    uint64_t reads; // 입력 태그 read 수(readcnt 합)
+    uint64_t arrivals; // ARRIVE 이벤트 수
+    uint64_t presents; // PRESENT 이벤트 수
+    uint64_t departures; // DEPART 이벤트 수
+    uint64_t deferred; // 이벤트 버퍼가 가득 차 다음 호출로 미룬 이벤트 수
+    uint64_t table_full; // 추적 용량 초과로 무시한 read 수
+    uint64_t snapshots; // 기록한 스냅샷 수
+    uint64_t snapshot_pages; // 스냅샷에 복사한 페이지 수(변경된 페이지만)
+    uint32_t restored; // 스냅샷에서 복원한 (EPC, zone) 수
+    uint32_t tracked; // 현재 추적 중인 (EPC, zone) 수
+    uint32_t capacity; // 추적 용량
+} rfid_presence_stat_t;
+
+/**
+ * @brief 타이머 id(0: 없음). 해제된 타이머의 id 는 재사용되지 않는 값으로 바뀐다.
+ */
+typedef uint64_t rfid_timer_id_t;
+
+/**
+ * @brief 만료된 타이머
+ */
+typedef struct rfid_timer_expiry {
+    rfid_timer_id_t id; // 타이머 id(만료와 함께 해제됨)
+    uint64_t user_data; // 등록 시 넘긴 값(예: 태그 인덱스/EPC 해시)
+    uint64_t deadline_ms; // 등록한 만료 시각
+} rfid_timer_expiry_t;
+
+/**
+ * @brief 타이밍 휠 상태(조회용)
+ */
+typedef struct rfid_timer_wheel_stat {
+    uint64_t now_ms; // 휠의 현재 시각(마지막 advance 시각)
+    uint64_t scheduled; // 등록 수(reschedule 포함)
+    uint64_t cancelled; // 취소 수
+    uint64_t expired; // 만료 수
+    uint64_t cascaded; // 상위 단계에서 하위 단계로 옮긴 수
+    uint64_t table_full; // 용량 초과로 실패한 등록 수
+    uint32_t active; // 현재 등록된 타이머 수
+    uint32_t capacity; // 타이머 용량
+} rfid_timer_wheel_stat_t;
+
+/**
+ * @brief 리더 간 병합 단계 생성 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_merge_params {
+    uint32_t window_ms; // 중복 제거 창(ms, 기본 1000). EPC 별 첫 read 부터 이 시간 동안의 read 를 이벤트 1개로 합친다.
+    uint32_t capacity; // 동시에 열 수 있는 창(EPC) 수(기본 65536, shard 에 고르게 나눈다)
+    uint32_t shards; // shard 수(2의 거듭제곱, 기본 64). 리더 스레드 수보다 충분히 크게 잡는다.
+} rfid_merge_params_t;
+
+/**
+ * @brief 병합 이벤트(EPC 별 창 1개, 고정 크기)
+ */
+typedef struct rfid_merge_event {
+    uint64_t first_seen_ms; // 창을 연 read 시각
+    uint64_t last_seen_ms; // 창 안의 마지막 read 시각
+    uint32_t reads; // 창 안의 read 수(모든 리더 readcnt 합)
+    uint16_t reader_id; // RSSI 가 가장 높았던 리더
+    uint8_t antenna; // RSSI 가 가장 높았던 안테나(reader_id 기준)
+    int8_t rssi; // 창 안의 최대 RSSI
+    uint8_t reader_count; // 창 안에서 이 EPC 를 읽은 리더 수
+    uint8_t epc_len; // epc 유효 바이트 수
+    uint8_t epc[RFID_EPC_MAX_BYTES]; // 바이너리 EPC(MSB first)
+} rfid_merge_event_t;
+
+/**
+ * @brief 리더 간 병합 단계 상태(조회용)
+ * @note 지연 백분위는 로그-선형 히스토그램(2배 구간당 8칸) 값이므로 최대 12.5% 오차가 있다.
+ */
+typedef struct rfid_merge_stat {
+    uint64_t reads; // 입력 태그 read 수(readcnt 합)
+    uint64_t windows; // 연 창 수
+    uint64_t events; // 내보낸 이벤트 수
+    uint64_t table_full; // 용량 초과로 버린 read 수
+    uint64_t contended; // shard 잠금을 바로 얻지 못한 횟수(경합 지표)
+    uint32_t active; // 현재 열린 창 수
+    uint32_t capacity; // 창 용량
+    uint32_t shards; // shard 수
+    uint32_t push_p50_ns; // 태그 1건 push 지연(잠금 대기 포함, ns)
+    uint32_t push_p99_ns;
+    uint32_t push_p999_ns;
+    uint32_t push_max_ns;
+    uint32_t merge_p50_us; // 병합 지연: 창이 닫힌 뒤(첫 read + window_ms) 이벤트로 꺼낼 때까지(us, 단조 시계 기준)
+    uint32_t merge_p99_us;
+    uint32_t merge_p999_us;
+    uint32_t merge_max_us;
+} rfid_merge_stat_t;
+
+/**
+ * @brief GS1 EPC 부호화 방식(EPC header 로 구분)
+ */
+typedef enum RFID_GS1_SCHEME {
+    RFID_GS1_UNKNOWN = 0, // GS1 96bit 방식이 아니거나 값이 규격 범위를 벗어남
+    RFID_GS1_SGTIN_96, // header 0x30, 상품 단위(GTIN + serial)
+    RFID_GS1_SSCC_96, // header 0x31, 물류 단위(SSCC)
+    RFID_GS1_GRAI_96, // header 0x33, 회수 자산(asset type + serial)
+    RFID_GS1_GIAI_96 // header 0x34, 개별 자산
+} RFID_GS1_SCHEME;
+
+/**
+ * @brief GS1 EPC 해석 결과(고정 크기)
+ * @note reference/serial 의 뜻은 방식마다 다르다.
+ *       SGTIN: 지시자 + 품목 참조 / serial, SSCC: 확장 자리 + serial 참조 / 0,
+ *       GRAI: 자산 유형 / serial, GIAI: 개별 자산 참조 / 0
+ */
+typedef struct rfid_gs1_record {
+    uint64_t company_prefix; // GS1 업체 코드 값
+    uint64_t reference; // 방식별 참조 값(위 참고)
+    uint64_t serial; // 방식별 serial(SGTIN/GRAI 38bit, 그 외 0)
+    uint8_t scheme; // RFID_GS1_SCHEME
+    uint8_t header; // EPC header(첫 바이트, 해석 실패해도 채움)
+    uint8_t filter; // filter 값(0..7)
+    uint8_t partition; // partition 값(0..6)
+    uint8_t company_digits; // 업체 코드 자릿수(6..12, URN 에서 앞자리 0 포함)
+    uint8_t reference_digits; // 참조 자릿수(URN 에서 앞자리 0 포함, GIAI 는 앞자리 0 없이 출력)
+} rfid_gs1_record_t;
+
+/**
+ * @brief EPC intern 테이블 생성 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_epc_intern_params {
+    uint32_t capacity; // 최대 id 수(기본 262144). shard 마다 capacity / shards 개(올림)로 나누므로 여유를 둔다. id 는 shard 안에서만 조밀하다(rfid_epc_intern.h 참고).
+    uint32_t shards; // shard 수(2의 거듭제곱, 기본 64)
+    uint32_t idle_ms; // 0이면 제거하지 않는다(가득 차면 새 EPC 실패). 0보다 크면 가득 찼을 때 이 시간 이상 조회되지 않은 id 를 재사용한다.
+} rfid_epc_intern_params_t;
+
+/**
+ * @brief EPC intern 테이블 상태(조회용)
+ */
+typedef struct rfid_epc_intern_stat {
+    uint64_t interned; // 새로 발급한 id 수(재사용 포함)
+    uint64_t evicted; // 오래 쓰이지 않아 다른 EPC 에 재사용된 id 수
+    uint64_t table_full; // 용량 초과로 id 를 주지 못한 횟수
+    uint32_t count; // 현재 등록된 EPC 수
+    uint32_t capacity; // id 용량
+    uint32_t shards; // shard 수
+} rfid_epc_intern_stat_t;
+
+/**
+ * @brief 태그 지연 구간 분포(us)
+ * @note 로그-선형 히스토그램(2배 구간당 8칸) 값이므로 최대 12.5% 오차가 있다.
+ */
+typedef struct rfid_latency_dist {
+    uint64_t count; // 기록한 태그 수
+    uint32_t p50_us;
+    uint32_t p99_us;
+    uint32_t p999_us;
+    uint32_t max_us;
+} rfid_latency_dist_t;
+
+/**
+ * @brief 태그 지연 구간 상태(조회용, 모든 시각은 호스트 단조 시계)
+ *
+ * - air: 모듈 태그 시각(dspMicros)을 호스트 시계로 옮긴 값. 동기 read 는 search 명령 송신 시각을, 스트림은
+ *   "태그는 읽힌 뒤에야 받는다" 하한(수신 시각 - 모듈 시각의 최솟값)을 기준으로 삼고 모듈 시계 빠르기를 보정한다.
+ * - rx: 응답 프레임 수신, parse: 결과 태그 변환, deliver: 하류(intern/로그/버스/병합/풀)와 콜백에 넘긴 시각.
+ * - 풀 대기(수신 → 작업 스레드가 꺼냄)는 rfid_pool_stat_t.rx_p*_us 로 본다.
+ */
+typedef struct rfid_latency_stat {
+    rfid_latency_dist_t air_to_rx; // 모듈 read → 프레임 수신(모듈 버퍼, 링크 전송)
+    rfid_latency_dist_t rx_to_parse; // 프레임 수신 → 결과 태그 변환(SDK 해석, 같은 프레임의 앞 태그 처리)
+    rfid_latency_dist_t parse_to_deliver; // 결과 태그 변환 → 하류 전달(read 사이클 끝/batch 대기)
+    rfid_latency_dist_t air_to_deliver; // 모듈 read → 하류 전달(종단 간)
+    uint64_t untimed; // air 시각을 정하지 못한 태그 수(모듈 시각 없음)
+    uint64_t epochs; // 모듈 시각 기준점을 새로 잡은 횟수(search 명령, 모듈 시각 되돌아감)
+    double drift_ppm; // 추정한 모듈 시계 빠르기(호스트 대비, ppm. +면 모듈 시계가 느리다)
+} rfid_latency_stat_t;
+
+/**
+ * @brief 후처리 풀 stage 수/이름 길이 상한
+ */
+#define RFID_POOL_STAGE_MAX (16)
+#define RFID_POOL_STAGE_NAME_MAX (32)
+
+/**
+ * @brief 후처리 풀 backpressure 정책(lane 이 가득 찼을 때, 또는 COALESCE 는 항상)
+ */
+typedef enum RFID_POOL_POLICY {
+    RFID_POOL_POLICY_DROP_NEWEST = 0, // 새 태그를 버린다(대기 중인 태그 순서 유지)
+    RFID_POOL_POLICY_DROP_OLDEST, // 가장 오래된 대기 태그를 버리고 새 태그를 넣는다(최신 상태 우선)
+    RFID_POOL_POLICY_BLOCK, // 자리가 날 때까지 block_timeout_ms 까지 기다린 뒤, 그래도 가득 차 있으면 새 태그를 버린다
+    RFID_POOL_POLICY_COALESCE // 같은 EPC 가 lane 에 대기 중이면 그 레코드에 합친다. 합칠 대상 없이 가득 차면 새 태그를 버린다
+} RFID_POOL_POLICY;
+
+/**
+ * @brief 후처리 풀 생성 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_pool_params {
+    uint32_t workers; // 작업 스레드 수(기본: 온라인 CPU 수, 최대 64)
+    uint32_t lanes; // EPC 친화 lane 수(2의 거듭제곱, 기본 64). 같은 EPC 는 항상 같은 lane 에서 순서대로 처리한다.
+    uint32_t lane_capacity; // lane 별 대기 태그 수(기본 256). memory_limit_bytes 를 주면 무시한다.
+    uint32_t batch; // stage 호출 1회에 넘기는 최대 태그 수(기본 64)
+    RFID_POOL_POLICY policy; // lane 이 가득 찼을 때의 정책(기본 DROP_NEWEST)
+    uint32_t block_timeout_ms; // BLOCK 정책의 최대 대기 시간(ms, 기본 10). read 스레드가 이 이상 멈추지 않는다.
+    uint64_t memory_limit_bytes; // 대기 태그 메모리 상한(0이면 lane_capacity 사용). lane 수로 나눠 lane_capacity 를 정한다.
+} rfid_pool_params_t;
+
+/**
+ * @brief 후처리 풀 작업 항목(태그 1건)
+ */
+typedef struct rfid_pool_item {
+    uint64_t submit_us; // 풀에 넣은 단조 시각(us, 대기 시간 기준)
+    uint16_t reader_id; // 태그를 넣은 리더 id(COALESCE 로 합친 경우 RSSI 가 가장 높았던 리더)
+    uint32_t merged; // COALESCE 정책으로 이 레코드에 합친 태그 수(readcnt 합, 최대 RSSI, 마지막 ts 로 합친다)
+    rfid_tag_t tag; // 태그(stage 가 고쳐 쓸 수 있다)
+} rfid_pool_item_t;
+
+/**
+ * @brief 후처리 풀 상태(조회용)
+ */
+typedef struct rfid_pool_stat {
+    uint64_t submitted; // 받은 태그 수(합친 태그 포함, 버린 새 태그 제외)
+    uint64_t processed; // 모든 stage 를 거친(또는 중간 stage 가 걸러낸) 레코드 수
+    uint64_t dropped; // 버린 태그 수 합(dropped_newest + dropped_oldest)
+    uint64_t dropped_newest; // lane 이 가득 차 버린 새 태그 수(DROP_NEWEST, BLOCK 시간 초과, COALESCE 대상 없음)
+    uint64_t dropped_oldest; // 새 태그에 자리를 내주고 버린 대기 태그 수(DROP_OLDEST)
+    uint64_t coalesced; // 대기 중인 레코드에 합친 태그 수(COALESCE)
+    uint64_t blocked; // 자리가 없어 기다린 submit 태그 수(BLOCK)
+    uint64_t block_timeouts; // 기다려도 자리가 나지 않아 버린 태그 수(BLOCK, dropped_newest 에 포함)
+    uint64_t block_wait_us; // 기다린 시간 합(BLOCK, us)
+    uint64_t memory_bytes; // 대기 태그 메모리(고정, lane 수 * lane 용량 * 레코드 크기)
+    uint64_t batches; // 처리한 batch 수
+    uint64_t steals; // 다른 작업 스레드의 deque 에서 가져온 lane 수
+    uint32_t rx_p50_us; // 프레임 수신(rfid_tag_t.rx_us) → 작업 스레드가 꺼낼 때까지(us, rx_us 가 있는 태그만)
+    uint32_t rx_p99_us;
+    uint32_t rx_p999_us;
+    uint32_t rx_max_us;
+    uint32_t pending; // 대기 중이거나 처리 중인 레코드 수
+    uint32_t workers; // 작업 스레드 수
+    uint32_t lanes; // lane 수
+    uint32_t lane_capacity; // lane 별 대기 레코드 수
+    uint32_t stages; // stage 수
+    RFID_POOL_POLICY policy; // backpressure 정책
+} rfid_pool_stat_t;
+
+/**
+ * @brief 후처리 풀 stage 별 상태(조회용)
+ * @note 대기 시간 백분위는 로그-선형 히스토그램(2배 구간당 8칸) 값이므로 최대 12.5% 오차가 있다.
+ */
+typedef struct rfid_pool_stage_stat {
+    char name[RFID_POOL_STAGE_NAME_MAX]; // stage 이름
+    uint64_t items_in; // stage 에 넘긴 태그 수
+    uint64_t items_out; // stage 가 남긴 태그 수(다음 stage 입력)
+    uint64_t calls; // stage 호출 수
+    uint64_t busy_us; // stage 실행 시간 합(모든 작업 스레드, us)
+    double items_per_sec; // 실행 시간 기준 처리율(items_in / busy, 작업 스레드 1개 기준)
+    uint32_t queue_p50_us; // 풀에 넣은 뒤 이 stage 가 시작할 때까지(us)
+    uint32_t queue_p99_us;
+    uint32_t queue_p999_us;
+    uint32_t queue_max_us;
+} rfid_pool_stage_stat_t;
+
+/**
+ * @brief autonomous read 시작 방식
+ */
+typedef enum RFID_AUTONOMOUS_MODE {
+    RFID_AUTONOMOUS_ARM = 0, // read plan 을 autonomous 로 표시해 모듈에 저장하고(SAVE_WITH_READPLAN, 플래시 쓰기) 스트림을 시작한다
+    RFID_AUTONOMOUS_RESUME // 모듈에 이미 저장된 설정을 다시 불러와(RESTORE) 스트림을 이어 받는다(플래시에 쓰지 않음, 호스트 재시작용)
+} RFID_AUTONOMOUS_MODE;
+
+/**
+ * @brief autonomous read 로 받은 태그 batch 를 넘겨받는 함수(수신 스레드에서 호출).
+ *
+ * @param[in] user 등록 시 넘긴 사용자 값
+ * @param[in] tags 태그 배열(받은 순서, epc_id 포함). 호출 중에만 유효하다.
+ * @param[in] count 태그 수(> 0)
+ */
+typedef void (*rfid_autonomous_fn)(void *user, const rfid_tag_t *tags, int count);
+
+/**
+ * @brief autonomous read 시작 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_autonomous_params {
+    RFID_AUTONOMOUS_MODE mode; // 시작 방식(기본 ARM)
+    const int *antennas; // ARM 의 read plan 안테나 배열(가중치 read plan 목록이 있으면 무시)
+    int antenna_count; // 안테나 개수
+    uint32_t on_time_ms; // ARM 에서 모듈 search 사이클 길이(ms, 0이면 SDK 기본 250)
+    int persist; // 1이면 stop 후에도 모듈 전원이 다시 들어오면 autonomous read 로 시작한다. 0이면 stop 이 autonomous 를 끈 설정을 저장한다.
+    uint32_t batch_max; // 하류 전달 1회 최대 태그 수(기본 64)
+    uint32_t flush_ms; // batch_max 만큼 모이지 않아도 전달하는 간격(ms, 기본 20)
+    uint32_t poll_ms; // 수신 대기 1회 시간(ms, 기본 100). stop 응답 지연의 상한이다.
+    uint32_t silence_ms; // 이 시간 동안 모듈 프레임이 없으면 재연결(ms, 0이면 사용 안 함). 태그가 없어도 사이클마다 응답하는 모듈에서만 켠다.
+    uint32_t error_limit; // 연속 수신 오류가 이 횟수에 이르면 재연결(기본 3)
+    uint32_t reconnect_ms; // 재연결 실패 후 다시 시도할 때까지 대기(ms, 기본 1000)
+    rfid_autonomous_fn on_tags; // 태그 batch 콜백(NULL 허용, 연결된 로그/버스/병합/풀 뒤에 호출)
+    void *user; // on_tags 에 넘길 사용자 값
+} rfid_autonomous_params_t;
+
+/**
+ * @brief autonomous read 상태(조회용)
+ */
+typedef struct rfid_autonomous_stat {
+    uint64_t frames; // 받은 태그 프레임 수
+    uint64_t tags; // 하류로 전달한 태그 수
+    uint64_t filtered; // 호스트 Select/EPC 규칙으로 제외한 태그 수
+    uint64_t batches; // 하류 전달 횟수
+    uint64_t rx_errors; // 수신 오류 수(수신 대기 시간 초과 제외)
+    uint64_t reconnects; // 재연결 성공 수
+    uint64_t reconnect_failures; // 재연결 실패 수
+    uint32_t last_status; // 마지막 수신/재연결 오류 TMR 상태(0이면 없음)
+    uint32_t idle_ms; // 마지막 모듈 프레임 이후 경과 시간(ms)
+    int running; // 1: 수신 스레드 실행 중
+    int streaming; // 1: 스트림 수신 중, 0: 재연결 대기 중
+} rfid_autonomous_stat_t;
+
+/**
+ * @brief trigger read 에 쓸 수 있는 GPI 핀 수 상한
+ */
+#define RFID_TRIGGER_PIN_MAX (8)
+
+/**
+ * @brief trigger read 를 시작하는 GPI 변화
+ */
+typedef enum RFID_TRIGGER_EDGE {
+    RFID_TRIGGER_EDGE_RISING = 0, // low → high 에서 시작하고 high 인 동안(그리고 hold_ms 더) 읽는다
+    RFID_TRIGGER_EDGE_FALLING, // high → low 에서 시작하고 low 인 동안(그리고 hold_ms 더) 읽는다
+    RFID_TRIGGER_EDGE_BOTH // 어느 쪽으로 바뀌어도 시작하고 마지막 변화 뒤 hold_ms 동안 읽는다
+} RFID_TRIGGER_EDGE;
+
+/**
+ * @brief trigger read 로 읽은 태그를 넘겨받는 함수(trigger 스레드에서 read 사이클마다 호출).
+ *
+ * @param[in] user 등록 시 넘긴 사용자 값
+ * @param[in] tags 태그 배열(rfid_read() 결과와 같은 순서, epc_id 포함). 호출 중에만 유효하다.
+ * @param[in] count 태그 수(> 0)
+ */
+typedef void (*rfid_trigger_fn)(void *user, const rfid_tag_t *tags, int count);
+
+/**
+ * @brief trigger read 시작 파라미터
+ * @note 0 값은 라이브러리 기본값 사용
+ */
+typedef struct rfid_trigger_params {
+    const int *pins; // 감시할 GPI 핀 번호 배열(모듈 핀 id, 하나라도 조건을 만족하면 읽는다)
+    int pin_count; // 핀 개수(1..RFID_TRIGGER_PIN_MAX)
+    RFID_TRIGGER_EDGE edge; // 시작 조건(기본 RISING)
+    uint32_t debounce_ms; // 핀 값이 이 시간 동안 유지되어야 변화로 인정(ms, 기본 10). 시작 지연에 더해진다.
+    uint32_t poll_ms; // 읽지 않는 동안 GPI 조회 간격(ms, 기본 5)
+    const int *antennas; // read plan 안테나 배열(가중치 read plan 목록이 있으면 무시)
+    int antenna_count; // 안테나 개수
+    uint32_t read_ms; // read 사이클 1회 길이(ms, 기본 50). 사이클 사이에 GPI 를 다시 조회하므로 종료 지연의 상한이다.
+    uint32_t hold_ms; // 조건이 풀린 뒤 더 읽는 시간(ms, 기본 0. BOTH 는 변화 뒤 읽는 시간이며 기본 1000)
+    uint32_t max_ms; // trigger 1회 최대 read 시간(ms, 0이면 제한 없음). 넘기면 다음 변화까지 읽지 않는다.
+    uint32_t tag_capacity; // read 사이클 1회 최대 태그 수(기본 256)
+    rfid_trigger_fn on_tags; // 태그 콜백(NULL 허용, 연결된 로그/버스/병합/풀 뒤에 호출)
+    void *user; // on_tags 에 넘길 사용자 값
+} rfid_trigger_params_t;
+
+/**
+ * @brief trigger read 상태(조회용)
+ * @note 지연 백분위는 로그-선형 히스토그램(2배 구간당 8칸) 값이므로 최대 12.5% 오차가 있다.
+ *       지연은 새 핀 값을 처음 본 GPI 조회 시각(호스트 단조 시계)부터 잰다.
+ */
+typedef struct rfid_trigger_stat {
+    uint64_t polls; // GPI 조회 수
+    uint64_t gpi_errors; // GPI 조회 실패 수
+    uint64_t bounces; // debounce_ms 안에 되돌아가 무시한 핀 변화 수
+    uint64_t triggers; // 시작 조건을 만족한 핀 변화 수(읽는 중 다시 걸린 것 포함)
+    uint64_t sessions; // read 를 시작한 횟수
+    uint64_t empty_sessions; // 태그 없이 끝난 read 횟수
+    uint64_t cycles; // read 사이클 수
+    uint64_t read_errors; // read 사이클 실패 수
+    uint64_t tags; // 하류로 전달한 태그 수
+    uint32_t last_status; // 마지막 GPI/read 오류 TMR 상태(0이면 없음)
+    uint32_t gpi_state; // debounce 된 핀 값(bit i: pins[i] 가 high)
+    uint32_t start_p50_us; // trigger → 첫 read 사이클 시작(us)
+    uint32_t start_p99_us;
+    uint32_t start_max_us;
+    uint32_t first_tag_p50_us; // trigger → 첫 태그 전달(us, 태그를 읽은 read 만 집계)
+    uint32_t first_tag_p99_us;
+    uint32_t first_tag_max_us;
+    int running; // 1: trigger 스레드 실행 중
+    int active; // 1: 지금 읽는 중
+} rfid_trigger_stat_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,162 @@
+#ifndef RFID_UTIL_INTERNAL_H_
+#define RFID_UTIL_INTERNAL_H_
+
+/*
+ * c_lib/api 모듈이 함께 쓰는 내부 도우미(설치하지 않는 헤더).
+ *
+ * - EPC 해시: FNV-1a 64 뒤에 비트 섞기. 상위 비트는 shard/lane, 하위 비트는 슬롯 선택에 쓴다.
+ * - 지연 히스토그램: 8 미만은 값 그대로, 이후 2배 구간마다 8칸(상대 오차 12.5% 이하)인 로그-선형 칸.
+ * - 선형 탐사 해시 테이블 삭제: tombstone 없이 뒤 항목을 당겨 채운다(backward shift).
+ */
+
+#include <stddef.h>   // size_t
+#include <stdint.h>
+#include <string.h>   // memcpy
+
+#include "rfid_types.h"
+
+// FNV-1a 64 상수
+#define RFID_FNV64_OFFSET   (1469598103934665603ULL)
+#define RFID_FNV64_PRIME    (1099511628211ULL)
+
+// 지연 히스토그램 상수
+#define RFID_HIST_SUB       (8U)     // 2배 구간당 칸 수
+#define RFID_HIST_MSB_MAX   (40U)    // 이보다 큰 값(us 기준 약 12일, ns 기준 약 18분 이상)은 마지막 칸에 모은다
+#define RFID_HIST_BUCKETS   (RFID_HIST_SUB * (RFID_HIST_MSB_MAX - 1U))
+
+/**
+ * @brief 바이트열의 FNV-1a 64 해시(섞기 전 값)
+ */
+static inline uint64_t RfidFnv1a_(IN_ const uint8_t *data, IN_ const uint32_t len) {
+    uint64_t h = RFID_FNV64_OFFSET;
+    for (uint32_t i = 0; i < len; ++i) {
+        h ^= (uint64_t) data[i];
+        h *= RFID_FNV64_PRIME;
+    }
+    return h;
+}
+
+/**
+ * @brief 해시 비트 섞기(murmur3 finalizer 앞 절반). 상위 비트까지 입력이 고르게 퍼지게 한다.
+ */
+static inline uint64_t RfidHashMix_(IN_ uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief EPC 해시(FNV-1a + 비트 섞기)
+ */
+static inline uint64_t RfidEpcHash_(IN_ const uint8_t *epc, IN_ const uint32_t len) {
+    return RfidHashMix_(RfidFnv1a_(epc, len));
+}
+
+/**
+ * @brief 값을 히스토그램 칸 인덱스로 바꾼다.
+ */
+static inline uint32_t RfidHistIndex_(IN_ const uint64_t v) {
+    if (v < RFID_HIST_SUB)
+        return (uint32_t) v;
+    const uint32_t msb = 63U - (uint32_t) __builtin_clzll(v);
+    if (msb > RFID_HIST_MSB_MAX)
+        return RFID_HIST_BUCKETS - 1U;
+    return ((msb - 2U) * RFID_HIST_SUB) + (uint32_t) ((v >> (msb - 3U)) & (RFID_HIST_SUB - 1U));
+}
+
+/**
+ * @brief 히스토그램 칸의 상한 값
+ */
+static inline uint64_t RfidHistUpper_(IN_ const uint32_t idx) {
+    if (idx < RFID_HIST_SUB)
+        return idx;
+    const uint32_t msb = (idx / RFID_HIST_SUB) + 2U;
+    const uint64_t sub = idx % RFID_HIST_SUB;
+    return ((RFID_HIST_SUB + sub + 1U) << (msb - 3U)) - 1U;
+}
+
+/**
+ * @brief 히스토그램에서 백분위 값을 구한다(칸 상한, uint32 로 포화).
+ *
+ * @param[in] hist 히스토그램(RFID_HIST_BUCKETS 칸, 호출자가 복사본/합계를 만든 값)
+ * @param[in] total 전체 개수
+ * @param[in] permille 백분위(천분율, 1000이면 최대값)
+ *
+ * @return 백분위 값(total 이 0이면 0)
+ */
+static inline uint32_t RfidHistPercentile_(IN_ const uint64_t *hist, IN_ const uint64_t total, IN_ const uint32_t permille) {
+    if (0U == total)
+        return 0U;
+    // rank 는 1부터. 예: total=1000, 999‰ → 999번째 값.
+    uint64_t rank = (total * permille + 999U) / 1000U;
+    if (0U == rank)
+        rank = 1U;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < RFID_HIST_BUCKETS; ++i) {
+        seen += hist[i];
+        if (seen >= rank) {
+            const uint64_t v = RfidHistUpper_(i);
+            return (v > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t) v;
+        }
+    }
+    return 0xFFFFFFFFU;
+}
+
+/**
+ * @brief 슬롯 값이 바뀔 때 부르는 콜백(스냅샷 dirty 표시 등, NULL 허용)
+ */
+typedef void (*rfid_slot_touch_fn)(void *user, const uint32_t *slot);
+
+/**
+ * @brief 선형 탐사 해시 테이블에서 항목을 지운다(backward shift, tombstone 없음).
+ *
+ * 슬롯 값은 항목 인덱스 + 1(0이면 빈 슬롯)이고, 항목의 home 슬롯은 항목 안 uint64 해시 & mask 이다.
+ *
+ * @param[in,out] slots 슬롯 배열(mask + 1 개)
+ * @param[in]     mask 슬롯 수 - 1
+ * @param[in]     entries 항목 배열
+ * @param[in]     stride 항목 크기(sizeof)
+ * @param[in]     hash_off 항목 안 해시 필드 위치(offsetof)
+ * @param[in]     idx 지울 항목 인덱스(테이블에 있어야 한다)
+ * @param[in]     touch 바뀐 슬롯마다 부를 콜백(NULL 허용)
+ * @param[in]     user touch 에 넘길 값
+ */
+static inline void RfidSlotUnindex_(INOUT_ uint32_t *slots
+                                    , IN_ const uint32_t mask
+                                    , IN_ const void *entries
+                                    , IN_ const size_t stride
+                                    , IN_ const size_t hash_off
+                                    , IN_ const uint32_t idx
+                                    , IN_ rfid_slot_touch_fn touch
+                                    , IN_ void *user) {
+    const uint8_t *base = (const uint8_t *) entries;
+    uint64_t hash;
+    memcpy(&hash, base + (size_t) idx * stride + hash_off, sizeof(hash));
+    uint32_t i = (uint32_t) hash & mask;
+    while (slots[i] != idx + 1U)
+        i = (i + 1U) & mask;
+
+    uint32_t j = i;
+    for (;;) {
+        j = (j + 1U) & mask;
+        const uint32_t v = slots[j];
+        if (0U == v)
+            break;
+        // j 의 항목이 i 자리로 옮겨도 자기 home 에서 탐사 가능한지 확인한다.
+        memcpy(&hash, base + (size_t) (v - 1U) * stride + hash_off, sizeof(hash));
+        const uint32_t home = (uint32_t) hash & mask;
+        const int movable = (i <= j) ? ((home <= i) || (home > j)) : ((home <= i) && (home > j));
+        if (0 != movable) {
+            slots[i] = v;
+            if (NULL != touch)
+                touch(user, &slots[i]);
+            i = j;
+        }
+    }
+    slots[i] = 0U;
+    if (NULL != touch)
+        touch(user, &slots[i]);
+}
+
+#endif  // RFID_UTIL_INTERNAL_H_
@@ -0,0 +1,57 @@
+/**
+ * @file rfid_test.h
+ * @brief 단위 테스트 공용 검사 매크로
+ *
+ * 리더 장치 없이 도는 모듈 단위 테스트에서 쓴다. 실패한 검사는 위치와 식을 출력하고
+ * 실패 수를 세며, RFID_TEST_RESULT() 가 그 값으로 프로세스 종료 코드를 정한다(ctest 판정).
+ */
+
+#ifndef RFID_TEST_H_
+#define RFID_TEST_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int rfid_test_failures_ = 0; /**< 누적 검사 실패 수 */
+
+/**
+ * @brief 조건을 검사하고, 실패하면 위치와 식을 출력한다(테스트는 계속 진행).
+ */
+#define RFID_CHECK(cond)                                                       \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            ++rfid_test_failures_;                                             \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief 두 정수 값이 같은지 검사하고, 다르면 두 값을 함께 출력한다.
+ */
+#define RFID_CHECK_EQ(actual, expected)                                        \
+    do {                                                                       \
+        const long long rfid_a_ = (long long) (actual);                        \
+        const long long rfid_e_ = (long long) (expected);                      \
+        if (rfid_a_ != rfid_e_) {                                              \
+            ++rfid_test_failures_;                                             \
+            fprintf(stderr, "%s:%d: check failed: %s == %s (%lld != %lld)\n",  \
+                    __FILE__, __LINE__, #actual, #expected, rfid_a_, rfid_e_); \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief 테스트 함수 1개를 실행하고 PASS/FAIL 을 출력한다.
+ */
+#define RFID_TEST_RUN(fn)                                                      \
+    do {                                                                       \
+        const int rfid_before_ = rfid_test_failures_;                          \
+        fn();                                                                  \
+        printf("[%s] %s\n", (rfid_before_ == rfid_test_failures_) ? "PASS" : "FAIL", #fn); \
+    } while (0)
+
+/**
+ * @brief main() 의 반환 값(실패가 없으면 EXIT_SUCCESS)
+ */
+#define RFID_TEST_RESULT() ((0 == rfid_test_failures_) ? EXIT_SUCCESS : EXIT_FAILURE)
+
+#endif  // RFID_TEST_H_
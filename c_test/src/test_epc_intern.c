@@ -0,0 +1,246 @@
+/**
+ * @file test_epc_intern.c
+ * @brief EPC intern 테이블(rfid_epc_intern) 단위 테스트
+ *
+ * - 같은 EPC 는 같은 id, id ↔ EPC 왕복, id 범위(shard 번호/용량)
+ * - idle_ms 가 0이면 가득 찼을 때 새 EPC 실패(table_full)
+ * - idle_ms 가 지나면 최근 조회되지 않은 id 를 새 EPC 에 재사용(CLOCK), 최근 조회된 id 는 유지
+ */
+
+#define _POSIX_C_SOURCE 200809L  // nanosleep
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "rfid_epc_intern.h"
+#include "rfid_test.h"
+
+#define TEST_EPC_COUNT  (200)   /**< 기본 동작 테스트 EPC 수 */
+#define TEST_IDLE_MS    (200U)  /**< 재사용 기준 미조회 시간(느린 환경에서도 테스트 안의 연속 호출보다 충분히 길게) */
+
+/**
+ * @brief 12 bytes EPC 를 만든다(뒤 4 bytes 가 n).
+ */
+static void MakeEpc_(IN_ const uint32_t n, OUT_ uint8_t *epc) {
+    memset(epc, 0, 12U);
+    epc[0] = 0x30;
+    epc[8] = (uint8_t) (n >> 24);
+    epc[9] = (uint8_t) (n >> 16);
+    epc[10] = (uint8_t) (n >> 8);
+    epc[11] = (uint8_t) n;
+}
+
+/**
+ * @brief 테이블을 만든다.
+ */
+static rfid_epc_intern_t* Create_(IN_ const uint32_t capacity, IN_ const uint32_t shards, IN_ const uint32_t idle_ms) {
+    rfid_epc_intern_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.capacity = capacity;
+    params.shards = shards;
+    params.idle_ms = idle_ms;
+    rfid_epc_intern_t *t = NULL;
+    RFID_CHECK_EQ(rfid_epc_intern_create(&params, &t), RFID_RESULT_OK);
+    return t;
+}
+
+/**
+ * @brief EPC n 의 id 를 얻는다.
+ */
+static uint32_t Get_(IN_ rfid_epc_intern_t *t, IN_ const uint32_t n) {
+    uint8_t epc[12];
+    MakeEpc_(n, epc);
+    uint32_t id = 0;
+    (void) rfid_epc_intern_get(t, epc, sizeof(epc), &id);
+    return id;
+}
+
+/**
+ * @brief EPC n 의 id 를 찾는다(발급하지 않음).
+ */
+static uint32_t Find_(IN_ rfid_epc_intern_t *t, IN_ const uint32_t n) {
+    uint8_t epc[12];
+    MakeEpc_(n, epc);
+    uint32_t id = 0;
+    RFID_CHECK_EQ(rfid_epc_intern_find(t, epc, sizeof(epc), &id), RFID_RESULT_OK);
+    return id;
+}
+
+/**
+ * @brief id 가 EPC n 을 가리키는지 확인한다.
+ */
+static int LookupIs_(IN_ rfid_epc_intern_t *t, IN_ const uint32_t id, IN_ const uint32_t n) {
+    uint8_t expected[12];
+    uint8_t epc[RFID_EPC_MAX_BYTES];
+    uint32_t len = 0;
+    MakeEpc_(n, expected);
+    if (RFID_RESULT_OK != rfid_epc_intern_lookup(t, id, epc, &len))
+        return 0;
+    return (sizeof(expected) == len) && (0 == memcmp(epc, expected, len));
+}
+
+/**
+ * @brief ms 만큼 잠든다.
+ */
+static void SleepMs_(IN_ const uint32_t ms) {
+    struct timespec ts;
+    ts.tv_sec = (time_t) (ms / 1000U);
+    ts.tv_nsec = (long) (ms % 1000U) * 1000000L;
+    while (0 != nanosleep(&ts, &ts)) {
+    }
+}
+
+/**
+ * @brief 발급/조회/역조회와 id 범위를 확인한다.
+ */
+static void TestInternLookup_(void) {
+    rfid_epc_intern_t *t = Create_(512U, 8U, 0U);
+    if (NULL == t)
+        return;
+
+    rfid_epc_intern_stat_t stat;
+    RFID_CHECK_EQ(rfid_epc_intern_get_stats(t, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.capacity, 512);
+    RFID_CHECK_EQ(stat.shards, 8);
+
+    static uint32_t ids[TEST_EPC_COUNT];
+    static uint8_t seen[512];
+    memset(seen, 0, sizeof(seen));
+    for (uint32_t n = 0; n < TEST_EPC_COUNT; ++n) {
+        ids[n] = Get_(t, n);
+        RFID_CHECK(ids[n] < stat.capacity);
+        if (ids[n] < stat.capacity) {
+            RFID_CHECK_EQ(seen[ids[n]], 0);
+            seen[ids[n]] = 1U;
+        }
+    }
+    for (uint32_t n = 0; n < TEST_EPC_COUNT; ++n) {
+        RFID_CHECK_EQ(Get_(t, n), ids[n]);
+        RFID_CHECK_EQ(Find_(t, n), ids[n]);
+        RFID_CHECK(LookupIs_(t, ids[n], n));
+    }
+    RFID_CHECK_EQ(Find_(t, TEST_EPC_COUNT), RFID_EPC_ID_NONE);
+
+    // 앞부분이 같아도 길이가 다르면 다른 EPC 다.
+    uint8_t epc[12];
+    MakeEpc_(0U, epc);
+    uint32_t short_id = RFID_EPC_ID_NONE;
+    RFID_CHECK_EQ(rfid_epc_intern_get(t, epc, 8U, &short_id), RFID_RESULT_OK);
+    RFID_CHECK(short_id != ids[0]);
+
+    // 태그 배열: epc_len 0 은 건너뛴다.
+    rfid_tag_t tags[3];
+    memset(tags, 0, sizeof(tags));
+    MakeEpc_(5U, tags[0].epc_bytes);
+    tags[0].epc_len = 12U;
+    MakeEpc_(TEST_EPC_COUNT + 1U, tags[2].epc_bytes);
+    tags[2].epc_len = 12U;
+    int assigned = 0;
+    RFID_CHECK_EQ(rfid_epc_intern_tags(t, tags, 3, &assigned), RFID_RESULT_OK);
+    RFID_CHECK_EQ(assigned, 2);
+    RFID_CHECK_EQ(tags[0].epc_id, ids[5]);
+    RFID_CHECK_EQ(tags[1].epc_id, RFID_EPC_ID_NONE);
+    RFID_CHECK(LookupIs_(t, tags[2].epc_id, TEST_EPC_COUNT + 1U));
+
+    RFID_CHECK_EQ(rfid_epc_intern_get_stats(t, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.interned, TEST_EPC_COUNT + 2);
+    RFID_CHECK_EQ(stat.count, TEST_EPC_COUNT + 2);
+    RFID_CHECK_EQ(stat.evicted, 0);
+
+    // 인자 오류
+    uint32_t id = 0;
+    uint32_t len = 0;
+    RFID_CHECK_EQ(rfid_epc_intern_get(t, epc, 0U, &id), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_epc_intern_get(t, epc, RFID_EPC_MAX_BYTES + 1U, &id), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(id, RFID_EPC_ID_NONE);
+    RFID_CHECK_EQ(rfid_epc_intern_lookup(t, RFID_EPC_ID_NONE, epc, &len), RFID_RESULT_INVALID_ARG);
+    rfid_epc_intern_destroy(&t);
+    RFID_CHECK(NULL == t);
+
+    rfid_epc_intern_params_t bad;
+    memset(&bad, 0, sizeof(bad));
+    bad.shards = 6U;
+    RFID_CHECK_EQ(rfid_epc_intern_create(&bad, &t), RFID_RESULT_INVALID_ARG);
+}
+
+/**
+ * @brief idle_ms 가 0이면 가득 찬 뒤 새 EPC 를 받지 않는다.
+ */
+static void TestTableFull_(void) {
+    rfid_epc_intern_t *t = Create_(4U, 1U, 0U);
+    if (NULL == t)
+        return;
+
+    for (uint32_t n = 0; n < 4U; ++n)
+        RFID_CHECK(RFID_EPC_ID_NONE != Get_(t, n));
+
+    uint8_t epc[12];
+    uint32_t id = 0;
+    MakeEpc_(4U, epc);
+    RFID_CHECK_EQ(rfid_epc_intern_get(t, epc, sizeof(epc), &id), RFID_RESULT_INTERNAL_ERROR);
+    RFID_CHECK_EQ(id, RFID_EPC_ID_NONE);
+    RFID_CHECK_EQ(Find_(t, 4U), RFID_EPC_ID_NONE);
+
+    // 등록된 EPC 는 계속 조회된다.
+    RFID_CHECK(LookupIs_(t, Get_(t, 0U), 0U));
+
+    rfid_epc_intern_stat_t stat;
+    RFID_CHECK_EQ(rfid_epc_intern_get_stats(t, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.table_full, 1);
+    RFID_CHECK_EQ(stat.count, 4);
+    rfid_epc_intern_destroy(&t);
+}
+
+/**
+ * @brief idle_ms 가 지난 id 만 재사용하고, 최근 조회된 id 는 남기는지 확인한다.
+ */
+static void TestEvictReuse_(void) {
+    rfid_epc_intern_t *t = Create_(4U, 1U, TEST_IDLE_MS);
+    if (NULL == t)
+        return;
+
+    uint32_t ids[4];
+    for (uint32_t n = 0; n < 4U; ++n)
+        ids[n] = Get_(t, n);
+
+    // 아직 idle_ms 가 지나지 않았으므로 재사용할 id 가 없다.
+    RFID_CHECK_EQ(Get_(t, 10U), RFID_EPC_ID_NONE);
+
+    SleepMs_(TEST_IDLE_MS + 50U);
+    RFID_CHECK_EQ(Get_(t, 0U), ids[0]);
+    RFID_CHECK_EQ(Get_(t, 1U), ids[1]);
+
+    // 0, 1 은 방금 조회했으므로 남고, 오래 조회되지 않은 2, 3 의 id 를 차례로 재사용한다.
+    const uint32_t id10 = Get_(t, 10U);
+    const uint32_t id11 = Get_(t, 11U);
+    RFID_CHECK(RFID_EPC_ID_NONE != id10);
+    RFID_CHECK(RFID_EPC_ID_NONE != id11);
+    RFID_CHECK(((id10 == ids[2]) && (id11 == ids[3])) || ((id10 == ids[3]) && (id11 == ids[2])));
+    RFID_CHECK_EQ(Find_(t, 2U), RFID_EPC_ID_NONE);
+    RFID_CHECK_EQ(Find_(t, 3U), RFID_EPC_ID_NONE);
+
+    // 재사용된 id 는 새 EPC 를 가리킨다(id 만으로는 구분할 수 없음).
+    RFID_CHECK(LookupIs_(t, id10, 10U));
+    RFID_CHECK(LookupIs_(t, id11, 11U));
+    RFID_CHECK_EQ(Find_(t, 0U), ids[0]);
+    RFID_CHECK_EQ(Find_(t, 1U), ids[1]);
+
+    // 모두 최근 조회됐으므로 다시 가득 찬 상태다.
+    RFID_CHECK_EQ(Get_(t, 12U), RFID_EPC_ID_NONE);
+
+    rfid_epc_intern_stat_t stat;
+    RFID_CHECK_EQ(rfid_epc_intern_get_stats(t, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.evicted, 2);
+    RFID_CHECK_EQ(stat.interned, 6);
+    RFID_CHECK_EQ(stat.table_full, 2);
+    RFID_CHECK_EQ(stat.count, 4);
+    rfid_epc_intern_destroy(&t);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestInternLookup_);
+    RFID_TEST_RUN(TestTableFull_);
+    RFID_TEST_RUN(TestEvictReuse_);
+    return RFID_TEST_RESULT();
+}
@@ -0,0 +1,287 @@
+/**
+ * @file test_epc_match.c
+ * @brief EPC 규칙 엔진(rfid_epc_match) 단위 테스트
+ *
+ * - 컴파일된 DFA 의 분류 결과가 규칙 순회(선형 탐색) 결과와 같은지
+ * - 여러 규칙이 일치할 때 가장 긴 규칙, 길이가 같으면 앞선 규칙을 고르는지
+ * - 규칙 보관소 교체 시 기존 스냅샷은 이전 규칙을, 새 스냅샷은 새 규칙을 쓰는지
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rfid_epc_match.h"
+#include "rfid_test.h"
+
+#define TEST_EPC_BYTES   (12)    /**< SGTIN-96 EPC 길이 */
+#define TEST_RULE_COUNT  (200)   /**< 무작위 규칙 수 */
+#define TEST_TAG_COUNT   (20000) /**< 무작위 태그 수 */
+
+/**
+ * @brief 선형 탐색 비교용 규칙(바이트 단위 value/mask)
+ */
+typedef struct test_rule {
+    uint8_t val[TEST_EPC_BYTES];
+    uint8_t msk[TEST_EPC_BYTES];
+    uint32_t bits;
+    uint32_t rule_id;
+} test_rule_t;
+
+static uint64_t test_rng_state_ = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief xorshift64* 난수
+ */
+static uint64_t NextRand_(void) {
+    uint64_t x = test_rng_state_;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    test_rng_state_ = x;
+    return x * 2685821657736338717ULL;
+}
+
+/**
+ * @brief 무작위 접두사 규칙을 만든다(4 ~ 64비트, 1/4 은 마스크 규칙).
+ *
+ * @param[out] out 선형 탐색용 규칙
+ * @param[out] out_val value hex 문자열(TEST_EPC_BYTES * 2 + 1 이상)
+ * @param[out] out_msk mask hex 문자열(TEST_EPC_BYTES * 2 + 1 이상)
+ * @param[out] out_rule 컴파일 입력 규칙
+ * @param[in]  rule_id 규칙 id
+ */
+static void MakeRule_(OUT_ test_rule_t *out
+                      , OUT_ char *out_val
+                      , OUT_ char *out_msk
+                      , OUT_ rfid_epc_rule_t *out_rule
+                      , IN_ const uint32_t rule_id) {
+    memset(out, 0, sizeof(*out));
+    // 짧은 접두사끼리 자주 겹치도록 첫 바이트 후보를 좁힌다.
+    out->val[0] = (uint8_t) (0x30U + (NextRand_() % 2U));
+    for (int i = 1; i < TEST_EPC_BYTES; ++i)
+        out->val[i] = (uint8_t) ((0U == (NextRand_() % 2U)) ? 0x00U : NextRand_());
+
+    out->bits = 4U + (uint32_t) (NextRand_() % 61U);
+    out->rule_id = rule_id;
+    for (uint32_t b = 0; b < out->bits; ++b)
+        out->msk[b / 8U] |= (uint8_t) (0x80U >> (b % 8U));
+
+    const int masked = (0U == (NextRand_() % 4U));
+    if (0 != masked) {
+        // 접두사 중 일부 비트를 비교에서 뺀다(첫 nibble 은 유지).
+        for (uint32_t b = 4; b < out->bits; ++b) {
+            if (0U == (NextRand_() % 5U))
+                out->msk[b / 8U] &= (uint8_t) ~(0x80U >> (b % 8U));
+        }
+    }
+    for (int i = 0; i < TEST_EPC_BYTES; ++i)
+        out->val[i] &= out->msk[i];
+
+    static const char hex[] = "0123456789ABCDEF";
+    const uint32_t nibbles = (out->bits + 3U) / 4U;
+    for (uint32_t n = 0; n < nibbles; ++n) {
+        const uint8_t v = out->val[n / 2U];
+        const uint8_t m = out->msk[n / 2U];
+        out_val[n] = hex[(0U == (n % 2U)) ? (v >> 4) : (v & 0x0FU)];
+        out_msk[n] = hex[(0U == (n % 2U)) ? (m >> 4) : (m & 0x0FU)];
+    }
+    out_val[nibbles] = '\0';
+    out_msk[nibbles] = '\0';
+
+    out_rule->value_hex = out_val;
+    out_rule->mask_hex = (0 != masked) ? out_msk : NULL;
+    out_rule->bit_length = (int) out->bits;
+    out_rule->rule_id = rule_id;
+}
+
+/**
+ * @brief 규칙 순회로 분류한다(가장 긴 규칙, 같으면 앞선 규칙).
+ */
+static uint32_t ClassifyLinear_(IN_ const test_rule_t *rules, IN_ const int count, IN_ const uint8_t *epc) {
+    uint32_t best = RFID_EPC_RULE_NONE;
+    uint32_t best_bits = 0;
+    for (int r = 0; r < count; ++r) {
+        if ((RFID_EPC_RULE_NONE != best) && (rules[r].bits <= best_bits))
+            continue;
+        int hit = 1;
+        for (int i = 0; (i < TEST_EPC_BYTES) && (0 != hit); ++i)
+            hit = ((epc[i] & rules[r].msk[i]) == rules[r].val[i]);
+        if (0 != hit) {
+            best = rules[r].rule_id;
+            best_bits = rules[r].bits;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief hex 문자열을 EPC 바이트로 바꾼다(테스트 입력 전용, 짝수 길이 가정).
+ */
+static void HexToEpc_(IN_ const char *hex, OUT_ uint8_t *out) {
+    memset(out, 0, TEST_EPC_BYTES);
+    for (size_t i = 0; (hex[i] != '\0') && (i / 2U < TEST_EPC_BYTES); ++i) {
+        const char c = hex[i];
+        const uint8_t v = (uint8_t) ((c <= '9') ? (c - '0') : (c - 'A' + 10));
+        out[i / 2U] |= (uint8_t) ((0U == (i % 2U)) ? (v << 4) : v);
+    }
+}
+
+/**
+ * @brief 무작위 규칙/태그에서 DFA 결과가 선형 탐색 결과와 같은지 확인한다.
+ */
+static void TestDfaMatchesLinear_(void) {
+    static test_rule_t ref[TEST_RULE_COUNT];
+    static char val_hex[TEST_RULE_COUNT][TEST_EPC_BYTES * 2 + 1];
+    static char msk_hex[TEST_RULE_COUNT][TEST_EPC_BYTES * 2 + 1];
+    static rfid_epc_rule_t rules[TEST_RULE_COUNT];
+    for (int r = 0; r < TEST_RULE_COUNT; ++r)
+        MakeRule_(&ref[r], val_hex[r], msk_hex[r], &rules[r], (uint32_t) (r + 1));
+
+    rfid_epc_rules_t *compiled = NULL;
+    RFID_CHECK_EQ(rfid_epc_rules_compile(rules, TEST_RULE_COUNT, &compiled), RFID_RESULT_OK);
+    RFID_CHECK(NULL != compiled);
+    if (NULL == compiled)
+        return;
+    RFID_CHECK(rfid_epc_rules_state_count(compiled) > 0U);
+
+    int hits = 0;
+    int mismatches = 0;
+    for (int t = 0; t < TEST_TAG_COUNT; ++t) {
+        uint8_t epc[TEST_EPC_BYTES];
+        for (int i = 0; i < TEST_EPC_BYTES; ++i)
+            epc[i] = (uint8_t) NextRand_();
+        if (0U != (NextRand_() % 4U)) {
+            // 규칙 하나의 비교 비트를 덮어써 일치 태그를 만든다.
+            const test_rule_t *rule = &ref[NextRand_() % TEST_RULE_COUNT];
+            for (int i = 0; i < TEST_EPC_BYTES; ++i)
+                epc[i] = (uint8_t) ((epc[i] & (uint8_t) ~rule->msk[i]) | rule->val[i]);
+        }
+
+        const uint32_t expected = ClassifyLinear_(ref, TEST_RULE_COUNT, epc);
+        const uint32_t actual = rfid_epc_rules_classify(compiled, epc, TEST_EPC_BYTES);
+        if (RFID_EPC_RULE_NONE != expected)
+            ++hits;
+        if (expected != actual) {
+            if (0 == mismatches)
+                RFID_CHECK_EQ(actual, expected);
+            ++mismatches;
+        }
+    }
+    RFID_CHECK_EQ(mismatches, 0);
+    // 일치/불일치가 모두 충분히 나와야 비교가 의미 있다.
+    RFID_CHECK(hits > TEST_TAG_COUNT / 2);
+    RFID_CHECK(hits < TEST_TAG_COUNT);
+
+    rfid_epc_rules_release(compiled);
+}
+
+/**
+ * @brief 겹치는 규칙 중 가장 긴 규칙, 같은 길이면 앞선 규칙을 고르는지 확인한다.
+ */
+static void TestLongestMatch_(void) {
+    const rfid_epc_rule_t rules[] = {
+        { "30", NULL, 0, 1U },
+        { "3034", NULL, 0, 2U },
+        { "303425", NULL, 0, 3U },
+        { "3034FF", NULL, 0, 4U },
+        { "3034FF", NULL, 0, 5U },     // 4와 같은 길이/값: 앞선 4가 이긴다
+        { "3F", "F0", 8, 6U },         // 첫 nibble 3 만 비교(8비트 길이)
+        { "E2", NULL, 5, 7U },         // 5비트 접두사(1110 0)
+    };
+    rfid_epc_rules_t *compiled = NULL;
+    RFID_CHECK_EQ(rfid_epc_rules_compile(rules, (int) (sizeof(rules) / sizeof(rules[0])), &compiled), RFID_RESULT_OK);
+    if (NULL == compiled)
+        return;
+
+    static const struct {
+        const char *epc_hex;
+        uint32_t expected;
+    } cases[] = {
+        { "303425000000000000000001", 3U },
+        { "303426000000000000000001", 2U },
+        { "3034FF000000000000000001", 4U },
+        { "300000000000000000000001", 1U },
+        { "310000000000000000000001", 6U },
+        { "E20000000000000000000001", 7U },
+        { "E70000000000000000000001", 7U },
+        { "E80000000000000000000001", RFID_EPC_RULE_NONE },
+        { "400000000000000000000001", RFID_EPC_RULE_NONE },
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        uint8_t epc[TEST_EPC_BYTES];
+        HexToEpc_(cases[i].epc_hex, epc);
+        RFID_CHECK_EQ(rfid_epc_rules_classify(compiled, epc, TEST_EPC_BYTES), cases[i].expected);
+    }
+
+    // 규칙보다 짧은 EPC 는 그 규칙에 일치하지 않는다.
+    const uint8_t short_epc[2] = { 0x30, 0x34 };
+    RFID_CHECK_EQ(rfid_epc_rules_classify(compiled, short_epc, 2U), 2U);
+    RFID_CHECK_EQ(rfid_epc_rules_classify(compiled, short_epc, 1U), 1U);
+
+    rfid_epc_rules_release(compiled);
+
+    // 잘못된 입력
+    const rfid_epc_rule_t bad_hex = { "3G", NULL, 0, 1U };
+    const rfid_epc_rule_t bad_len = { "30", NULL, 12, 1U };
+    const rfid_epc_rule_t bad_id = { "30", NULL, 0, RFID_EPC_RULE_NONE };
+    compiled = NULL;
+    RFID_CHECK_EQ(rfid_epc_rules_compile(&bad_hex, 1, &compiled), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_epc_rules_compile(&bad_len, 1, &compiled), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_epc_rules_compile(&bad_id, 1, &compiled), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK(NULL == compiled);
+}
+
+/**
+ * @brief 규칙 보관소 교체와 스냅샷 수명을 확인한다.
+ */
+static void TestMatcherSwap_(void) {
+    const rfid_epc_rule_t rule_a = { "3034", NULL, 0, 10U };
+    const rfid_epc_rule_t rule_b = { "3034", NULL, 0, 20U };
+    uint8_t epc[TEST_EPC_BYTES];
+    HexToEpc_("303400000000000000000001", epc);
+
+    rfid_epc_matcher_t *matcher = NULL;
+    RFID_CHECK_EQ(rfid_epc_matcher_create(&matcher), RFID_RESULT_OK);
+    if (NULL == matcher)
+        return;
+
+    // 규칙이 없으면 스냅샷도 없다.
+    rfid_epc_rules_t *snap = rfid_epc_matcher_acquire(matcher);
+    RFID_CHECK(NULL == snap);
+    RFID_CHECK_EQ(rfid_epc_rules_classify(snap, epc, TEST_EPC_BYTES), RFID_EPC_RULE_NONE);
+
+    rfid_epc_rules_t *a = NULL;
+    rfid_epc_rules_t *b = NULL;
+    RFID_CHECK_EQ(rfid_epc_rules_compile(&rule_a, 1, &a), RFID_RESULT_OK);
+    RFID_CHECK_EQ(rfid_epc_rules_compile(&rule_b, 1, &b), RFID_RESULT_OK);
+
+    // swap 이 자기 참조를 가져가므로 호출자 참조는 바로 놓아도 된다.
+    rfid_epc_matcher_swap(matcher, a);
+    rfid_epc_rules_release(a);
+    rfid_epc_rules_t *snap_a = rfid_epc_matcher_acquire(matcher);
+    RFID_CHECK_EQ(rfid_epc_rules_classify(snap_a, epc, TEST_EPC_BYTES), 10U);
+
+    // 교체 후에도 기존 스냅샷은 이전 규칙으로 분류한다.
+    rfid_epc_matcher_swap(matcher, b);
+    rfid_epc_rules_release(b);
+    rfid_epc_rules_t *snap_b = rfid_epc_matcher_acquire(matcher);
+    RFID_CHECK_EQ(rfid_epc_rules_classify(snap_a, epc, TEST_EPC_BYTES), 10U);
+    RFID_CHECK_EQ(rfid_epc_rules_classify(snap_b, epc, TEST_EPC_BYTES), 20U);
+    rfid_epc_rules_release(snap_a);
+
+    // 규칙 제거
+    rfid_epc_matcher_swap(matcher, NULL);
+    RFID_CHECK(NULL == rfid_epc_matcher_acquire(matcher));
+    RFID_CHECK_EQ(rfid_epc_rules_classify(snap_b, epc, TEST_EPC_BYTES), 20U);
+    rfid_epc_rules_release(snap_b);
+
+    rfid_epc_matcher_destroy(&matcher);
+    RFID_CHECK(NULL == matcher);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestDfaMatchesLinear_);
+    RFID_TEST_RUN(TestLongestMatch_);
+    RFID_TEST_RUN(TestMatcherSwap_);
+    return RFID_TEST_RESULT();
+}
@@ -0,0 +1,237 @@
+/**
+ * @file test_gs1.c
+ * @brief GS1 EPC 해석(rfid_gs1) 단위 테스트
+ *
+ * - EPC Tag Data Standard 예시(SGTIN/SSCC/GRAI/GIAI-96)의 필드와 pure identity URN
+ * - 방식마다 partition 0..6 벡터를 해석해 tag URI 가 일치하는지(앞자리 0, 빈 자산 유형 포함)
+ * - header/partition/자릿수/길이 오류와 batch/태그 배열 경로
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rfid_gs1.h"
+#include "rfid_test.h"
+
+#define TEST_EPC_BYTES  (12)  /**< 96bit EPC 바이트 수 */
+
+/**
+ * @brief 해석 벡터(24자리 hex EPC 와 기대 URN)
+ */
+typedef struct test_gs1_vector {
+    const char *hex;
+    const char *urn;
+} test_gs1_vector_t;
+
+// EPC Tag Data Standard 예시(모두 partition 5, 업체 코드 0614141)
+static const test_gs1_vector_t test_tds_vectors_[] = {
+    { "3074257BF7194E4000001A85", "urn:epc:id:sgtin:0614141.812345.6789" },
+    { "3174257BF4499602D2000000", "urn:epc:id:sscc:0614141.1234567890" },
+    { "3374257BF40C0E400000162E", "urn:epc:id:grai:0614141.12345.5678" },
+    { "3474257BF40000000000162E", "urn:epc:id:giai:0614141.5678" },
+};
+
+// 방식별 partition 0..6 (filter = partition + 1). 업체 코드/참조 자릿수가 partition 표를 따른다.
+static const test_gs1_vector_t test_partition_vectors_[] = {
+    { "3020393245B7980000001A85", "urn:epc:tag:sgtin-96:1.061414141414.0.6789" },
+    { "30442DC1D15FA04000001A86", "urn:epc:tag:sgtin-96:2.06141414141.01.6790" },
+    { "3068249B0DE6030000001A87", "urn:epc:tag:sgtin-96:3.0614141414.012.6791" },
+    { "308C3A91AFD01EC000001A88", "urn:epc:tag:sgtin-96:4.061414141.0123.6792" },
+    { "30B02EDAF301348000001A89", "urn:epc:tag:sgtin-96:5.06141414.01234.6793" },
+    { "30D4257BF40C0E4000001A8A", "urn:epc:tag:sgtin-96:6.0614141.012345.6794" },
+    { "30F83BF98078900000001A8B", "urn:epc:tag:sgtin-96:7.061414.0123456.6795" },
+    { "3120393245B79804D2000000", "urn:epc:tag:sscc-96:1.061414141414.01234" },
+    { "31442DC1D15FA03039000000", "urn:epc:tag:sscc-96:2.06141414141.012345" },
+    { "3168249B0DE601E240000000", "urn:epc:tag:sscc-96:3.0614141414.0123456" },
+    { "318C3A91AFD012D687000000", "urn:epc:tag:sscc-96:4.061414141.01234567" },
+    { "31B02EDAF300BC614E000000", "urn:epc:tag:sscc-96:5.06141414.012345678" },
+    { "31D4257BF4075BCD15000000", "urn:epc:tag:sscc-96:6.0614141.0123456789" },
+    { "31F83BF980499602D2000000", "urn:epc:tag:sscc-96:7.061414.01234567890" },
+    { "3320393245B7980000001A85", "urn:epc:tag:grai-96:1.061414141414..6789" },
+    { "33442DC1D15FA00000001A86", "urn:epc:tag:grai-96:2.06141414141.0.6790" },
+    { "3368249B0DE6004000001A87", "urn:epc:tag:grai-96:3.0614141414.01.6791" },
+    { "338C3A91AFD0030000001A88", "urn:epc:tag:grai-96:4.061414141.012.6792" },
+    { "33B02EDAF3001EC000001A89", "urn:epc:tag:grai-96:5.06141414.0123.6793" },
+    { "33D4257BF401348000001A8A", "urn:epc:tag:grai-96:6.0614141.01234.6794" },
+    { "33F83BF9800C0E4000001A8B", "urn:epc:tag:grai-96:7.061414.012345.6795" },
+    { "3420393245B7980D38F2A17F", "urn:epc:tag:giai-96:1.061414141414.56789999999" },
+    { "34442DC1D15FA084397A4EFF", "urn:epc:tag:giai-96:2.06141414141.567899999999" },
+    { "3468249B0DE6052A3EC715FF", "urn:epc:tag:giai-96:3.0614141414.5678999999999" },
+    { "348C3A91AFD033A673C6DBFF", "urn:epc:tag:giai-96:4.061414141.56789999999999" },
+    { "34B02EDAF302048085C497FF", "urn:epc:tag:giai-96:5.06141414.567899999999999" },
+    { "34D4257BF4142D0539ADEFFF", "urn:epc:tag:giai-96:6.0614141.5678999999999999" },
+    { "34F83BF980C9C23440CB5FFF", "urn:epc:tag:giai-96:7.061414.56789999999999999" },
+};
+
+#define TEST_PARTITION_VECTORS ((int) (sizeof(test_partition_vectors_) / sizeof(test_partition_vectors_[0])))
+
+/**
+ * @brief 24자리 hex 문자열을 12 bytes 로 바꾼다.
+ */
+static void ParseHex_(IN_ const char *hex, OUT_ uint8_t *out) {
+    for (int i = 0; i < TEST_EPC_BYTES; ++i) {
+        uint8_t v = 0;
+        for (int k = 0; k < 2; ++k) {
+            const char c = hex[(i * 2) + k];
+            v = (uint8_t) (v << 4);
+            v |= (uint8_t) (((c >= '0') && (c <= '9')) ? (c - '0') : (c - 'A' + 10));
+        }
+        out[i] = v;
+    }
+}
+
+/**
+ * @brief 벡터를 해석하고 URN 이 기대값과 같은지 확인한다.
+ */
+static void CheckUrn_(IN_ const test_gs1_vector_t *v, IN_ const int tag_uri, OUT_ rfid_gs1_record_t *out) {
+    uint8_t epc[TEST_EPC_BYTES];
+    ParseHex_(v->hex, epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, out), 1);
+
+    char urn[RFID_GS1_URN_MAX];
+    size_t len = 0;
+    RFID_CHECK_EQ(rfid_gs1_format_urn(out, tag_uri, urn, sizeof(urn), &len), RFID_RESULT_OK);
+    RFID_CHECK_EQ(len, strlen(v->urn));
+    if (0 != strcmp(urn, v->urn)) {
+        fprintf(stderr, "%s: got %s, expected %s\n", v->hex, urn, v->urn);
+        RFID_CHECK(0 == strcmp(urn, v->urn));
+    }
+}
+
+/**
+ * @brief 규격 예시의 필드 값과 pure identity URN 을 확인한다.
+ */
+static void TestTdsExamples_(void) {
+    rfid_gs1_record_t r;
+
+    CheckUrn_(&test_tds_vectors_[0], 0, &r);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_SGTIN_96);
+    RFID_CHECK_EQ(r.header, 0x30);
+    RFID_CHECK_EQ(r.filter, 3);
+    RFID_CHECK_EQ(r.partition, 5);
+    RFID_CHECK_EQ(r.company_prefix, 614141);
+    RFID_CHECK_EQ(r.company_digits, 7);
+    RFID_CHECK_EQ(r.reference, 812345);
+    RFID_CHECK_EQ(r.reference_digits, 6);
+    RFID_CHECK_EQ(r.serial, 6789);
+
+    CheckUrn_(&test_tds_vectors_[1], 0, &r);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_SSCC_96);
+    RFID_CHECK_EQ(r.reference, 1234567890);
+    RFID_CHECK_EQ(r.reference_digits, 10);
+    RFID_CHECK_EQ(r.serial, 0);
+
+    CheckUrn_(&test_tds_vectors_[2], 0, &r);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_GRAI_96);
+    RFID_CHECK_EQ(r.reference, 12345);
+    RFID_CHECK_EQ(r.serial, 5678);
+
+    CheckUrn_(&test_tds_vectors_[3], 0, &r);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_GIAI_96);
+    RFID_CHECK_EQ(r.reference, 5678);
+    RFID_CHECK_EQ(r.reference_digits, 18);
+    RFID_CHECK_EQ(r.serial, 0);
+
+    // tag URI 는 filter 를 포함한다.
+    const test_gs1_vector_t tag = { "3074257BF7194E4000001A85", "urn:epc:tag:sgtin-96:3.0614141.812345.6789" };
+    CheckUrn_(&tag, 1, &r);
+}
+
+/**
+ * @brief 방식마다 partition 0..6 을 모두 해석한다.
+ */
+static void TestPartitions_(void) {
+    for (int i = 0; i < TEST_PARTITION_VECTORS; ++i) {
+        rfid_gs1_record_t r;
+        CheckUrn_(&test_partition_vectors_[i], 1, &r);
+        RFID_CHECK_EQ(r.partition, i % 7);
+        RFID_CHECK_EQ(r.filter, (i % 7) + 1);
+        RFID_CHECK_EQ(r.company_digits, 12 - (i % 7));
+    }
+
+    // 같은 벡터를 12 bytes 간격 배열과 rfid_tag_t 배열로도 해석한다.
+    uint8_t packed[TEST_PARTITION_VECTORS * TEST_EPC_BYTES];
+    rfid_tag_t tags[TEST_PARTITION_VECTORS];
+    memset(tags, 0, sizeof(tags));
+    for (int i = 0; i < TEST_PARTITION_VECTORS; ++i) {
+        ParseHex_(test_partition_vectors_[i].hex, &packed[i * TEST_EPC_BYTES]);
+        memcpy(tags[i].epc_bytes, &packed[i * TEST_EPC_BYTES], TEST_EPC_BYTES);
+        tags[i].epc_len = TEST_EPC_BYTES;
+    }
+    tags[3].epc_len = 8U;  // 96bit 가 아니면 해석하지 않는다.
+
+    rfid_gs1_record_t single;
+    rfid_gs1_record_t batch[TEST_PARTITION_VECTORS];
+    memset(&single, 0, sizeof(single));  // 구조체 끝 padding 까지 memcmp 로 비교한다.
+    memset(batch, 0, sizeof(batch));
+    int decoded = -1;
+    RFID_CHECK_EQ(rfid_gs1_decode_batch(packed, TEST_EPC_BYTES, TEST_PARTITION_VECTORS, batch, &decoded), RFID_RESULT_OK);
+    RFID_CHECK_EQ(decoded, TEST_PARTITION_VECTORS);
+    for (int i = 0; i < TEST_PARTITION_VECTORS; ++i) {
+        (void) rfid_gs1_decode(&packed[i * TEST_EPC_BYTES], TEST_EPC_BYTES, &single);
+        RFID_CHECK(0 == memcmp(&single, &batch[i], sizeof(single)));
+    }
+
+    RFID_CHECK_EQ(rfid_gs1_decode_batch(tags[0].epc_bytes, sizeof(rfid_tag_t), TEST_PARTITION_VECTORS, batch, &decoded), RFID_RESULT_OK);
+    RFID_CHECK_EQ(decoded, TEST_PARTITION_VECTORS);
+    RFID_CHECK_EQ(rfid_gs1_decode_tags(tags, TEST_PARTITION_VECTORS, batch, &decoded), RFID_RESULT_OK);
+    RFID_CHECK_EQ(decoded, TEST_PARTITION_VECTORS - 1);
+    RFID_CHECK_EQ(batch[3].scheme, RFID_GS1_UNKNOWN);
+    RFID_CHECK_EQ(batch[3].header, 0x30);
+}
+
+/**
+ * @brief 해석할 수 없는 EPC 와 인자 오류를 확인한다.
+ */
+static void TestRejects_(void) {
+    uint8_t epc[TEST_EPC_BYTES];
+    rfid_gs1_record_t r;
+
+    // 지원하지 않는 header
+    ParseHex_("3574257BF7194E4000001A85", epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, &r), 0);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_UNKNOWN);
+    RFID_CHECK_EQ(r.header, 0x35);
+
+    // partition 7(예약)
+    ParseHex_("307C257BF7194E4000001A85", epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, &r), 0);
+    RFID_CHECK_EQ(r.partition, 7);
+
+    // partition 6 업체 코드 20bit 가 모두 1: 1048575 는 6자리를 넘는다.
+    ParseHex_("30FBFFFFC078900000001A8B", epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, &r), 0);
+    RFID_CHECK_EQ(r.scheme, RFID_GS1_UNKNOWN);
+
+    // 참조 자릿수 초과(SGTIN partition 0 지시자 4bit = 15)
+    ParseHex_("3020393245B79BC000001A85", epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, &r), 0);
+
+    // 길이 오류와 NULL
+    ParseHex_("3074257BF7194E4000001A85", epc);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, 16U, &r), 0);
+    RFID_CHECK_EQ(r.header, 0x30);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, NULL), 0);
+
+    // 해석하지 못한 record 와 버퍼 부족은 URN 을 만들지 않는다.
+    char urn[RFID_GS1_URN_MAX];
+    RFID_CHECK_EQ(rfid_gs1_format_urn(&r, 0, urn, sizeof(urn), NULL), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_decode(epc, TEST_EPC_BYTES, &r), 1);
+    RFID_CHECK_EQ(rfid_gs1_format_urn(&r, 0, urn, 10U, NULL), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_format_urn(&r, 0, urn, strlen(test_tds_vectors_[0].urn), NULL), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_format_urn(&r, 0, urn, strlen(test_tds_vectors_[0].urn) + 1U, NULL), RFID_RESULT_OK);
+
+    int decoded = 0;
+    RFID_CHECK_EQ(rfid_gs1_decode_batch(epc, 8U, 1, &r, &decoded), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_decode_batch(NULL, TEST_EPC_BYTES, 1, &r, &decoded), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_decode_tags(NULL, 1, &r, &decoded), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_gs1_decode_batch(NULL, TEST_EPC_BYTES, 0, NULL, &decoded), RFID_RESULT_OK);
+    RFID_CHECK_EQ(decoded, 0);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestTdsExamples_);
+    RFID_TEST_RUN(TestPartitions_);
+    RFID_TEST_RUN(TestRejects_);
+    return RFID_TEST_RESULT();
+}
@@ -0,0 +1,211 @@
+/**
+ * @file test_merge.c
+ * @brief 리더 간 병합 단계(rfid_merge) 단위 테스트
+ *
+ * - 창 안에서 RSSI 가 가장 높은 read 의 리더/안테나로 귀속하고(같으면 먼저 읽은 쪽), 리더 수/read 수를 합치는지
+ * - 창이 첫 read 시각에 열려 window_ms 뒤에 닫히고, 열린 순서대로 꺼내지는지
+ * - 용량 초과, 이벤트 버퍼 분할, 종료 flush
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rfid_merge.h"
+#include "rfid_test.h"
+
+#define TEST_WINDOW_MS  (1000U)  /**< 테스트 창 길이 */
+#define TEST_EVENT_MAX  (16)     /**< 테스트 이벤트 버퍼 크기 */
+
+/**
+ * @brief EPC 마지막 바이트가 id 인 태그를 만든다.
+ */
+static rfid_tag_t MakeTag_(IN_ const uint8_t id, IN_ const int antenna, IN_ const int rssi, IN_ const uint32_t readcnt) {
+    rfid_tag_t tag;
+    memset(&tag, 0, sizeof(tag));
+    tag.epc_len = 12U;
+    tag.epc_bytes[0] = 0x30;
+    tag.epc_bytes[11] = id;
+    tag.antenna = antenna;
+    tag.rssi = rssi;
+    tag.readcnt = readcnt;
+    return tag;
+}
+
+/**
+ * @brief 병합 단계를 만든다(shard 1개: 꺼내는 순서가 창을 연 순서와 같다).
+ */
+static rfid_merge_t* Create_(IN_ const uint32_t capacity) {
+    rfid_merge_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.window_ms = TEST_WINDOW_MS;
+    params.capacity = capacity;
+    params.shards = 1U;
+    rfid_merge_t *m = NULL;
+    RFID_CHECK_EQ(rfid_merge_create(&params, &m), RFID_RESULT_OK);
+    return m;
+}
+
+/**
+ * @brief 태그 1건을 넣는다.
+ */
+static void Push_(IN_ rfid_merge_t *m, IN_ const uint16_t reader_id, IN_ const rfid_tag_t tag, IN_ const uint64_t now_ms) {
+    RFID_CHECK_EQ(rfid_merge_push(m, reader_id, &tag, 1, now_ms), RFID_RESULT_OK);
+}
+
+/**
+ * @brief now_ms 기준으로 닫힌 창을 꺼내고 이벤트 수를 반환한다.
+ */
+static int Poll_(IN_ rfid_merge_t *m, IN_ const uint64_t now_ms, OUT_ rfid_merge_event_t *events, IN_ const int capacity) {
+    int n = -1;
+    RFID_CHECK_EQ(rfid_merge_poll(m, now_ms, events, capacity, &n), RFID_RESULT_OK);
+    return n;
+}
+
+/**
+ * @brief 창 안의 가장 강한 read 로 귀속하는지 확인한다.
+ */
+static void TestRssiAttribution_(void) {
+    rfid_merge_t *m = Create_(64U);
+    if (NULL == m)
+        return;
+
+    Push_(m, 1U, MakeTag_(1U, 2, -70, 2U), 1000U);
+    Push_(m, 2U, MakeTag_(1U, 1, -55, 1U), 1100U);
+    Push_(m, 3U, MakeTag_(1U, 3, -55, 4U), 1200U);  // 같은 RSSI: 먼저 읽은 리더 2 유지
+    Push_(m, 1U, MakeTag_(1U, 4, -60, 0U), 1300U);  // readcnt 0 은 1회
+
+    rfid_merge_event_t ev[TEST_EVENT_MAX];
+    RFID_CHECK_EQ(Poll_(m, 1999U, ev, TEST_EVENT_MAX), 0);
+    RFID_CHECK_EQ(Poll_(m, 2000U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].reader_id, 2);
+    RFID_CHECK_EQ(ev[0].antenna, 1);
+    RFID_CHECK_EQ(ev[0].rssi, -55);
+    RFID_CHECK_EQ(ev[0].reader_count, 3);
+    RFID_CHECK_EQ(ev[0].reads, 8);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 1000);
+    RFID_CHECK_EQ(ev[0].last_seen_ms, 1300);
+    RFID_CHECK_EQ(ev[0].epc_len, 12);
+    RFID_CHECK_EQ(ev[0].epc[11], 1);
+
+    // 더 강한 read 가 나중에 오면 귀속을 옮긴다. 같은 리더의 여러 read 는 리더 1개로 센다.
+    Push_(m, 5U, MakeTag_(2U, 1, -80, 1U), 3000U);
+    Push_(m, 5U, MakeTag_(2U, 2, -75, 1U), 3100U);
+    Push_(m, 6U, MakeTag_(2U, 7, -40, 1U), 3200U);
+    RFID_CHECK_EQ(Poll_(m, 4000U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].reader_id, 6);
+    RFID_CHECK_EQ(ev[0].antenna, 7);
+    RFID_CHECK_EQ(ev[0].rssi, -40);
+    RFID_CHECK_EQ(ev[0].reader_count, 2);
+    RFID_CHECK_EQ(ev[0].reads, 3);
+
+    rfid_merge_stat_t stat;
+    RFID_CHECK_EQ(rfid_merge_get_stats(m, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.reads, 11);
+    RFID_CHECK_EQ(stat.windows, 2);
+    RFID_CHECK_EQ(stat.events, 2);
+    RFID_CHECK_EQ(stat.active, 0);
+    RFID_CHECK_EQ(stat.shards, 1);
+
+    rfid_merge_destroy(&m);
+    RFID_CHECK(NULL == m);
+}
+
+/**
+ * @brief 고정 창의 열림/닫힘과 꺼내는 순서를 확인한다.
+ */
+static void TestWindowEviction_(void) {
+    rfid_merge_t *m = Create_(64U);
+    if (NULL == m)
+        return;
+
+    rfid_merge_event_t ev[TEST_EVENT_MAX];
+
+    // 창은 첫 read 에 열린다: 계속 읽혀도 window_ms 뒤에는 닫힌다.
+    Push_(m, 1U, MakeTag_(1U, 1, -60, 1U), 1000U);
+    Push_(m, 2U, MakeTag_(2U, 1, -60, 1U), 1500U);
+    Push_(m, 1U, MakeTag_(1U, 1, -60, 1U), 1900U);
+    RFID_CHECK_EQ(Poll_(m, 2000U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].epc[11], 1);
+    RFID_CHECK_EQ(ev[0].reads, 2);
+
+    // 닫혔지만 아직 꺼내지 않은 창에는 read 를 합친다.
+    Push_(m, 3U, MakeTag_(2U, 1, -60, 1U), 2600U);
+    RFID_CHECK_EQ(Poll_(m, 2600U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].epc[11], 2);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 1500);
+    RFID_CHECK_EQ(ev[0].last_seen_ms, 2600);
+    RFID_CHECK_EQ(ev[0].reader_count, 2);
+
+    // 꺼낸 뒤의 read 는 새 창을 연다.
+    Push_(m, 1U, MakeTag_(1U, 1, -60, 1U), 2700U);
+    RFID_CHECK_EQ(Poll_(m, 3699U, ev, TEST_EVENT_MAX), 0);
+    RFID_CHECK_EQ(Poll_(m, 3700U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 2700);
+    RFID_CHECK_EQ(ev[0].reads, 1);
+
+    // 창을 연 시각보다 작은 now_ms 는 경과 0, last_seen_ms 는 뒤로 가지 않는다.
+    Push_(m, 1U, MakeTag_(3U, 1, -60, 1U), 5000U);
+    Push_(m, 2U, MakeTag_(3U, 1, -60, 1U), 4900U);
+    RFID_CHECK_EQ(Poll_(m, 4950U, ev, TEST_EVENT_MAX), 0);
+    RFID_CHECK_EQ(Poll_(m, 6000U, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 5000);
+    RFID_CHECK_EQ(ev[0].last_seen_ms, 5000);
+
+    rfid_merge_destroy(&m);
+}
+
+/**
+ * @brief 용량 초과, 이벤트 버퍼 분할, UINT64_MAX flush 를 확인한다.
+ */
+static void TestCapacityAndFlush_(void) {
+    rfid_merge_t *m = Create_(2U);
+    if (NULL == m)
+        return;
+
+    rfid_merge_event_t ev[TEST_EVENT_MAX];
+    const rfid_tag_t tags[] = {
+        MakeTag_(1U, 1, -60, 1U),
+        MakeTag_(2U, 1, -60, 1U),
+        MakeTag_(3U, 1, -60, 2U),
+    };
+    RFID_CHECK_EQ(rfid_merge_push(m, 1U, tags, 3, 1000U), RFID_RESULT_OK);
+
+    rfid_merge_stat_t stat;
+    RFID_CHECK_EQ(rfid_merge_get_stats(m, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.table_full, 2);
+    RFID_CHECK_EQ(stat.active, 2);
+    RFID_CHECK_EQ(stat.capacity, 2);
+
+    // 버퍼 1칸이면 남은 창은 다음 호출로 미룬다.
+    RFID_CHECK_EQ(Poll_(m, 2000U, ev, 1), 1);
+    RFID_CHECK_EQ(ev[0].epc[11], 1);
+    RFID_CHECK_EQ(Poll_(m, 2000U, ev, 1), 1);
+    RFID_CHECK_EQ(ev[0].epc[11], 2);
+    RFID_CHECK_EQ(Poll_(m, 2000U, ev, 1), 0);
+
+    // 자리가 비면 다시 받는다. 종료 시 UINT64_MAX 로 열린 창을 모두 꺼낸다.
+    Push_(m, 1U, tags[2], 2100U);
+    RFID_CHECK_EQ(Poll_(m, 2100U, ev, TEST_EVENT_MAX), 0);
+    RFID_CHECK_EQ(Poll_(m, UINT64_MAX, ev, TEST_EVENT_MAX), 1);
+    RFID_CHECK_EQ(ev[0].epc[11], 3);
+    RFID_CHECK_EQ(ev[0].reads, 2);
+
+    // 인자 오류
+    int n = 0;
+    RFID_CHECK_EQ(rfid_merge_poll(m, 2000U, ev, 0, &n), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_merge_push(m, 1U, NULL, 1, 2000U), RFID_RESULT_INVALID_ARG);
+    rfid_merge_destroy(&m);
+
+    rfid_merge_params_t bad;
+    memset(&bad, 0, sizeof(bad));
+    bad.shards = 3U;
+    RFID_CHECK_EQ(rfid_merge_create(&bad, &m), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK(NULL == m);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestRssiAttribution_);
+    RFID_TEST_RUN(TestWindowEviction_);
+    RFID_TEST_RUN(TestCapacityAndFlush_);
+    return RFID_TEST_RESULT();
+}
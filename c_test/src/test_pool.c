@@ -0,0 +1,477 @@
+/**
+ * @file test_pool.c
+ * @brief 태그 후처리 풀(rfid_pool) 단위 테스트
+ *
+ * - 여러 작업 스레드가 lane 을 훔쳐 가며 처리해도 같은 EPC 는 넣은 순서대로 stage 에 들어오는지
+ * - stage 가 걸러낸 태그는 다음 stage 로 넘어가지 않고, stage 별 집계가 맞는지
+ * - destroy 가 대기 중인 태그를 모두 처리한 뒤 끝나는지
+ * - lane 이 가득 찼을 때 정책별 동작(DROP_NEWEST/DROP_OLDEST/BLOCK/COALESCE)과 정책별 카운터
+ */
+
+#define _POSIX_C_SOURCE 200809L  // nanosleep
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "rfid_pool.h"
+#include "rfid_test.h"
+
+#define TEST_EPC_COUNT   (64)     /**< 서로 다른 EPC 수 */
+#define TEST_SEQ_COUNT   (200)    /**< EPC 당 넣는 태그 수 */
+#define TEST_SUBMIT_MAX  (32)     /**< submit 1회 태그 수 */
+#define TEST_DRAIN_MS    (10000U) /**< drain 최대 대기 */
+#define TEST_GATE_CAP    (4U)     /**< 정책 테스트 lane 용량 */
+#define TEST_GATE_LOG    (32)     /**< 정책 테스트 기록 수 */
+
+/**
+ * @brief 순서 확인 stage 상태(여러 작업 스레드가 함께 쓰므로 원자적 접근)
+ *
+ * @param next     EPC 별 다음에 와야 할 최소 seq
+ * @param seen     EPC 별 받은 태그 수
+ * @param reorder  순서가 뒤바뀐 태그 수
+ * @param bad_reader reader_id 가 넣은 값과 다른 태그 수
+ */
+typedef struct test_order_state {
+    uint32_t next[TEST_EPC_COUNT];
+    uint32_t seen[TEST_EPC_COUNT];
+    uint32_t reorder;
+    uint32_t bad_reader;
+} test_order_state_t;
+
+/**
+ * @brief 정책 테스트 stage 상태. release_ms 전까지 stage 가 첫 태그를 붙잡아 lane 을 채울 수 있게 한다.
+ *
+ * @param release_ms stage 를 놓아줄 단조 시각(ms, 원자적 접근)
+ * @param entered    stage 에 들어온 태그 수(원자적 접근)
+ * @param log        stage 에 들어온 레코드(작업 스레드 1개, batch 1)
+ */
+typedef struct test_gate {
+    uint64_t release_ms;
+    uint32_t entered;
+    rfid_pool_item_t log[TEST_GATE_LOG];
+} test_gate_t;
+
+/**
+ * @brief EPC 번호 epc, 순번 seq 인 태그를 만든다(seq 는 ts 에 싣는다).
+ */
+static void MakeTag_(IN_ const uint32_t epc, IN_ const uint32_t seq, OUT_ rfid_tag_t *tag) {
+    memset(tag, 0, sizeof(*tag));
+    tag->epc_len = 12U;
+    tag->epc_bytes[0] = 0x30;
+    tag->epc_bytes[11] = (uint8_t) epc;
+    tag->rssi = -60;
+    tag->readcnt = 1U;
+    tag->ts = seq;
+}
+
+/**
+ * @brief 잠깐 멈춰 다른 작업 스레드가 lane 을 훔칠 틈을 준다.
+ */
+static void Nap_(IN_ const long ns) {
+    const struct timespec ts = {0, ns};
+    (void) nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief seq 가 4의 배수인 태그를 걸러낸다.
+ */
+static int DropEveryFourthStage_(void *user, rfid_pool_item_t *items, int count) {
+    (void) user;
+    int out = 0;
+    for (int i = 0; i < count; ++i) {
+        if (0U != (items[i].tag.ts % 4U))
+            items[out++] = items[i];
+    }
+    return out;
+}
+
+/**
+ * @brief EPC 별 seq 가 늘어나는 순서로만 들어오는지 기록한다.
+ */
+static int OrderStage_(void *user, rfid_pool_item_t *items, int count) {
+    test_order_state_t *st = (test_order_state_t *) user;
+    for (int i = 0; i < count; ++i) {
+        const uint32_t epc = items[i].tag.epc_bytes[11];
+        const uint32_t seq = (uint32_t) items[i].tag.ts;
+        if (items[i].reader_id != (uint16_t) (7U + seq % 3U))
+            (void) __atomic_add_fetch(&st->bad_reader, 1U, __ATOMIC_RELAXED);
+        if (seq < __atomic_load_n(&st->next[epc], __ATOMIC_RELAXED))
+            (void) __atomic_add_fetch(&st->reorder, 1U, __ATOMIC_RELAXED);
+        __atomic_store_n(&st->next[epc], seq + 1U, __ATOMIC_RELAXED);
+        (void) __atomic_add_fetch(&st->seen[epc], 1U, __ATOMIC_RELAXED);
+    }
+    Nap_(20000L);
+    return count;
+}
+
+/**
+ * @brief EPC 를 섞어 가며 모든 태그를 넣는다(EPC 별 seq 는 증가 순, reader_id 는 seq 로 정한다).
+ * @return 받은 태그 수
+ */
+static int SubmitAll_(IN_ rfid_pool_t *pool) {
+    rfid_tag_t tags[TEST_SUBMIT_MAX];
+    int total = 0;
+    for (uint32_t seq = 0; seq < TEST_SEQ_COUNT; ++seq) {
+        for (uint32_t base = 0; base < TEST_EPC_COUNT; base += TEST_SUBMIT_MAX) {
+            for (uint32_t i = 0; i < TEST_SUBMIT_MAX; ++i)
+                MakeTag_(base + i, seq, &tags[i]);
+            int accepted = 0;
+            RFID_CHECK_EQ(rfid_pool_submit(pool, (uint16_t) (7U + seq % 3U), tags, TEST_SUBMIT_MAX, &accepted), RFID_RESULT_OK);
+            total += accepted;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief 같은 EPC 의 태그 순서와 stage 연결을 확인한다.
+ */
+static void TestPerEpcOrder_(void) {
+    static test_order_state_t st;
+    memset(&st, 0, sizeof(st));
+    const rfid_pool_stage_t stages[] = {
+        { "filter", DropEveryFourthStage_, NULL },
+        { "order", OrderStage_, &st },
+    };
+
+    rfid_pool_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.workers = 4U;
+    params.lanes = 16U;
+    params.lane_capacity = 2048U;  // 한 lane 에 몰려도 버리지 않을 만큼
+    params.batch = 8U;
+    rfid_pool_t *pool = NULL;
+    RFID_CHECK_EQ(rfid_pool_create(&params, stages, 2, &pool), RFID_RESULT_OK);
+    if (NULL == pool)
+        return;
+
+    const int total = SubmitAll_(pool);
+    RFID_CHECK_EQ(total, TEST_EPC_COUNT * TEST_SEQ_COUNT);
+    uint32_t pending = 1U;
+    RFID_CHECK_EQ(rfid_pool_drain(pool, TEST_DRAIN_MS, &pending), RFID_RESULT_OK);
+    RFID_CHECK_EQ(pending, 0);
+
+    RFID_CHECK_EQ(st.reorder, 0);
+    RFID_CHECK_EQ(st.bad_reader, 0);
+    for (int epc = 0; epc < TEST_EPC_COUNT; ++epc)
+        RFID_CHECK_EQ(st.seen[epc], TEST_SEQ_COUNT * 3 / 4);
+
+    rfid_pool_stat_t stat;
+    rfid_pool_stage_stat_t stage_stat[RFID_POOL_STAGE_MAX];
+    int stage_count = 0;
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, stage_stat, RFID_POOL_STAGE_MAX, &stage_count), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stage_count, 2);
+    RFID_CHECK_EQ(stat.submitted, total);
+    RFID_CHECK_EQ(stat.processed, total);
+    RFID_CHECK_EQ(stat.dropped, 0);
+    RFID_CHECK_EQ(stat.pending, 0);
+    RFID_CHECK_EQ(stat.workers, 4);
+    RFID_CHECK_EQ(stat.lanes, 16);
+    RFID_CHECK_EQ(stat.policy, RFID_POOL_POLICY_DROP_NEWEST);
+    RFID_CHECK(0 == strcmp(stage_stat[0].name, "filter"));
+    RFID_CHECK(0 == strcmp(stage_stat[1].name, "order"));
+    RFID_CHECK_EQ(stage_stat[0].items_in, total);
+    RFID_CHECK_EQ(stage_stat[0].items_out, total * 3 / 4);
+    RFID_CHECK_EQ(stage_stat[1].items_in, total * 3 / 4);
+    RFID_CHECK_EQ(stage_stat[1].items_out, total * 3 / 4);
+    RFID_CHECK_EQ(stage_stat[0].calls, stat.batches);
+
+    rfid_pool_destroy(&pool);
+    RFID_CHECK(NULL == pool);
+}
+
+/**
+ * @brief 처리한 태그 수를 센다.
+ */
+static int CountStage_(void *user, rfid_pool_item_t *items, int count) {
+    (void) items;
+    (void) __atomic_add_fetch((uint32_t *) user, (uint32_t) count, __ATOMIC_RELAXED);
+    Nap_(100000L);
+    return count;
+}
+
+/**
+ * @brief destroy 가 대기 중인 태그를 버리지 않고 모두 처리하는지 확인한다.
+ */
+static void TestDestroyDrains_(void) {
+    static uint32_t counted;
+    counted = 0U;
+    const rfid_pool_stage_t stage = { "count", CountStage_, &counted };
+
+    rfid_pool_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.workers = 2U;
+    params.lanes = 4U;
+    params.lane_capacity = 256U;
+    params.batch = 4U;
+    rfid_pool_t *pool = NULL;
+    RFID_CHECK_EQ(rfid_pool_create(&params, &stage, 1, &pool), RFID_RESULT_OK);
+    if (NULL == pool)
+        return;
+
+    rfid_tag_t tags[TEST_SUBMIT_MAX];
+    for (uint32_t i = 0; i < TEST_SUBMIT_MAX; ++i)
+        MakeTag_(i, 0U, &tags[i]);
+    int accepted = 0;
+    RFID_CHECK_EQ(rfid_pool_submit(pool, 1U, tags, TEST_SUBMIT_MAX, &accepted), RFID_RESULT_OK);
+    RFID_CHECK_EQ(accepted, TEST_SUBMIT_MAX);
+    rfid_pool_destroy(&pool);
+    RFID_CHECK_EQ(counted, TEST_SUBMIT_MAX);
+
+    // 인자 오류
+    rfid_pool_stage_t bad_stage = { "null", NULL, NULL };
+    RFID_CHECK_EQ(rfid_pool_create(&params, &bad_stage, 1, &pool), RFID_RESULT_INVALID_ARG);
+    params.lanes = 3U;
+    RFID_CHECK_EQ(rfid_pool_create(&params, &stage, 1, &pool), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK(NULL == pool);
+    RFID_CHECK_EQ(rfid_pool_submit(NULL, 1U, tags, 1, &accepted), RFID_RESULT_INVALID_ARG);
+}
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ms)
+ */
+static uint64_t NowMs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000ULL) + ((uint64_t) ts.tv_nsec / 1000000ULL);
+}
+
+/**
+ * @brief 레코드를 기록하고 release_ms 까지 붙잡는다.
+ */
+static int GateStage_(void *user, rfid_pool_item_t *items, int count) {
+    test_gate_t *g = (test_gate_t *) user;
+    for (int i = 0; i < count; ++i) {
+        const uint32_t n = __atomic_load_n(&g->entered, __ATOMIC_RELAXED);
+        if (n < (uint32_t) TEST_GATE_LOG)
+            g->log[n] = items[i];
+        __atomic_store_n(&g->entered, n + 1U, __ATOMIC_RELEASE);
+    }
+    while (NowMs_() < __atomic_load_n(&g->release_ms, __ATOMIC_ACQUIRE))
+        Nap_(200000L);
+    return count;
+}
+
+/**
+ * @brief 작업 스레드 1개, lane 1개, batch 1 인 풀을 만든다(lane 용량 TEST_GATE_CAP).
+ */
+static rfid_pool_t* CreateGated_(IN_ test_gate_t *g, IN_ const RFID_POOL_POLICY policy, IN_ const uint32_t block_timeout_ms) {
+    memset(g, 0, sizeof(*g));
+    g->release_ms = UINT64_MAX;
+    const rfid_pool_stage_t stage = { "gate", GateStage_, g };
+
+    rfid_pool_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.workers = 1U;
+    params.lanes = 1U;
+    params.batch = 1U;
+    params.policy = policy;
+    params.block_timeout_ms = block_timeout_ms;
+    if (RFID_POOL_POLICY_COALESCE == policy)
+        params.memory_limit_bytes = TEST_GATE_CAP * (sizeof(rfid_pool_item_t) + sizeof(uint64_t));  // COALESCE 는 레코드마다 해시 8 bytes
+    else
+        params.lane_capacity = TEST_GATE_CAP;
+    rfid_pool_t *pool = NULL;
+    RFID_CHECK_EQ(rfid_pool_create(&params, &stage, 1, &pool), RFID_RESULT_OK);
+    return pool;
+}
+
+/**
+ * @brief EPC epc 태그 1건을 넣고 받은 수를 반환한다.
+ */
+static int SubmitOne_(IN_ rfid_pool_t *pool, IN_ const uint16_t reader_id, IN_ const uint32_t epc, IN_ const uint32_t seq) {
+    rfid_tag_t tag;
+    MakeTag_(epc, seq, &tag);
+    int accepted = -1;
+    RFID_CHECK_EQ(rfid_pool_submit(pool, reader_id, &tag, 1, &accepted), RFID_RESULT_OK);
+    return accepted;
+}
+
+/**
+ * @brief seq 0 을 넣고 stage 가 붙잡을 때까지 기다린다(이후 lane 에는 TEST_GATE_CAP 자리가 빈다).
+ */
+static void HoldFirst_(IN_ rfid_pool_t *pool, IN_ test_gate_t *g) {
+    RFID_CHECK_EQ(SubmitOne_(pool, 1U, 0U, 0U), 1);
+    const uint64_t until = NowMs_() + TEST_DRAIN_MS;
+    while ((0U == __atomic_load_n(&g->entered, __ATOMIC_ACQUIRE)) && (NowMs_() < until))
+        Nap_(200000L);
+    RFID_CHECK_EQ(g->entered, 1);
+}
+
+/**
+ * @brief stage 를 놓아주고 남은 태그를 모두 처리한다.
+ */
+static void Release_(IN_ rfid_pool_t *pool, IN_ test_gate_t *g) {
+    __atomic_store_n(&g->release_ms, 0U, __ATOMIC_RELEASE);
+    uint32_t pending = 1U;
+    RFID_CHECK_EQ(rfid_pool_drain(pool, TEST_DRAIN_MS, &pending), RFID_RESULT_OK);
+    RFID_CHECK_EQ(pending, 0);
+}
+
+/**
+ * @brief DROP_NEWEST 는 새 태그를 버리고, DROP_OLDEST 는 가장 오래된 대기 태그를 버린다.
+ */
+static void TestDropPolicies_(void) {
+    static test_gate_t g;
+    rfid_pool_stat_t stat;
+
+    rfid_pool_t *pool = CreateGated_(&g, RFID_POOL_POLICY_DROP_NEWEST, 0U);
+    if (NULL == pool)
+        return;
+    HoldFirst_(pool, &g);
+    int accepted = 0;
+    for (uint32_t seq = 1U; seq <= TEST_GATE_CAP + 2U; ++seq)
+        accepted += SubmitOne_(pool, 1U, 1U, seq);
+    RFID_CHECK_EQ(accepted, TEST_GATE_CAP);
+    Release_(pool, &g);
+    RFID_CHECK_EQ(g.entered, TEST_GATE_CAP + 1U);
+    for (uint32_t i = 0; i <= TEST_GATE_CAP; ++i)
+        RFID_CHECK_EQ(g.log[i].tag.ts, i);  // 대기 태그 순서 유지, seq 5, 6 버림
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.dropped_newest, 2);
+    RFID_CHECK_EQ(stat.dropped_oldest, 0);
+    RFID_CHECK_EQ(stat.dropped, 2);
+    RFID_CHECK_EQ(stat.submitted, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(stat.processed, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(stat.lane_capacity, TEST_GATE_CAP);
+    rfid_pool_destroy(&pool);
+
+    pool = CreateGated_(&g, RFID_POOL_POLICY_DROP_OLDEST, 0U);
+    if (NULL == pool)
+        return;
+    HoldFirst_(pool, &g);
+    accepted = 0;
+    for (uint32_t seq = 1U; seq <= TEST_GATE_CAP + 2U; ++seq)
+        accepted += SubmitOne_(pool, 1U, 1U, seq);
+    RFID_CHECK_EQ(accepted, TEST_GATE_CAP + 2U);
+    Release_(pool, &g);
+    RFID_CHECK_EQ(g.entered, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(g.log[0].tag.ts, 0);
+    for (uint32_t i = 1U; i <= TEST_GATE_CAP; ++i)
+        RFID_CHECK_EQ(g.log[i].tag.ts, i + 2U);  // seq 1, 2 가 자리를 내줬다.
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.dropped_newest, 0);
+    RFID_CHECK_EQ(stat.dropped_oldest, 2);
+    RFID_CHECK_EQ(stat.submitted, TEST_GATE_CAP + 3U);
+    RFID_CHECK_EQ(stat.processed, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(stat.pending, 0);
+    rfid_pool_destroy(&pool);
+}
+
+/**
+ * @brief BLOCK 은 자리가 나면 받아들이고, block_timeout_ms 안에 자리가 나지 않으면 새 태그를 버린다.
+ */
+static void TestBlockPolicy_(void) {
+    static test_gate_t g;
+    rfid_pool_stat_t stat;
+
+    // stage 가 100ms 뒤 놓아주면 기다리던 태그가 들어간다.
+    rfid_pool_t *pool = CreateGated_(&g, RFID_POOL_POLICY_BLOCK, TEST_DRAIN_MS);
+    if (NULL == pool)
+        return;
+    HoldFirst_(pool, &g);
+    for (uint32_t seq = 1U; seq <= TEST_GATE_CAP; ++seq)
+        RFID_CHECK_EQ(SubmitOne_(pool, 1U, 1U, seq), 1);
+    __atomic_store_n(&g.release_ms, NowMs_() + 100U, __ATOMIC_RELEASE);
+    RFID_CHECK_EQ(SubmitOne_(pool, 1U, 1U, TEST_GATE_CAP + 1U), 1);
+    Release_(pool, &g);
+    RFID_CHECK_EQ(g.entered, TEST_GATE_CAP + 2U);
+    RFID_CHECK_EQ(g.log[TEST_GATE_CAP + 1U].tag.ts, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.blocked, 1);
+    RFID_CHECK_EQ(stat.block_timeouts, 0);
+    RFID_CHECK_EQ(stat.dropped, 0);
+    RFID_CHECK(stat.block_wait_us > 0U);
+    rfid_pool_destroy(&pool);
+
+    // 자리가 나지 않으면 submit 호출 1회 전체가 block_timeout_ms 까지만 기다린다.
+    pool = CreateGated_(&g, RFID_POOL_POLICY_BLOCK, 30U);
+    if (NULL == pool)
+        return;
+    HoldFirst_(pool, &g);
+    rfid_tag_t tags[TEST_GATE_CAP + 3U];
+    for (uint32_t i = 0; i < TEST_GATE_CAP + 3U; ++i)
+        MakeTag_(1U, i + 1U, &tags[i]);
+    int accepted = 0;
+    const uint64_t t0 = NowMs_();
+    RFID_CHECK_EQ(rfid_pool_submit(pool, 1U, tags, (int) (TEST_GATE_CAP + 3U), &accepted), RFID_RESULT_OK);
+    const uint64_t waited = NowMs_() - t0;
+    RFID_CHECK_EQ(accepted, TEST_GATE_CAP);
+    RFID_CHECK(waited >= 25U);
+    RFID_CHECK(waited < 1000U);
+    Release_(pool, &g);
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.blocked, 3);
+    RFID_CHECK_EQ(stat.block_timeouts, 3);
+    RFID_CHECK_EQ(stat.dropped_newest, 3);
+    RFID_CHECK_EQ(stat.processed, TEST_GATE_CAP + 1U);
+    rfid_pool_destroy(&pool);
+}
+
+/**
+ * @brief COALESCE 는 대기 중인 같은 EPC 레코드에 합치고, 합칠 대상 없이 가득 차면 새 태그를 버린다.
+ */
+static void TestCoalescePolicy_(void) {
+    static test_gate_t g;
+    rfid_pool_t *pool = CreateGated_(&g, RFID_POOL_POLICY_COALESCE, 0U);
+    if (NULL == pool)
+        return;
+
+    rfid_pool_stat_t stat;
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.lane_capacity, TEST_GATE_CAP);  // memory_limit_bytes 로 정한 용량
+    RFID_CHECK_EQ(stat.memory_bytes, TEST_GATE_CAP * (sizeof(rfid_pool_item_t) + sizeof(uint64_t)));
+
+    HoldFirst_(pool, &g);
+    for (uint32_t epc = 1U; epc <= TEST_GATE_CAP; ++epc)
+        RFID_CHECK_EQ(SubmitOne_(pool, 1U, epc, 1U), 1);
+
+    // EPC 2 에 합친다: readcnt 합, RSSI 가 높은 read 의 리더/안테나, 마지막 ts.
+    rfid_tag_t tag;
+    MakeTag_(2U, 5U, &tag);
+    tag.readcnt = 3U;
+    tag.rssi = -40;
+    tag.antenna = 2;
+    int accepted = 0;
+    RFID_CHECK_EQ(rfid_pool_submit(pool, 9U, &tag, 1, &accepted), RFID_RESULT_OK);
+    RFID_CHECK_EQ(accepted, 1);
+    MakeTag_(2U, 3U, &tag);
+    tag.rssi = -70;
+    RFID_CHECK_EQ(rfid_pool_submit(pool, 4U, &tag, 1, &accepted), RFID_RESULT_OK);
+    RFID_CHECK_EQ(accepted, 1);
+
+    // 처리 중인 EPC 0 과 새 EPC 는 합칠 대상이 없으므로 버린다.
+    RFID_CHECK_EQ(SubmitOne_(pool, 1U, 0U, 1U), 0);
+    RFID_CHECK_EQ(SubmitOne_(pool, 1U, TEST_GATE_CAP + 1U, 1U), 0);
+
+    Release_(pool, &g);
+    RFID_CHECK_EQ(g.entered, TEST_GATE_CAP + 1U);
+    const rfid_pool_item_t *merged = &g.log[2];
+    RFID_CHECK_EQ(merged->tag.epc_bytes[11], 2);
+    RFID_CHECK_EQ(merged->merged, 2);
+    RFID_CHECK_EQ(merged->tag.readcnt, 5);
+    RFID_CHECK_EQ(merged->tag.rssi, -40);
+    RFID_CHECK_EQ(merged->tag.antenna, 2);
+    RFID_CHECK_EQ(merged->reader_id, 9);
+    RFID_CHECK_EQ(merged->tag.ts, 5);
+    RFID_CHECK_EQ(g.log[1].merged, 0);
+    RFID_CHECK_EQ(g.log[1].tag.epc_bytes[11], 1);
+
+    RFID_CHECK_EQ(rfid_pool_get_stats(pool, &stat, NULL, 0, NULL), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.coalesced, 2);
+    RFID_CHECK_EQ(stat.dropped_newest, 2);
+    RFID_CHECK_EQ(stat.submitted, TEST_GATE_CAP + 3U);
+    RFID_CHECK_EQ(stat.processed, TEST_GATE_CAP + 1U);
+    RFID_CHECK_EQ(stat.policy, RFID_POOL_POLICY_COALESCE);
+    rfid_pool_destroy(&pool);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestPerEpcOrder_);
+    RFID_TEST_RUN(TestDestroyDrains_);
+    RFID_TEST_RUN(TestDropPolicies_);
+    RFID_TEST_RUN(TestBlockPolicy_);
+    RFID_TEST_RUN(TestCoalescePolicy_);
+    return RFID_TEST_RESULT();
+}
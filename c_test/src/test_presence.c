@@ -0,0 +1,484 @@
+/**
+ * @file test_presence.c
+ * @brief 태그 존재 감지 엔진(rfid_presence) 단위 테스트
+ *
+ * - (EPC, zone) 별 ARRIVE → PRESENT(holdoff 간격) → DEPART(depart 시간 미검출) 순서와 이벤트 내용
+ * - zone 별 holdoff/depart, zone 미지정 안테나의 기본 zone
+ * - 이벤트 버퍼가 가득 찼을 때 미루기와 추적 용량 초과
+ * - 스냅샷 복원 후 가짜 ARRIVE 없이 이어가기, 소유자/나이/형식 검사, 기록 중 깨진 슬롯 대신 이전 슬롯 사용
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include "rfid_presence.h"
+#include "rfid_test.h"
+
+#define TEST_EVENT_MAX  (16)    /**< 테스트 이벤트 버퍼 크기 */
+#define TEST_SNAP_PAGE  (4096)  /**< 스냅샷 페이지 크기(구현과 같은 값) */
+
+static const int test_zone_a_ants_[] = { 1, 2 };
+static const int test_zone_b_ants_[] = { 3 };
+
+/**
+ * @brief 테스트 zone 구성: zone 10(안테나 1, 2), zone 20(안테나 3), 나머지 안테나는 zone 0.
+ */
+static const rfid_presence_zone_t test_zones_[] = {
+    { 10, test_zone_a_ants_, 2, 1000U, 500U },
+    { 20, test_zone_b_ants_, 1, 2000U, 1500U },
+};
+
+/**
+ * @brief 테스트 기본 파라미터(zone 0: holdoff 3000, depart 800)
+ */
+static void DefaultParams_(OUT_ rfid_presence_params_t *params) {
+    memset(params, 0, sizeof(*params));
+    params->capacity = 64U;
+    params->holdoff_ms = 3000U;
+    params->depart_ms = 800U;
+    params->zones = test_zones_;
+    params->zone_count = 2;
+}
+
+/**
+ * @brief EPC 마지막 바이트가 id 인 태그를 만든다.
+ */
+static rfid_tag_t MakeTag_(IN_ const uint8_t id, IN_ const int antenna, IN_ const int rssi, IN_ const uint32_t readcnt) {
+    rfid_tag_t tag;
+    memset(&tag, 0, sizeof(tag));
+    tag.epc_len = 12U;
+    tag.epc_bytes[0] = 0x30;
+    tag.epc_bytes[11] = id;
+    tag.antenna = antenna;
+    tag.rssi = rssi;
+    tag.readcnt = readcnt;
+    return tag;
+}
+
+/**
+ * @brief 태그 1건(또는 없음)으로 update 하고 이벤트 수를 반환한다.
+ */
+static int Update_(IN_ rfid_presence_t *p, IN_ const rfid_tag_t *tag, IN_ const uint64_t now_ms, OUT_ rfid_presence_event_t *events) {
+    int n = -1;
+    RFID_CHECK_EQ(rfid_presence_update(p, tag, (NULL != tag) ? 1 : 0, now_ms, events, TEST_EVENT_MAX, &n), RFID_RESULT_OK);
+    return n;
+}
+
+/**
+ * @brief 이벤트의 종류/zone/EPC id 를 확인한다.
+ */
+static void CheckEvent_(IN_ const rfid_presence_event_t *ev
+                        , IN_ const RFID_PRESENCE_EVENT type
+                        , IN_ const int32_t zone_id
+                        , IN_ const uint8_t id) {
+    RFID_CHECK_EQ(ev->type, type);
+    RFID_CHECK_EQ(ev->zone_id, zone_id);
+    RFID_CHECK_EQ(ev->epc_len, 12);
+    RFID_CHECK_EQ(ev->epc[0], 0x30);
+    RFID_CHECK_EQ(ev->epc[11], id);
+}
+
+/**
+ * @brief 한 zone 에서 ARRIVE → PRESENT → DEPART 순서와 이벤트 내용을 확인한다.
+ */
+static void TestLifecycle_(void) {
+    rfid_presence_params_t params;
+    DefaultParams_(&params);
+    rfid_presence_t *p = NULL;
+    RFID_CHECK_EQ(rfid_presence_create(&params, &p), RFID_RESULT_OK);
+    if (NULL == p)
+        return;
+
+    rfid_presence_event_t ev[TEST_EVENT_MAX];
+    rfid_tag_t tag = MakeTag_(1U, 1, -60, 0U);
+
+    // 처음 읽으면 ARRIVE(readcnt 0 은 1회로 센다).
+    RFID_CHECK_EQ(Update_(p, &tag, 1000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 1U);
+    RFID_CHECK_EQ(ev[0].ts_ms, 1000);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 1000);
+    RFID_CHECK_EQ(ev[0].reads, 1);
+    RFID_CHECK_EQ(ev[0].antenna, 1);
+    RFID_CHECK_EQ(ev[0].rssi, -60);
+
+    // 같은 zone 의 다른 안테나에서 holdoff(1000) 전에 읽히면 이벤트 없이 누적만 한다.
+    tag = MakeTag_(1U, 2, -50, 3U);
+    RFID_CHECK_EQ(Update_(p, &tag, 1200U, ev), 0);
+    tag = MakeTag_(1U, 1, -70, 1U);
+    RFID_CHECK_EQ(Update_(p, &tag, 1999U, ev), 0);
+
+    // holdoff 가 지나면 PRESENT: 직전 이벤트 이후 read 수와 최대 RSSI 를 담는다.
+    tag = MakeTag_(1U, 2, -65, 2U);
+    RFID_CHECK_EQ(Update_(p, &tag, 2000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_PRESENT, 10, 1U);
+    RFID_CHECK_EQ(ev[0].ts_ms, 2000);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 1000);
+    RFID_CHECK_EQ(ev[0].reads, 6);
+    RFID_CHECK_EQ(ev[0].rssi, -50);
+    RFID_CHECK_EQ(ev[0].antenna, 2);
+
+    // PRESENT 는 holdoff 마다 최대 1회
+    RFID_CHECK_EQ(Update_(p, &tag, 2400U, ev), 0);
+
+    // 마지막 read(2400) 뒤 depart(500) 전에는 DEPART 가 나가지 않는다.
+    RFID_CHECK_EQ(Update_(p, NULL, 2899U, ev), 0);
+    RFID_CHECK_EQ(Update_(p, NULL, 2900U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 1U);
+    RFID_CHECK_EQ(ev[0].ts_ms, 2400);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 1000);
+    RFID_CHECK_EQ(ev[0].reads, 2);
+    RFID_CHECK_EQ(Update_(p, NULL, 5000U, ev), 0);
+
+    // DEPART 뒤 다시 읽히면 새 ARRIVE
+    RFID_CHECK_EQ(Update_(p, &tag, 6000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 1U);
+    RFID_CHECK_EQ(ev[0].first_seen_ms, 6000);
+
+    rfid_presence_stat_t stat;
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.arrivals, 2);
+    RFID_CHECK_EQ(stat.presents, 1);
+    RFID_CHECK_EQ(stat.departures, 1);
+    RFID_CHECK_EQ(stat.reads, 11);
+    RFID_CHECK_EQ(stat.tracked, 1);
+    RFID_CHECK_EQ(stat.capacity, 64);
+
+    rfid_presence_destroy(&p);
+    RFID_CHECK(NULL == p);
+}
+
+/**
+ * @brief zone 별 설정, 기본 zone, (EPC, zone) 분리 추적과 DEPART 순서를 확인한다.
+ */
+static void TestZones_(void) {
+    rfid_presence_params_t params;
+    DefaultParams_(&params);
+    rfid_presence_t *p = NULL;
+    RFID_CHECK_EQ(rfid_presence_create(&params, &p), RFID_RESULT_OK);
+    if (NULL == p)
+        return;
+
+    rfid_presence_event_t ev[TEST_EVENT_MAX];
+
+    // 같은 EPC 라도 zone 이 다르면 따로 추적한다. 안테나 4 는 zone 미지정(zone 0).
+    const rfid_tag_t tags[] = {
+        MakeTag_(1U, 1, -60, 1U),
+        MakeTag_(1U, 3, -60, 1U),
+        MakeTag_(1U, 4, -60, 1U),
+        MakeTag_(2U, 2, -60, 1U),
+    };
+    int n = -1;
+    RFID_CHECK_EQ(rfid_presence_update(p, tags, 4, 1000U, ev, TEST_EVENT_MAX, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 4);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 1U);
+    CheckEvent_(&ev[1], RFID_PRESENCE_ARRIVE, 20, 1U);
+    CheckEvent_(&ev[2], RFID_PRESENCE_ARRIVE, 0, 1U);
+    CheckEvent_(&ev[3], RFID_PRESENCE_ARRIVE, 10, 2U);
+
+    // zone 10 에서 EPC 1 을 다시 읽으면 목록 뒤로 가므로 EPC 2 가 먼저 떠난다.
+    rfid_tag_t tag = MakeTag_(1U, 1, -60, 1U);
+    RFID_CHECK_EQ(Update_(p, &tag, 1100U, ev), 0);
+
+    // zone 10 depart 500: EPC 2 는 1500, EPC 1 은 1600 에 떠난다.
+    RFID_CHECK_EQ(Update_(p, NULL, 1500U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 2U);
+    RFID_CHECK_EQ(Update_(p, NULL, 1600U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 1U);
+    RFID_CHECK_EQ(ev[0].ts_ms, 1100);
+
+    // zone 0 depart 800
+    RFID_CHECK_EQ(Update_(p, NULL, 1799U, ev), 0);
+    RFID_CHECK_EQ(Update_(p, NULL, 1800U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 0, 1U);
+
+    // zone 20: holdoff 2000 이 지나야 PRESENT, depart 1500
+    tag = MakeTag_(1U, 3, -60, 1U);
+    RFID_CHECK_EQ(Update_(p, &tag, 2000U, ev), 0);
+    RFID_CHECK_EQ(Update_(p, &tag, 3000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_PRESENT, 20, 1U);
+    RFID_CHECK_EQ(Update_(p, NULL, 4499U, ev), 0);
+    RFID_CHECK_EQ(Update_(p, NULL, 4500U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 20, 1U);
+
+    rfid_presence_stat_t stat;
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.tracked, 0);
+    RFID_CHECK_EQ(stat.arrivals, 4);
+    RFID_CHECK_EQ(stat.departures, 4);
+    rfid_presence_destroy(&p);
+
+    // 범위를 벗어난 zone 안테나 번호
+    static const int bad_ants[] = { 0 };
+    const rfid_presence_zone_t bad_zone = { 1, bad_ants, 1, 0U, 0U };
+    params.zones = &bad_zone;
+    params.zone_count = 1;
+    RFID_CHECK_EQ(rfid_presence_create(&params, &p), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK(NULL == p);
+}
+
+/**
+ * @brief 이벤트 버퍼가 가득 찼을 때 미루기와 추적 용량 초과를 확인한다.
+ */
+static void TestDeferAndCapacity_(void) {
+    rfid_presence_params_t params;
+    DefaultParams_(&params);
+    params.capacity = 2U;
+    rfid_presence_t *p = NULL;
+    RFID_CHECK_EQ(rfid_presence_create(&params, &p), RFID_RESULT_OK);
+    if (NULL == p)
+        return;
+
+    rfid_presence_event_t ev[TEST_EVENT_MAX];
+    const rfid_tag_t tags[] = {
+        MakeTag_(1U, 1, -60, 1U),
+        MakeTag_(2U, 1, -60, 1U),
+        MakeTag_(3U, 1, -60, 1U),
+    };
+
+    // 버퍼 1칸: 두 번째 태그는 ARRIVE 를 낼 자리가 없어 추적을 시작하지 않는다.
+    int n = -1;
+    RFID_CHECK_EQ(rfid_presence_update(p, tags, 2, 1000U, ev, 1, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 1U);
+
+    // 다음 read 에서 ARRIVE. 세 번째 태그는 용량(2) 초과로 무시한다.
+    RFID_CHECK_EQ(rfid_presence_update(p, &tags[1], 2, 1100U, ev, TEST_EVENT_MAX, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 2U);
+
+    // DEPART 도 버퍼가 없으면 다음 호출로 미룬다.
+    RFID_CHECK_EQ(rfid_presence_update(p, NULL, 0, 2000U, ev, 0, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 0);
+    RFID_CHECK_EQ(rfid_presence_update(p, NULL, 0, 2000U, ev, 1, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 1U);
+    RFID_CHECK_EQ(Update_(p, NULL, 2000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 2U);
+
+    rfid_presence_stat_t stat;
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.deferred, 3);
+    RFID_CHECK_EQ(stat.table_full, 1);
+    RFID_CHECK_EQ(stat.tracked, 0);
+
+    // 떠난 자리는 다시 쓴다.
+    RFID_CHECK_EQ(Update_(p, &tags[2], 3000U, ev), 1);
+    CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 3U);
+
+    rfid_presence_destroy(&p);
+}
+
+/**
+ * @brief 임시 디렉터리와 그 안의 스냅샷 파일 경로를 만든다.
+ * @return 성공 1
+ */
+static int MakeSnapshotPath_(OUT_ char *out_dir, IN_ const size_t dir_size, OUT_ char *out_path, IN_ const size_t path_size) {
+    const int n = snprintf(out_dir, dir_size, "/tmp/rfid_test_presence.XXXXXX");
+    if ((n <= 0) || ((size_t) n >= dir_size) || (NULL == mkdtemp(out_dir)))
+        return 0;
+    const int m = snprintf(out_path, path_size, "%s/presence.snap", out_dir);
+    return ((m > 0) && ((size_t) m < path_size)) ? 1 : 0;
+}
+
+/**
+ * @brief 스냅샷 파일과 임시 디렉터리를 지운다.
+ */
+static void RemoveSnapshotPath_(IN_ const char *dir, IN_ const char *path) {
+    (void) unlink(path);
+    (void) rmdir(dir);
+}
+
+/**
+ * @brief 스냅샷을 쓰는 엔진을 만들고 복원한다.
+ * @return 엔진(실패 시 NULL)
+ */
+static rfid_presence_t* OpenRestored_(IN_ const rfid_presence_params_t *params
+                                      , IN_ const char *identity
+                                      , IN_ const uint64_t now_ms
+                                      , OUT_ uint32_t *out_restored) {
+    rfid_presence_t *p = NULL;
+    *out_restored = 0xFFFFFFFFU;
+    RFID_CHECK_EQ(rfid_presence_create(params, &p), RFID_RESULT_OK);
+    if (NULL != p)
+        RFID_CHECK_EQ(rfid_presence_restore(p, identity, now_ms, out_restored), RFID_RESULT_OK);
+    return p;
+}
+
+/**
+ * @brief 재시작 후 복원한 항목이 가짜 ARRIVE 없이 이어지고, 중단 전 시각 관계를 유지하는지 확인한다.
+ */
+static void TestSnapshotRestore_(void) {
+    char dir[64];
+    char path[PATH_MAX];
+    RFID_CHECK(0 != MakeSnapshotPath_(dir, sizeof(dir), path, sizeof(path)));
+
+    rfid_presence_params_t params;
+    DefaultParams_(&params);
+    params.snapshot_path = path;
+    params.snapshot_interval_ms = 100000U;
+
+    // 첫 실행: 새 파일이라 복원할 것이 없다.
+    uint32_t restored = 0;
+    rfid_presence_t *p = OpenRestored_(&params, "reader-1", 1000U, &restored);
+    if (NULL == p) {
+        RemoveSnapshotPath_(dir, path);
+        return;
+    }
+    RFID_CHECK_EQ(restored, 0);
+
+    rfid_presence_event_t ev[TEST_EVENT_MAX];
+    const rfid_tag_t tags[] = {
+        MakeTag_(1U, 1, -60, 1U),
+        MakeTag_(2U, 3, -60, 1U),
+    };
+    int n = -1;
+    RFID_CHECK_EQ(rfid_presence_update(p, tags, 2, 1000U, ev, TEST_EVENT_MAX, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 2);
+    RFID_CHECK_EQ(Update_(p, &tags[0], 1200U, ev), 0);
+
+    // 복원은 첫 update 전에만 할 수 있다.
+    RFID_CHECK_EQ(rfid_presence_restore(p, "reader-1", 1200U, &restored), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_presence_snapshot(p), RFID_RESULT_OK);
+
+    rfid_presence_stat_t stat;
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.snapshots, 1);
+    RFID_CHECK(stat.snapshot_pages > 0U);
+    rfid_presence_destroy(&p);
+
+    // 다른 리더의 스냅샷은 복원하지 않는다.
+    p = OpenRestored_(&params, "reader-2", 50000U, &restored);
+    RFID_CHECK_EQ(restored, 0);
+    rfid_presence_destroy(&p);
+
+    // 같은 리더: 두 항목을 복원하고, 다시 읽어도 ARRIVE 를 내지 않는다.
+    p = OpenRestored_(&params, "reader-1", 50000U, &restored);
+    if (NULL == p) {
+        RemoveSnapshotPath_(dir, path);
+        return;
+    }
+    RFID_CHECK_EQ(restored, 2);
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.restored, 2);
+    RFID_CHECK_EQ(stat.tracked, 2);
+    RFID_CHECK_EQ(stat.arrivals, 0);
+
+    RFID_CHECK_EQ(Update_(p, &tags[0], 50010U, ev), 0);
+
+    // 시각은 중단 전 관계를 유지한 채 옮겨진다(중단 시간은 수 ms 이내).
+    // EPC 1: first_seen 은 마지막 기록 시각 200 ms 전, EPC 2: 마지막 read 가 200 ms 전.
+    RFID_CHECK_EQ(Update_(p, NULL, 51400U, ev), 2);
+    CheckEvent_(&ev[0], RFID_PRESENCE_DEPART, 10, 1U);
+    CheckEvent_(&ev[1], RFID_PRESENCE_DEPART, 20, 2U);
+    RFID_CHECK_EQ(ev[0].ts_ms, 50010);
+    RFID_CHECK((ev[0].first_seen_ms <= 49800U) && (ev[0].first_seen_ms > 49700U));
+    RFID_CHECK((ev[1].ts_ms <= 49800U) && (ev[1].ts_ms > 49700U));
+    RFID_CHECK_EQ(ev[1].first_seen_ms, ev[1].ts_ms);
+    RFID_CHECK_EQ(rfid_presence_get_stats(p, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.arrivals, 0);
+    RFID_CHECK_EQ(stat.departures, 2);
+    rfid_presence_destroy(&p);
+
+    RemoveSnapshotPath_(dir, path);
+}
+
+/**
+ * @brief 스냅샷 파일에서 한 바이트를 뒤집는다.
+ */
+static void FlipByte_(IN_ const char *path, IN_ const off_t offset) {
+    const int fd = open(path, O_RDWR);
+    RFID_CHECK(fd >= 0);
+    if (fd < 0)
+        return;
+    uint8_t b = 0;
+    RFID_CHECK_EQ(pread(fd, &b, 1U, offset), 1);
+    b ^= 0x01U;
+    RFID_CHECK_EQ(pwrite(fd, &b, 1U, offset), 1);
+    (void) close(fd);
+}
+
+/**
+ * @brief 깨진 최신 슬롯 대신 이전 슬롯을 쓰고, 오래됐거나 형식이 다른 스냅샷은 버리는지 확인한다.
+ */
+static void TestSnapshotFallback_(void) {
+    char dir[64];
+    char path[PATH_MAX];
+    RFID_CHECK(0 != MakeSnapshotPath_(dir, sizeof(dir), path, sizeof(path)));
+
+    rfid_presence_params_t params;
+    DefaultParams_(&params);
+    params.snapshot_path = path;
+    params.snapshot_interval_ms = 100000U;
+
+    rfid_presence_t *writer = NULL;
+    RFID_CHECK_EQ(rfid_presence_create(&params, &writer), RFID_RESULT_OK);
+    if (NULL == writer) {
+        RemoveSnapshotPath_(dir, path);
+        return;
+    }
+
+    // 슬롯은 번갈아 쓴다: 첫 기록은 슬롯 1(EPC 1), 두 번째는 슬롯 0(EPC 1, 2).
+    rfid_presence_event_t ev[TEST_EVENT_MAX];
+    const rfid_tag_t tag1 = MakeTag_(1U, 1, -60, 1U);
+    const rfid_tag_t tag2 = MakeTag_(2U, 1, -60, 1U);
+    RFID_CHECK_EQ(Update_(writer, &tag1, 1000U, ev), 1);
+    RFID_CHECK_EQ(rfid_presence_snapshot(writer), RFID_RESULT_OK);
+    RFID_CHECK_EQ(Update_(writer, &tag2, 1100U, ev), 1);
+    RFID_CHECK_EQ(rfid_presence_snapshot(writer), RFID_RESULT_OK);
+
+    // writer 를 닫지 않은 채(비정상 종료) 최신 슬롯 0 의 첫 항목 페이지를 깨뜨린다.
+    // 파일 배치: 헤더 페이지, 슬롯 0(메타 페이지 + 항목/해시 페이지), 슬롯 1.
+    FlipByte_(path, (off_t) (2 * TEST_SNAP_PAGE));
+
+    uint32_t restored = 0;
+    rfid_presence_t *p = OpenRestored_(&params, NULL, 5000U, &restored);
+    RFID_CHECK_EQ(restored, 1);
+    if (NULL != p) {
+        // 복원한 EPC 1 은 이어가고, 슬롯 1 에 없던 EPC 2 는 새로 ARRIVE 한다.
+        RFID_CHECK_EQ(Update_(p, &tag1, 5001U, ev), 0);
+        RFID_CHECK_EQ(Update_(p, &tag2, 5002U, ev), 1);
+        CheckEvent_(&ev[0], RFID_PRESENCE_ARRIVE, 10, 2U);
+    }
+    rfid_presence_destroy(&p);
+    rfid_presence_destroy(&writer);
+
+    // 최대 나이를 넘은 스냅샷은 복원하지 않는다.
+    const struct timespec wait = { 0, 20L * 1000000L };
+    (void) nanosleep(&wait, NULL);
+    rfid_presence_params_t aged = params;
+    aged.snapshot_max_age_ms = 1U;
+    p = OpenRestored_(&aged, NULL, 9000U, &restored);
+    RFID_CHECK_EQ(restored, 0);
+    rfid_presence_destroy(&p);
+
+    // 같은 파일로 되돌리면 정상 종료 때 기록한 스냅샷을 다시 쓴다.
+    p = OpenRestored_(&params, NULL, 9000U, &restored);
+    RFID_CHECK_EQ(restored, 2);
+    rfid_presence_destroy(&p);
+
+    // 용량(형식)이 다르면 파일을 새로 만들고 복원하지 않는다.
+    rfid_presence_params_t resized = params;
+    resized.capacity = 128U;
+    p = OpenRestored_(&resized, NULL, 9000U, &restored);
+    RFID_CHECK_EQ(restored, 0);
+    rfid_presence_destroy(&p);
+
+    RemoveSnapshotPath_(dir, path);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestLifecycle_);
+    RFID_TEST_RUN(TestZones_);
+    RFID_TEST_RUN(TestDeferAndCapacity_);
+    RFID_TEST_RUN(TestSnapshotRestore_);
+    RFID_TEST_RUN(TestSnapshotFallback_);
+    return RFID_TEST_RESULT();
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_tag_bus.c
+ * @brief 공유 메모리 태그 버스(rfid_tag_bus) 단위 테스트
+ *
+ * - 발행한 레코드를 seq 순서로 읽고, 링을 한 바퀴 넘게 밀리면 overrun 손실 수를 보고하는지
+ * - peek 가 링 끝에서 구간을 끊고, release 가 처리 중 덮어쓰기를 알려주는지
+ * - 발행자가 닫으면 남은 레코드 뒤에 닫힘을 알리고, 재시작하면 seq 를 이어 받는지
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <unistd.h>
+
+#include "rfid_tag_bus.h"
+#include "rfid_test.h"
+
+#define TEST_BUS_CAPACITY  (16U)  /**< 테스트용 링 용량 */
+
+/**
+ * @brief 프로세스마다 다른 버스 이름을 만든다(동시에 도는 ctest 끼리 겹치지 않게).
+ */
+static void BusName_(OUT_ char *out_name, IN_ const size_t size, IN_ const char *suffix) {
+    (void) snprintf(out_name, size, "rfid_test_bus_%ld_%s", (long) getpid(), suffix);
+}
+
+/**
+ * @brief 태그 count 건을 발행한다(epc 마지막 바이트 = first + i).
+ */
+static void Publish_(IN_ rfid_tag_bus_t *bus, IN_ const int first, IN_ const int count) {
+    rfid_tag_t tags[64];
+    RFID_CHECK(count <= (int) (sizeof(tags) / sizeof(tags[0])));
+    memset(tags, 0, sizeof(tags));
+    for (int i = 0; i < count; ++i) {
+        tags[i].epc_len = 12U;
+        tags[i].epc_bytes[0] = 0x30;
+        tags[i].epc_bytes[11] = (uint8_t) (first + i);
+        tags[i].ts = (uint64_t) (first + i);
+    }
+    RFID_CHECK_EQ(rfid_tag_bus_publish(bus, 3U, tags, count), count);
+}
+
+/**
+ * @brief 레코드들이 first_seq 부터 seq 가 이어지고 내용이 발행 순서와 같은지 확인한다.
+ */
+static void CheckRecords_(IN_ const rfid_tag_log_record_t *recs, IN_ const int count, IN_ const uint64_t first_seq) {
+    for (int i = 0; i < count; ++i) {
+        const uint64_t seq = first_seq + (uint64_t) i;
+        if ((recs[i].seq != seq) || (recs[i].ts != seq) || (recs[i].epc[11] != (uint8_t) seq) || (3U != recs[i].reader_id)) {
+            RFID_CHECK_EQ(recs[i].seq, seq);
+            RFID_CHECK_EQ(recs[i].ts, seq);
+            RFID_CHECK_EQ(recs[i].epc[11], (uint8_t) seq);
+            RFID_CHECK_EQ(recs[i].reader_id, 3);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 순서대로 읽기와 overrun 손실 보고를 확인한다.
+ */
+static void TestReadOverrun_(void) {
+    char name[64];
+    BusName_(name, sizeof(name), "read");
+
+    rfid_tag_bus_sub_t *early = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 0, &early), RFID_RESULT_NOT_INITIALIZED);
+
+    rfid_tag_bus_t *bus = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_create(name, TEST_BUS_CAPACITY, &bus), RFID_RESULT_OK);
+    if (NULL == bus)
+        return;
+
+    rfid_tag_bus_sub_t *sub = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 0, &sub), RFID_RESULT_OK);
+    if (NULL == sub) {
+        rfid_tag_bus_destroy(&bus);
+        return;
+    }
+
+    rfid_tag_log_record_t recs[32];
+    int n = -1;
+    uint64_t lost = 99U;
+
+    // 새 레코드가 없으면 바로 돌아온다.
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 0);
+    RFID_CHECK_EQ(lost, 0);
+
+    Publish_(bus, 1, 5);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 5);
+    RFID_CHECK_EQ(lost, 0);
+    CheckRecords_(recs, n, 1U);
+
+    // 버퍼 용량만큼만 가져가고 나머지는 다음 호출에서 이어 읽는다.
+    Publish_(bus, 6, 4);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 3, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 3);
+    CheckRecords_(recs, n, 6U);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    CheckRecords_(recs, n, 9U);
+
+    // 링(16)보다 많이 밀리면 덮어쓰인 만큼 손실로 보고하고 가장 오래된 유효 레코드부터 읽는다.
+    // head 는 9 + 40 = 49, 유효 구간은 34 ~ 49, 다음 읽을 seq 는 10 → 손실 24.
+    Publish_(bus, 10, 40);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(lost, 24);
+    RFID_CHECK_EQ(n, 16);
+    CheckRecords_(recs, n, 34U);
+
+    // 새 구독자: from_oldest 이면 링에 남은 유효 구간부터, 아니면 이후 발행분부터 읽는다.
+    rfid_tag_bus_sub_t *oldest = NULL;
+    rfid_tag_bus_sub_t *latest = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 1, &oldest), RFID_RESULT_OK);
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 0, &latest), RFID_RESULT_OK);
+    if ((NULL != oldest) && (NULL != latest)) {
+        RFID_CHECK_EQ(rfid_tag_bus_read(oldest, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+        RFID_CHECK_EQ(n, 16);
+        RFID_CHECK_EQ(lost, 0);
+        CheckRecords_(recs, n, 34U);
+        RFID_CHECK_EQ(rfid_tag_bus_read(latest, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+        RFID_CHECK_EQ(n, 0);
+    }
+    rfid_tag_bus_unsubscribe(&oldest);
+    rfid_tag_bus_unsubscribe(&latest);
+    RFID_CHECK(NULL == oldest);
+
+    // 발행자가 닫으면 남은 레코드를 먼저 돌려주고, 그 다음 닫힘을 알린다.
+    Publish_(bus, 50, 2);
+    rfid_tag_bus_destroy(&bus);
+    RFID_CHECK(NULL == bus);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 2);
+    CheckRecords_(recs, n, 50U);
+    RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, -1, &n, &lost), RFID_RESULT_NOT_INITIALIZED);
+    RFID_CHECK_EQ(n, 0);
+    rfid_tag_bus_unsubscribe(&sub);
+
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 0, &sub), RFID_RESULT_NOT_INITIALIZED);
+}
+
+/**
+ * @brief peek 구간 분할과 release 의 덮어쓰기 판정을 확인한다.
+ */
+static void TestPeekRelease_(void) {
+    char name[64];
+    BusName_(name, sizeof(name), "peek");
+
+    rfid_tag_bus_t *bus = NULL;
+    rfid_tag_bus_sub_t *sub = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_create(name, TEST_BUS_CAPACITY, &bus), RFID_RESULT_OK);
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 0, &sub), RFID_RESULT_OK);
+    if ((NULL == bus) || (NULL == sub)) {
+        rfid_tag_bus_unsubscribe(&sub);
+        rfid_tag_bus_destroy(&bus);
+        return;
+    }
+
+    const rfid_tag_log_record_t *recs = NULL;
+    int n = -1;
+    uint64_t lost = 99U;
+
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK(NULL == recs);
+    RFID_CHECK_EQ(n, 0);
+
+    // seq 1 ~ 13 을 모두 소비해 읽기 위치를 링 끝(슬롯 14) 근처로 옮긴다.
+    Publish_(bus, 1, 13);
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 13);
+    CheckRecords_(recs, n, 1U);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, n), 1);
+
+    // seq 14 ~ 23: 슬롯 14, 15 에서 링 끝을 만나 구간이 끊긴다.
+    Publish_(bus, 14, 10);
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 2);
+    RFID_CHECK_EQ(lost, 0);
+    CheckRecords_(recs, n, 14U);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, n), 1);
+
+    // 일부만 소비하면 다음 peek 는 소비하지 않은 레코드부터 시작한다.
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 8);
+    CheckRecords_(recs, n, 16U);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, 3), 1);
+
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 5);
+    CheckRecords_(recs, n, 19U);
+
+    // 참조하는 동안 발행자가 링을 한 바퀴 넘게 돌면 release 가 덮어쓰기를 알린다.
+    // head 는 23 + 20 = 43, 유효 구간은 28 ~ 43, 다음 읽을 seq 는 24 → 손실 4.
+    Publish_(bus, 24, 20);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, n), 0);
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(lost, 4);
+    RFID_CHECK_EQ(n, 4);
+    CheckRecords_(recs, n, 28U);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, n), 1);
+
+    // 링 처음부터 이어지는 나머지 구간
+    RFID_CHECK_EQ(rfid_tag_bus_peek(sub, 0, &recs, &n, &lost), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 12);
+    RFID_CHECK_EQ(lost, 0);
+    CheckRecords_(recs, n, 32U);
+    RFID_CHECK_EQ(rfid_tag_bus_release(sub, n), 1);
+
+    rfid_tag_bus_unsubscribe(&sub);
+    rfid_tag_bus_destroy(&bus);
+}
+
+/**
+ * @brief 발행자 재시작(같은 이름/용량) 시 링과 seq 를 이어 받는지 확인한다.
+ */
+static void TestPublisherRestart_(void) {
+    char name[64];
+    BusName_(name, sizeof(name), "restart");
+
+    // 첫 발행자는 destroy 없이 남겨 비정상 종료를 흉내 낸다.
+    rfid_tag_bus_t *crashed = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_create(name, TEST_BUS_CAPACITY, &crashed), RFID_RESULT_OK);
+    if (NULL == crashed)
+        return;
+    Publish_(crashed, 1, 3);
+
+    rfid_tag_bus_sub_t *sub = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_subscribe(name, 1, &sub), RFID_RESULT_OK);
+
+    rfid_tag_bus_t *bus = NULL;
+    RFID_CHECK_EQ(rfid_tag_bus_create(name, TEST_BUS_CAPACITY, &bus), RFID_RESULT_OK);
+    if (NULL != bus)
+        Publish_(bus, 4, 2);
+
+    rfid_tag_log_record_t recs[32];
+    int n = 0;
+    uint64_t lost = 0;
+    if (NULL != sub) {
+        RFID_CHECK_EQ(rfid_tag_bus_read(sub, recs, 32, 0, &n, &lost), RFID_RESULT_OK);
+        RFID_CHECK_EQ(n, 5);
+        RFID_CHECK_EQ(lost, 0);
+        CheckRecords_(recs, n, 1U);
+    }
+
+    rfid_tag_bus_unsubscribe(&sub);
+    rfid_tag_bus_destroy(&bus);
+    rfid_tag_bus_destroy(&crashed);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestReadOverrun_);
+    RFID_TEST_RUN(TestPeekRelease_);
+    RFID_TEST_RUN(TestPublisherRestart_);
+    return RFID_TEST_RESULT();
+}
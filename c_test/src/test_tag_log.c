@@ -0,0 +1,299 @@
+/**
+ * @file test_tag_log.c
+ * @brief mmap 태그 로그(rfid_tag_log) 단위 테스트
+ *
+ * - 세그먼트 크기를 넘기면 다음 번호 세그먼트로 넘어가고 seq 가 이어지는지
+ * - max_segments 를 넘는 오래된 세그먼트를 지우고, 다시 열면 번호/seq 를 이어 받는지
+ * - 비정상 종료로 committed 뒤 레코드만 남은 세그먼트에서 유효 레코드 수를 복구하는지
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <limits.h>
+#include <unistd.h>
+
+#include "rfid_tag_log.h"
+#include "rfid_test.h"
+
+#define TEST_SEG_RECORDS  (100U)  /**< 테스트용 세그먼트당 레코드 수 */
+#define TEST_HEADER_SIZE  (4096U) /**< 세그먼트 헤더 영역 크기(구현과 같은 값) */
+
+/**
+ * @brief 임시 디렉터리를 만든다.
+ * @return 성공 1
+ */
+static int MakeTempDir_(OUT_ char *out_dir, IN_ const size_t size) {
+    const int n = snprintf(out_dir, size, "/tmp/rfid_test_tag_log.XXXXXX");
+    return ((n > 0) && ((size_t) n < size) && (NULL != mkdtemp(out_dir))) ? 1 : 0;
+}
+
+/**
+ * @brief 디렉터리의 파일을 모두 지우고 디렉터리를 지운다.
+ */
+static void RemoveDir_(IN_ const char *dir) {
+    DIR *d = opendir(dir);
+    if (NULL != d) {
+        const struct dirent *e;
+        char path[PATH_MAX];
+        while (NULL != (e = readdir(d))) {
+            if ((0 == strcmp(e->d_name, ".")) || (0 == strcmp(e->d_name, "..")))
+                continue;
+            if (snprintf(path, sizeof(path), "%s/%s", dir, e->d_name) < (int) sizeof(path))
+                (void) unlink(path);
+        }
+        (void) closedir(d);
+    }
+    (void) rmdir(dir);
+}
+
+/**
+ * @brief 디렉터리의 세그먼트 파일(.rtl) 수를 센다.
+ */
+static int CountSegments_(IN_ const char *dir) {
+    int n = 0;
+    DIR *d = opendir(dir);
+    if (NULL == d)
+        return -1;
+    const struct dirent *e;
+    while (NULL != (e = readdir(d))) {
+        const size_t len = strlen(e->d_name);
+        if ((len > 4U) && (0 == strcmp(e->d_name + len - 4U, ".rtl")))
+            ++n;
+    }
+    (void) closedir(d);
+    return n;
+}
+
+/**
+ * @brief 세그먼트 파일 경로(<dir>/tags-<index 10자리>.rtl)
+ */
+static void SegmentPath_(IN_ const char *dir, IN_ const uint64_t index, OUT_ char *out_path, IN_ const size_t size) {
+    (void) snprintf(out_path, size, "%s/tags-%010llu.rtl", dir, (unsigned long long) index);
+}
+
+/**
+ * @brief 태그 로그를 열어 count 건을 기록하고 닫는다(ts 는 ts_base 부터 1씩 증가).
+ */
+static void WriteTags_(IN_ const char *dir, IN_ const uint32_t max_segments, IN_ const int count, IN_ const uint64_t ts_base) {
+    rfid_tag_log_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.dir = dir;
+    params.segment_records = TEST_SEG_RECORDS;
+    params.queue_records = 1024U;
+    params.max_segments = max_segments;
+
+    rfid_tag_log_t *log = NULL;
+    RFID_CHECK_EQ(rfid_tag_log_open(&params, &log), RFID_RESULT_OK);
+    if (NULL == log)
+        return;
+
+    rfid_tag_t tag;
+    memset(&tag, 0, sizeof(tag));
+    tag.antenna = 1;
+    tag.rssi = -60;
+    tag.epc_len = 12U;
+    tag.epc_bytes[0] = 0x30;
+    for (int i = 0; i < count; ++i) {
+        tag.ts = ts_base + (uint64_t) i;
+        tag.epc_bytes[11] = (uint8_t) i;
+        RFID_CHECK_EQ(rfid_tag_log_append(log, 7U, &tag, 1), 1);
+    }
+    RFID_CHECK_EQ(rfid_tag_log_flush(log), RFID_RESULT_OK);
+
+    rfid_tag_log_stat_t stat;
+    RFID_CHECK_EQ(rfid_tag_log_get_stats(log, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.appended, count);
+    RFID_CHECK_EQ(stat.dropped, 0);
+    RFID_CHECK_EQ(stat.written, count);
+    RFID_CHECK_EQ(stat.synced, count);
+    RFID_CHECK_EQ(stat.lost, 0);
+    rfid_tag_log_close(&log);
+    RFID_CHECK(NULL == log);
+}
+
+/**
+ * @brief 세그먼트를 매핑해 헤더와 레코드를 확인한다.
+ *
+ * @param[in] dir 디렉터리
+ * @param[in] index 세그먼트 번호
+ * @param[in] first_seq 기대하는 첫 seq
+ * @param[in] count 기대하는 유효 레코드 수
+ * @param[in] ts_first 첫 레코드의 기대 ts
+ */
+static void CheckSegment_(IN_ const char *dir
+                          , IN_ const uint64_t index
+                          , IN_ const uint64_t first_seq
+                          , IN_ const uint64_t count
+                          , IN_ const uint64_t ts_first) {
+    char path[PATH_MAX];
+    SegmentPath_(dir, index, path, sizeof(path));
+    rfid_tag_log_segment_t *seg = NULL;
+    RFID_CHECK_EQ(rfid_tag_log_segment_map(path, &seg), RFID_RESULT_OK);
+    if (NULL == seg)
+        return;
+
+    const rfid_tag_log_header_t *hdr = rfid_tag_log_segment_header(seg);
+    RFID_CHECK_EQ(hdr->segment_index, index);
+    RFID_CHECK_EQ(hdr->first_seq, first_seq);
+    RFID_CHECK_EQ(hdr->record_capacity, TEST_SEG_RECORDS);
+
+    uint64_t n = 0;
+    const rfid_tag_log_record_t *recs = rfid_tag_log_segment_records(seg, &n);
+    RFID_CHECK_EQ(n, count);
+    for (uint64_t i = 0; (NULL != recs) && (i < n); ++i) {
+        if ((recs[i].seq != first_seq + i) || (recs[i].ts != ts_first + i)) {
+            RFID_CHECK_EQ(recs[i].seq, first_seq + i);
+            RFID_CHECK_EQ(recs[i].ts, ts_first + i);
+            break;
+        }
+    }
+    if ((NULL != recs) && (n > 0U)) {
+        RFID_CHECK_EQ(recs[0].reader_id, 7);
+        RFID_CHECK_EQ(recs[0].epc_len, 12);
+        RFID_CHECK_EQ(recs[0].epc[0], 0x30);
+    }
+    rfid_tag_log_segment_unmap(&seg);
+}
+
+/**
+ * @brief 세그먼트 크기를 넘기면 다음 세그먼트로 넘어가는지 확인한다.
+ */
+static void TestRotation_(void) {
+    char dir[64];
+    RFID_CHECK(0 != MakeTempDir_(dir, sizeof(dir)));
+
+    WriteTags_(dir, 0U, 350, 1000U);
+
+    // 예비 세그먼트는 close 에서 지워지고, 기록한 세그먼트 4개만 남는다.
+    RFID_CHECK_EQ(CountSegments_(dir), 4);
+    CheckSegment_(dir, 0U, 1U, 100U, 1000U);
+    CheckSegment_(dir, 1U, 101U, 100U, 1100U);
+    CheckSegment_(dir, 2U, 201U, 100U, 1200U);
+    CheckSegment_(dir, 3U, 301U, 50U, 1300U);
+
+    RemoveDir_(dir);
+}
+
+/**
+ * @brief 보관 개수를 넘는 세그먼트 삭제와 다시 열 때 번호/seq 이어 받기를 확인한다.
+ */
+static void TestRetention_(void) {
+    char dir[64];
+    RFID_CHECK(0 != MakeTempDir_(dir, sizeof(dir)));
+
+    WriteTags_(dir, 2U, 500, 0U);
+    RFID_CHECK_EQ(CountSegments_(dir), 2);
+    CheckSegment_(dir, 3U, 301U, 100U, 300U);
+    CheckSegment_(dir, 4U, 401U, 100U, 400U);
+
+    char path[PATH_MAX];
+    SegmentPath_(dir, 2U, path, sizeof(path));
+    RFID_CHECK(0 != access(path, F_OK));
+
+    // 다시 열면 다음 번호(5)와 다음 seq(501)부터 기록하고, 보관 개수를 다시 맞춘다.
+    WriteTags_(dir, 2U, 10, 500U);
+    RFID_CHECK_EQ(CountSegments_(dir), 2);
+    CheckSegment_(dir, 4U, 401U, 100U, 400U);
+    CheckSegment_(dir, 5U, 501U, 10U, 500U);
+
+    RemoveDir_(dir);
+}
+
+/**
+ * @brief 기록 중 종료된 세그먼트 파일을 직접 만든다.
+ *
+ * 헤더 committed 뒤로 seq 가 이어지는 레코드 valid_tail 개를 두고, 그 다음 슬롯은 broken_seq 로 채운다.
+ */
+static int WriteCrashedSegment_(IN_ const char *dir
+                                , IN_ const uint64_t index
+                                , IN_ const uint64_t first_seq
+                                , IN_ const uint64_t committed
+                                , IN_ const uint64_t valid_tail
+                                , IN_ const uint64_t broken_seq) {
+    char path[PATH_MAX];
+    SegmentPath_(dir, index, path, sizeof(path));
+    FILE *fp = fopen(path, "wb");
+    if (NULL == fp)
+        return 0;
+
+    static uint8_t header[TEST_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    rfid_tag_log_header_t *hdr = (rfid_tag_log_header_t *) header;
+    memcpy(hdr->magic, RFID_TAG_LOG_MAGIC, sizeof(hdr->magic));
+    hdr->version = RFID_TAG_LOG_VERSION;
+    hdr->header_size = TEST_HEADER_SIZE;
+    hdr->record_size = (uint32_t) sizeof(rfid_tag_log_record_t);
+    hdr->record_capacity = TEST_SEG_RECORDS;
+    hdr->segment_index = index;
+    hdr->first_seq = first_seq;
+    hdr->committed = committed;
+    int ok = (1U == fwrite(header, sizeof(header), 1U, fp)) ? 1 : 0;
+
+    // 미리 할당한 세그먼트처럼 record_capacity 슬롯을 모두 둔다(기록되지 않은 슬롯은 0).
+    for (uint64_t i = 0; (0 != ok) && (i < TEST_SEG_RECORDS); ++i) {
+        rfid_tag_log_record_t rec;
+        memset(&rec, 0, sizeof(rec));
+        if (i < committed + valid_tail) {
+            rec.seq = first_seq + i;
+            rec.ts = first_seq + i;
+            rec.reader_id = 7U;
+            rec.epc_len = 12U;
+            rec.epc[0] = 0x30;
+        } else if (i == committed + valid_tail) {
+            rec.seq = broken_seq;
+        }
+        ok = (1U == fwrite(&rec, sizeof(rec), 1U, fp)) ? 1 : 0;
+    }
+    return ((0 == fclose(fp)) && (0 != ok)) ? 1 : 0;
+}
+
+/**
+ * @brief 비정상 종료 세그먼트의 유효 레코드 수 복구와 이어 쓰기를 확인한다.
+ */
+static void TestCrashRecovery_(void) {
+    char dir[64];
+    RFID_CHECK(0 != MakeTempDir_(dir, sizeof(dir)));
+
+    // committed 20 + seq 가 이어지는 15개, 그 뒤 슬롯은 기록 전(seq 0)
+    RFID_CHECK(0 != WriteCrashedSegment_(dir, 0U, 1U, 20U, 15U, 0U));
+    CheckSegment_(dir, 0U, 1U, 35U, 1U);
+
+    // committed 뒤 첫 슬롯이 이전 내용(seq 불연속)이면 committed 까지만 유효하다.
+    RFID_CHECK(0 != WriteCrashedSegment_(dir, 1U, 36U, 20U, 0U, 9999U));
+    CheckSegment_(dir, 1U, 36U, 20U, 36U);
+
+    // committed 가 0이어도(첫 msync 전 종료) seq 가 이어지는 앞쪽 구간은 유효하다.
+    RFID_CHECK(0 != WriteCrashedSegment_(dir, 2U, 56U, 0U, 7U, 1U));
+    CheckSegment_(dir, 2U, 56U, 7U, 56U);
+
+    // 다시 열면 마지막 세그먼트의 유효 범위 다음 seq(63), 다음 번호(3)부터 기록한다.
+    WriteTags_(dir, 0U, 5, 63U);
+    CheckSegment_(dir, 3U, 63U, 5U, 63U);
+
+    // 형식이 아닌 파일은 매핑하지 않는다.
+    char path[PATH_MAX];
+    SegmentPath_(dir, 9U, path, sizeof(path));
+    FILE *fp = fopen(path, "wb");
+    if (NULL != fp) {
+        static const uint8_t junk[TEST_HEADER_SIZE] = { 'n', 'o', 't', 'a', 'l', 'o', 'g' };
+        (void) fwrite(junk, sizeof(junk), 1U, fp);
+        (void) fclose(fp);
+    }
+    rfid_tag_log_segment_t *seg = NULL;
+    RFID_CHECK_EQ(rfid_tag_log_segment_map(path, &seg), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK(NULL == seg);
+
+    RemoveDir_(dir);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestRotation_);
+    RFID_TEST_RUN(TestRetention_);
+    RFID_TEST_RUN(TestCrashRecovery_);
+    return RFID_TEST_RESULT();
+}
@@ -0,0 +1,272 @@
+/**
+ * @file test_timer_wheel.c
+ * @brief 계층형 타이밍 휠(rfid_timer_wheel) 단위 테스트
+ *
+ * - 무작위 등록/재등록/취소/진행에서 만료 결과가 단순 목록 비교(참조 모델)와 같은지
+ * - 해제된 타이머 id 는 세대가 바뀌어 같은 자리를 다시 써도 취소/재등록되지 않는지
+ * - 상위 단계 타이머가 하위 단계로 옮겨져(cascade) 정확한 시각에 만료되는지
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rfid_timer_wheel.h"
+#include "rfid_test.h"
+
+#define TEST_TIMERS      (512)    /**< 참조 모델 타이머 수 */
+#define TEST_STEPS       (20000)  /**< 참조 모델 무작위 연산 수 */
+#define TEST_EXPIRY_MAX  (64)     /**< advance 1회 만료 버퍼 */
+#define TEST_START_MS    (1000U)  /**< 휠 시작 시각 */
+
+static uint64_t test_rng_state_ = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief xorshift64* 난수
+ */
+static uint64_t NextRand_(void) {
+    uint64_t x = test_rng_state_;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    test_rng_state_ = x;
+    return x * 2685821657736338717ULL;
+}
+
+/**
+ * @brief 참조 모델 타이머
+ */
+typedef struct test_timer {
+    rfid_timer_id_t id;
+    uint64_t deadline_ms;
+    int active;
+} test_timer_t;
+
+/**
+ * @brief 만료 시각을 고른다(대부분 가까운 미래, 일부는 상위 단계/과거).
+ */
+static uint64_t PickDeadline_(IN_ const uint64_t now) {
+    switch (NextRand_() % 8U) {
+        case 0:
+            return (now > 50U) ? (now - (NextRand_() % 50U)) : now;  // 이미 지난 시각
+        case 1:
+            return now + (NextRand_() % 200000U);                    // 단계 2 이상
+        case 2:
+            return now + (NextRand_() % 20000000U);                  // 단계 3 이상
+        default:
+            return now + (NextRand_() % 3000U);
+    }
+}
+
+/**
+ * @brief 휠을 now 까지 진행하고 만료 결과를 참조 모델과 비교한다.
+ * @return 불일치 수
+ */
+static int AdvanceAndCheck_(IN_ rfid_timer_wheel_t *w, INOUT_ test_timer_t *ref, IN_ const uint64_t now) {
+    int bad = 0;
+    rfid_timer_expiry_t exp[TEST_EXPIRY_MAX];
+    int n = TEST_EXPIRY_MAX;
+    // 버퍼가 가득 차면 같은 now 로 다시 호출한다.
+    while (TEST_EXPIRY_MAX == n) {
+        RFID_CHECK_EQ(rfid_timer_wheel_advance(w, now, exp, TEST_EXPIRY_MAX, &n), RFID_RESULT_OK);
+        for (int i = 0; i < n; ++i) {
+            const uint64_t u = exp[i].user_data;
+            if ((u >= TEST_TIMERS) || (0 == ref[u].active) || (ref[u].id != exp[i].id)
+                || (ref[u].deadline_ms != exp[i].deadline_ms) || (exp[i].deadline_ms > now)) {
+                ++bad;
+                continue;
+            }
+            ref[u].active = 0;
+        }
+    }
+    // 만료 시각이 지난 타이머가 남아 있으면 늦게 만료되는 것이다.
+    for (int i = 0; i < TEST_TIMERS; ++i) {
+        if ((0 != ref[i].active) && (ref[i].deadline_ms <= now))
+            ++bad;
+    }
+    return bad;
+}
+
+/**
+ * @brief 무작위 연산에서 휠 결과가 참조 모델과 같은지 확인한다.
+ */
+static void TestMatchesReference_(void) {
+    rfid_timer_wheel_t *w = NULL;
+    RFID_CHECK_EQ(rfid_timer_wheel_create(TEST_TIMERS, TEST_START_MS, &w), RFID_RESULT_OK);
+    if (NULL == w)
+        return;
+
+    static test_timer_t ref[TEST_TIMERS];
+    memset(ref, 0, sizeof(ref));
+    uint64_t now = TEST_START_MS;
+    int active = 0;
+    int bad = 0;
+    uint64_t scheduled = 0;
+    uint64_t cancelled = 0;
+
+    for (int step = 0; step < TEST_STEPS; ++step) {
+        const uint32_t i = (uint32_t) (NextRand_() % TEST_TIMERS);
+        const uint64_t op = NextRand_() % 10U;
+        if (op < 4U) {
+            if (0 == ref[i].active) {
+                ref[i].deadline_ms = PickDeadline_(now);
+                RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, ref[i].deadline_ms, i, &ref[i].id), RFID_RESULT_OK);
+                ref[i].active = 1;
+            } else {
+                ref[i].deadline_ms = PickDeadline_(now);
+                RFID_CHECK_EQ(rfid_timer_wheel_reschedule(w, ref[i].id, ref[i].deadline_ms), RFID_RESULT_OK);
+            }
+            ++scheduled;
+        } else if (op < 5U) {
+            if (0 != ref[i].active) {
+                RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, ref[i].id), RFID_RESULT_OK);
+                ref[i].active = 0;
+                ++cancelled;
+            }
+        } else {
+            // 대부분 짧게, 가끔 상위 단계 경계를 여러 개 넘도록 길게 진행한다.
+            now += (0U == (NextRand_() % 50U)) ? (NextRand_() % 5000000U) : (NextRand_() % 700U);
+            bad += AdvanceAndCheck_(w, ref, now);
+        }
+    }
+    // 남은 타이머를 모두 만료시킨다.
+    now += 40000000U;
+    bad += AdvanceAndCheck_(w, ref, now);
+    RFID_CHECK_EQ(bad, 0);
+
+    for (int i = 0; i < TEST_TIMERS; ++i)
+        active += ref[i].active;
+    rfid_timer_wheel_stat_t stat;
+    RFID_CHECK_EQ(rfid_timer_wheel_get_stats(w, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(active, 0);
+    RFID_CHECK_EQ(stat.active, 0);
+    RFID_CHECK_EQ(stat.now_ms, now);
+    RFID_CHECK_EQ(stat.scheduled, scheduled);
+    RFID_CHECK_EQ(stat.cancelled, cancelled);
+    RFID_CHECK(stat.cascaded > 0U);
+    RFID_CHECK_EQ(stat.table_full, 0);
+
+    rfid_timer_wheel_destroy(&w);
+    RFID_CHECK(NULL == w);
+}
+
+/**
+ * @brief 해제된 id 의 세대 검사와 용량 초과를 확인한다.
+ */
+static void TestCancelByGeneration_(void) {
+    rfid_timer_wheel_t *w = NULL;
+    RFID_CHECK_EQ(rfid_timer_wheel_create(2U, TEST_START_MS, &w), RFID_RESULT_OK);
+    if (NULL == w)
+        return;
+
+    rfid_timer_id_t a = 0;
+    rfid_timer_id_t b = 0;
+    rfid_timer_id_t c = 0;
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, TEST_START_MS + 100U, 1U, &a), RFID_RESULT_OK);
+    RFID_CHECK(0U != a);
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, a), RFID_RESULT_OK);
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, a), RFID_RESULT_INVALID_ARG);
+
+    // 같은 자리를 다시 쓰지만 세대가 달라 옛 id 로는 건드릴 수 없다.
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, TEST_START_MS + 100U, 2U, &b), RFID_RESULT_OK);
+    RFID_CHECK_EQ(b & 0xFFFFFFFFULL, a & 0xFFFFFFFFULL);
+    RFID_CHECK(a != b);
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, a), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_timer_wheel_reschedule(w, a, TEST_START_MS + 5U), RFID_RESULT_INVALID_ARG);
+
+    // 없는 id, 범위 밖 id
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, 0U), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, (b & ~0xFFFFFFFFULL) | 3U), RFID_RESULT_INVALID_ARG);
+
+    // 용량(2) 초과
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, TEST_START_MS + 50U, 3U, &c), RFID_RESULT_OK);
+    rfid_timer_id_t d = 99U;
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, TEST_START_MS + 50U, 4U, &d), RFID_RESULT_INTERNAL_ERROR);
+    RFID_CHECK_EQ(d, 0);
+
+    rfid_timer_expiry_t exp[4];
+    int n = -1;
+    RFID_CHECK_EQ(rfid_timer_wheel_advance(w, TEST_START_MS + 100U, exp, 4, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 2);
+    if (2 == n) {
+        // 시각 순: c(+50) 다음 b(+100)
+        RFID_CHECK_EQ(exp[0].id, c);
+        RFID_CHECK_EQ(exp[0].user_data, 3);
+        RFID_CHECK_EQ(exp[1].id, b);
+        RFID_CHECK_EQ(exp[1].user_data, 2);
+    }
+
+    // 만료된 id 도 해제되었으므로 취소/재등록할 수 없다.
+    RFID_CHECK_EQ(rfid_timer_wheel_cancel(w, b), RFID_RESULT_INVALID_ARG);
+    RFID_CHECK_EQ(rfid_timer_wheel_reschedule(w, c, TEST_START_MS + 500U), RFID_RESULT_INVALID_ARG);
+
+    rfid_timer_wheel_stat_t stat;
+    RFID_CHECK_EQ(rfid_timer_wheel_get_stats(w, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.cancelled, 1);
+    RFID_CHECK_EQ(stat.expired, 2);
+    RFID_CHECK_EQ(stat.table_full, 1);
+    RFID_CHECK_EQ(stat.active, 0);
+
+    rfid_timer_wheel_destroy(&w);
+}
+
+/**
+ * @brief 상위 단계 타이머의 cascade, 만료 버퍼 분할, 시각 되돌림 무시를 확인한다.
+ */
+static void TestCascade_(void) {
+    rfid_timer_wheel_t *w = NULL;
+    RFID_CHECK_EQ(rfid_timer_wheel_create(16U, TEST_START_MS, &w), RFID_RESULT_OK);
+    if (NULL == w)
+        return;
+
+    // 1000(0x3E8) 와 71000(0x11558) 은 단계 2 자리부터 다르다: 단계 2 → 1 → 0 으로 두 번 옮겨진다.
+    rfid_timer_id_t id = 0;
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, 71000U, 7U, &id), RFID_RESULT_OK);
+
+    rfid_timer_expiry_t exp[4];
+    int n = -1;
+    RFID_CHECK_EQ(rfid_timer_wheel_advance(w, 70999U, exp, 4, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 0);
+    rfid_timer_wheel_stat_t stat;
+    RFID_CHECK_EQ(rfid_timer_wheel_get_stats(w, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.cascaded, 2);
+    RFID_CHECK_EQ(stat.now_ms, 70999);
+
+    RFID_CHECK_EQ(rfid_timer_wheel_advance(w, 71000U, exp, 4, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    RFID_CHECK_EQ(exp[0].id, id);
+    RFID_CHECK_EQ(exp[0].deadline_ms, 71000);
+
+    // 오래 호출하지 않아도 한 번의 advance 로 먼 시각까지 건너뛴다.
+    RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, 500000000U, 8U, &id), RFID_RESULT_OK);
+    RFID_CHECK_EQ(rfid_timer_wheel_advance(w, 1000000000U, exp, 4, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 1);
+    RFID_CHECK_EQ(exp[0].user_data, 8);
+
+    // 시각은 되돌리지 않고, 지난 시각 등록은 다음 advance 에서 바로 만료된다.
+    RFID_CHECK_EQ(rfid_timer_wheel_advance(w, 5000U, exp, 4, &n), RFID_RESULT_OK);
+    RFID_CHECK_EQ(n, 0);
+    RFID_CHECK_EQ(rfid_timer_wheel_get_stats(w, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.now_ms, 1000000000U);
+
+    // 같은 ms 의 만료 5개를 버퍼 2칸으로 나눠 꺼낸다.
+    for (uint64_t u = 0; u < 5U; ++u)
+        RFID_CHECK_EQ(rfid_timer_wheel_schedule(w, 999999000U, u, &id), RFID_RESULT_OK);
+    int total = 0;
+    for (int round = 0; round < 3; ++round) {
+        RFID_CHECK_EQ(rfid_timer_wheel_advance(w, 1000000000U, exp, 2, &n), RFID_RESULT_OK);
+        RFID_CHECK_EQ(n, (round < 2) ? 2 : 1);
+        total += n;
+    }
+    RFID_CHECK_EQ(total, 5);
+    RFID_CHECK_EQ(rfid_timer_wheel_get_stats(w, &stat), RFID_RESULT_OK);
+    RFID_CHECK_EQ(stat.active, 0);
+
+    rfid_timer_wheel_destroy(&w);
+}
+
+int main(void) {
+    RFID_TEST_RUN(TestMatchesReference_);
+    RFID_TEST_RUN(TestCancelByGeneration_);
+    RFID_TEST_RUN(TestCascade_);
+    return RFID_TEST_RESULT();
+}
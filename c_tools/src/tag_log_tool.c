@@ -0,0 +1,497 @@
+/**
+ * @file tag_log_tool.c
+ * @brief 태그 로그(.rtl) 세그먼트 조회/필터/변환 도구
+ *
+ * 세그먼트를 mmap 으로 읽어 고정 크기 레코드를 순차 스캔한다(파싱 없이 레코드 비교만 수행).
+ *
+ * 사용법: rfid_tag_log_tool <command> [options] <segment.rtl | dir>...
+ *   stat   세그먼트별 헤더/유효 레코드 수/시간 범위
+ *   count  필터에 일치하는 레코드 수와 스캔 속도
+ *   csv    CSV 로 출력(stdout)
+ *   jsonl  JSON Lines 로 출력(stdout)
+ *   bin    일치한 레코드를 새 세그먼트 파일(-o)로 저장
+ *
+ * options:
+ *   --epc HEX       EPC 접두사(hex, nibble 단위)
+ *   --antenna N     안테나 번호
+ *   --reader N      리더 id
+ *   --rule N        EPC 규칙 id
+ *   --from MS       ts >= MS
+ *   --to MS         ts < MS
+ *   --min-rssi DBM  rssi >= DBM
+ *   -o FILE         bin 출력 파일
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "rfid_tag_log.h"
+
+#define TOOL_OUT_BUFFER     (1U << 20)  /**< 출력 버퍼 크기 */
+#define TOOL_LINE_MAX       (256)       /**< 레코드 1건 최대 출력 길이 */
+#define TOOL_HEADER_SIZE    (4096U)     /**< bin 출력 세그먼트 헤더 영역 */
+
+/**
+ * @brief 레코드 필터(0/-1 값은 미사용)
+ */
+typedef struct tool_filter {
+    uint8_t epc[RFID_TAG_LOG_EPC_BYTES];
+    uint8_t epc_mask[RFID_TAG_LOG_EPC_BYTES];
+    uint32_t epc_bytes; // 비교할 바이트 수(마지막 바이트는 상위 nibble 만 비교할 수 있음)
+    int antenna;
+    int reader;
+    int64_t rule;
+    int use_from;
+    uint64_t from;
+    int use_to;
+    uint64_t to;
+    int use_rssi;
+    int min_rssi;
+} tool_filter_t;
+
+/**
+ * @brief 버퍼 출력기
+ */
+typedef struct tool_out {
+    FILE *fp;
+    char *buf;
+    size_t len;
+} tool_out_t;
+
+/**
+ * @brief 단조 시계 기준 현재 시각(ns)
+ */
+static uint64_t NowNs_(void) {
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief 필터 일치 여부
+ */
+static int Match_(IN_ const tool_filter_t *f, IN_ const rfid_tag_log_record_t *r) {
+    if ((f->antenna >= 0) && (r->antenna != f->antenna))
+        return 0;
+    if ((f->reader >= 0) && (r->reader_id != f->reader))
+        return 0;
+    if ((f->rule >= 0) && ((int64_t) r->rule_id != f->rule))
+        return 0;
+    if ((0 != f->use_from) && (r->ts < f->from))
+        return 0;
+    if ((0 != f->use_to) && (r->ts >= f->to))
+        return 0;
+    if ((0 != f->use_rssi) && (r->rssi < f->min_rssi))
+        return 0;
+    if (f->epc_bytes > 0U) {
+        if (r->epc_len < f->epc_bytes)
+            return 0;
+        for (uint32_t i = 0; i < f->epc_bytes; ++i) {
+            if (0 != ((r->epc[i] ^ f->epc[i]) & f->epc_mask[i]))
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 출력 버퍼를 비운다.
+ */
+static void OutFlush_(IN_ tool_out_t *o) {
+    if (o->len > 0U)
+        (void) fwrite(o->buf, 1, o->len, o->fp);
+    o->len = 0;
+}
+
+/**
+ * @brief 부호 없는 정수를 10진수로 기록한다.
+ */
+static char* PutU64_(OUT_ char *p, IN_ uint64_t v) {
+    char tmp[24];
+    int n = 0;
+    do {
+        tmp[n++] = (char) ('0' + (v % 10U));
+        v /= 10U;
+    } while (0U != v);
+    while (n > 0)
+        *p++ = tmp[--n];
+    return p;
+}
+
+/**
+ * @brief 부호 있는 정수를 10진수로 기록한다.
+ */
+static char* PutI64_(OUT_ char *p, IN_ const int64_t v) {
+    if (v < 0) {
+        *p++ = '-';
+        return PutU64_(p, (uint64_t) (-(v + 1)) + 1U);
+    }
+    return PutU64_(p, (uint64_t) v);
+}
+
+/**
+ * @brief 바이트 배열을 대문자 hex 로 기록한다.
+ */
+static char* PutHex_(OUT_ char *p, IN_ const uint8_t *b, IN_ const uint32_t n) {
+    static const char digits[] = "0123456789ABCDEF";
+    for (uint32_t i = 0; i < n; ++i) {
+        *p++ = digits[b[i] >> 4];
+        *p++ = digits[b[i] & 0x0FU];
+    }
+    return p;
+}
+
+/**
+ * @brief 문자열을 그대로 기록한다.
+ */
+static char* PutStr_(OUT_ char *p, IN_ const char *s) {
+    while ('\0' != *s)
+        *p++ = *s++;
+    return p;
+}
+
+/**
+ * @brief 레코드 1건을 CSV 또는 JSON Lines 로 기록한다.
+ */
+static void PutRecord_(IN_ tool_out_t *o, IN_ const rfid_tag_log_record_t *r, IN_ const int json) {
+    if ((o->len + TOOL_LINE_MAX) > TOOL_OUT_BUFFER)
+        OutFlush_(o);
+
+    char *p = o->buf + o->len;
+    if (0 != json) {
+        p = PutStr_(p, "{\"seq\":");
+        p = PutU64_(p, r->seq);
+        p = PutStr_(p, ",\"ts\":");
+        p = PutU64_(p, r->ts);
+        p = PutStr_(p, ",\"reader\":");
+        p = PutU64_(p, r->reader_id);
+        p = PutStr_(p, ",\"antenna\":");
+        p = PutU64_(p, r->antenna);
+        p = PutStr_(p, ",\"rssi\":");
+        p = PutI64_(p, r->rssi);
+        p = PutStr_(p, ",\"readcnt\":");
+        p = PutU64_(p, r->readcnt);
+        p = PutStr_(p, ",\"rule\":");
+        p = (RFID_EPC_RULE_NONE == r->rule_id) ? PutStr_(p, "null") : PutU64_(p, r->rule_id);
+        p = PutStr_(p, ",\"epc\":\"");
+        p = PutHex_(p, r->epc, r->epc_len);
+        p = PutStr_(p, (0U != (r->flags & RFID_TAG_LOG_FLAG_TRUNCATED)) ? "\",\"truncated\":true}\n" : "\"}\n");
+    } else {
+        p = PutU64_(p, r->seq);
+        *p++ = ',';
+        p = PutU64_(p, r->ts);
+        *p++ = ',';
+        p = PutU64_(p, r->reader_id);
+        *p++ = ',';
+        p = PutU64_(p, r->antenna);
+        *p++ = ',';
+        p = PutI64_(p, r->rssi);
+        *p++ = ',';
+        p = PutU64_(p, r->readcnt);
+        *p++ = ',';
+        if (RFID_EPC_RULE_NONE != r->rule_id)
+            p = PutU64_(p, r->rule_id);
+        *p++ = ',';
+        p = PutHex_(p, r->epc, r->epc_len);
+        *p++ = ',';
+        *p++ = (0U != (r->flags & RFID_TAG_LOG_FLAG_TRUNCATED)) ? '1' : '0';
+        *p++ = '\n';
+    }
+    o->len = (size_t) (p - o->buf);
+}
+
+/**
+ * @brief hex EPC 접두사를 필터로 변환한다.
+ * @return 성공 0, 실패 -1
+ */
+static int ParseEpc_(IN_ const char *hex, OUT_ tool_filter_t *f) {
+    const size_t n = strlen(hex);
+    if ((0U == n) || (n > (size_t) RFID_TAG_LOG_EPC_BYTES * 2U))
+        return -1;
+
+    for (size_t i = 0; i < n; ++i) {
+        const char c = hex[i];
+        int v;
+        if ((c >= '0') && (c <= '9'))
+            v = c - '0';
+        else if ((c >= 'a') && (c <= 'f'))
+            v = c - 'a' + 10;
+        else if ((c >= 'A') && (c <= 'F'))
+            v = c - 'A' + 10;
+        else
+            return -1;
+
+        const int shift = (0U == (i & 1U)) ? 4 : 0;
+        f->epc[i / 2U] |= (uint8_t) (v << shift);
+        f->epc_mask[i / 2U] |= (uint8_t) (0x0FU << shift);
+    }
+    f->epc_bytes = (uint32_t) ((n + 1U) / 2U);
+    return 0;
+}
+
+/**
+ * @brief 문자열 비교(qsort 용)
+ */
+static int CompareStr_(IN_ const void *a, IN_ const void *b) {
+    return strcmp(*(const char *const *) a, *(const char *const *) b);
+}
+
+/**
+ * @brief 경로 목록에 추가한다.
+ * @return 성공 0, 실패 -1
+ */
+static int PushPath_(INOUT_ char ***paths, INOUT_ size_t *count, INOUT_ size_t *cap, IN_ const char *path) {
+    if (*count == *cap) {
+        const size_t ncap = (0U == *cap) ? 64U : (*cap * 2U);
+        char **np = (char **) realloc(*paths, ncap * sizeof(char *));
+        if (NULL == np)
+            return -1;
+        *paths = np;
+        *cap = ncap;
+    }
+    char *dup = strdup(path);
+    if (NULL == dup)
+        return -1;
+    (*paths)[(*count)++] = dup;
+    return 0;
+}
+
+/**
+ * @brief 인자를 세그먼트 파일 목록으로 펼친다(디렉터리는 *.rtl 을 이름순으로).
+ * @return 성공 0, 실패 -1
+ */
+static int ExpandPath_(IN_ const char *arg, INOUT_ char ***paths, INOUT_ size_t *count, INOUT_ size_t *cap) {
+    struct stat st;
+    if (0 != stat(arg, &st)) {
+        fprintf(stderr, "cannot stat %s\n", arg);
+        return -1;
+    }
+    if (!S_ISDIR(st.st_mode))
+        return PushPath_(paths, count, cap, arg);
+
+    DIR *d = opendir(arg);
+    if (NULL == d) {
+        fprintf(stderr, "cannot open %s\n", arg);
+        return -1;
+    }
+    const size_t first = *count;
+    const struct dirent *e;
+    while (NULL != (e = readdir(d))) {
+        const size_t n = strlen(e->d_name);
+        if ((n < 5U) || (0 != strcmp(e->d_name + n - 4U, ".rtl")))
+            continue;
+        char path[4096];
+        const int w = snprintf(path, sizeof(path), "%s/%s", arg, e->d_name);
+        if ((w < 0) || ((size_t) w >= sizeof(path)) || (0 != PushPath_(paths, count, cap, path))) {
+            (void) closedir(d);
+            return -1;
+        }
+    }
+    (void) closedir(d);
+    qsort(*paths + first, *count - first, sizeof(char *), CompareStr_);
+    return 0;
+}
+
+/**
+ * @brief bin 출력 세그먼트를 연다(헤더는 끝에서 채운다).
+ */
+static FILE* BinOpen_(IN_ const char *path) {
+    FILE *fp = fopen(path, "wb");
+    if (NULL == fp)
+        return NULL;
+    static const uint8_t zero[TOOL_HEADER_SIZE];
+    if (1U != fwrite(zero, sizeof(zero), 1, fp)) {
+        (void) fclose(fp);
+        return NULL;
+    }
+    return fp;
+}
+
+/**
+ * @brief bin 출력 세그먼트 헤더를 쓰고 닫는다.
+ * @return 성공 0, 실패 -1
+ */
+static int BinClose_(IN_ FILE *fp, IN_ const uint64_t count, IN_ const uint64_t first_seq) {
+    rfid_tag_log_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, RFID_TAG_LOG_MAGIC, sizeof(hdr.magic));
+    hdr.version = RFID_TAG_LOG_VERSION;
+    hdr.header_size = TOOL_HEADER_SIZE;
+    hdr.record_size = (uint32_t) sizeof(rfid_tag_log_record_t);
+    hdr.record_capacity = (count > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t) count;
+    hdr.first_seq = first_seq;
+    hdr.created_ms = (uint64_t) time(NULL) * 1000U;
+    hdr.committed = hdr.record_capacity;
+
+    int rc = 0;
+    if ((0 != fseek(fp, 0, SEEK_SET)) || (1U != fwrite(&hdr, sizeof(hdr), 1, fp)))
+        rc = -1;
+    if (0 != fclose(fp))
+        rc = -1;
+    return rc;
+}
+
+/**
+ * @brief 사용법 출력
+ */
+static void Usage_(void) {
+    fprintf(stderr,
+            "usage: rfid_tag_log_tool <stat|count|csv|jsonl|bin> [options] <segment.rtl|dir>...\n"
+            "  --epc HEX  --antenna N  --reader N  --rule N  --from MS  --to MS  --min-rssi DBM  -o FILE(bin)\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        Usage_();
+        return 2;
+    }
+
+    const char *cmd = argv[1];
+    const int is_stat = (0 == strcmp(cmd, "stat"));
+    const int is_count = (0 == strcmp(cmd, "count"));
+    const int is_csv = (0 == strcmp(cmd, "csv"));
+    const int is_json = (0 == strcmp(cmd, "jsonl"));
+    const int is_bin = (0 == strcmp(cmd, "bin"));
+    if (!(is_stat || is_count || is_csv || is_json || is_bin)) {
+        Usage_();
+        return 2;
+    }
+
+    tool_filter_t f;
+    memset(&f, 0, sizeof(f));
+    f.antenna = -1;
+    f.reader = -1;
+    f.rule = -1;
+    const char *out_path = NULL;
+
+    char **paths = NULL;
+    size_t path_count = 0;
+    size_t path_cap = 0;
+    for (int i = 2; i < argc; ++i) {
+        const char *a = argv[i];
+        const int has_value = (i + 1 < argc);
+        if ((0 == strcmp(a, "--epc")) && has_value) {
+            if (0 != ParseEpc_(argv[++i], &f)) {
+                fprintf(stderr, "invalid --epc\n");
+                return 2;
+            }
+        } else if ((0 == strcmp(a, "--antenna")) && has_value) {
+            f.antenna = atoi(argv[++i]);
+        } else if ((0 == strcmp(a, "--reader")) && has_value) {
+            f.reader = atoi(argv[++i]);
+        } else if ((0 == strcmp(a, "--rule")) && has_value) {
+            f.rule = strtoll(argv[++i], NULL, 10);
+        } else if ((0 == strcmp(a, "--from")) && has_value) {
+            f.use_from = 1;
+            f.from = strtoull(argv[++i], NULL, 10);
+        } else if ((0 == strcmp(a, "--to")) && has_value) {
+            f.use_to = 1;
+            f.to = strtoull(argv[++i], NULL, 10);
+        } else if ((0 == strcmp(a, "--min-rssi")) && has_value) {
+            f.use_rssi = 1;
+            f.min_rssi = atoi(argv[++i]);
+        } else if ((0 == strcmp(a, "-o")) && has_value) {
+            out_path = argv[++i];
+        } else if ('-' == a[0]) {
+            Usage_();
+            return 2;
+        } else if (0 != ExpandPath_(a, &paths, &path_count, &path_cap)) {
+            return 1;
+        }
+    }
+    if ((0U == path_count) || ((0 != is_bin) && (NULL == out_path))) {
+        Usage_();
+        return 2;
+    }
+
+    tool_out_t out;
+    out.fp = stdout;
+    out.len = 0;
+    out.buf = (char *) malloc(TOOL_OUT_BUFFER);
+    FILE *bin = (0 != is_bin) ? BinOpen_(out_path) : NULL;
+    if ((NULL == out.buf) || ((0 != is_bin) && (NULL == bin))) {
+        fprintf(stderr, "cannot allocate output\n");
+        return 1;
+    }
+
+    if (0 != is_csv) {
+        const char *hdr = "seq,ts,reader,antenna,rssi,readcnt,rule,epc,truncated\n";
+        memcpy(out.buf, hdr, strlen(hdr));
+        out.len = strlen(hdr);
+    }
+
+    int failed = 0;
+    uint64_t total = 0;
+    uint64_t matched = 0;
+    uint64_t bin_first = 0;
+    uint64_t scan_ns = 0;
+    for (size_t p = 0; p < path_count; ++p) {
+        rfid_tag_log_segment_t *seg = NULL;
+        if (RFID_RESULT_OK != rfid_tag_log_segment_map(paths[p], &seg)) {
+            fprintf(stderr, "skip %s: not a tag log segment\n", paths[p]);
+            failed = 1;
+            continue;
+        }
+
+        uint64_t n = 0;
+        const rfid_tag_log_record_t *recs = rfid_tag_log_segment_records(seg, &n);
+        const rfid_tag_log_header_t *h = rfid_tag_log_segment_header(seg);
+        total += n;
+
+        if (0 != is_stat) {
+            printf("%s index=%llu first_seq=%llu created_ms=%llu committed=%llu valid=%llu capacity=%u",
+                   paths[p],
+                   (unsigned long long) h->segment_index,
+                   (unsigned long long) h->first_seq,
+                   (unsigned long long) h->created_ms,
+                   (unsigned long long) h->committed,
+                   (unsigned long long) n,
+                   (unsigned) h->record_capacity);
+            if (n > 0U)
+                printf(" ts=[%llu..%llu]", (unsigned long long) recs[0].ts, (unsigned long long) recs[n - 1U].ts);
+            printf("\n");
+        } else {
+            const uint64_t t0 = NowNs_();
+            for (uint64_t i = 0; i < n; ++i) {
+                if (0 == Match_(&f, &recs[i]))
+                    continue;
+                if (0U == matched)
+                    bin_first = recs[i].seq;
+                matched++;
+                if ((0 != is_csv) || (0 != is_json))
+                    PutRecord_(&out, &recs[i], is_json);
+                else if ((0 != is_bin) && (1U != fwrite(&recs[i], sizeof(recs[i]), 1, bin)))
+                    failed = 1;
+            }
+            scan_ns += NowNs_() - t0;
+        }
+        rfid_tag_log_segment_unmap(&seg);
+    }
+    OutFlush_(&out);
+
+    if (0 != is_count) {
+        const double sec = (double) scan_ns / 1e9;
+        const double mb = (double) total * (double) sizeof(rfid_tag_log_record_t) / (1024.0 * 1024.0);
+        printf("segments=%zu records=%llu matched=%llu scan=%.3fs (%.0f MiB/s, %.1f Mrec/s)\n",
+               path_count,
+               (unsigned long long) total,
+               (unsigned long long) matched,
+               sec,
+               (sec > 0.0) ? mb / sec : 0.0,
+               (sec > 0.0) ? (double) total / sec / 1e6 : 0.0);
+    }
+    if ((0 != is_bin) && (0 != BinClose_(bin, matched, bin_first)))
+        failed = 1;
+
+    for (size_t p = 0; p < path_count; ++p)
+        free(paths[p]);
+    free(paths);
+    free(out.buf);
+    return failed;
+}
@@ -10,12 +10,22 @@
 
 extern "C" {
 #include "rfid_api.h"
+#include "rfid_epc_match.h"
+#include "rfid_tag_log.h"
+#include "rfid_tag_bus.h"
+#include "rfid_presence.h"
+#include "rfid_timer_wheel.h"
+#include "rfid_merge.h"
+#include "rfid_gs1.h"
+#include "rfid_epc_intern.h"
+#include "rfid_pool.h"
 #include "rfid_types.h"
 }
 
 #include <algorithm>
 #include <cstring>
 #include <cctype>
+#include <climits>
 #include <string_view>
 #include <nlohmann/json.hpp>
 
@@ -31,6 +41,23 @@ namespace mercuryapi {
 
         std::vector<rfid_tag_t> cbuf; /**< C read 결과 버퍼 (내부용) */
 
+        std::shared_ptr<EpcMatcher> matcher; /**< 연결된 EPC 규칙 엔진 (ctx보다 오래 유지) */
+        bool matcher_drop = false; /**< 규칙 불일치 태그 제외 여부 */
+
+        std::shared_ptr<TagLog> tag_log; /**< 연결된 태그 로그 (ctx보다 오래 유지) */
+        std::uint16_t tag_log_reader_id = 0; /**< 태그 로그 레코드의 리더 id */
+
+        std::shared_ptr<TagBus> tag_bus; /**< 연결된 태그 버스 (ctx보다 오래 유지) */
+        std::uint16_t tag_bus_reader_id = 0; /**< 태그 버스 레코드의 리더 id */
+        std::shared_ptr<PresenceEngine> presence; /**< Init 시 스냅샷을 복원할 태그 존재 감지 엔진 */
+        std::shared_ptr<TagMerger> merger; /**< 연결된 리더 간 병합 단계 (ctx보다 오래 유지) */
+        std::uint16_t merger_reader_id = 0; /**< 병합 단계에 넘길 리더 id */
+        std::shared_ptr<EpcIntern> intern; /**< 연결된 EPC intern 테이블 (ctx보다 오래 유지) */
+        std::shared_ptr<TagPool> pool; /**< 연결된 태그 후처리 풀 (ctx보다 오래 유지) */
+        std::uint16_t pool_reader_id = 0; /**< 풀에 넘길 리더 id */
+        AutonomousHandler on_autonomous; /**< autonomous read 태그 batch 처리 함수 (수신 중에는 바꾸지 않는다) */
+        TriggerHandler on_trigger; /**< trigger read 태그 처리 함수 (실행 중에는 바꾸지 않는다) */
+
     private:
         Result last_error = Result::Ok; /**< 마지막 오류 상태 */
         std::string last_error_string; /**< 마지막 오류 문자열 */
@@ -76,6 +103,10 @@ namespace mercuryapi {
                     return "ReadFail"sv;
                 case Result::InternalError:
                     return "InternalError"sv;
+                case Result::WriteFail:
+                    return "WriteFail"sv;
+                case Result::Busy:
+                    return "Busy"sv;
             }
             return "UnknownResult"sv;
         }
@@ -105,6 +136,10 @@ namespace mercuryapi {
                     return Result::ReadFail;
                 case RFID_RESULT_INTERNAL_ERROR:
                     return Result::InternalError;
+                case RFID_RESULT_WRITE_FAIL:
+                    return Result::WriteFail;
+                case RFID_RESULT_BUSY:
+                    return Result::Busy;
                 default:
                     return Result::InternalError;
             }
@@ -135,6 +170,10 @@ namespace mercuryapi {
                     return RFID_RESULT_READ_FAIL;
                 case Result::InternalError:
                     return RFID_RESULT_INTERNAL_ERROR;
+                case Result::WriteFail:
+                    return RFID_RESULT_WRITE_FAIL;
+                case Result::Busy:
+                    return RFID_RESULT_BUSY;
                 default:
                     return RFID_RESULT_INTERNAL_ERROR;
             }
@@ -160,6 +199,71 @@ namespace mercuryapi {
             }
         }
 
+        /**
+         * @brief C++ Gen2 튜닝 설정을 C API 구조체로 변환
+         * @param[in] cfg C++ 튜닝 설정
+         * @return 대응되는 rfid_gen2_tune_params_t 값
+         * @note C++ enum과 C enum은 같은 순서로 정의되어 있다.
+         */
+        static rfid_gen2_tune_params_t ToCGen2_(const Gen2TuneConfig &cfg) noexcept {
+            rfid_gen2_tune_params_t p{};
+            p.mode = static_cast<RFID_GEN2_TUNE_MODE>(cfg.mode);
+            p.eval_cycles = cfg.eval_cycles;
+            p.manual.q = cfg.manual.q;
+            p.manual.session = cfg.manual.session;
+            p.manual.target = static_cast<RFID_GEN2_TARGET>(cfg.manual.target);
+            p.manual.link = static_cast<RFID_GEN2_LINK_PROFILE>(cfg.manual.link);
+            return p;
+        }
+
+        /**
+         * @brief C++ Select 필터 목록을 C API 구조체로 변환
+         * @param[in] filters C++ 필터 목록(mask 문자열은 호출자가 소유)
+         * @return 대응되는 rfid_select_filter_t 목록
+         */
+        static std::vector<rfid_select_filter_t> ToCSelect_(const std::vector<SelectFilter> &filters) {
+            std::vector<rfid_select_filter_t> out;
+            out.reserve(filters.size());
+            for (const SelectFilter &f : filters) {
+                rfid_select_filter_t c{};
+                c.bank = static_cast<RFID_GEN2_BANK>(f.bank);
+                c.bit_pointer = f.bit_pointer;
+                c.mask_hex = f.mask_hex.c_str();
+                c.mask_bits = f.mask_bits;
+                c.invert = f.invert ? 1 : 0;
+                out.push_back(c);
+            }
+            return out;
+        }
+
+        /**
+         * @brief C++ embedded read 설정을 C API 구조체로 변환
+         * @param[in] cfg C++ 설정
+         * @return 대응되는 rfid_embedded_read_t 값
+         */
+        static rfid_embedded_read_t ToCEmbedded_(const EmbeddedReadConfig &cfg) noexcept {
+            rfid_embedded_read_t c{};
+            c.enable = cfg.enable ? 1 : 0;
+            c.bank = static_cast<RFID_GEN2_BANK>(cfg.bank);
+            c.word_address = cfg.word_address;
+            c.word_count = cfg.word_count;
+            return c;
+        }
+
+        /**
+         * @brief C API Gen2 설정을 C++ 모델로 변환
+         * @param[in] s C API 설정
+         * @return 대응되는 Gen2Settings 값
+         */
+        static Gen2Settings FromCGen2Settings_(const rfid_gen2_settings_t &s) noexcept {
+            Gen2Settings out;
+            out.q = s.q;
+            out.session = s.session;
+            out.target = static_cast<Gen2Target>(s.target);
+            out.link = static_cast<Gen2LinkProfile>(s.link);
+            return out;
+        }
+
         /**
          * @brief 마지막 오류 상태 설정
          * @param[in] r Result 값
@@ -214,6 +318,35 @@ namespace mercuryapi {
                 cbuf.resize(cap);
             return static_cast<int>(cbuf.size());
         }
+
+        /**
+         * @brief cbuf 앞쪽 count개 결과를 Tag 리스트로 변환
+         * @param count 변환할 개수
+         * @param[out] out_tags 결과 태그 리스트(뒤에 추가)
+         */
+        void CopyTags_(const int count, std::vector<Tag> &out_tags) const {
+            if (count <= 0)
+                return;
+
+            out_tags.reserve(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i) {
+                const rfid_tag_t &tags = cbuf[static_cast<std::size_t>(i)];
+                Tag convTags;
+                convTags.epc = tags.epc;
+                convTags.rssi = tags.rssi;
+                convTags.readcnt = tags.readcnt;
+                convTags.antenna = tags.antenna;
+                convTags.ts = tags.ts;
+                convTags.epc_bytes.assign(tags.epc_bytes, tags.epc_bytes + tags.epc_len);
+                convTags.rule_id = tags.rule_id;
+                convTags.epc_id = tags.epc_id;
+                convTags.air_us = tags.air_us;
+                convTags.rx_us = tags.rx_us;
+                convTags.parse_us = tags.parse_us;
+                convTags.data.assign(tags.data, tags.data + tags.data_len);
+                out_tags.push_back(std::move(convTags));
+            }
+        }
     };
 
     /**
@@ -268,6 +401,166 @@ namespace mercuryapi {
                 cfg.write_power_cdbm = j.at("write_power_cdbm").get<int>();
             if (j.contains("capacity"))
                 cfg.capacity = j.at("capacity").get<std::size_t>();
+            if (j.contains("dwell")) {
+                const auto &dv = j.at("dwell");
+                cfg.dwell.enable = dv.value("enable", cfg.dwell.enable);
+                cfg.dwell.update_cycles = dv.value("update_cycles", cfg.dwell.update_cycles);
+                cfg.dwell.min_share_pct = dv.value("min_share_pct", cfg.dwell.min_share_pct);
+                cfg.dwell.max_share_pct = dv.value("max_share_pct", cfg.dwell.max_share_pct);
+            }
+            if (j.contains("gen2")) {
+                const auto &gv = j.at("gen2");
+                const std::string mode = gv.value("mode", std::string("off"));
+                if (mode == "off")
+                    cfg.gen2.mode = Gen2TuneMode::Off;
+                else if (mode == "auto")
+                    cfg.gen2.mode = Gen2TuneMode::Auto;
+                else if (mode == "manual")
+                    cfg.gen2.mode = Gen2TuneMode::Manual;
+                else
+                    throw std::runtime_error("invalid gen2.mode string");
+
+                cfg.gen2.eval_cycles = gv.value("eval_cycles", cfg.gen2.eval_cycles);
+                cfg.gen2.manual.q = gv.value("q", cfg.gen2.manual.q);
+                cfg.gen2.manual.session = gv.value("session", cfg.gen2.manual.session);
+
+                const std::string target = gv.value("target", std::string("A"));
+                if (target == "A")
+                    cfg.gen2.manual.target = Gen2Target::A;
+                else if (target == "B")
+                    cfg.gen2.manual.target = Gen2Target::B;
+                else if (target == "AB")
+                    cfg.gen2.manual.target = Gen2Target::AB;
+                else if (target == "BA")
+                    cfg.gen2.manual.target = Gen2Target::BA;
+                else
+                    throw std::runtime_error("invalid gen2.target string");
+
+                const std::string link = gv.value("link", std::string("keep"));
+                if (link == "keep")
+                    cfg.gen2.manual.link = Gen2LinkProfile::Keep;
+                else if (link == "high_speed")
+                    cfg.gen2.manual.link = Gen2LinkProfile::HighSpeed;
+                else if (link == "balanced")
+                    cfg.gen2.manual.link = Gen2LinkProfile::Balanced;
+                else if (link == "dense")
+                    cfg.gen2.manual.link = Gen2LinkProfile::Dense;
+                else
+                    throw std::runtime_error("invalid gen2.link string");
+            }
+            // "select" 객체(전역/plan 항목 공통): {"combine": "any"|"all", "filters": [...]}
+            const auto parse_select = [](const json &sv, std::vector<SelectFilter> &filters, SelectCombine &combine_out) {
+                const std::string combine = sv.value("combine", std::string("any"));
+                if (combine == "any")
+                    combine_out = SelectCombine::Any;
+                else if (combine == "all")
+                    combine_out = SelectCombine::All;
+                else
+                    throw std::runtime_error("invalid select.combine string");
+
+                if (sv.contains("filters")) {
+                    for (const auto &fv : sv.at("filters")) {
+                        SelectFilter f;
+                        const std::string bank = fv.value("bank", std::string("epc"));
+                        if (bank == "epc")
+                            f.bank = Gen2Bank::Epc;
+                        else if (bank == "tid")
+                            f.bank = Gen2Bank::Tid;
+                        else if (bank == "user")
+                            f.bank = Gen2Bank::User;
+                        else
+                            throw std::runtime_error("invalid select.filters.bank string");
+                        f.bit_pointer = fv.value("bit_pointer", f.bit_pointer);
+                        f.mask_hex = fv.at("mask").get<std::string>();
+                        f.mask_bits = fv.value("mask_bits", f.mask_bits);
+                        f.invert = fv.value("invert", f.invert);
+                        filters.push_back(std::move(f));
+                    }
+                }
+            };
+            if (j.contains("select"))
+                parse_select(j.at("select"), cfg.select_filters, cfg.select_combine);
+            if (j.contains("plans")) {
+                for (const auto &pv : j.at("plans")) {
+                    ReadPlanConfig plan;
+                    plan.antennas = pv.at("antennas").get<std::vector<int> >();
+                    plan.weight = pv.value("weight", plan.weight);
+                    if (pv.contains("select"))
+                        parse_select(pv.at("select"), plan.select_filters, plan.select_combine);
+                    cfg.plans.push_back(std::move(plan));
+                }
+            }
+            if (j.contains("antenna_power_cdbm"))
+                cfg.antenna_power_cdbm = j.at("antenna_power_cdbm").get<std::vector<int> >();
+            if (j.contains("power_ctrl")) {
+                const auto &pv = j.at("power_ctrl");
+                const std::string mode = pv.value("mode", std::string("off"));
+                if (mode == "off")
+                    cfg.power_ctrl.mode = PowerCtrlMode::Off;
+                else if (mode == "read_rate")
+                    cfg.power_ctrl.mode = PowerCtrlMode::ReadRate;
+                else if (mode == "rssi_band")
+                    cfg.power_ctrl.mode = PowerCtrlMode::RssiBand;
+                else
+                    throw std::runtime_error("invalid power_ctrl.mode string");
+
+                cfg.power_ctrl.min_cdbm = pv.value("min_cdbm", cfg.power_ctrl.min_cdbm);
+                cfg.power_ctrl.max_cdbm = pv.value("max_cdbm", cfg.power_ctrl.max_cdbm);
+                cfg.power_ctrl.step_cdbm = pv.value("step_cdbm", cfg.power_ctrl.step_cdbm);
+                cfg.power_ctrl.update_cycles = pv.value("update_cycles", cfg.power_ctrl.update_cycles);
+                cfg.power_ctrl.deadband_pct = pv.value("deadband_pct", cfg.power_ctrl.deadband_pct);
+                cfg.power_ctrl.target_reads_per_sec = pv.value("target_reads_per_sec", cfg.power_ctrl.target_reads_per_sec);
+                cfg.power_ctrl.rssi_low_dbm = pv.value("rssi_low_dbm", cfg.power_ctrl.rssi_low_dbm);
+                cfg.power_ctrl.rssi_high_dbm = pv.value("rssi_high_dbm", cfg.power_ctrl.rssi_high_dbm);
+                if (pv.contains("foreign_tags")) {
+                    for (const auto &fv : pv.at("foreign_tags")) {
+                        ForeignTag ft;
+                        ft.epc = fv.at("epc").get<std::string>();
+                        ft.home_antenna = fv.value("home_antenna", 0);
+                        cfg.power_ctrl.foreign_tags.push_back(std::move(ft));
+                    }
+                }
+            }
+            if (j.contains("baud")) {
+                const auto &bv = j.at("baud");
+                cfg.baud.enable = bv.value("enable", cfg.baud.enable);
+                cfg.baud.max_rate = bv.value("max_rate", cfg.baud.max_rate);
+                cfg.baud.probe_count = bv.value("probe_count", cfg.baud.probe_count);
+                cfg.baud.fallback_errors = bv.value("fallback_errors", cfg.baud.fallback_errors);
+            }
+            if (j.contains("embedded_read")) {
+                const auto &ev = j.at("embedded_read");
+                const std::string bank = ev.value("bank", std::string("tid"));
+                if (bank == "epc")
+                    cfg.embedded_read.bank = Gen2Bank::Epc;
+                else if (bank == "tid")
+                    cfg.embedded_read.bank = Gen2Bank::Tid;
+                else if (bank == "user")
+                    cfg.embedded_read.bank = Gen2Bank::User;
+                else
+                    throw std::runtime_error("invalid embedded_read.bank string");
+                cfg.embedded_read.enable = ev.value("enable", true);
+                cfg.embedded_read.word_address = ev.value("word_address", cfg.embedded_read.word_address);
+                cfg.embedded_read.word_count = ev.value("word_count", cfg.embedded_read.word_count);
+            }
+            if (j.contains("tag_metadata")) {
+                cfg.tag_metadata = 0;
+                for (const auto &mv : j.at("tag_metadata")) {
+                    const std::string m = mv.get<std::string>();
+                    if (m == "readcount")
+                        cfg.tag_metadata |= kTagMetaReadCount;
+                    else if (m == "rssi")
+                        cfg.tag_metadata |= kTagMetaRssi;
+                    else if (m == "antenna")
+                        cfg.tag_metadata |= kTagMetaAntenna;
+                    else if (m == "timestamp")
+                        cfg.tag_metadata |= kTagMetaTimestamp;
+                    else if (m == "all")
+                        cfg.tag_metadata |= kTagMetaAll;
+                    else
+                        throw std::runtime_error("invalid tag_metadata string");
+                }
+            }
 
             out_cfg = std::move(cfg);
             return true;
@@ -286,176 +579,2398 @@ namespace mercuryapi {
 #endif
     }
 
-    // Reader 생성자/소멸자/Move
-    Reader::Reader() : impl_(std::make_unique<Impl>()) {}
+    /**
+     * @brief Read 결과 태그의 GS1 EPC 해석
+     * @param[in] tags Read 결과
+     * @param[out] out_records 해석 결과
+     * @param[in] with_urn URN 생성 여부
+     * @param[in] tag_uri tag URI 여부
+     * @return 해석에 성공한 태그 수
+     */
+    std::size_t DecodeGs1(const std::vector<Tag> &tags
+                          , std::vector<Gs1Record> &out_records
+                          , const bool with_urn
+                          , const bool tag_uri) {
+        out_records.clear();
+        out_records.resize(tags.size());
 
-    Reader::~Reader() {
-        Destroy();
+        std::size_t decoded = 0;
+        char urn[RFID_GS1_URN_MAX];
+        for (std::size_t i = 0; i < tags.size(); ++i) {
+            const std::vector<std::uint8_t> &epc = tags[i].epc_bytes;
+            rfid_gs1_record_t c{};
+            if (0 == rfid_gs1_decode(epc.empty() ? nullptr : epc.data(), static_cast<std::uint32_t>(epc.size()), &c)) {
+                out_records[i].header = c.header;
+                continue;
+            }
+
+            Gs1Record &r = out_records[i];
+            r.scheme = static_cast<Gs1Scheme>(c.scheme);
+            r.header = c.header;
+            r.filter = c.filter;
+            r.partition = c.partition;
+            r.company_prefix = c.company_prefix;
+            r.reference = c.reference;
+            r.serial = c.serial;
+            r.company_digits = c.company_digits;
+            r.reference_digits = c.reference_digits;
+            std::size_t len = 0;
+            if (with_urn && (RFID_RESULT_OK == rfid_gs1_format_urn(&c, tag_uri ? 1 : 0, urn, sizeof(urn), &len)))
+                r.urn.assign(urn, len);
+            decoded++;
+        }
+        return decoded;
     }
 
-    Reader::Reader(Reader &&other) = default;
-    Reader& Reader::operator=(Reader &&other) = default;
+    /**
+     * @brief EpcMatcher 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class EpcMatcher::Impl {
+    public:
+        rfid_epc_matcher_t *matcher = nullptr; /**< C 규칙 보관소 */
+
+        Impl() {
+            (void) rfid_epc_matcher_create(&matcher);
+        }
+
+        ~Impl() {
+            rfid_epc_matcher_destroy(&matcher);
+        }
+    };
+
+    EpcMatcher::EpcMatcher() : impl_(std::make_unique<Impl>()) {}
+
+    EpcMatcher::~EpcMatcher() = default;
 
     /**
-     * @brief RFID 장치 초기화
-     * @param[in] cfg 초기화 설정
-     * @return 초기화 결과 Result
+     * @brief 규칙 집합 컴파일 및 교체
+     * @param[in] rules 규칙 목록
+     * @return 결과 Result
      */
-    Result Reader::Init(const Config &cfg) {
-        Destroy();
-        if (nullptr == impl_)
+    Result EpcMatcher::Load(const std::vector<EpcRule> &rules) {
+        if ((nullptr == impl_) || (nullptr == impl_->matcher))
             return Result::InternalError;
-        if (!cfg.enable)
-            return impl_->SetLastError_(Result::Disabled, "Init failed");
-        if (cfg.uri.empty())
-            return impl_->SetLastError_(Result::InvalidArg, "Init failed: invalid argument (uri is empty)");
-        if (cfg.antennas.empty())
-            return impl_->SetLastError_(Result::InvalidArg, "Init failed: invalid argument (antennas is empty)");
 
-        impl_->EnsureBuf_(cfg.capacity);
-        impl_->antennas = cfg.antennas;
+        // 문자열은 rules가 소유하며 rfid_epc_rules_compile() 동안만 참조된다.
+        std::vector<rfid_epc_rule_t> crules;
+        crules.reserve(rules.size());
+        for (const EpcRule &r : rules)
+            crules.push_back(rfid_epc_rule_t{r.value_hex.c_str(), r.mask_hex.empty() ? nullptr : r.mask_hex.c_str(), r.bit_length, r.rule_id});
 
-        rfid_init_params_t params{};
-        params.rfid_enable = 1;
-        params.uri = cfg.uri.c_str();
-        params.region = Impl::ToCRegion_(cfg.region);
-        params.antennas = cfg.antennas.data();
-        params.antenna_count = static_cast<int>(cfg.antennas.size());
-        params.plan_timeout_ms = cfg.plan_timeout_ms;
-        params.write_power_cdbm = cfg.write_power_cdbm;
+        rfid_epc_rules_t *compiled = nullptr;
+        const RFID_RESULT rc = rfid_epc_rules_compile(crules.empty() ? nullptr : crules.data(), static_cast<int>(crules.size()), &compiled);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
 
-        rfid_ctx_t *tmp = nullptr;
-        uint32_t status = 0;
-        const char *errstr = nullptr;
-        const RFID_RESULT rc = rfid_init(&tmp, &params, &status, &errstr);
-        const Result r = Impl::ToCppResult_(rc);
+        rfid_epc_matcher_swap(impl_->matcher, compiled);
+        rfid_epc_rules_release(compiled);
+        return Result::Ok;
+    }
 
-        if (Result::Ok != r) {
-            if (nullptr != tmp)
-                (void) rfid_deinit(&tmp, nullptr, nullptr);
-            impl_->SetLastError_(r, "Init failed");
-            impl_->AppendLastErrorDetail_(errstr);
-            return r;
-        }
+    /**
+     * @brief 바이너리 EPC 분류
+     * @param[in] epc EPC 바이트 배열
+     * @param[in] len 바이트 수
+     * @return rule_id 또는 kEpcRuleNone
+     */
+    std::uint32_t EpcMatcher::Classify(const std::uint8_t *epc, const std::size_t len) const {
+        if (nullptr == impl_)
+            return kEpcRuleNone;
 
-        impl_->ctx = tmp;
-        return impl_->SetLastError_(Result::Ok);
+        rfid_epc_rules_t *rules = rfid_epc_matcher_acquire(impl_->matcher);
+        const std::uint32_t id = rfid_epc_rules_classify(rules, epc, static_cast<uint32_t>(len));
+        rfid_epc_rules_release(rules);
+        return id;
     }
 
     /**
-     * @brief RFID 장치 해제
-     * @return 해제 결과 Result
+     * @brief 태그 분류
+     * @param[in] tag 태그
+     * @return rule_id 또는 kEpcRuleNone
      */
-    Result Reader::Destroy() {
+    std::uint32_t EpcMatcher::Classify(const Tag &tag) const {
+        return Classify(tag.epc_bytes.data(), tag.epc_bytes.size());
+    }
+
+    /**
+     * @brief 현재 규칙의 DFA 상태 수
+     * @return 상태 수
+     */
+    std::size_t EpcMatcher::StateCount() const {
         if (nullptr == impl_)
-            return Result::InternalError;
-        if (nullptr == impl_->ctx)
-            return impl_->SetLastError_(Result::Ok);
+            return 0;
 
-        uint32_t status = 0;
-        const char *errstr = nullptr;
-        const RFID_RESULT rc = rfid_deinit(&impl_->ctx, &status, &errstr);
-        const Result r = Impl::ToCppResult_(rc);
+        rfid_epc_rules_t *rules = rfid_epc_matcher_acquire(impl_->matcher);
+        const std::size_t n = rfid_epc_rules_state_count(rules);
+        rfid_epc_rules_release(rules);
+        return n;
+    }
 
-        if (Result::Ok != r) {
-            impl_->SetLastError_(r);
-            impl_->AppendLastErrorDetail_(errstr);
-            return r;
+    /**
+     * @brief 로그/버스 레코드에 들어가는 필드만 C 태그로 옮긴다(EPC 문자열은 기록하지 않음).
+     * @param[in] tags 태그 목록
+     * @return C 태그 목록
+     */
+    static std::vector<rfid_tag_t> ToRecordTags_(const std::vector<Tag> &tags) {
+        std::vector<rfid_tag_t> ctags(tags.size());
+        for (std::size_t i = 0; i < tags.size(); ++i) {
+            const Tag &t = tags[i];
+            rfid_tag_t &c = ctags[i];
+            c.rssi = t.rssi;
+            c.readcnt = t.readcnt;
+            c.antenna = t.antenna;
+            c.ts = t.ts;
+            c.epc_len = static_cast<uint32_t>(std::min<std::size_t>(t.epc_bytes.size(), RFID_EPC_MAX_BYTES));
+            std::memcpy(c.epc_bytes, t.epc_bytes.data(), c.epc_len);
+            c.rule_id = t.rule_id;
+            c.epc_id = t.epc_id;
         }
+        return ctags;
+    }
 
-        impl_->ctx = nullptr;
-        return impl_->SetLastError_(Result::Ok);
+    /**
+     * @brief TagLog 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TagLog::Impl {
+    public:
+        rfid_tag_log_t *log = nullptr; /**< C 태그 로그 */
+
+        ~Impl() {
+            rfid_tag_log_close(&log);
+        }
+    };
+
+    TagLog::TagLog() : impl_(std::make_unique<Impl>()) {}
+
+    TagLog::~TagLog() = default;
+
+    /**
+     * @brief 태그 로그 열기
+     * @param[in] cfg 로그 설정
+     * @return 결과 Result
+     */
+    Result TagLog::Open(const TagLogConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if ((nullptr != impl_->log) || cfg.dir.empty())
+            return Result::InvalidArg;
+
+        rfid_tag_log_params_t params{};
+        params.dir = cfg.dir.c_str();
+        params.prefix = cfg.prefix.empty() ? nullptr : cfg.prefix.c_str();
+        params.segment_records = cfg.segment_records;
+        params.queue_records = cfg.queue_records;
+        params.sync_interval_ms = cfg.sync_interval_ms;
+        params.max_segments = cfg.max_segments;
+
+        const RFID_RESULT rc = rfid_tag_log_open(&params, &impl_->log);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
     }
 
     /**
-     * @brief 초기화 여부 확인
-     * @return true: 초기화됨, false: 초기화 안됨
+     * @brief 태그를 기록 큐에 넣기
+     * @param[in] tags 태그 목록
+     * @param[in] reader_id 리더 id
+     * @return 큐에 넣은 태그 수
      */
-    bool Reader::IsInitialized() const {
-        return impl_ && (impl_->ctx != nullptr);
+    std::size_t TagLog::Append(const std::vector<Tag> &tags, const std::uint16_t reader_id) {
+        if ((nullptr == impl_) || (nullptr == impl_->log) || tags.empty())
+            return 0;
+
+        const std::vector<rfid_tag_t> ctags = ToRecordTags_(tags);
+        const int n = rfid_tag_log_append(impl_->log, reader_id, ctags.data(), static_cast<int>(ctags.size()));
+        return static_cast<std::size_t>(n);
     }
 
     /**
-     * @brief RFID 태그 읽기
-     * @param[in] read_timeout_ms 읽기 타임아웃(ms)
-     * @param[out] out_tags 읽은 태그를 저장할 vector
-     * @return 읽기 결과 Result
+     * @brief 기록/msync 완료 대기
+     * @return 결과 Result
      */
-    Result Reader::Read(const int read_timeout_ms, std::vector<Tag> &out_tags) {
-        out_tags.clear();
+    Result TagLog::Flush() {
+        if ((nullptr == impl_) || (nullptr == impl_->log))
+            return Result::NotInitialized;
+        return (RFID_RESULT_OK == rfid_tag_log_flush(impl_->log)) ? Result::Ok : Result::InternalError;
+    }
+
+    /**
+     * @brief 태그 로그 상태 조회
+     * @param[out] out_stats 로그 상태
+     * @return 결과 Result
+     */
+    Result TagLog::GetStats(TagLogStats &out_stats) const {
+        out_stats = TagLogStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->log))
+            return Result::NotInitialized;
+
+        rfid_tag_log_stat_t cstat{};
+        if (RFID_RESULT_OK != rfid_tag_log_get_stats(impl_->log, &cstat))
+            return Result::InternalError;
+
+        out_stats.appended = cstat.appended;
+        out_stats.dropped = cstat.dropped;
+        out_stats.written = cstat.written;
+        out_stats.synced = cstat.synced;
+        out_stats.lost = cstat.lost;
+        out_stats.segment_index = cstat.segment_index;
+        out_stats.segments_opened = cstat.segments_opened;
+        out_stats.queue_used = cstat.queue_used;
+        out_stats.queue_peak = cstat.queue_peak;
+        out_stats.queue_capacity = cstat.queue_capacity;
+        out_stats.sync_count = cstat.sync_count;
+        out_stats.sync_max_us = cstat.sync_max_us;
+        out_stats.last_errno = cstat.last_errno;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief TagBus 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TagBus::Impl {
+    public:
+        rfid_tag_bus_t *bus = nullptr; /**< C 태그 버스 */
+
+        ~Impl() {
+            rfid_tag_bus_destroy(&bus);
+        }
+    };
+
+    TagBus::TagBus() : impl_(std::make_unique<Impl>()) {}
+
+    TagBus::~TagBus() = default;
+
+    /**
+     * @brief 태그 버스 만들기
+     * @param[in] name 공유 메모리 이름
+     * @param[in] capacity 링 용량
+     * @return 결과 Result
+     */
+    Result TagBus::Open(const std::string &name, const std::uint32_t capacity) {
         if (nullptr == impl_)
             return Result::InternalError;
-        if (nullptr == impl_->ctx)
-            return impl_->SetLastError_(Result::NotInitialized, "Read failed");
-        if (read_timeout_ms < 0)
-            return impl_->SetLastError_(Result::InvalidArg, "Read failed: invalid argument (read_timeout_ms < 0)");
+        if ((nullptr != impl_->bus) || name.empty())
+            return Result::InvalidArg;
 
-        if (impl_->cbuf.empty())
-            impl_->EnsureBuf_(64);
+        const RFID_RESULT rc = rfid_tag_bus_create(name.c_str(), capacity, &impl_->bus);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
 
-        int out_count = 0;
-        uint32_t status = 0;
-        const char *errstr = nullptr;
-        const RFID_RESULT rc = rfid_read(
-                impl_->ctx
-                , impl_->antennas.data()
-                , static_cast<int>(impl_->antennas.size())
-                , read_timeout_ms
-                , impl_->cbuf.data()
-                , static_cast<int>(impl_->cbuf.size())
-                , &out_count
-                , &status
-                , &errstr
-                );
+    /**
+     * @brief 태그 발행
+     * @param[in] tags 태그 목록
+     * @param[in] reader_id 리더 id
+     * @return 발행한 태그 수
+     */
+    std::size_t TagBus::Publish(const std::vector<Tag> &tags, const std::uint16_t reader_id) {
+        if ((nullptr == impl_) || (nullptr == impl_->bus) || tags.empty())
+            return 0;
 
-        const Result r = Impl::ToCppResult_(rc);
-        if (Result::Ok != r) {
-            impl_->SetLastError_(r, "Read failed");
-            impl_->AppendLastErrorDetail_(errstr);
-            return r;
+        const std::vector<rfid_tag_t> ctags = ToRecordTags_(tags);
+        const int n = rfid_tag_bus_publish(impl_->bus, reader_id, ctags.data(), static_cast<int>(ctags.size()));
+        return static_cast<std::size_t>(n);
+    }
+
+    /**
+     * @brief TagSubscriber 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TagSubscriber::Impl {
+    public:
+        rfid_tag_bus_sub_t *sub = nullptr; /**< C 구독자 */
+        std::vector<rfid_tag_log_record_t> cbuf; /**< C read 결과 버퍼 (내부용) */
+
+        ~Impl() {
+            rfid_tag_bus_unsubscribe(&sub);
         }
+    };
 
-        if (out_count <= 0)
-            return impl_->SetLastError_(Result::Ok);
+    TagSubscriber::TagSubscriber() : impl_(std::make_unique<Impl>()) {}
 
-        out_tags.reserve(static_cast<std::size_t>(out_count));
-        for (int i = 0; i < out_count; ++i) {
-            const rfid_tag_t &tags = impl_->cbuf[static_cast<std::size_t>(i)];
-            Tag convTags;
-            convTags.epc = tags.epc;
-            convTags.rssi = tags.rssi;
-            convTags.readcnt = tags.readcnt;
-            convTags.antenna = tags.antenna;
-            convTags.ts = tags.ts;
-            out_tags.push_back(std::move(convTags));
+    TagSubscriber::~TagSubscriber() = default;
+
+    /**
+     * @brief 태그 버스 구독
+     * @param[in] name 공유 메모리 이름
+     * @param[in] from_oldest 가장 오래된 레코드부터 읽을지 여부
+     * @return 결과 Result
+     */
+    Result TagSubscriber::Open(const std::string &name, const bool from_oldest) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if ((nullptr != impl_->sub) || name.empty())
+            return Result::InvalidArg;
+
+        const RFID_RESULT rc = rfid_tag_bus_subscribe(name.c_str(), from_oldest ? 1 : 0, &impl_->sub);
+        switch (rc) {
+            case RFID_RESULT_OK:
+                return Result::Ok;
+            case RFID_RESULT_INVALID_ARG:
+                return Result::InvalidArg;
+            case RFID_RESULT_NOT_INITIALIZED:
+                return Result::NotInitialized;
+            default:
+                return Result::InternalError;
         }
+    }
 
-        return impl_->SetLastError_(Result::Ok);
+    /**
+     * @brief 새 레코드 읽기
+     * @param[out] out_records 읽은 레코드
+     * @param[in] max_records 최대 레코드 수
+     * @param[in] timeout_ms 최대 대기 시간(ms)
+     * @param[out] out_lost 놓친 레코드 수
+     * @return 결과 Result
+     */
+    Result TagSubscriber::Read(std::vector<TagBusRecord> &out_records
+                               , const std::size_t max_records
+                               , const int timeout_ms
+                               , std::uint64_t *out_lost) {
+        out_records.clear();
+        if (nullptr != out_lost)
+            *out_lost = 0;
+        if ((nullptr == impl_) || (nullptr == impl_->sub))
+            return Result::NotInitialized;
+        if (0 == max_records)
+            return Result::InvalidArg;
+
+        const std::size_t cap = std::min<std::size_t>(max_records, static_cast<std::size_t>(INT_MAX));
+        if (impl_->cbuf.size() < cap)
+            impl_->cbuf.resize(cap);
+
+        int count = 0;
+        uint64_t lost = 0;
+        const RFID_RESULT rc = rfid_tag_bus_read(impl_->sub, impl_->cbuf.data(), static_cast<int>(cap), timeout_ms, &count, &lost);
+        if (nullptr != out_lost)
+            *out_lost = lost;
+        if (RFID_RESULT_NOT_INITIALIZED == rc)
+            return Result::NotInitialized;
+        if (RFID_RESULT_OK != rc)
+            return Result::InternalError;
+
+        static const char digits[] = "0123456789ABCDEF";
+        out_records.resize(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            const rfid_tag_log_record_t &c = impl_->cbuf[static_cast<std::size_t>(i)];
+            TagBusRecord &r = out_records[static_cast<std::size_t>(i)];
+            r.seq = c.seq;
+            r.reader_id = c.reader_id;
+            r.truncated = (0U != (c.flags & RFID_TAG_LOG_FLAG_TRUNCATED));
+            r.tag.rssi = c.rssi;
+            r.tag.readcnt = c.readcnt;
+            r.tag.antenna = c.antenna;
+            r.tag.ts = c.ts;
+            r.tag.rule_id = c.rule_id;
+            r.tag.epc_bytes.assign(c.epc, c.epc + c.epc_len);
+            r.tag.epc.resize(static_cast<std::size_t>(c.epc_len) * 2U);
+            for (std::size_t b = 0; b < c.epc_len; ++b) {
+                r.tag.epc[b * 2U] = digits[c.epc[b] >> 4];
+                r.tag.epc[b * 2U + 1U] = digits[c.epc[b] & 0x0F];
+            }
+        }
+        return Result::Ok;
     }
 
     /**
-     * @brief 쓰기 전력 설정
-     * @param[in] write_power_cdbm 쓰기 전력 (cdbm)
-     * @return 설정 결과 Result
+     * @brief PresenceEngine 클래스 내부 구현체 (PImpl 패턴)
      */
-    Result Reader::SetWritePowerCdbm(const int write_power_cdbm) {
+    class PresenceEngine::Impl {
+    public:
+        rfid_presence_t *presence = nullptr; /**< C 엔진 */
+        std::vector<rfid_presence_event_t> cbuf; /**< C 이벤트 버퍼 (내부용) */
+
+        ~Impl() {
+            rfid_presence_destroy(&presence);
+        }
+    };
+
+    PresenceEngine::PresenceEngine() : impl_(std::make_unique<Impl>()) {}
+
+    PresenceEngine::~PresenceEngine() = default;
+
+    /**
+     * @brief 태그 존재 감지 엔진 만들기
+     * @param[in] cfg 엔진 설정
+     * @return 결과 Result
+     */
+    Result PresenceEngine::Open(const PresenceConfig &cfg) {
         if (nullptr == impl_)
             return Result::InternalError;
-        if (nullptr == impl_->ctx)
-            return impl_->SetLastError_(Result::NotInitialized, "SetWritePower failed");
-
-        uint32_t status = 0;
-        const char *errstr = nullptr;
-        const RFID_RESULT rc = rfid_set_write_power(impl_->ctx, write_power_cdbm, &status, &errstr);
-        const Result r = Impl::ToCppResult_(rc);
+        if ((nullptr != impl_->presence) || (cfg.zones.size() > static_cast<std::size_t>(RFID_PRESENCE_ZONE_MAX)))
+            return Result::InvalidArg;
 
-        if (Result::Ok != r) {
-            impl_->SetLastError_(r, "SetWritePower failed");
-            impl_->AppendLastErrorDetail_(errstr);
-            return r;
+        std::vector<rfid_presence_zone_t> czones;
+        czones.reserve(cfg.zones.size());
+        for (const PresenceZone &z : cfg.zones) {
+            czones.push_back(rfid_presence_zone_t{z.zone_id
+                                                  , z.antennas.empty() ? nullptr : z.antennas.data()
+                                                  , static_cast<int>(z.antennas.size())
+                                                  , z.holdoff_ms
+                                                  , z.depart_ms});
         }
 
-        return impl_->SetLastError_(Result::Ok);
+        rfid_presence_params_t params{};
+        params.capacity = cfg.capacity;
+        params.holdoff_ms = cfg.holdoff_ms;
+        params.depart_ms = cfg.depart_ms;
+        params.zones = czones.empty() ? nullptr : czones.data();
+        params.zone_count = static_cast<int>(czones.size());
+        params.snapshot_path = cfg.snapshot_path.empty() ? nullptr : cfg.snapshot_path.c_str();
+        params.snapshot_interval_ms = cfg.snapshot_interval_ms;
+        params.snapshot_max_age_ms = cfg.snapshot_max_age_ms;
+
+        const RFID_RESULT rc = rfid_presence_create(&params, &impl_->presence);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief read 결과 반영 및 이벤트 얻기
+     * @param[in] tags Read 결과
+     * @param[out] out_events 이벤트
+     * @param[in] now_ms 현재 시각(ms)
+     * @return 결과 Result
+     */
+    Result PresenceEngine::Update(const std::vector<Tag> &tags, std::vector<PresenceEvent> &out_events, const std::uint64_t now_ms) {
+        out_events.clear();
+        if ((nullptr == impl_) || (nullptr == impl_->presence))
+            return Result::NotInitialized;
+
+        // 태그마다 이벤트는 최대 1개이고, DEPART 는 남은 자리만큼 내고 나머지는 다음 호출로 미뤄진다.
+        const std::vector<rfid_tag_t> ctags = ToRecordTags_(tags);
+        const std::size_t cap = std::max<std::size_t>(tags.size() + 256U, impl_->cbuf.size());
+        if (impl_->cbuf.size() < cap)
+            impl_->cbuf.resize(cap);
+
+        int count = 0;
+        const RFID_RESULT rc = rfid_presence_update(impl_->presence
+                                                    , ctags.data()
+                                                    , static_cast<int>(ctags.size())
+                                                    , now_ms
+                                                    , impl_->cbuf.data()
+                                                    , static_cast<int>(std::min<std::size_t>(cap, static_cast<std::size_t>(INT_MAX)))
+                                                    , &count);
+        if (RFID_RESULT_OK != rc)
+            return Result::InvalidArg;
+
+        static const char digits[] = "0123456789ABCDEF";
+        out_events.resize(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            const rfid_presence_event_t &c = impl_->cbuf[static_cast<std::size_t>(i)];
+            PresenceEvent &e = out_events[static_cast<std::size_t>(i)];
+            e.type = static_cast<PresenceEventType>(c.type);
+            e.ts_ms = c.ts_ms;
+            e.first_seen_ms = c.first_seen_ms;
+            e.reads = c.reads;
+            e.zone_id = c.zone_id;
+            e.antenna = c.antenna;
+            e.rssi = c.rssi;
+            e.epc_bytes.assign(c.epc, c.epc + c.epc_len);
+            e.epc.resize(static_cast<std::size_t>(c.epc_len) * 2U);
+            for (std::size_t b = 0; b < c.epc_len; ++b) {
+                e.epc[b * 2U] = digits[c.epc[b] >> 4];
+                e.epc[b * 2U + 1U] = digits[c.epc[b] & 0x0F];
+            }
+        }
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 스냅샷에서 추적 상태 복원
+     * @param[in] identity 스냅샷 소유자
+     * @param[out] out_restored 복원한 수
+     * @param[in] now_ms 현재 시각(ms)
+     * @return 결과 Result
+     */
+    Result PresenceEngine::Restore(const std::string &identity, std::uint32_t &out_restored, const std::uint64_t now_ms) {
+        out_restored = 0;
+        if ((nullptr == impl_) || (nullptr == impl_->presence))
+            return Result::NotInitialized;
+
+        const RFID_RESULT rc = rfid_presence_restore(impl_->presence, identity.c_str(), now_ms, &out_restored);
+        return (RFID_RESULT_OK == rc) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 스냅샷 즉시 기록
+     * @return 결과 Result
+     */
+    Result PresenceEngine::Snapshot() {
+        if ((nullptr == impl_) || (nullptr == impl_->presence))
+            return Result::NotInitialized;
+        return (RFID_RESULT_OK == rfid_presence_snapshot(impl_->presence)) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 태그 존재 감지 엔진 상태 조회
+     * @param[out] out_stats 엔진 상태
+     * @return 결과 Result
+     */
+    Result PresenceEngine::GetStats(PresenceStats &out_stats) const {
+        out_stats = PresenceStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->presence))
+            return Result::NotInitialized;
+
+        rfid_presence_stat_t cstat{};
+        if (RFID_RESULT_OK != rfid_presence_get_stats(impl_->presence, &cstat))
+            return Result::InternalError;
+
+        out_stats.reads = cstat.reads;
+        out_stats.arrivals = cstat.arrivals;
+        out_stats.presents = cstat.presents;
+        out_stats.departures = cstat.departures;
+        out_stats.deferred = cstat.deferred;
+        out_stats.table_full = cstat.table_full;
+        out_stats.snapshots = cstat.snapshots;
+        out_stats.snapshot_pages = cstat.snapshot_pages;
+        out_stats.restored = cstat.restored;
+        out_stats.tracked = cstat.tracked;
+        out_stats.capacity = cstat.capacity;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief TimerWheel 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TimerWheel::Impl {
+    public:
+        rfid_timer_wheel_t *wheel = nullptr; /**< C 휠 */
+        std::vector<rfid_timer_expiry_t> cbuf; /**< C 만료 버퍼 (내부용) */
+
+        ~Impl() {
+            rfid_timer_wheel_destroy(&wheel);
+        }
+    };
+
+    TimerWheel::TimerWheel() : impl_(std::make_unique<Impl>()) {}
+
+    TimerWheel::~TimerWheel() = default;
+
+    /**
+     * @brief 단조 시계 기준 현재 시각(ms)
+     * @return 현재 시각(ms)
+     */
+    std::uint64_t TimerWheel::NowMs() {
+        return rfid_timer_wheel_now_ms();
+    }
+
+    /**
+     * @brief 타이밍 휠 만들기
+     * @param[in] capacity 최대 타이머 수
+     * @param[in] start_ms 시작 시각(ms)
+     * @return 결과 Result
+     */
+    Result TimerWheel::Open(const std::uint32_t capacity, const std::uint64_t start_ms) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr != impl_->wheel)
+            return Result::InvalidArg;
+
+        const RFID_RESULT rc = rfid_timer_wheel_create(capacity, start_ms, &impl_->wheel);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        impl_->cbuf.resize(1024U);
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 타이머 등록
+     * @param[in] deadline_ms 만료 시각(ms)
+     * @param[in] user_data 만료 시 돌려받을 값
+     * @param[out] out_id 타이머 id
+     * @return 결과 Result
+     */
+    Result TimerWheel::Schedule(const std::uint64_t deadline_ms, const std::uint64_t user_data, std::uint64_t &out_id) {
+        out_id = 0;
+        if ((nullptr == impl_) || (nullptr == impl_->wheel))
+            return Result::NotInitialized;
+
+        rfid_timer_id_t id = 0;
+        if (RFID_RESULT_OK != rfid_timer_wheel_schedule(impl_->wheel, deadline_ms, user_data, &id))
+            return Result::InternalError;
+        out_id = id;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 타이머 만료 시각 변경
+     * @param[in] id 타이머 id
+     * @param[in] deadline_ms 새 만료 시각(ms)
+     * @return 결과 Result
+     */
+    Result TimerWheel::Reschedule(const std::uint64_t id, const std::uint64_t deadline_ms) {
+        if ((nullptr == impl_) || (nullptr == impl_->wheel))
+            return Result::NotInitialized;
+        return (RFID_RESULT_OK == rfid_timer_wheel_reschedule(impl_->wheel, id, deadline_ms)) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 타이머 취소
+     * @param[in] id 타이머 id
+     * @return 결과 Result
+     */
+    Result TimerWheel::Cancel(const std::uint64_t id) {
+        if ((nullptr == impl_) || (nullptr == impl_->wheel))
+            return Result::NotInitialized;
+        return (RFID_RESULT_OK == rfid_timer_wheel_cancel(impl_->wheel, id)) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 휠 시각 진행 및 만료 타이머 꺼내기
+     * @param[out] out_expired 만료된 타이머
+     * @param[in] now_ms 현재 시각(ms)
+     * @return 결과 Result
+     */
+    Result TimerWheel::Advance(std::vector<TimerExpiry> &out_expired, const std::uint64_t now_ms) {
+        out_expired.clear();
+        if ((nullptr == impl_) || (nullptr == impl_->wheel))
+            return Result::NotInitialized;
+
+        // 버퍼가 가득 차면 같은 시각으로 다시 불러 남은 만료분을 꺼낸다.
+        const std::uint64_t target = (0U != now_ms) ? now_ms : rfid_timer_wheel_now_ms();
+        const int cap = static_cast<int>(impl_->cbuf.size());
+        int count = 0;
+        do {
+            if (RFID_RESULT_OK != rfid_timer_wheel_advance(impl_->wheel, target, impl_->cbuf.data(), cap, &count))
+                return Result::InternalError;
+            for (int i = 0; i < count; ++i) {
+                const rfid_timer_expiry_t &c = impl_->cbuf[static_cast<std::size_t>(i)];
+                out_expired.push_back(TimerExpiry{c.id, c.user_data, c.deadline_ms});
+            }
+        } while (cap == count);
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 타이밍 휠 상태 조회
+     * @param[out] out_stats 휠 상태
+     * @return 결과 Result
+     */
+    Result TimerWheel::GetStats(TimerWheelStats &out_stats) const {
+        out_stats = TimerWheelStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->wheel))
+            return Result::NotInitialized;
+
+        rfid_timer_wheel_stat_t cstat{};
+        if (RFID_RESULT_OK != rfid_timer_wheel_get_stats(impl_->wheel, &cstat))
+            return Result::InternalError;
+
+        out_stats.now_ms = cstat.now_ms;
+        out_stats.scheduled = cstat.scheduled;
+        out_stats.cancelled = cstat.cancelled;
+        out_stats.expired = cstat.expired;
+        out_stats.cascaded = cstat.cascaded;
+        out_stats.table_full = cstat.table_full;
+        out_stats.active = cstat.active;
+        out_stats.capacity = cstat.capacity;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief TagMerger 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TagMerger::Impl {
+    public:
+        rfid_merge_t *merge = nullptr; /**< C 병합 단계 */
+
+        ~Impl() {
+            rfid_merge_destroy(&merge);
+        }
+    };
+
+    TagMerger::TagMerger() : impl_(std::make_unique<Impl>()) {}
+
+    TagMerger::~TagMerger() = default;
+
+    /**
+     * @brief 리더 간 병합 단계 만들기
+     * @param[in] cfg 병합 설정
+     * @return 결과 Result
+     */
+    Result TagMerger::Open(const MergeConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr != impl_->merge)
+            return Result::InvalidArg;
+
+        rfid_merge_params_t params{};
+        params.window_ms = cfg.window_ms;
+        params.capacity = cfg.capacity;
+        params.shards = cfg.shards;
+
+        const RFID_RESULT rc = rfid_merge_create(&params, &impl_->merge);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 한 리더의 Read 결과 넣기
+     * @param[in] reader_id 리더 id
+     * @param[in] tags Read 결과
+     * @param[in] now_ms 현재 시각(ms)
+     * @return 결과 Result
+     */
+    Result TagMerger::Push(const std::uint16_t reader_id, const std::vector<Tag> &tags, const std::uint64_t now_ms) {
+        if ((nullptr == impl_) || (nullptr == impl_->merge))
+            return Result::NotInitialized;
+        if (tags.size() > static_cast<std::size_t>(INT_MAX))
+            return Result::InvalidArg;
+
+        const std::vector<rfid_tag_t> ctags = ToRecordTags_(tags);
+        const RFID_RESULT rc = rfid_merge_push(impl_->merge, reader_id, ctags.data(), static_cast<int>(ctags.size()), now_ms);
+        return (RFID_RESULT_OK == rc) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 닫힌 창을 이벤트로 꺼내기
+     * @param[out] out_events 이벤트
+     * @param[in] now_ms 현재 시각(ms)
+     * @return 결과 Result
+     */
+    Result TagMerger::Poll(std::vector<MergeEvent> &out_events, const std::uint64_t now_ms) {
+        out_events.clear();
+        if ((nullptr == impl_) || (nullptr == impl_->merge))
+            return Result::NotInitialized;
+
+        // 여러 스레드가 동시에 Poll 할 수 있으므로 C 버퍼는 호출마다 따로 둔다.
+        static const char digits[] = "0123456789ABCDEF";
+        std::vector<rfid_merge_event_t> cbuf(256U);
+        int count = 0;
+        do {
+            const RFID_RESULT rc = rfid_merge_poll(impl_->merge, now_ms, cbuf.data(), static_cast<int>(cbuf.size()), &count);
+            if (RFID_RESULT_OK != rc)
+                return Result::InvalidArg;
+
+            for (int i = 0; i < count; ++i) {
+                const rfid_merge_event_t &c = cbuf[static_cast<std::size_t>(i)];
+                MergeEvent e;
+                e.first_seen_ms = c.first_seen_ms;
+                e.last_seen_ms = c.last_seen_ms;
+                e.reads = c.reads;
+                e.reader_id = c.reader_id;
+                e.antenna = c.antenna;
+                e.rssi = c.rssi;
+                e.reader_count = c.reader_count;
+                e.epc_bytes.assign(c.epc, c.epc + c.epc_len);
+                e.epc.resize(static_cast<std::size_t>(c.epc_len) * 2U);
+                for (std::size_t b = 0; b < c.epc_len; ++b) {
+                    e.epc[b * 2U] = digits[c.epc[b] >> 4];
+                    e.epc[b * 2U + 1U] = digits[c.epc[b] & 0x0F];
+                }
+                out_events.push_back(std::move(e));
+            }
+        } while (static_cast<std::size_t>(count) == cbuf.size());
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 리더 간 병합 단계 상태 조회
+     * @param[out] out_stats 병합 단계 상태
+     * @return 결과 Result
+     */
+    Result TagMerger::GetStats(MergeStats &out_stats) const {
+        out_stats = MergeStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->merge))
+            return Result::NotInitialized;
+
+        rfid_merge_stat_t cstat{};
+        if (RFID_RESULT_OK != rfid_merge_get_stats(impl_->merge, &cstat))
+            return Result::InternalError;
+
+        out_stats.reads = cstat.reads;
+        out_stats.windows = cstat.windows;
+        out_stats.events = cstat.events;
+        out_stats.table_full = cstat.table_full;
+        out_stats.contended = cstat.contended;
+        out_stats.active = cstat.active;
+        out_stats.capacity = cstat.capacity;
+        out_stats.shards = cstat.shards;
+        out_stats.push_p50_ns = cstat.push_p50_ns;
+        out_stats.push_p99_ns = cstat.push_p99_ns;
+        out_stats.push_p999_ns = cstat.push_p999_ns;
+        out_stats.push_max_ns = cstat.push_max_ns;
+        out_stats.merge_p50_us = cstat.merge_p50_us;
+        out_stats.merge_p99_us = cstat.merge_p99_us;
+        out_stats.merge_p999_us = cstat.merge_p999_us;
+        out_stats.merge_max_us = cstat.merge_max_us;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief EpcIntern 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class EpcIntern::Impl {
+    public:
+        rfid_epc_intern_t *intern = nullptr; /**< C intern 테이블 */
+
+        ~Impl() {
+            rfid_epc_intern_destroy(&intern);
+        }
+    };
+
+    EpcIntern::EpcIntern() : impl_(std::make_unique<Impl>()) {}
+
+    EpcIntern::~EpcIntern() = default;
+
+    /**
+     * @brief EPC intern 테이블 만들기
+     * @param[in] cfg 테이블 설정
+     * @return 결과 Result
+     */
+    Result EpcIntern::Open(const EpcInternConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr != impl_->intern)
+            return Result::InvalidArg;
+
+        rfid_epc_intern_params_t params{};
+        params.capacity = cfg.capacity;
+        params.shards = cfg.shards;
+        params.idle_ms = cfg.idle_ms;
+
+        const RFID_RESULT rc = rfid_epc_intern_create(&params, &impl_->intern);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief EPC id 얻기(없으면 발급)
+     * @param[in] epc_bytes 바이너리 EPC
+     * @param[out] out_id id
+     * @return 결과 Result
+     */
+    Result EpcIntern::Intern(const std::vector<std::uint8_t> &epc_bytes, std::uint32_t &out_id) {
+        out_id = kEpcIdNone;
+        if ((nullptr == impl_) || (nullptr == impl_->intern))
+            return Result::NotInitialized;
+
+        const RFID_RESULT rc = rfid_epc_intern_get(impl_->intern
+                                                   , epc_bytes.data()
+                                                   , static_cast<std::uint32_t>(epc_bytes.size())
+                                                   , &out_id);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 등록된 EPC id 찾기
+     * @param[in] epc_bytes 바이너리 EPC
+     * @param[out] out_id id
+     * @return 결과 Result
+     */
+    Result EpcIntern::Find(const std::vector<std::uint8_t> &epc_bytes, std::uint32_t &out_id) const {
+        out_id = kEpcIdNone;
+        if ((nullptr == impl_) || (nullptr == impl_->intern))
+            return Result::NotInitialized;
+
+        const RFID_RESULT rc = rfid_epc_intern_find(impl_->intern
+                                                    , epc_bytes.data()
+                                                    , static_cast<std::uint32_t>(epc_bytes.size())
+                                                    , &out_id);
+        return (RFID_RESULT_OK == rc) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief id 로 EPC 얻기
+     * @param[in] id id
+     * @param[out] out_epc_bytes 바이너리 EPC
+     * @return 결과 Result
+     */
+    Result EpcIntern::Lookup(const std::uint32_t id, std::vector<std::uint8_t> &out_epc_bytes) const {
+        out_epc_bytes.clear();
+        if ((nullptr == impl_) || (nullptr == impl_->intern))
+            return Result::NotInitialized;
+
+        std::uint8_t buf[RFID_EPC_MAX_BYTES];
+        std::uint32_t len = 0;
+        if (RFID_RESULT_OK != rfid_epc_intern_lookup(impl_->intern, id, buf, &len))
+            return Result::InvalidArg;
+
+        out_epc_bytes.assign(buf, buf + len);
+        return Result::Ok;
+    }
+
+    /**
+     * @brief EPC intern 테이블 상태 조회
+     * @param[out] out_stats 테이블 상태
+     * @return 결과 Result
+     */
+    Result EpcIntern::GetStats(EpcInternStats &out_stats) const {
+        out_stats = EpcInternStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->intern))
+            return Result::NotInitialized;
+
+        rfid_epc_intern_stat_t cstat{};
+        if (RFID_RESULT_OK != rfid_epc_intern_get_stats(impl_->intern, &cstat))
+            return Result::InternalError;
+
+        out_stats.interned = cstat.interned;
+        out_stats.evicted = cstat.evicted;
+        out_stats.table_full = cstat.table_full;
+        out_stats.count = cstat.count;
+        out_stats.capacity = cstat.capacity;
+        out_stats.shards = cstat.shards;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief C 태그를 Tag 로 옮긴다(모든 필드).
+     * @param[in] c C 태그
+     * @param[out] out_tag 결과 태그
+     */
+    static void FromPoolTag_(const rfid_tag_t &c, Tag &out_tag) {
+        out_tag.epc = c.epc;
+        out_tag.rssi = c.rssi;
+        out_tag.readcnt = c.readcnt;
+        out_tag.antenna = c.antenna;
+        out_tag.ts = c.ts;
+        out_tag.epc_bytes.assign(c.epc_bytes, c.epc_bytes + c.epc_len);
+        out_tag.rule_id = c.rule_id;
+        out_tag.epc_id = c.epc_id;
+        out_tag.air_us = c.air_us;
+        out_tag.rx_us = c.rx_us;
+        out_tag.parse_us = c.parse_us;
+        out_tag.data.assign(c.data, c.data + c.data_len);
+    }
+
+    /**
+     * @brief Tag 를 C 태그로 옮긴다(모든 필드, 버퍼보다 긴 값은 자른다).
+     * @param[in] t 태그
+     * @param[out] out_c 결과 C 태그
+     */
+    static void ToPoolTag_(const Tag &t, rfid_tag_t &out_c) {
+        std::memset(&out_c, 0, sizeof(out_c));
+        const std::size_t epc_chars = std::min<std::size_t>(t.epc.size(), RFID_EPC_MAX_LEN - 1);
+        std::memcpy(out_c.epc, t.epc.data(), epc_chars);
+        out_c.rssi = t.rssi;
+        out_c.readcnt = t.readcnt;
+        out_c.antenna = t.antenna;
+        out_c.ts = t.ts;
+        out_c.epc_len = static_cast<uint32_t>(std::min<std::size_t>(t.epc_bytes.size(), RFID_EPC_MAX_BYTES));
+        std::memcpy(out_c.epc_bytes, t.epc_bytes.data(), out_c.epc_len);
+        out_c.rule_id = t.rule_id;
+        out_c.epc_id = t.epc_id;
+        out_c.air_us = t.air_us;
+        out_c.rx_us = t.rx_us;
+        out_c.parse_us = t.parse_us;
+        out_c.data_len = static_cast<uint32_t>(std::min<std::size_t>(t.data.size(), RFID_TAG_DATA_MAX_BYTES));
+        std::memcpy(out_c.data, t.data.data(), out_c.data_len);
+    }
+
+    /**
+     * @brief TagPool 클래스 내부 구현체 (PImpl 패턴)
+     */
+    class TagPool::Impl {
+    public:
+        /**
+         * @brief 등록된 C++ stage (C stage 의 user 값, 풀보다 오래 유지)
+         */
+        struct Stage {
+            std::string name; /**< stage 이름 */
+            PoolStage fn; /**< stage 함수 */
+        };
+
+        rfid_pool_t *pool = nullptr; /**< C 풀 */
+        std::vector<std::unique_ptr<Stage>> stages; /**< 등록된 stage */
+
+        ~Impl() {
+            // 풀 해제가 남은 태그를 처리하므로 stage 보다 먼저 해제한다.
+            rfid_pool_destroy(&pool);
+        }
+
+        /**
+         * @brief C stage 에서 C++ stage 를 호출한다.
+         * @param[in] user Stage
+         * @param[in,out] items 태그 batch
+         * @param[in] count 태그 수
+         * @return 남긴 태그 수
+         */
+        static int RunStage_(void *user, rfid_pool_item_t *items, int count) {
+            const Stage *stage = static_cast<const Stage *>(user);
+            std::vector<PoolItem> batch(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i) {
+                PoolItem &dst = batch[static_cast<std::size_t>(i)];
+                FromPoolTag_(items[i].tag, dst.tag);
+                dst.reader_id = items[i].reader_id;
+                dst.submit_us = items[i].submit_us;
+                dst.merged = items[i].merged;
+            }
+
+            // 예외는 C 작업 스레드로 넘길 수 없으므로 batch 를 그대로 다음 stage 로 넘긴다.
+            try {
+                stage->fn(batch);
+            } catch (...) {
+                return count;
+            }
+
+            const std::size_t kept = std::min<std::size_t>(batch.size(), static_cast<std::size_t>(count));
+            for (std::size_t i = 0; i < kept; ++i) {
+                ToPoolTag_(batch[i].tag, items[i].tag);
+                items[i].reader_id = batch[i].reader_id;
+                items[i].submit_us = batch[i].submit_us;
+                items[i].merged = batch[i].merged;
+            }
+            return static_cast<int>(kept);
+        }
+    };
+
+    TagPool::TagPool() : impl_(std::make_unique<Impl>()) {}
+
+    TagPool::~TagPool() = default;
+
+    /**
+     * @brief stage 등록
+     * @param[in] name stage 이름
+     * @param[in] stage stage 함수
+     * @return 결과 Result
+     */
+    Result TagPool::AddStage(const std::string &name, PoolStage stage) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if ((nullptr != impl_->pool) || (!stage) || (impl_->stages.size() >= static_cast<std::size_t>(RFID_POOL_STAGE_MAX)))
+            return Result::InvalidArg;
+
+        impl_->stages.push_back(std::make_unique<Impl::Stage>(Impl::Stage{name, std::move(stage)}));
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 작업 스레드 시작
+     * @param[in] cfg 풀 설정
+     * @return 결과 Result
+     */
+    Result TagPool::Open(const PoolConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if ((nullptr != impl_->pool) || impl_->stages.empty())
+            return Result::InvalidArg;
+
+        std::vector<rfid_pool_stage_t> cstages;
+        cstages.reserve(impl_->stages.size());
+        for (const auto &st : impl_->stages)
+            cstages.push_back(rfid_pool_stage_t{st->name.c_str(), &Impl::RunStage_, st.get()});
+
+        rfid_pool_params_t params{};
+        params.workers = cfg.workers;
+        params.lanes = cfg.lanes;
+        params.lane_capacity = cfg.lane_capacity;
+        params.batch = cfg.batch;
+        params.policy = static_cast<RFID_POOL_POLICY>(cfg.policy);
+        params.block_timeout_ms = cfg.block_timeout_ms;
+        params.memory_limit_bytes = cfg.memory_limit_bytes;
+
+        const RFID_RESULT rc = rfid_pool_create(&params, cstages.data(), static_cast<int>(cstages.size()), &impl_->pool);
+        if (RFID_RESULT_OK != rc)
+            return (RFID_RESULT_INVALID_ARG == rc) ? Result::InvalidArg : Result::InternalError;
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 한 리더의 Read 결과 넣기
+     * @param[in] reader_id 리더 id
+     * @param[in] tags Read 결과
+     * @param[out] out_accepted 받은 태그 수
+     * @return 결과 Result
+     */
+    Result TagPool::Submit(const std::uint16_t reader_id, const std::vector<Tag> &tags, std::size_t *out_accepted) {
+        if (nullptr != out_accepted)
+            *out_accepted = 0;
+        if ((nullptr == impl_) || (nullptr == impl_->pool))
+            return Result::NotInitialized;
+        if (tags.size() > static_cast<std::size_t>(INT_MAX))
+            return Result::InvalidArg;
+
+        std::vector<rfid_tag_t> ctags(tags.size());
+        for (std::size_t i = 0; i < tags.size(); ++i)
+            ToPoolTag_(tags[i], ctags[i]);
+
+        int accepted = 0;
+        const RFID_RESULT rc = rfid_pool_submit(impl_->pool, reader_id, ctags.data(), static_cast<int>(ctags.size()), &accepted);
+        if (nullptr != out_accepted)
+            *out_accepted = static_cast<std::size_t>(accepted);
+        return (RFID_RESULT_OK == rc) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 대기 중인 태그 처리 대기
+     * @param[in] timeout_ms 최대 대기 시간(ms)
+     * @param[out] out_pending 남은 태그 수
+     * @return 결과 Result
+     */
+    Result TagPool::Drain(const std::uint32_t timeout_ms, std::uint32_t &out_pending) {
+        out_pending = 0;
+        if ((nullptr == impl_) || (nullptr == impl_->pool))
+            return Result::NotInitialized;
+
+        return (RFID_RESULT_OK == rfid_pool_drain(impl_->pool, timeout_ms, &out_pending)) ? Result::Ok : Result::InvalidArg;
+    }
+
+    /**
+     * @brief 풀 상태 조회
+     * @param[out] out_stats 풀 상태
+     * @return 결과 Result
+     */
+    Result TagPool::GetStats(PoolStats &out_stats) const {
+        out_stats = PoolStats{};
+        if ((nullptr == impl_) || (nullptr == impl_->pool))
+            return Result::NotInitialized;
+
+        rfid_pool_stat_t cstat{};
+        std::vector<rfid_pool_stage_stat_t> cstages(impl_->stages.size());
+        int count = 0;
+        if (RFID_RESULT_OK != rfid_pool_get_stats(impl_->pool, &cstat, cstages.data(), static_cast<int>(cstages.size()), &count))
+            return Result::InternalError;
+
+        out_stats.submitted = cstat.submitted;
+        out_stats.processed = cstat.processed;
+        out_stats.dropped = cstat.dropped;
+        out_stats.dropped_newest = cstat.dropped_newest;
+        out_stats.dropped_oldest = cstat.dropped_oldest;
+        out_stats.coalesced = cstat.coalesced;
+        out_stats.blocked = cstat.blocked;
+        out_stats.block_timeouts = cstat.block_timeouts;
+        out_stats.block_wait_us = cstat.block_wait_us;
+        out_stats.memory_bytes = cstat.memory_bytes;
+        out_stats.batches = cstat.batches;
+        out_stats.steals = cstat.steals;
+        out_stats.rx_p50_us = cstat.rx_p50_us;
+        out_stats.rx_p99_us = cstat.rx_p99_us;
+        out_stats.rx_p999_us = cstat.rx_p999_us;
+        out_stats.rx_max_us = cstat.rx_max_us;
+        out_stats.pending = cstat.pending;
+        out_stats.workers = cstat.workers;
+        out_stats.lanes = cstat.lanes;
+        out_stats.lane_capacity = cstat.lane_capacity;
+        out_stats.policy = static_cast<PoolPolicy>(cstat.policy);
+        out_stats.stages.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            const rfid_pool_stage_stat_t &c = cstages[static_cast<std::size_t>(i)];
+            PoolStageStats st;
+            st.name = c.name;
+            st.items_in = c.items_in;
+            st.items_out = c.items_out;
+            st.calls = c.calls;
+            st.busy_us = c.busy_us;
+            st.items_per_sec = c.items_per_sec;
+            st.queue_p50_us = c.queue_p50_us;
+            st.queue_p99_us = c.queue_p99_us;
+            st.queue_p999_us = c.queue_p999_us;
+            st.queue_max_us = c.queue_max_us;
+            out_stats.stages.push_back(std::move(st));
+        }
+        return Result::Ok;
+    }
+
+    // Reader 생성자/소멸자/Move
+    Reader::Reader() : impl_(std::make_unique<Impl>()) {}
+
+    Reader::~Reader() {
+        Destroy();
+    }
+
+    Reader::Reader(Reader &&other) = default;
+    Reader& Reader::operator=(Reader &&other) = default;
+
+    /**
+     * @brief RFID 장치 초기화
+     * @param[in] cfg 초기화 설정
+     * @return 초기화 결과 Result
+     */
+    Result Reader::Init(const Config &cfg) {
+        Destroy();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (!cfg.enable)
+            return impl_->SetLastError_(Result::Disabled, "Init failed");
+        if (cfg.uri.empty())
+            return impl_->SetLastError_(Result::InvalidArg, "Init failed: invalid argument (uri is empty)");
+        if (cfg.antennas.empty() && cfg.plans.empty())
+            return impl_->SetLastError_(Result::InvalidArg, "Init failed: invalid argument (antennas is empty)");
+
+        impl_->EnsureBuf_(cfg.capacity);
+        impl_->antennas = cfg.antennas;
+
+        rfid_init_params_t params{};
+        params.rfid_enable = 1;
+        params.uri = cfg.uri.c_str();
+        params.region = Impl::ToCRegion_(cfg.region);
+        params.antennas = cfg.antennas.empty() ? nullptr : cfg.antennas.data();
+        params.antenna_count = static_cast<int>(cfg.antennas.size());
+        params.plan_timeout_ms = cfg.plan_timeout_ms;
+        params.write_power_cdbm = cfg.write_power_cdbm;
+        params.dwell.enable = cfg.dwell.enable ? 1 : 0;
+        params.dwell.update_cycles = cfg.dwell.update_cycles;
+        params.dwell.min_share_pct = cfg.dwell.min_share_pct;
+        params.dwell.max_share_pct = cfg.dwell.max_share_pct;
+        params.gen2 = Impl::ToCGen2_(cfg.gen2);
+
+        if (!cfg.antenna_power_cdbm.empty()) {
+            if (cfg.antenna_power_cdbm.size() != cfg.antennas.size())
+                return impl_->SetLastError_(Result::InvalidArg, "Init failed: invalid argument (antenna_power_cdbm size)");
+            params.antenna_power_cdbm = cfg.antenna_power_cdbm.data();
+        }
+
+        // foreign EPC 문자열은 cfg가 소유하며 rfid_init() 동안만 참조된다.
+        std::vector<rfid_foreign_tag_t> foreign;
+        foreign.reserve(cfg.power_ctrl.foreign_tags.size());
+        for (const ForeignTag &ft : cfg.power_ctrl.foreign_tags)
+            foreign.push_back(rfid_foreign_tag_t{ft.epc.c_str(), ft.home_antenna});
+
+        params.power_ctrl.mode = static_cast<RFID_POWER_CTRL_MODE>(cfg.power_ctrl.mode);
+        params.power_ctrl.min_cdbm = cfg.power_ctrl.min_cdbm;
+        params.power_ctrl.max_cdbm = cfg.power_ctrl.max_cdbm;
+        params.power_ctrl.step_cdbm = cfg.power_ctrl.step_cdbm;
+        params.power_ctrl.update_cycles = cfg.power_ctrl.update_cycles;
+        params.power_ctrl.deadband_pct = cfg.power_ctrl.deadband_pct;
+        params.power_ctrl.target_reads_per_sec = cfg.power_ctrl.target_reads_per_sec;
+        params.power_ctrl.rssi_low_dbm = cfg.power_ctrl.rssi_low_dbm;
+        params.power_ctrl.rssi_high_dbm = cfg.power_ctrl.rssi_high_dbm;
+        params.power_ctrl.foreign_tags = foreign.empty() ? nullptr : foreign.data();
+        params.power_ctrl.foreign_count = static_cast<int>(foreign.size());
+
+        const std::vector<rfid_select_filter_t> select = Impl::ToCSelect_(cfg.select_filters);
+        params.select_filters = select.empty() ? nullptr : select.data();
+        params.select_count = static_cast<int>(select.size());
+        params.select_combine = static_cast<RFID_SELECT_COMBINE>(cfg.select_combine);
+        params.baud.enable = cfg.baud.enable ? 1 : 0;
+        params.baud.max_rate = cfg.baud.max_rate;
+        params.baud.probe_count = cfg.baud.probe_count;
+        params.baud.fallback_errors = cfg.baud.fallback_errors;
+        params.tag_metadata = cfg.tag_metadata;
+
+        // plan 항목의 안테나/필터는 cfg가 소유하며 rfid_init() 동안만 참조된다.
+        std::vector<std::vector<rfid_select_filter_t> > plan_selects;
+        std::vector<rfid_plan_entry_t> plans;
+        plan_selects.reserve(cfg.plans.size());
+        plans.reserve(cfg.plans.size());
+        for (const ReadPlanConfig &pc : cfg.plans) {
+            plan_selects.push_back(Impl::ToCSelect_(pc.select_filters));
+            const std::vector<rfid_select_filter_t> &ps = plan_selects.back();
+            rfid_plan_entry_t e{};
+            e.antennas = pc.antennas.empty() ? nullptr : pc.antennas.data();
+            e.antenna_count = static_cast<int>(pc.antennas.size());
+            e.weight = pc.weight;
+            e.select_filters = ps.empty() ? nullptr : ps.data();
+            e.select_count = static_cast<int>(ps.size());
+            e.select_combine = static_cast<RFID_SELECT_COMBINE>(pc.select_combine);
+            plans.push_back(e);
+        }
+        params.plans = plans.empty() ? nullptr : plans.data();
+        params.plan_count = static_cast<int>(plans.size());
+        params.embedded_read = Impl::ToCEmbedded_(cfg.embedded_read);
+
+        rfid_ctx_t *tmp = nullptr;
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_init(&tmp, &params, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            if (nullptr != tmp)
+                (void) rfid_deinit(&tmp, nullptr, nullptr);
+            impl_->SetLastError_(r, "Init failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        impl_->ctx = tmp;
+        if (nullptr != impl_->matcher)
+            (void) rfid_set_epc_matcher(impl_->ctx, impl_->matcher->impl_->matcher, impl_->matcher_drop ? 1 : 0);
+        if (nullptr != impl_->tag_log)
+            (void) rfid_set_tag_log(impl_->ctx, impl_->tag_log->impl_->log, impl_->tag_log_reader_id);
+        if (nullptr != impl_->tag_bus)
+            (void) rfid_set_tag_bus(impl_->ctx, impl_->tag_bus->impl_->bus, impl_->tag_bus_reader_id);
+        if (nullptr != impl_->merger)
+            (void) rfid_set_merge(impl_->ctx, impl_->merger->impl_->merge, impl_->merger_reader_id);
+        if (nullptr != impl_->intern)
+            (void) rfid_set_epc_intern(impl_->ctx, impl_->intern->impl_->intern);
+        if (nullptr != impl_->pool)
+            (void) rfid_set_pool(impl_->ctx, impl_->pool->impl_->pool, impl_->pool_reader_id);
+        if (nullptr != impl_->presence) {
+            // 이미 Update 한 엔진(재 Init 등)은 복원하지 않는다.
+            std::uint32_t restored = 0;
+            (void) impl_->presence->Restore(cfg.uri, restored);
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief RFID 장치 해제
+     * @return 해제 결과 Result
+     */
+    Result Reader::Destroy() {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::Ok);
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_deinit(&impl_->ctx, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r);
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        impl_->ctx = nullptr;
+        impl_->on_autonomous = nullptr;
+        impl_->on_trigger = nullptr;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 초기화 여부 확인
+     * @return true: 초기화됨, false: 초기화 안됨
+     */
+    bool Reader::IsInitialized() const {
+        return impl_ && (impl_->ctx != nullptr);
+    }
+
+    /**
+     * @brief RFID 태그 읽기
+     * @param[in] read_timeout_ms 읽기 타임아웃(ms)
+     * @param[out] out_tags 읽은 태그를 저장할 vector
+     * @return 읽기 결과 Result
+     */
+    Result Reader::Read(const int read_timeout_ms, std::vector<Tag> &out_tags) {
+        out_tags.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "Read failed");
+        if (read_timeout_ms < 0)
+            return impl_->SetLastError_(Result::InvalidArg, "Read failed: invalid argument (read_timeout_ms < 0)");
+
+        if (impl_->cbuf.empty())
+            impl_->EnsureBuf_(64);
+
+        int out_count = 0;
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_read(
+                impl_->ctx
+                , impl_->antennas.data()
+                , static_cast<int>(impl_->antennas.size())
+                , read_timeout_ms
+                , impl_->cbuf.data()
+                , static_cast<int>(impl_->cbuf.size())
+                , &out_count
+                , &status
+                , &errstr
+                );
+
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "Read failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        impl_->CopyTags_(out_count, out_tags);
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 쓰기 전력 설정
+     * @param[in] write_power_cdbm 쓰기 전력 (cdbm)
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetWritePowerCdbm(const int write_power_cdbm) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetWritePower failed");
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_set_write_power(impl_->ctx, write_power_cdbm, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "SetWritePower failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 리더 측 Select 필터 교체
+     * @param[in] filters 필터 목록
+     * @param[in] combine 결합 방식
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetSelectFilters(const std::vector<SelectFilter> &filters, const SelectCombine combine) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetSelectFilters failed");
+
+        const std::vector<rfid_select_filter_t> select = Impl::ToCSelect_(filters);
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_set_select_filters(impl_->ctx
+                                                       , select.empty() ? nullptr : select.data()
+                                                       , static_cast<int>(select.size())
+                                                       , static_cast<RFID_SELECT_COMBINE>(combine)
+                                                       , &status
+                                                       , &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "SetSelectFilters failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief embedded read 설정 교체
+     * @param[in] cfg 설정
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetEmbeddedRead(const EmbeddedReadConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetEmbeddedRead failed");
+
+        const rfid_embedded_read_t read = Impl::ToCEmbedded_(cfg);
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_set_embedded_read(impl_->ctx, &read, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "SetEmbeddedRead failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 적응형 dwell 스케줄러 상태 조회
+     * @param[out] out_stats 안테나별 상태
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetDwellStats(std::vector<DwellStat> &out_stats) {
+        out_stats.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "GetDwellStats failed");
+
+        rfid_dwell_stat_t cstats[RFID_ANTENNA_MAX];
+        int out_count = 0;
+        const RFID_RESULT rc = rfid_get_dwell_stats(impl_->ctx, cstats, RFID_ANTENNA_MAX, &out_count);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "GetDwellStats failed");
+
+        out_stats.reserve(static_cast<std::size_t>(out_count));
+        for (int i = 0; i < out_count; ++i) {
+            DwellStat st;
+            st.antenna = cstats[i].antenna;
+            st.share_permille = cstats[i].share_permille;
+            st.new_tags = cstats[i].new_tags;
+            st.dwell_ms = cstats[i].dwell_ms;
+            st.yield_per_sec = cstats[i].yield_per_sec;
+            out_stats.push_back(st);
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 안테나별 read power 설정
+     * @param[in] antenna 안테나 번호
+     * @param[in] power_cdbm read power (cdbm)
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetAntennaPowerCdbm(const int antenna, const int power_cdbm) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetAntennaPower failed");
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_set_antenna_power(impl_->ctx, antenna, power_cdbm, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "SetAntennaPower failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 안테나별 read power 제어 상태 조회
+     * @param[out] out_stats 안테나별 상태
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetPowerStats(std::vector<PowerStat> &out_stats) {
+        out_stats.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "GetPowerStats failed");
+
+        rfid_power_stat_t cstats[RFID_ANTENNA_MAX];
+        int out_count = 0;
+        const RFID_RESULT rc = rfid_get_power_stats(impl_->ctx, cstats, RFID_ANTENNA_MAX, &out_count);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "GetPowerStats failed");
+
+        out_stats.reserve(static_cast<std::size_t>(out_count));
+        for (int i = 0; i < out_count; ++i) {
+            PowerStat st;
+            st.antenna = cstats[i].antenna;
+            st.power_cdbm = cstats[i].power_cdbm;
+            st.reads_per_sec = cstats[i].reads_per_sec;
+            st.rssi_avg = cstats[i].rssi_avg;
+            st.foreign_reads = cstats[i].foreign_reads;
+            st.adjustments = cstats[i].adjustments;
+            st.last_step_cdbm = cstats[i].last_step_cdbm;
+            out_stats.push_back(st);
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief Gen2 튜닝 모드 변경
+     * @param[in] cfg 튜닝 설정
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetGen2Tuning(const Gen2TuneConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetGen2Tuning failed");
+
+        const rfid_gen2_tune_params_t params = Impl::ToCGen2_(cfg);
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_set_gen2_tuning(impl_->ctx, &params, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "SetGen2Tuning failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief Gen2 튜닝 상태 조회
+     * @param[out] out_status 튜닝 상태
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetGen2Status(Gen2Status &out_status) {
+        out_status = Gen2Status{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "GetGen2Status failed");
+
+        rfid_gen2_status_t cstatus{};
+        const RFID_RESULT rc = rfid_get_gen2_status(impl_->ctx, &cstatus);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "GetGen2Status failed");
+
+        out_status.mode = static_cast<Gen2TuneMode>(cstatus.mode);
+        out_status.settings = Impl::FromCGen2Settings_(cstatus.settings);
+        out_status.population_estimate = cstatus.population_estimate;
+        out_status.tags_per_sec = cstatus.tags_per_sec;
+        out_status.last_apply_status = cstatus.last_apply_status;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief EPC 규칙 엔진 연결
+     * @param[in] matcher 규칙 엔진(nullptr이면 해제)
+     * @param[in] drop_unmatched 규칙 불일치 태그 제외 여부
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetEpcMatcher(std::shared_ptr<EpcMatcher> matcher, const bool drop_unmatched) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetEpcMatcher failed");
+        if ((nullptr != matcher) && (nullptr == matcher->impl_))
+            return impl_->SetLastError_(Result::InvalidArg, "SetEpcMatcher failed: invalid argument (matcher is moved-from)");
+
+        rfid_epc_matcher_t *cmatcher = (nullptr != matcher) ? matcher->impl_->matcher : nullptr;
+        const RFID_RESULT rc = rfid_set_epc_matcher(impl_->ctx, cmatcher, drop_unmatched ? 1 : 0);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetEpcMatcher failed");
+
+        // C ctx는 matcher를 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->matcher = std::move(matcher);
+        impl_->matcher_drop = drop_unmatched;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 태그 로그 연결
+     * @param[in] log 태그 로그(nullptr이면 해제)
+     * @param[in] reader_id 레코드에 기록할 리더 id
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetTagLog(std::shared_ptr<TagLog> log, const std::uint16_t reader_id) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetTagLog failed");
+        if ((nullptr != log) && ((nullptr == log->impl_) || (nullptr == log->impl_->log)))
+            return impl_->SetLastError_(Result::InvalidArg, "SetTagLog failed: invalid argument (log is not open)");
+
+        rfid_tag_log_t *clog = (nullptr != log) ? log->impl_->log : nullptr;
+        const RFID_RESULT rc = rfid_set_tag_log(impl_->ctx, clog, reader_id);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetTagLog failed");
+
+        // C ctx는 로그를 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->tag_log = std::move(log);
+        impl_->tag_log_reader_id = reader_id;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 공유 메모리 태그 버스 연결
+     * @param[in] bus 태그 버스(nullptr이면 해제)
+     * @param[in] reader_id 레코드에 기록할 리더 id
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetTagBus(std::shared_ptr<TagBus> bus, const std::uint16_t reader_id) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetTagBus failed");
+        if ((nullptr != bus) && ((nullptr == bus->impl_) || (nullptr == bus->impl_->bus)))
+            return impl_->SetLastError_(Result::InvalidArg, "SetTagBus failed: invalid argument (bus is not open)");
+
+        rfid_tag_bus_t *cbus = (nullptr != bus) ? bus->impl_->bus : nullptr;
+        const RFID_RESULT rc = rfid_set_tag_bus(impl_->ctx, cbus, reader_id);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetTagBus failed");
+
+        // C ctx는 버스를 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->tag_bus = std::move(bus);
+        impl_->tag_bus_reader_id = reader_id;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 리더 간 병합 단계 연결
+     * @param[in] merger 병합 단계(nullptr이면 해제)
+     * @param[in] reader_id 병합 단계에 넘길 리더 id
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetTagMerger(std::shared_ptr<TagMerger> merger, const std::uint16_t reader_id) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetTagMerger failed");
+        if ((nullptr != merger) && ((nullptr == merger->impl_) || (nullptr == merger->impl_->merge)))
+            return impl_->SetLastError_(Result::InvalidArg, "SetTagMerger failed: invalid argument (merger is not open)");
+
+        rfid_merge_t *cmerge = (nullptr != merger) ? merger->impl_->merge : nullptr;
+        const RFID_RESULT rc = rfid_set_merge(impl_->ctx, cmerge, reader_id);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetTagMerger failed");
+
+        // C ctx는 병합 단계를 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->merger = std::move(merger);
+        impl_->merger_reader_id = reader_id;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief EPC intern 테이블 연결
+     * @param[in] intern intern 테이블(nullptr이면 해제)
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetEpcIntern(std::shared_ptr<EpcIntern> intern) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetEpcIntern failed");
+        if ((nullptr != intern) && ((nullptr == intern->impl_) || (nullptr == intern->impl_->intern)))
+            return impl_->SetLastError_(Result::InvalidArg, "SetEpcIntern failed: invalid argument (intern is not open)");
+
+        rfid_epc_intern_t *cintern = (nullptr != intern) ? intern->impl_->intern : nullptr;
+        const RFID_RESULT rc = rfid_set_epc_intern(impl_->ctx, cintern);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetEpcIntern failed");
+
+        // C ctx는 테이블을 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->intern = std::move(intern);
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 태그 후처리 풀 연결
+     * @param[in] pool 풀(nullptr이면 해제)
+     * @param[in] reader_id 풀에 넘길 리더 id
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetTagPool(std::shared_ptr<TagPool> pool, const std::uint16_t reader_id) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetTagPool failed");
+        if ((nullptr != pool) && ((nullptr == pool->impl_) || (nullptr == pool->impl_->pool)))
+            return impl_->SetLastError_(Result::InvalidArg, "SetTagPool failed: invalid argument (pool is not open)");
+
+        rfid_pool_t *cpool = (nullptr != pool) ? pool->impl_->pool : nullptr;
+        const RFID_RESULT rc = rfid_set_pool(impl_->ctx, cpool, reader_id);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetTagPool failed");
+
+        // C ctx는 풀을 소유하지 않으므로 연결된 동안 Reader가 참조를 유지한다.
+        impl_->pool = std::move(pool);
+        impl_->pool_reader_id = reader_id;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 태그 존재 감지 엔진 연결
+     * @param[in] engine 엔진(nullptr이면 해제)
+     * @return 설정 결과 Result
+     */
+    Result Reader::SetPresenceEngine(std::shared_ptr<PresenceEngine> engine) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+
+        impl_->presence = std::move(engine);
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 시리얼 링크 상태 조회
+     * @param[out] out_stat 링크 상태
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetLinkStats(LinkStat &out_stat) {
+        out_stat = LinkStat{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "GetLinkStats failed");
+
+        rfid_link_stat_t cstat{};
+        const RFID_RESULT rc = rfid_get_link_stats(impl_->ctx, &cstat);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "GetLinkStats failed");
+
+        out_stat.baud_rate = cstat.baud_rate;
+        out_stat.connect_rate = cstat.connect_rate;
+        out_stat.verified_max_rate = cstat.verified_max_rate;
+        out_stat.probe_rtt_us = cstat.probe_rtt_us;
+        out_stat.tx_bytes = cstat.tx_bytes;
+        out_stat.rx_bytes = cstat.rx_bytes;
+        out_stat.bytes_per_sec = cstat.bytes_per_sec;
+        out_stat.utilization_pct = cstat.utilization_pct;
+        out_stat.comm_errors = cstat.comm_errors;
+        out_stat.fallbacks = cstat.fallbacks;
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 리더 상태 카운터 스냅샷 조회
+     * @param[out] out_counters 카운터 스냅샷
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetCounters(ReaderCounters &out_counters) const {
+        out_counters = ReaderCounters{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return Result::NotInitialized;
+
+        rfid_counters_t c{};
+        const Result r = Impl::ToCppResult_(rfid_get_counters(impl_->ctx, &c));
+        if (Result::Ok != r)
+            return r;
+
+        out_counters.uptime_ms = c.uptime_ms;
+        out_counters.tx_frames = c.tx_frames;
+        out_counters.tx_bytes = c.tx_bytes;
+        out_counters.rx_frames = c.rx_frames;
+        out_counters.rx_bytes = c.rx_bytes;
+        out_counters.crc_errors = c.crc_errors;
+        out_counters.soh_resyncs = c.soh_resyncs;
+        out_counters.discarded_bytes = c.discarded_bytes;
+        out_counters.timeouts = c.timeouts;
+        out_counters.read_cycles = c.read_cycles;
+        out_counters.read_errors = c.read_errors;
+        out_counters.buffer_overflows = c.buffer_overflows;
+        out_counters.overflow_tags = c.overflow_tags;
+        out_counters.queue_depth = c.queue_depth;
+        out_counters.queue_peak = c.queue_peak;
+        out_counters.antennas.reserve(static_cast<std::size_t>(c.antenna_count));
+        for (int i = 0; i < c.antenna_count; ++i) {
+            const rfid_antenna_counters_t &a = c.antennas[i];
+            out_counters.antennas.push_back(AntennaCounters{a.antenna, a.reads, a.unique_tags, a.reads_per_sec, a.unique_per_sec});
+        }
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 카운터 exposition 텍스트 생성
+     * @param[out] out_text exposition 텍스트
+     * @param[in] reader_label reader 라벨 값
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetCountersText(std::string &out_text, const std::string &reader_label) const {
+        out_text.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return Result::NotInitialized;
+
+        rfid_counters_t c{};
+        const Result r = Impl::ToCppResult_(rfid_get_counters(impl_->ctx, &c));
+        if (Result::Ok != r)
+            return r;
+
+        const char *label = reader_label.empty() ? nullptr : reader_label.c_str();
+        const int len = rfid_format_counters(&c, label, nullptr, 0);
+        if (len < 0)
+            return Result::InternalError;
+        out_text.resize(static_cast<std::size_t>(len) + 1U);
+        (void) rfid_format_counters(&c, label, out_text.data(), out_text.size());
+        out_text.resize(static_cast<std::size_t>(len));
+        return Result::Ok;
+    }
+
+    /**
+     * @brief 가중치 read plan 항목별 상태 조회
+     * @param[out] out_stats 항목별 상태
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetPlanStats(std::vector<PlanStat> &out_stats) {
+        out_stats.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "GetPlanStats failed");
+
+        rfid_plan_stat_t cstats[RFID_PLAN_MAX];
+        int count = 0;
+        const RFID_RESULT rc = rfid_get_plan_stats(impl_->ctx, cstats, RFID_PLAN_MAX, &count);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "GetPlanStats failed");
+
+        out_stats.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            PlanStat st;
+            st.weight = cstats[i].weight;
+            st.share_permille = cstats[i].share_permille;
+            st.tags = cstats[i].tags;
+            st.airtime_ms = cstats[i].airtime_ms;
+            st.yield_per_sec = cstats[i].yield_per_sec;
+            out_stats.push_back(st);
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 가중치 read plan 항목 가중치 변경
+     * @param[in] weights 항목별 가중치
+     * @return 변경 결과 Result
+     */
+    Result Reader::SetPlanWeights(const std::vector<int> &weights) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "SetPlanWeights failed");
+        if (weights.empty())
+            return impl_->SetLastError_(Result::InvalidArg, "SetPlanWeights failed: invalid argument (weights is empty)");
+
+        const RFID_RESULT rc = rfid_set_plan_weights(impl_->ctx, weights.data(), static_cast<int>(weights.size()));
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "SetPlanWeights failed");
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 조기 종료 태그 읽기
+     * @param[in] read_timeout_ms 최대 대기 시간(ms)
+     * @param[in] cond 종료 조건
+     * @param[out] out_tags 결과 태그 리스트
+     * @param[out] out_report 종료 사유/지연 시간(nullptr 허용)
+     * @return 읽기 결과 Result
+     */
+    Result Reader::ReadUntil(const int read_timeout_ms
+                             , const EarlyExit &cond
+                             , std::vector<Tag> &out_tags
+                             , EarlyExitReport *out_report) {
+        out_tags.clear();
+        if (nullptr != out_report)
+            *out_report = EarlyExitReport{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "ReadUntil failed");
+        if (read_timeout_ms < 0)
+            return impl_->SetLastError_(Result::InvalidArg, "ReadUntil failed: invalid argument (read_timeout_ms < 0)");
+        if ((cond.stop_count <= 0) && cond.expected_epcs.empty())
+            return impl_->SetLastError_(Result::InvalidArg, "ReadUntil failed: no stop condition");
+
+        if (impl_->cbuf.empty())
+            impl_->EnsureBuf_(64);
+
+        std::vector<const char *> expected;
+        expected.reserve(cond.expected_epcs.size());
+        for (const auto &epc : cond.expected_epcs)
+            expected.push_back(epc.c_str());
+
+        rfid_early_exit_t ccond{};
+        ccond.stop_count = cond.stop_count;
+        ccond.expected_epcs = expected.empty() ? nullptr : expected.data();
+        ccond.expected_count = static_cast<int>(expected.size());
+        ccond.fast_search = cond.fast_search ? 1 : 0;
+
+        int out_count = 0;
+        rfid_early_exit_report_t creport{};
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_read_until(
+                impl_->ctx
+                , impl_->antennas.data()
+                , static_cast<int>(impl_->antennas.size())
+                , read_timeout_ms
+                , &ccond
+                , impl_->cbuf.data()
+                , static_cast<int>(impl_->cbuf.size())
+                , &out_count
+                , &creport
+                , &status
+                , &errstr
+                );
+
+        if (nullptr != out_report) {
+            out_report->reason = static_cast<EarlyExitReason>(creport.reason);
+            out_report->latency_us = creport.latency_us;
+            out_report->reads = creport.reads;
+            out_report->unique_tags = creport.unique_tags;
+            out_report->expected_found = creport.expected_found;
+        }
+
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "ReadUntil failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        impl_->CopyTags_(out_count, out_tags);
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief 태그 발행 작업 목록 실행
+     * @param[in] jobs 작업 목록
+     * @param[out] out_results 작업별 결과
+     * @param[out] out_stats 호출 요약(nullptr 허용)
+     * @param[in] cfg 실행 설정
+     * @return 실행 결과 Result
+     */
+    Result Reader::Commission(const std::vector<CommissionJob> &jobs
+                              , std::vector<CommissionResult> &out_results
+                              , CommissionStats *out_stats
+                              , const CommissionConfig &cfg) {
+        out_results.clear();
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "Commission failed");
+        if (jobs.empty())
+            return impl_->SetLastError_(Result::InvalidArg, "Commission failed: invalid argument (jobs is empty)");
+
+        // 필터/EPC 문자열은 jobs가 소유하며 rfid_commission() 동안만 참조된다.
+        std::vector<rfid_select_filter_t> targets(jobs.size());
+        std::vector<rfid_commission_job_t> cjobs(jobs.size());
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            const CommissionJob &j = jobs[i];
+            rfid_commission_job_t &c = cjobs[i];
+            if (!j.target.mask_hex.empty()) {
+                rfid_select_filter_t &t = targets[i];
+                t.bank = static_cast<RFID_GEN2_BANK>(j.target.bank);
+                t.bit_pointer = j.target.bit_pointer;
+                t.mask_hex = j.target.mask_hex.c_str();
+                t.mask_bits = j.target.mask_bits;
+                t.invert = j.target.invert ? 1 : 0;
+                c.target = &t;
+            }
+            c.epc = j.epc.c_str();
+            c.lock_mask = j.lock_mask;
+            c.lock_action = j.lock_action;
+            c.access_password = j.access_password;
+        }
+
+        rfid_commission_params_t params{};
+        params.antenna = cfg.antenna;
+        params.max_attempts = cfg.max_attempts;
+        params.op_timeout_ms = cfg.op_timeout_ms;
+
+        std::vector<rfid_commission_result_t> cresults(jobs.size());
+        rfid_commission_stat_t cstat{};
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_commission(impl_->ctx
+                                               , cjobs.data()
+                                               , static_cast<int>(cjobs.size())
+                                               , &params
+                                               , cresults.data()
+                                               , &cstat
+                                               , &status
+                                               , &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "Commission failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+
+        out_results.reserve(cresults.size());
+        for (const rfid_commission_result_t &c : cresults) {
+            CommissionResult cr;
+            cr.result = Impl::ToCppResult_(c.result);
+            cr.stage = static_cast<CommissionStage>(c.stage);
+            cr.status = c.status;
+            cr.attempts = c.attempts;
+            cr.latency_us = c.latency_us;
+            out_results.push_back(cr);
+        }
+        if (nullptr != out_stats) {
+            out_stats->jobs = cstat.jobs;
+            out_stats->succeeded = cstat.succeeded;
+            out_stats->failed = cstat.failed;
+            out_stats->retries = cstat.retries;
+            out_stats->elapsed_us = cstat.elapsed_us;
+            out_stats->max_latency_us = cstat.max_latency_us;
+            out_stats->tags_per_min = cstat.tags_per_min;
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief autonomous read 수신 스레드가 모은 C 태그 batch 를 처리 함수로 넘긴다.
+     * @param[in] user AutonomousHandler 주소(Reader 가 수신 중 유지)
+     * @param[in] tags C 태그 배열
+     * @param[in] count 태그 수
+     */
+    static void RunAutonomousHandler_(void *user, const rfid_tag_t *tags, int count) {
+        const AutonomousHandler *handler = static_cast<const AutonomousHandler *>(user);
+        try {
+            std::vector<Tag> batch(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i)
+                FromPoolTag_(tags[i], batch[static_cast<std::size_t>(i)]);
+            (*handler)(batch);
+        }
+        catch (...) {
+            // 수신 스레드 밖으로 예외를 내보내지 않는다.
+        }
+    }
+
+    /**
+     * @brief autonomous read 시작
+     * @param[in] cfg 설정
+     * @return 시작 결과 Result
+     */
+    Result Reader::StartAutonomous(const AutonomousConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "StartAutonomous failed");
+
+        rfid_autonomous_params_t p{};
+        p.mode = static_cast<RFID_AUTONOMOUS_MODE>(cfg.mode);
+        p.antennas = impl_->antennas.empty() ? nullptr : impl_->antennas.data();
+        p.antenna_count = static_cast<int>(impl_->antennas.size());
+        p.on_time_ms = cfg.on_time_ms;
+        p.persist = cfg.persist ? 1 : 0;
+        p.batch_max = cfg.batch_max;
+        p.flush_ms = cfg.flush_ms;
+        p.poll_ms = cfg.poll_ms;
+        p.silence_ms = cfg.silence_ms;
+        p.error_limit = cfg.error_limit;
+        p.reconnect_ms = cfg.reconnect_ms;
+
+        // 수신 중인 스레드가 처리 함수를 참조하므로 수신 중이면 바꾸지 않는다.
+        AutonomousStats stats;
+        if ((Result::Ok == GetAutonomousStats(stats)) && stats.running)
+            return impl_->SetLastError_(Result::Busy, "StartAutonomous failed");
+
+        impl_->on_autonomous = cfg.on_tags;
+        if (impl_->on_autonomous) {
+            p.on_tags = RunAutonomousHandler_;
+            p.user = &impl_->on_autonomous;
+        }
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_autonomous_start(impl_->ctx, &p, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r) {
+            impl_->on_autonomous = nullptr;
+            impl_->SetLastError_(r, "StartAutonomous failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief autonomous read 정지
+     * @return 정지 결과 Result
+     */
+    Result Reader::StopAutonomous() {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "StopAutonomous failed");
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_autonomous_stop(impl_->ctx, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+
+        // 실패해도 수신 스레드는 멈췄으므로 처리 함수를 놓는다.
+        impl_->on_autonomous = nullptr;
+        if (Result::Ok != r) {
+            impl_->SetLastError_(r, "StopAutonomous failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief autonomous read 상태 조회
+     * @param[out] out_stats 결과
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetAutonomousStats(AutonomousStats &out_stats) const {
+        out_stats = AutonomousStats{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return Result::NotInitialized;
+
+        rfid_autonomous_stat_t c{};
+        const Result r = Impl::ToCppResult_(rfid_autonomous_get_stats(impl_->ctx, &c));
+        if (Result::Ok != r)
+            return r;
+
+        out_stats.frames = c.frames;
+        out_stats.tags = c.tags;
+        out_stats.filtered = c.filtered;
+        out_stats.batches = c.batches;
+        out_stats.rx_errors = c.rx_errors;
+        out_stats.reconnects = c.reconnects;
+        out_stats.reconnect_failures = c.reconnect_failures;
+        out_stats.last_status = c.last_status;
+        out_stats.idle_ms = c.idle_ms;
+        out_stats.running = (0 != c.running);
+        out_stats.streaming = (0 != c.streaming);
+        return Result::Ok;
+    }
+
+    /**
+     * @brief trigger 스레드가 읽은 C 태그 배열을 처리 함수로 넘긴다.
+     * @param[in] user TriggerHandler 주소(Reader 가 실행 중 유지)
+     * @param[in] tags C 태그 배열
+     * @param[in] count 태그 수
+     */
+    static void RunTriggerHandler_(void *user, const rfid_tag_t *tags, int count) {
+        const TriggerHandler *handler = static_cast<const TriggerHandler *>(user);
+        try {
+            std::vector<Tag> batch(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i)
+                FromPoolTag_(tags[i], batch[static_cast<std::size_t>(i)]);
+            (*handler)(batch);
+        }
+        catch (...) {
+            // trigger 스레드 밖으로 예외를 내보내지 않는다.
+        }
+    }
+
+    /**
+     * @brief GPI trigger read 시작
+     * @param[in] cfg 설정
+     * @return 시작 결과 Result
+     */
+    Result Reader::StartTrigger(const TriggerConfig &cfg) {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "StartTrigger failed");
+
+        rfid_trigger_params_t p{};
+        p.pins = cfg.pins.empty() ? nullptr : cfg.pins.data();
+        p.pin_count = static_cast<int>(cfg.pins.size());
+        p.edge = static_cast<RFID_TRIGGER_EDGE>(cfg.edge);
+        p.debounce_ms = cfg.debounce_ms;
+        p.poll_ms = cfg.poll_ms;
+        p.antennas = impl_->antennas.empty() ? nullptr : impl_->antennas.data();
+        p.antenna_count = static_cast<int>(impl_->antennas.size());
+        p.read_ms = cfg.read_ms;
+        p.hold_ms = cfg.hold_ms;
+        p.max_ms = cfg.max_ms;
+        p.tag_capacity = cfg.tag_capacity;
+
+        // 실행 중인 스레드가 처리 함수를 참조하므로 실행 중이면 바꾸지 않는다.
+        TriggerStats stats;
+        if ((Result::Ok == GetTriggerStats(stats)) && stats.running)
+            return impl_->SetLastError_(Result::Busy, "StartTrigger failed");
+
+        impl_->on_trigger = cfg.on_tags;
+        if (impl_->on_trigger) {
+            p.on_tags = RunTriggerHandler_;
+            p.user = &impl_->on_trigger;
+        }
+
+        uint32_t status = 0;
+        const char *errstr = nullptr;
+        const RFID_RESULT rc = rfid_trigger_start(impl_->ctx, &p, &status, &errstr);
+        const Result r = Impl::ToCppResult_(rc);
+        if (Result::Ok != r) {
+            impl_->on_trigger = nullptr;
+            impl_->SetLastError_(r, "StartTrigger failed");
+            impl_->AppendLastErrorDetail_(errstr);
+            return r;
+        }
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief GPI trigger read 정지
+     * @return 정지 결과 Result
+     */
+    Result Reader::StopTrigger() {
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return impl_->SetLastError_(Result::NotInitialized, "StopTrigger failed");
+
+        const Result r = Impl::ToCppResult_(rfid_trigger_stop(impl_->ctx));
+        impl_->on_trigger = nullptr;
+        if (Result::Ok != r)
+            return impl_->SetLastError_(r, "StopTrigger failed");
+        return impl_->SetLastError_(Result::Ok);
+    }
+
+    /**
+     * @brief GPI trigger read 상태 조회
+     * @param[out] out_stats 결과
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetTriggerStats(TriggerStats &out_stats) const {
+        out_stats = TriggerStats{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return Result::NotInitialized;
+
+        rfid_trigger_stat_t c{};
+        const Result r = Impl::ToCppResult_(rfid_trigger_get_stats(impl_->ctx, &c));
+        if (Result::Ok != r)
+            return r;
+
+        out_stats.polls = c.polls;
+        out_stats.gpi_errors = c.gpi_errors;
+        out_stats.bounces = c.bounces;
+        out_stats.triggers = c.triggers;
+        out_stats.sessions = c.sessions;
+        out_stats.empty_sessions = c.empty_sessions;
+        out_stats.cycles = c.cycles;
+        out_stats.read_errors = c.read_errors;
+        out_stats.tags = c.tags;
+        out_stats.last_status = c.last_status;
+        out_stats.gpi_state = c.gpi_state;
+        out_stats.start_p50_us = c.start_p50_us;
+        out_stats.start_p99_us = c.start_p99_us;
+        out_stats.start_max_us = c.start_max_us;
+        out_stats.first_tag_p50_us = c.first_tag_p50_us;
+        out_stats.first_tag_p99_us = c.first_tag_p99_us;
+        out_stats.first_tag_max_us = c.first_tag_max_us;
+        out_stats.running = (0 != c.running);
+        out_stats.active = (0 != c.active);
+        return Result::Ok;
+    }
+
+    /**
+     * @brief C 지연 분포를 LatencyDist 로 옮긴다.
+     * @param[in] c C 분포
+     * @param[out] out_dist 결과
+     */
+    static void FromLatencyDist_(const rfid_latency_dist_t &c, LatencyDist &out_dist) {
+        out_dist.count = c.count;
+        out_dist.p50_us = c.p50_us;
+        out_dist.p99_us = c.p99_us;
+        out_dist.p999_us = c.p999_us;
+        out_dist.max_us = c.max_us;
+    }
+
+    /**
+     * @brief 태그 지연 구간 분포 조회
+     * @param[out] out_stats 결과
+     * @return 조회 결과 Result
+     */
+    Result Reader::GetLatencyStats(LatencyStats &out_stats) const {
+        out_stats = LatencyStats{};
+        if (nullptr == impl_)
+            return Result::InternalError;
+        if (nullptr == impl_->ctx)
+            return Result::NotInitialized;
+
+        rfid_latency_stat_t c{};
+        const Result r = Impl::ToCppResult_(rfid_get_latency_stats(impl_->ctx, &c));
+        if (Result::Ok != r)
+            return r;
+
+        FromLatencyDist_(c.air_to_rx, out_stats.air_to_rx);
+        FromLatencyDist_(c.rx_to_parse, out_stats.rx_to_parse);
+        FromLatencyDist_(c.parse_to_deliver, out_stats.parse_to_deliver);
+        FromLatencyDist_(c.air_to_deliver, out_stats.air_to_deliver);
+        out_stats.untimed = c.untimed;
+        out_stats.epochs = c.epochs;
+        out_stats.drift_ppm = c.drift_ppm;
+        return Result::Ok;
     }
 
     /**
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -12,7 +13,7 @@ namespace mercuryapi {
      * @note C 레이어 결과를 래핑한 값입니다.
      */
     enum class Result {
-        Ok = 0, Disabled, InvalidArg, NotInitialized, ConnectFail, RegionFail, PlanFail, ReadFail, InternalError
+        Ok = 0, Disabled, InvalidArg, NotInitialized, ConnectFail, RegionFail, PlanFail, ReadFail, InternalError, WriteFail, Busy
     };
 
     /**
@@ -22,6 +23,16 @@ namespace mercuryapi {
         Auto = 0, KR2, US, EU
     };
 
+    /**
+     * @brief EPC 규칙에 일치하지 않음(또는 규칙 미사용)을 나타내는 rule id
+     */
+    constexpr std::uint32_t kEpcRuleNone = 0xFFFFFFFFu;
+
+    /**
+     * @brief EPC intern id 가 없음(intern 테이블 미사용 또는 용량 초과)을 나타내는 id
+     */
+    constexpr std::uint32_t kEpcIdNone = 0xFFFFFFFFu;
+
     /**
      * @brief RFID 태그 결과 모델
      */
@@ -31,65 +42,1431 @@ namespace mercuryapi {
         std::uint32_t readcnt = 0; ///< @brief read count
         int antenna = 0; ///< @brief 태그가 읽힌 안테나 번호
         std::uint64_t ts = 0; ///< @brief timestamp(ms)
+        std::vector<std::uint8_t> epc_bytes; ///< @brief 바이너리 EPC(MSB first)
+        std::uint32_t rule_id = kEpcRuleNone; ///< @brief EPC 규칙 분류 결과(Reader::SetEpcMatcher 사용 시)
+        std::vector<std::uint8_t> data; ///< @brief embedded read 결과(Config::embedded_read 사용 시, 읽기 실패 시 empty)
+        std::uint32_t epc_id = kEpcIdNone; ///< @brief 프로세스 단위 EPC id(Reader::SetEpcIntern 사용 시)
+        std::uint64_t air_us = 0; ///< @brief 모듈이 태그를 읽은 시각(호스트 단조 시계 us, 0이면 모름)
+        std::uint64_t rx_us = 0; ///< @brief 응답 프레임을 받은 시각(호스트 단조 시계 us)
+        std::uint64_t parse_us = 0; ///< @brief 결과 태그로 옮긴 시각(호스트 단조 시계 us)
+    };
+
+    /**
+     * @brief 안테나별 적응형 dwell 스케줄러 설정
+     * @note 0 이하 값은 라이브러리 기본값 사용
+     */
+    struct DwellConfig {
+        ///< @brief 신규 태그 발견율 기반 dwell 재분배 사용 여부
+        bool enable = false;
+        ///< @brief 가중치 재계산 주기(Read 호출 횟수)
+        int update_cycles = 0;
+        ///< @brief 안테나당 최소 점유율(%)
+        int min_share_pct = 0;
+        ///< @brief 안테나당 최대 점유율(%)
+        int max_share_pct = 0;
+    };
+
+    /**
+     * @brief 안테나별 dwell 스케줄러 상태
+     */
+    struct DwellStat {
+        int antenna = 0; ///< @brief 안테나 번호
+        int share_permille = 0; ///< @brief 현재 read 시간 점유율(‰)
+        std::uint32_t new_tags = 0; ///< @brief 직전 평가 구간 신규 태그 수
+        std::uint32_t dwell_ms = 0; ///< @brief 직전 평가 구간 누적 dwell(ms)
+        double yield_per_sec = 0.0; ///< @brief 평활화된 신규 태그 발견율(tags/s)
+    };
+
+    /**
+     * @brief Gen2 파라미터 튜닝 모드
+     */
+    enum class Gen2TuneMode {
+        Off = 0, Auto, Manual
+    };
+
+    /**
+     * @brief Gen2 inventory target (AB/BA: A/B flipping)
+     */
+    enum class Gen2Target {
+        A = 0, B, AB, BA
+    };
+
+    /**
+     * @brief Gen2 링크 프로파일(BLF / Tari / 태그 인코딩 묶음)
+     */
+    enum class Gen2LinkProfile {
+        Keep = 0, HighSpeed, Balanced, Dense
+    };
+
+    /**
+     * @brief Gen2 inventory 파라미터 묶음
+     */
+    struct Gen2Settings {
+        int q = -1; ///< @brief 0..15 이면 static Q, -1 이면 dynamic Q
+        int session = 1; ///< @brief 0..3 (S0..S3)
+        Gen2Target target = Gen2Target::A; ///< @brief inventory target
+        Gen2LinkProfile link = Gen2LinkProfile::Keep; ///< @brief 링크 프로파일
+    };
+
+    /**
+     * @brief Gen2 튜닝 설정
+     * @note 0 이하 값은 라이브러리 기본값 사용
+     */
+    struct Gen2TuneConfig {
+        ///< @brief 튜닝 모드(기본 Off: 모듈 기본값 유지)
+        Gen2TuneMode mode = Gen2TuneMode::Off;
+        ///< @brief Auto 재평가 주기(Read 호출 횟수)
+        int eval_cycles = 0;
+        ///< @brief Manual 모드에서 고정할 값
+        Gen2Settings manual;
+    };
+
+    /**
+     * @brief Gen2 튜닝 상태
+     */
+    struct Gen2Status {
+        Gen2TuneMode mode = Gen2TuneMode::Off; ///< @brief 현재 튜닝 모드
+        Gen2Settings settings; ///< @brief 현재 모듈에 적용된 값
+        double population_estimate = 0.0; ///< @brief 추정 태그 모집단 크기
+        double tags_per_sec = 0.0; ///< @brief 직전 평가 구간 처리량(tags/s)
+        std::uint32_t last_apply_status = 0; ///< @brief 마지막 파라미터 적용 TMR 상태 코드
+    };
+
+    /**
+     * @brief 안테나별 read power 자동 제어 목표
+     */
+    enum class PowerCtrlMode {
+        Off = 0, ReadRate, RssiBand
+    };
+
+    /**
+     * @brief 다른 구역(zone)에 속한 것으로 알려진 태그
+     */
+    struct ForeignTag {
+        std::string epc; ///< @brief EPC hex 문자열
+        int home_antenna = 0; ///< @brief 이 태그가 읽혀야 하는 안테나(0: 이 리더 밖)
+    };
+
+    /**
+     * @brief 안테나별 read power 폐루프 제어 설정
+     * @note 0 이하 값은 라이브러리 기본값 사용
+     */
+    struct PowerCtrlConfig {
+        ///< @brief 제어 목표(기본 Off)
+        PowerCtrlMode mode = PowerCtrlMode::Off;
+        ///< @brief 하한/상한(cdBm)
+        int min_cdbm = 0;
+        int max_cdbm = 0;
+        ///< @brief 1회 최대 조정 폭(cdBm)
+        int step_cdbm = 0;
+        ///< @brief 조정 주기(Read 호출 횟수)
+        int update_cycles = 0;
+        ///< @brief ReadRate 불감대(%)
+        int deadband_pct = 0;
+        ///< @brief ReadRate 목표(reads/s)
+        int target_reads_per_sec = 0;
+        ///< @brief RssiBand 구간(dBm)
+        int rssi_low_dbm = 0;
+        int rssi_high_dbm = 0;
+        ///< @brief 다른 구역 태그 목록(읽히면 해당 안테나 전력을 낮춤)
+        std::vector<ForeignTag> foreign_tags;
+    };
+
+    /**
+     * @brief 안테나별 read power 제어 상태
+     */
+    struct PowerStat {
+        int antenna = 0; ///< @brief 안테나 번호
+        int power_cdbm = 0; ///< @brief 현재 read power(cdBm)
+        double reads_per_sec = 0.0; ///< @brief 평활화된 read rate(reads/s)
+        double rssi_avg = 0.0; ///< @brief 평활화된 평균 RSSI(dBm)
+        std::uint32_t foreign_reads = 0; ///< @brief 누적 다른 구역 태그 read 수
+        std::uint32_t adjustments = 0; ///< @brief 누적 전력 조정 횟수
+        int last_step_cdbm = 0; ///< @brief 마지막 조정 폭(cdBm)
+    };
+
+    /**
+     * @brief Gen2 메모리 뱅크
+     */
+    enum class Gen2Bank {
+        Epc = 0, Tid, User
+    };
+
+    /**
+     * @brief 여러 Select 필터의 결합 방식
+     */
+    enum class SelectCombine {
+        Any = 0, All
+    };
+
+    /**
+     * @brief 리더 측 Gen2 Select 필터(일치하지 않는 태그는 singulation 되지 않음)
+     */
+    struct SelectFilter {
+        Gen2Bank bank = Gen2Bank::Epc; ///< @brief 비교할 메모리 뱅크
+        std::uint32_t bit_pointer = 32; ///< @brief 비교 시작 비트(EPC 접두사는 32부터)
+        std::string mask_hex; ///< @brief 비교 값(hex, MSB first)
+        int mask_bits = 0; ///< @brief 비교 비트 수(0 이하: mask_hex 길이 * 4)
+        bool invert = false; ///< @brief true면 일치하지 않는 태그를 통과
+    };
+
+    /**
+     * @brief inventory 중 태그마다 메모리 뱅크 일부를 함께 읽는 설정(embedded read)
+     * @note read plan 에 ReadData tagop 을 붙이므로 태그별 추가 read 없이 결과가 Tag::data 로 온다.
+     */
+    struct EmbeddedReadConfig {
+        bool enable = false; ///< @brief true면 사용
+        Gen2Bank bank = Gen2Bank::Tid; ///< @brief 읽을 메모리 뱅크
+        std::uint32_t word_address = 0; ///< @brief 시작 위치(word)
+        int word_count = 6; ///< @brief 읽을 길이(1..RFID_TAG_DATA_MAX_WORDS words)
+    };
+
+    /**
+     * @brief 태그 응답 metadata 선택 비트(Config::tag_metadata)
+     * @note 요청하지 않은 Tag 필드는 기본값(readcnt 1, rssi/antenna 0, ts는 read 시작 시각)으로 채워진다.
+     */
+    constexpr std::uint32_t kTagMetaReadCount = 0x01; ///< @brief Tag::readcnt
+    constexpr std::uint32_t kTagMetaRssi = 0x02; ///< @brief Tag::rssi
+    constexpr std::uint32_t kTagMetaAntenna = 0x04; ///< @brief Tag::antenna
+    constexpr std::uint32_t kTagMetaTimestamp = 0x08; ///< @brief Tag::ts(태그별 모듈 시각)
+    constexpr std::uint32_t kTagMetaAll = 0x0F; ///< @brief Tag가 사용하는 필드 전부
+
+    /**
+     * @brief 시리얼 링크 baud 자동 협상 설정
+     * @note 0 이하 값은 라이브러리 기본값 사용. TCP 등 baud 개념이 없는 연결에서는 무시된다.
+     */
+    struct BaudConfig {
+        ///< @brief 연결 후 지원 baud를 단계적으로 올려 검증을 통과한 최고 baud 사용
+        bool enable = false;
+        ///< @brief 시도할 최대 baud(0: 921600)
+        std::uint32_t max_rate = 0;
+        ///< @brief baud 1단계 검증에 쓰는 version 왕복 횟수
+        int probe_count = 0;
+        ///< @brief 연속 통신 오류가 이 횟수에 도달하면 한 단계 낮춤
+        int fallback_errors = 0;
+    };
+
+    /**
+     * @brief 시리얼 링크 상태(조회용)
+     */
+    struct LinkStat {
+        std::uint32_t baud_rate = 0; ///< @brief 현재 baud(baud 개념이 없는 연결이면 0)
+        std::uint32_t connect_rate = 0; ///< @brief 연결 시 probe된 baud
+        std::uint32_t verified_max_rate = 0; ///< @brief 검증을 통과한 최고 baud
+        double probe_rtt_us = 0.0; ///< @brief version 왕복 평균 시간(us)
+        std::uint64_t tx_bytes = 0; ///< @brief 누적 송신 바이트
+        std::uint64_t rx_bytes = 0; ///< @brief 누적 수신 바이트
+        double bytes_per_sec = 0.0; ///< @brief 평활화된 Read 구간 링크 처리량(bytes/s)
+        double utilization_pct = 0.0; ///< @brief 현재 baud 용량 대비 사용률(%)
+        std::uint32_t comm_errors = 0; ///< @brief 누적 통신 오류 수
+        std::uint32_t fallbacks = 0; ///< @brief 런타임 baud 하향 횟수
+    };
+
+    /**
+     * @brief 안테나별 read 카운터
+     */
+    struct AntennaCounters {
+        int antenna = 0; ///< @brief 안테나 번호(0: 안테나 정보 없는 태그)
+        std::uint64_t reads = 0; ///< @brief 누적 read 수(readcnt 합)
+        std::uint64_t unique_tags = 0; ///< @brief 누적 고유 태그 수(Read 1회 안 중복 제거 후 합)
+        double reads_per_sec = 0.0; ///< @brief 평활화된 reads/s
+        double unique_per_sec = 0.0; ///< @brief 평활화된 고유 tags/s
+    };
+
+    /**
+     * @brief 리더 상태 카운터 스냅샷
+     * @note 링크 프레임/바이트/오류 값은 시리얼 연결일 때만 센다.
+     */
+    struct ReaderCounters {
+        std::uint64_t uptime_ms = 0; ///< @brief Init 이후 경과 시간(ms)
+        std::uint64_t tx_frames = 0; ///< @brief 송신 프레임 수
+        std::uint64_t tx_bytes = 0; ///< @brief 송신 바이트 수
+        std::uint64_t rx_frames = 0; ///< @brief 수신 프레임 수
+        std::uint64_t rx_bytes = 0; ///< @brief 수신 바이트 수
+        std::uint64_t crc_errors = 0; ///< @brief 수신 프레임 CRC 오류 수
+        std::uint64_t soh_resyncs = 0; ///< @brief 프레임 경계(SOH) 재동기 횟수
+        std::uint64_t discarded_bytes = 0; ///< @brief 재동기 중 버린 바이트 수
+        std::uint64_t timeouts = 0; ///< @brief 수신 timeout 수
+        std::uint64_t read_cycles = 0; ///< @brief Read 사이클 수
+        std::uint64_t read_errors = 0; ///< @brief 모듈 read 실패 수
+        std::uint64_t buffer_overflows = 0; ///< @brief 모듈 태그 버퍼 넘침 수
+        std::uint64_t overflow_tags = 0; ///< @brief 결과 버퍼 초과로 반환하지 못한 태그 수
+        std::uint32_t queue_depth = 0; ///< @brief 직전 사이클 모듈 태그 버퍼 태그 수
+        std::uint32_t queue_peak = 0; ///< @brief queue_depth 최대값
+        std::vector<AntennaCounters> antennas; ///< @brief read 가 있었던 안테나(번호 오름차순)
+    };
+
+    /**
+     * @brief 가중치 read plan 항목(Config::plans)
+     * @note select_filters 가 비어 있으면 Config::select_filters(전역 필터)를 사용한다.
+     */
+    struct ReadPlanConfig {
+        std::vector<int> antennas; ///< @brief 안테나 목록
+        int weight = 1; ///< @brief read 시간 가중치(> 0)
+        std::vector<SelectFilter> select_filters; ///< @brief 이 항목 전용 Select 필터
+        SelectCombine select_combine = SelectCombine::Any; ///< @brief select_filters 결합 방식
+    };
+
+    /**
+     * @brief 가중치 read plan 항목별 상태(조회용)
+     */
+    struct PlanStat {
+        int weight = 0; ///< @brief 현재 가중치
+        int share_permille = 0; ///< @brief read 시간 점유율(‰)
+        std::uint64_t tags = 0; ///< @brief 누적 태그 수(안테나/필터로 귀속)
+        std::uint64_t airtime_ms = 0; ///< @brief 누적 추정 read 시간(ms)
+        double yield_per_sec = 0.0; ///< @brief tags / airtime(tags/s)
+    };
+
+    /**
+     * @brief 조기 종료 read(Reader::ReadUntil) 조건
+     * @note stop_count 와 expected_epcs 를 함께 지정하면 먼저 충족된 조건에서 종료한다.
+     */
+    struct EarlyExit {
+        int stop_count = 0; ///< @brief 고유 태그 N개를 찾으면 종료(0: 미사용)
+        std::vector<std::string> expected_epcs; ///< @brief 모두 찾으면 종료할 EPC(hex)
+        bool fast_search = true; ///< @brief 모듈 fast search 사용
+    };
+
+    /**
+     * @brief 조기 종료 read 종료 사유
+     */
+    enum class EarlyExitReason {
+        Timeout = 0, Count, Expected, Capacity
+    };
+
+    /**
+     * @brief 조기 종료 read 결과 보고
+     */
+    struct EarlyExitReport {
+        EarlyExitReason reason = EarlyExitReason::Timeout; ///< @brief 종료 사유
+        std::uint32_t latency_us = 0; ///< @brief 호출 시작부터 종료까지 경과 시간(us)
+        std::uint32_t reads = 0; ///< @brief 수행한 read 사이클 수
+        int unique_tags = 0; ///< @brief 발견한 고유 태그 수
+        int expected_found = 0; ///< @brief 발견한 expected_epcs 수
+    };
+
+    /**
+     * @brief Gen2 Lock 명령의 mask/action 비트(CommissionJob::lock_mask/lock_action)
+     * @note *Perm 비트는 되돌릴 수 없다(permalock).
+     */
+    constexpr std::uint16_t kLockUserPerm = 0x001; ///< @brief USER 뱅크 permalock
+    constexpr std::uint16_t kLockUser = 0x002; ///< @brief USER 뱅크 쓰기 잠금
+    constexpr std::uint16_t kLockTidPerm = 0x004; ///< @brief TID 뱅크 permalock
+    constexpr std::uint16_t kLockTid = 0x008; ///< @brief TID 뱅크 쓰기 잠금
+    constexpr std::uint16_t kLockEpcPerm = 0x010; ///< @brief EPC 뱅크 permalock
+    constexpr std::uint16_t kLockEpc = 0x020; ///< @brief EPC 뱅크 쓰기 잠금
+    constexpr std::uint16_t kLockAccessPerm = 0x040; ///< @brief access password permalock
+    constexpr std::uint16_t kLockAccess = 0x080; ///< @brief access password 읽기/쓰기 잠금
+    constexpr std::uint16_t kLockKillPerm = 0x100; ///< @brief kill password permalock
+    constexpr std::uint16_t kLockKill = 0x200; ///< @brief kill password 읽기/쓰기 잠금
+
+    /**
+     * @brief 태그 발행 작업 1건(대상 태그에 EPC 쓰기 → 읽어 확인 → lock)
+     */
+    struct CommissionJob {
+        SelectFilter target; ///< @brief 대상 태그 Select 필터(mask_hex 가 비어 있으면 필드에 있는 태그)
+        std::string epc; ///< @brief 쓸 EPC(hex, 4의 배수 자릿수)
+        std::uint16_t lock_mask = 0; ///< @brief 바꿀 lock 비트(kLock* 조합, 0이면 lock 생략)
+        std::uint16_t lock_action = 0; ///< @brief lock_mask 중 설정할 비트
+        std::uint32_t access_password = 0; ///< @brief 대상 태그 access password(0이면 없음)
+    };
+
+    /**
+     * @brief 태그 발행 실행 설정
+     * @note 0 이하 값은 라이브러리 기본값 사용
+     */
+    struct CommissionConfig {
+        int antenna = 0; ///< @brief 태그 명령에 쓸 안테나(0: 현재 설정 유지)
+        int max_attempts = 0; ///< @brief 작업당 최대 시도 수(0: 3)
+        int op_timeout_ms = 0; ///< @brief 태그 명령 1회 timeout(ms, 0: 현재 설정 유지)
+    };
+
+    /**
+     * @brief 태그 발행 작업이 멈춘 단계
+     */
+    enum class CommissionStage {
+        Done = 0, Write, Verify, Lock
+    };
+
+    /**
+     * @brief 태그 발행 작업별 결과
+     */
+    struct CommissionResult {
+        Result result = Result::Ok; ///< @brief Ok: 성공, WriteFail: 재시도 후에도 실패, InvalidArg: 작업 인자 오류
+        CommissionStage stage = CommissionStage::Done; ///< @brief 실패한 단계
+        std::uint32_t status = 0; ///< @brief 마지막 태그 명령의 TMR 상태 코드
+        int attempts = 0; ///< @brief 수행한 시도 수
+        std::uint32_t latency_us = 0; ///< @brief 작업 시작부터 끝까지(us)
+    };
+
+    /**
+     * @brief 태그 발행 호출 1회 요약
+     */
+    struct CommissionStats {
+        int jobs = 0; ///< @brief 실행한 작업 수
+        int succeeded = 0; ///< @brief 성공한 작업 수
+        int failed = 0; ///< @brief 실패한 작업 수
+        std::uint32_t retries = 0; ///< @brief 재시도 수
+        std::uint64_t elapsed_us = 0; ///< @brief 전체 경과 시간(us)
+        std::uint32_t max_latency_us = 0; ///< @brief 가장 오래 걸린 작업(us)
+        double tags_per_min = 0.0; ///< @brief 성공 기준 처리량(tags/min)
+    };
+
+    /**
+     * @brief 호스트 측 EPC 접두사/마스크 규칙
+     */
+    struct EpcRule {
+        std::string value_hex; ///< @brief 비교 값(hex, EPC 첫 비트부터)
+        std::string mask_hex; ///< @brief 비트 마스크(hex). 비어 있으면 bit_length 까지 전부 비교
+        int bit_length = 0; ///< @brief 비교 비트 수(0 이하: value_hex 길이 * 4)
+        std::uint32_t rule_id = 0; ///< @brief 일치 시 Tag::rule_id 에 채울 값(kEpcRuleNone 사용 불가)
+    };
+
+    /**
+     * @brief 태그 로그(mmap 세그먼트 파일) 설정
+     * @note 0 값은 라이브러리 기본값 사용
+     */
+    struct TagLogConfig {
+        std::string dir; ///< @brief 세그먼트 파일 디렉터리(없으면 생성)
+        std::string prefix = "tags"; ///< @brief 세그먼트 파일 이름 접두사
+        std::uint32_t segment_records = 0; ///< @brief 세그먼트당 레코드 수(기본 262144 = 16 MiB)
+        std::uint32_t queue_records = 0; ///< @brief 기록 대기 큐 용량(레코드 수, 기본 131072)
+        std::uint32_t sync_interval_ms = 0; ///< @brief 주기적 msync 간격(ms, 기본 500)
+        std::uint32_t max_segments = 0; ///< @brief 보관할 최대 세그먼트 수(0이면 삭제하지 않음)
+    };
+
+    /**
+     * @brief 태그 로그 상태
+     */
+    struct TagLogStats {
+        std::uint64_t appended = 0; ///< @brief 큐에 넣은 레코드 수
+        std::uint64_t dropped = 0; ///< @brief 큐가 가득 차 버린 레코드 수
+        std::uint64_t written = 0; ///< @brief 세그먼트에 기록한 레코드 수
+        std::uint64_t synced = 0; ///< @brief msync 로 영속화를 마친 레코드 수
+        std::uint64_t lost = 0; ///< @brief 세그먼트 생성/매핑 실패로 기록하지 못한 레코드 수
+        std::uint64_t segment_index = 0; ///< @brief 현재 세그먼트 번호
+        std::uint32_t segments_opened = 0; ///< @brief 이번 Open 이후 만든 세그먼트 수
+        std::uint32_t queue_used = 0; ///< @brief 현재 큐 사용량
+        std::uint32_t queue_peak = 0; ///< @brief 큐 최대 사용량
+        std::uint32_t queue_capacity = 0; ///< @brief 큐 용량
+        std::uint32_t sync_count = 0; ///< @brief msync 횟수
+        std::uint32_t sync_max_us = 0; ///< @brief msync 1회 최대 소요 시간(us)
+        int last_errno = 0; ///< @brief 마지막 I/O 오류 errno
+    };
+
+    /**
+     * @brief 공유 메모리 태그 버스에서 받은 레코드
+     */
+    struct TagBusRecord {
+        std::uint64_t seq = 0; ///< @brief 버스 발행 순번(1부터)
+        std::uint16_t reader_id = 0; ///< @brief 발행한 리더 id
+        Tag tag; ///< @brief 태그(epc 는 epc_bytes 의 16진 문자열)
+        bool truncated = false; ///< @brief EPC가 레코드 크기를 넘어 잘렸는지 여부
+    };
+
+    /**
+     * @brief 태그 존재 감지 zone(안테나 묶음) 설정
+     * @note 0 값은 PresenceConfig 의 값을 따른다.
+     */
+    struct PresenceZone {
+        int zone_id = 0; ///< @brief 이벤트에 기록할 zone id
+        std::vector<int> antennas; ///< @brief zone 에 속한 안테나 번호(다른 zone 과 겹치면 앞선 zone)
+        std::uint32_t holdoff_ms = 0; ///< @brief PRESENT 이벤트 최소 간격(ms)
+        std::uint32_t depart_ms = 0; ///< @brief 이 시간 동안 안 읽히면 DEPART(ms)
+    };
+
+    /**
+     * @brief 태그 존재 감지 엔진 설정
+     * @note 0 값은 라이브러리 기본값 사용
+     */
+    struct PresenceConfig {
+        std::uint32_t capacity = 0; ///< @brief 추적할 최대 (EPC, zone) 수(기본 262144)
+        std::uint32_t holdoff_ms = 0; ///< @brief zone 미지정 안테나의 PRESENT 최소 간격(ms, 기본 5000)
+        std::uint32_t depart_ms = 0; ///< @brief zone 미지정 안테나의 DEPART 기준 미검출 시간(ms, 기본 3000)
+        std::vector<PresenceZone> zones; ///< @brief zone 목록(최대 16개)
+        std::string snapshot_path; ///< @brief 추적 상태 스냅샷 파일(비어 있으면 사용 안 함)
+        std::uint32_t snapshot_interval_ms = 0; ///< @brief 스냅샷 주기(ms, 기본 5000)
+        std::uint32_t snapshot_max_age_ms = 0; ///< @brief 복원할 스냅샷의 최대 나이(ms, 기본 60000)
+    };
+
+    /**
+     * @brief 태그 존재 이벤트 종류
+     */
+    enum class PresenceEventType : std::uint8_t {
+        Arrive = 1, ///< @brief zone 에 처음 나타남
+        Present = 2, ///< @brief 계속 있음(holdoff_ms 마다 최대 1회)
+        Depart = 3 ///< @brief depart_ms 동안 안 읽혀 사라짐
+    };
+
+    /**
+     * @brief 태그 존재 이벤트
+     */
+    struct PresenceEvent {
+        PresenceEventType type = PresenceEventType::Arrive; ///< @brief 이벤트 종류
+        std::uint64_t ts_ms = 0; ///< @brief 이벤트 시각(DEPART 는 마지막으로 읽은 시각)
+        std::uint64_t first_seen_ms = 0; ///< @brief zone 에 나타난 시각
+        std::uint32_t reads = 0; ///< @brief 직전 이벤트 이후 read 수
+        int zone_id = 0; ///< @brief zone id
+        int antenna = 0; ///< @brief 마지막으로 읽은 안테나
+        int rssi = 0; ///< @brief 직전 이벤트 이후 최대 RSSI(read 가 없었으면 -128)
+        std::string epc; ///< @brief EPC 문자열(hex)
+        std::vector<std::uint8_t> epc_bytes; ///< @brief 바이너리 EPC
+    };
+
+    /**
+     * @brief 태그 존재 감지 엔진 상태
+     */
+    struct PresenceStats {
+        std::uint64_t reads = 0; ///< @brief 입력 read 수
+        std::uint64_t arrivals = 0; ///< @brief ARRIVE 이벤트 수
+        std::uint64_t presents = 0; ///< @brief PRESENT 이벤트 수
+        std::uint64_t departures = 0; ///< @brief DEPART 이벤트 수
+        std::uint64_t deferred = 0; ///< @brief 다음 호출로 미룬 이벤트 수
+        std::uint64_t table_full = 0; ///< @brief 추적 용량 초과로 무시한 read 수
+        std::uint64_t snapshots = 0; ///< @brief 기록한 스냅샷 수
+        std::uint64_t snapshot_pages = 0; ///< @brief 스냅샷에 복사한 페이지 수(변경된 페이지만)
+        std::uint32_t restored = 0; ///< @brief 스냅샷에서 복원한 수
+        std::uint32_t tracked = 0; ///< @brief 현재 추적 수
+        std::uint32_t capacity = 0; ///< @brief 추적 용량
+    };
+
+    /**
+     * @brief 만료된 타이머
+     */
+    struct TimerExpiry {
+        std::uint64_t id = 0; ///< @brief 타이머 id(만료와 함께 해제됨)
+        std::uint64_t user_data = 0; ///< @brief 등록 시 넘긴 값
+        std::uint64_t deadline_ms = 0; ///< @brief 등록한 만료 시각(ms)
+    };
+
+    /**
+     * @brief 타이밍 휠 상태
+     */
+    struct TimerWheelStats {
+        std::uint64_t now_ms = 0; ///< @brief 휠의 현재 시각(ms)
+        std::uint64_t scheduled = 0; ///< @brief 등록 수(재등록 포함)
+        std::uint64_t cancelled = 0; ///< @brief 취소 수
+        std::uint64_t expired = 0; ///< @brief 만료 수
+        std::uint64_t cascaded = 0; ///< @brief 상위 단계에서 하위 단계로 옮긴 수
+        std::uint64_t table_full = 0; ///< @brief 용량 초과로 실패한 등록 수
+        std::uint32_t active = 0; ///< @brief 현재 등록된 타이머 수
+        std::uint32_t capacity = 0; ///< @brief 타이머 용량
+    };
+
+    /**
+     * @brief 리더 간 병합 단계 설정
+     * @note 0 값은 라이브러리 기본값 사용
+     */
+    struct MergeConfig {
+        std::uint32_t window_ms = 0; ///< @brief 중복 제거 창(ms, 기본 1000)
+        std::uint32_t capacity = 0; ///< @brief 동시에 열 수 있는 창(EPC) 수(기본 65536)
+        std::uint32_t shards = 0; ///< @brief shard 수(2의 거듭제곱, 기본 64)
+    };
+
+    /**
+     * @brief 병합 이벤트(EPC 별 창 1개)
+     */
+    struct MergeEvent {
+        std::uint64_t first_seen_ms = 0; ///< @brief 창을 연 read 시각
+        std::uint64_t last_seen_ms = 0; ///< @brief 창 안의 마지막 read 시각
+        std::uint32_t reads = 0; ///< @brief 창 안의 read 수(모든 리더 합)
+        std::uint16_t reader_id = 0; ///< @brief RSSI 가 가장 높았던 리더
+        int antenna = 0; ///< @brief RSSI 가 가장 높았던 안테나
+        int rssi = 0; ///< @brief 창 안의 최대 RSSI
+        int reader_count = 0; ///< @brief 창 안에서 읽은 리더 수
+        std::string epc; ///< @brief EPC 문자열(hex)
+        std::vector<std::uint8_t> epc_bytes; ///< @brief 바이너리 EPC
+    };
+
+    /**
+     * @brief 리더 간 병합 단계 상태
+     * @note 지연 백분위는 히스토그램 값이라 최대 12.5% 오차가 있다.
+     */
+    struct MergeStats {
+        std::uint64_t reads = 0; ///< @brief 입력 read 수
+        std::uint64_t windows = 0; ///< @brief 연 창 수
+        std::uint64_t events = 0; ///< @brief 내보낸 이벤트 수
+        std::uint64_t table_full = 0; ///< @brief 용량 초과로 버린 read 수
+        std::uint64_t contended = 0; ///< @brief shard 잠금을 바로 얻지 못한 횟수
+        std::uint32_t active = 0; ///< @brief 현재 열린 창 수
+        std::uint32_t capacity = 0; ///< @brief 창 용량
+        std::uint32_t shards = 0; ///< @brief shard 수
+        std::uint32_t push_p50_ns = 0; ///< @brief 태그 1건 push 지연(잠금 대기 포함, ns)
+        std::uint32_t push_p99_ns = 0;
+        std::uint32_t push_p999_ns = 0;
+        std::uint32_t push_max_ns = 0;
+        std::uint32_t merge_p50_us = 0; ///< @brief 창이 닫힌 뒤 이벤트로 꺼낼 때까지(us)
+        std::uint32_t merge_p99_us = 0;
+        std::uint32_t merge_p999_us = 0;
+        std::uint32_t merge_max_us = 0;
+    };
+
+    /**
+     * @brief EPC intern 테이블 설정
+     * @note 0 값은 라이브러리 기본값 사용
+     */
+    struct EpcInternConfig {
+        ///< @brief 최대 id 수(메모리 고정, 기본 262144)
+        std::uint32_t capacity = 0;
+        ///< @brief 잠금 shard 수(2의 거듭제곱, 기본 64)
+        std::uint32_t shards = 0;
+        ///< @brief 가득 찼을 때 재사용할 수 있는 미조회 시간(ms). 0이면 재사용하지 않음
+        std::uint32_t idle_ms = 0;
+    };
+
+    /**
+     * @brief EPC intern 테이블 상태
+     */
+    struct EpcInternStats {
+        std::uint64_t interned = 0; ///< @brief 새로 발급한 id 수
+        std::uint64_t evicted = 0; ///< @brief 오래 조회되지 않아 재사용한 id 수
+        std::uint64_t table_full = 0; ///< @brief 용량 초과로 발급하지 못한 횟수
+        std::uint32_t count = 0; ///< @brief 사용 중인 id 수
+        std::uint32_t capacity = 0; ///< @brief id 용량
+        std::uint32_t shards = 0; ///< @brief shard 수
+    };
+
+    /**
+     * @brief 태그 후처리 풀 backpressure 정책(lane 이 가득 찼을 때)
+     */
+    enum class PoolPolicy : std::uint8_t {
+        DropNewest = 0, ///< @brief 새 태그를 버린다
+        DropOldest, ///< @brief 가장 오래된 대기 태그를 버리고 새 태그를 넣는다
+        Block, ///< @brief PoolConfig::block_timeout_ms 까지 기다린 뒤에도 가득 차 있으면 새 태그를 버린다
+        Coalesce ///< @brief 같은 EPC 가 대기 중이면 그 레코드에 합친다(항상). 합칠 대상 없이 가득 차면 새 태그를 버린다
+    };
+
+    /**
+     * @brief 태그 후처리 풀 설정
+     * @note 0 값은 라이브러리 기본값 사용
+     */
+    struct PoolConfig {
+        ///< @brief 작업 스레드 수(기본: 온라인 CPU 수, 최대 64)
+        std::uint32_t workers = 0;
+        ///< @brief EPC 친화 lane 수(2의 거듭제곱, 기본 64)
+        std::uint32_t lanes = 0;
+        ///< @brief lane 별 대기 태그 수(기본 256, 가득 차면 새 태그를 버림)
+        std::uint32_t lane_capacity = 0;
+        ///< @brief stage 호출 1회 최대 태그 수(기본 64)
+        std::uint32_t batch = 0;
+        ///< @brief lane 이 가득 찼을 때의 정책
+        PoolPolicy policy = PoolPolicy::DropNewest;
+        ///< @brief Block 정책의 Submit 1회 최대 대기 시간(ms, 기본 10)
+        std::uint32_t block_timeout_ms = 0;
+        ///< @brief 대기 태그 메모리 상한(bytes). 0이 아니면 lane_capacity 대신 이 값으로 lane 용량을 정한다
+        std::uint64_t memory_limit_bytes = 0;
+    };
+
+    /**
+     * @brief 태그 후처리 풀 작업 항목
+     */
+    struct PoolItem {
+        Tag tag; ///< @brief 태그(stage 가 고쳐 쓸 수 있다)
+        std::uint16_t reader_id = 0; ///< @brief 태그를 넣은 리더 id
+        std::uint64_t submit_us = 0; ///< @brief 풀에 넣은 단조 시각(us)
+        std::uint32_t merged = 0; ///< @brief Coalesce 정책으로 합친 태그 수(readcnt 합, 최대 RSSI, 마지막 ts)
+    };
+
+    /**
+     * @brief 태그 후처리 stage. 걸러낼 항목은 items 에서 지우고, 남은 항목이 다음 stage 로 넘어간다.
+     * @note 여러 작업 스레드에서 동시에 호출된다. 같은 EPC 의 항목은 넣은 순서대로 한 스레드에서만 처리한다.
+     *       예외는 잡아서 무시하고 batch 를 그대로 다음 stage 로 넘긴다.
+     */
+    using PoolStage = std::function<void(std::vector<PoolItem> &items)>;
+
+    /**
+     * @brief 태그 후처리 풀 stage 별 상태
+     */
+    struct PoolStageStats {
+        std::string name; ///< @brief stage 이름
+        std::uint64_t items_in = 0; ///< @brief stage 에 넘긴 태그 수
+        std::uint64_t items_out = 0; ///< @brief stage 가 남긴 태그 수
+        std::uint64_t calls = 0; ///< @brief 호출 수
+        std::uint64_t busy_us = 0; ///< @brief 실행 시간 합(모든 작업 스레드, us)
+        double items_per_sec = 0.0; ///< @brief 실행 시간 기준 처리율(작업 스레드 1개 기준)
+        std::uint32_t queue_p50_us = 0; ///< @brief 풀에 넣은 뒤 stage 시작까지(us)
+        std::uint32_t queue_p99_us = 0;
+        std::uint32_t queue_p999_us = 0;
+        std::uint32_t queue_max_us = 0;
+    };
+
+    /**
+     * @brief 태그 후처리 풀 상태
+     */
+    struct PoolStats {
+        std::uint64_t submitted = 0; ///< @brief 받은 태그 수(합친 태그 포함)
+        std::uint64_t processed = 0; ///< @brief 처리를 마친 레코드 수
+        std::uint64_t dropped = 0; ///< @brief 버린 태그 수 합(dropped_newest + dropped_oldest)
+        std::uint64_t dropped_newest = 0; ///< @brief 자리가 없어 버린 새 태그 수
+        std::uint64_t dropped_oldest = 0; ///< @brief 새 태그에 자리를 내준 대기 태그 수(DropOldest)
+        std::uint64_t coalesced = 0; ///< @brief 대기 레코드에 합친 태그 수(Coalesce)
+        std::uint64_t blocked = 0; ///< @brief 자리가 없어 기다린 태그 수(Block)
+        std::uint64_t block_timeouts = 0; ///< @brief 기다려도 자리가 나지 않은 태그 수(Block)
+        std::uint64_t block_wait_us = 0; ///< @brief 기다린 시간 합(Block, us)
+        std::uint64_t memory_bytes = 0; ///< @brief 대기 태그 메모리(고정)
+        std::uint64_t batches = 0; ///< @brief 처리한 batch 수
+        std::uint64_t steals = 0; ///< @brief 다른 작업 스레드에서 훔쳐 온 lane 수
+        std::uint32_t rx_p50_us = 0; ///< @brief 프레임 수신(Tag::rx_us) → 작업 스레드가 꺼낼 때까지(us)
+        std::uint32_t rx_p99_us = 0;
+        std::uint32_t rx_p999_us = 0;
+        std::uint32_t rx_max_us = 0;
+        std::uint32_t pending = 0; ///< @brief 대기/처리 중 레코드 수
+        std::uint32_t workers = 0; ///< @brief 작업 스레드 수
+        std::uint32_t lanes = 0; ///< @brief lane 수
+        std::uint32_t lane_capacity = 0; ///< @brief lane 별 대기 레코드 수
+        PoolPolicy policy = PoolPolicy::DropNewest; ///< @brief backpressure 정책
+        std::vector<PoolStageStats> stages; ///< @brief stage 별 상태(등록 순서)
+    };
+
+    /**
+     * @brief autonomous read 시작 방식
+     */
+    enum class AutonomousMode {
+        Arm = 0, ///< @brief read plan 을 autonomous 로 모듈에 저장하고(플래시 쓰기) 스트림을 시작한다
+        Resume ///< @brief 모듈에 저장된 설정을 다시 불러와 스트림을 이어 받는다(호스트 재시작용)
+    };
+
+    /**
+     * @brief autonomous read 로 받은 태그 batch 처리 함수
+     * @note 내부 수신 스레드에서 호출된다. 예외는 잡아서 무시한다.
+     */
+    using AutonomousHandler = std::function<void(const std::vector<Tag> &tags)>;
+
+    /**
+     * @brief autonomous read 설정(0 값은 라이브러리 기본값)
+     */
+    struct AutonomousConfig {
+        AutonomousMode mode = AutonomousMode::Arm; ///< @brief 시작 방식
+        std::uint32_t on_time_ms = 0; ///< @brief Arm 의 모듈 search 사이클 길이(ms, 0이면 250)
+        bool persist = false; ///< @brief true면 Stop 후에도 모듈 전원이 다시 들어오면 autonomous read 로 시작한다
+        std::uint32_t batch_max = 0; ///< @brief 전달 1회 최대 태그 수(기본 64)
+        std::uint32_t flush_ms = 0; ///< @brief 덜 모여도 전달하는 간격(ms, 기본 20)
+        std::uint32_t poll_ms = 0; ///< @brief 수신 대기 1회 시간(ms, 기본 100)
+        std::uint32_t silence_ms = 0; ///< @brief 이 시간 동안 프레임이 없으면 재연결(ms, 0이면 사용 안 함)
+        std::uint32_t error_limit = 0; ///< @brief 연속 수신 오류가 이 횟수에 이르면 재연결(기본 3)
+        std::uint32_t reconnect_ms = 0; ///< @brief 재연결 실패 후 재시도 간격(ms, 기본 1000)
+        AutonomousHandler on_tags; ///< @brief 태그 batch 처리 함수(비어 있으면 연결된 로그/버스/병합/풀로만 전달)
+    };
+
+    /**
+     * @brief autonomous read 상태
+     */
+    struct AutonomousStats {
+        std::uint64_t frames = 0; ///< @brief 받은 태그 프레임 수
+        std::uint64_t tags = 0; ///< @brief 전달한 태그 수
+        std::uint64_t filtered = 0; ///< @brief 호스트 Select/EPC 규칙으로 제외한 태그 수
+        std::uint64_t batches = 0; ///< @brief 전달 횟수
+        std::uint64_t rx_errors = 0; ///< @brief 수신 오류 수
+        std::uint64_t reconnects = 0; ///< @brief 재연결 성공 수
+        std::uint64_t reconnect_failures = 0; ///< @brief 재연결 실패 수
+        std::uint32_t last_status = 0; ///< @brief 마지막 수신/재연결 오류 TMR 상태
+        std::uint32_t idle_ms = 0; ///< @brief 마지막 프레임 이후 경과 시간(ms)
+        bool running = false; ///< @brief 수신 중
+        bool streaming = false; ///< @brief 스트림 수신 중(false면 재연결 대기)
+    };
+
+    /**
+     * @brief 태그 지연 구간 분포(us, 히스토그램 값이라 최대 12.5% 오차)
+     */
+    struct LatencyDist {
+        std::uint64_t count = 0; ///< @brief 기록한 태그 수
+        std::uint32_t p50_us = 0;
+        std::uint32_t p99_us = 0;
+        std::uint32_t p999_us = 0;
+        std::uint32_t max_us = 0;
+    };
+
+    /**
+     * @brief 태그 지연 구간 상태(호스트 단조 시계 기준)
+     */
+    struct LatencyStats {
+        LatencyDist air_to_rx; ///< @brief 모듈 read → 프레임 수신
+        LatencyDist rx_to_parse; ///< @brief 프레임 수신 → 결과 태그 변환
+        LatencyDist parse_to_deliver; ///< @brief 결과 태그 변환 → 하류 전달
+        LatencyDist air_to_deliver; ///< @brief 모듈 read → 하류 전달(종단 간)
+        std::uint64_t untimed = 0; ///< @brief 모듈 read 시각을 정하지 못한 태그 수
+        std::uint64_t epochs = 0; ///< @brief 모듈 시각 기준점을 새로 잡은 횟수
+        double drift_ppm = 0.0; ///< @brief 추정한 모듈 시계 빠르기(ppm, +면 모듈 시계가 느리다)
+    };
+
+    /**
+     * @brief trigger read 시작 조건(GPI 변화)
+     */
+    enum class TriggerEdge {
+        Rising = 0, ///< @brief low → high 에서 시작, high 인 동안 읽는다
+        Falling, ///< @brief high → low 에서 시작, low 인 동안 읽는다
+        Both ///< @brief 어느 쪽 변화든 시작, 마지막 변화 뒤 hold_ms 동안 읽는다
+    };
+
+    /**
+     * @brief trigger read 로 읽은 태그 처리 함수
+     * @note 내부 trigger 스레드에서 read 사이클마다 호출된다. 예외는 잡아서 무시한다.
+     */
+    using TriggerHandler = std::function<void(const std::vector<Tag> &tags)>;
+
+    /**
+     * @brief GPI trigger read 설정(0 값은 라이브러리 기본값)
+     */
+    struct TriggerConfig {
+        std::vector<int> pins; ///< @brief 감시할 GPI 핀 번호(1..8개, 하나라도 조건을 만족하면 읽는다)
+        TriggerEdge edge = TriggerEdge::Rising; ///< @brief 시작 조건
+        std::uint32_t debounce_ms = 0; ///< @brief 핀 값이 유지되어야 하는 시간(ms, 기본 10)
+        std::uint32_t poll_ms = 0; ///< @brief 읽지 않는 동안 GPI 조회 간격(ms, 기본 5)
+        std::uint32_t read_ms = 0; ///< @brief read 사이클 1회 길이(ms, 기본 50)
+        std::uint32_t hold_ms = 0; ///< @brief 조건이 풀린 뒤 더 읽는 시간(ms, 기본 0. Both 는 기본 1000)
+        std::uint32_t max_ms = 0; ///< @brief trigger 1회 최대 read 시간(ms, 0이면 제한 없음)
+        std::uint32_t tag_capacity = 0; ///< @brief read 사이클 1회 최대 태그 수(기본 256)
+        TriggerHandler on_tags; ///< @brief 태그 처리 함수(비어 있으면 연결된 로그/버스/병합/풀로만 전달)
+    };
+
+    /**
+     * @brief GPI trigger read 상태
+     * @note 지연 백분위는 히스토그램 값이라 최대 12.5% 오차가 있다. 지연은 새 핀 값을 처음 본 GPI 조회 시각부터 잰다.
+     */
+    struct TriggerStats {
+        std::uint64_t polls = 0; ///< @brief GPI 조회 수
+        std::uint64_t gpi_errors = 0; ///< @brief GPI 조회 실패 수
+        std::uint64_t bounces = 0; ///< @brief debounce 로 무시한 핀 변화 수
+        std::uint64_t triggers = 0; ///< @brief 시작 조건을 만족한 핀 변화 수
+        std::uint64_t sessions = 0; ///< @brief read 를 시작한 횟수
+        std::uint64_t empty_sessions = 0; ///< @brief 태그 없이 끝난 read 횟수
+        std::uint64_t cycles = 0; ///< @brief read 사이클 수
+        std::uint64_t read_errors = 0; ///< @brief read 사이클 실패 수
+        std::uint64_t tags = 0; ///< @brief 전달한 태그 수
+        std::uint32_t last_status = 0; ///< @brief 마지막 GPI/read 오류 TMR 상태
+        std::uint32_t gpi_state = 0; ///< @brief debounce 된 핀 값(bit i: pins[i] 가 high)
+        std::uint32_t start_p50_us = 0; ///< @brief trigger → 첫 read 사이클 시작(us)
+        std::uint32_t start_p99_us = 0;
+        std::uint32_t start_max_us = 0;
+        std::uint32_t first_tag_p50_us = 0; ///< @brief trigger → 첫 태그 전달(us)
+        std::uint32_t first_tag_p99_us = 0;
+        std::uint32_t first_tag_max_us = 0;
+        bool running = false; ///< @brief trigger 스레드 실행 중
+        bool active = false; ///< @brief 지금 읽는 중
+    };
+
+    /**
+     * @brief 초기화 파라미터 모델
+     */
+    struct Config {
+        ///< @brief 0이면 RFID 기능 비활성
+        bool enable = true;
+        ///< @brief 예: "tmr:///dev/ttyUSB0"
+        std::string uri;
+        ///< @brief region 설정(Auto 포함)
+        Region region = Region::Auto;
+        ///< @brief 사용할 안테나 목록(예: {1,2})
+        std::vector<int> antennas{1, 2};
+        ///< @brief read plan timeout(ms), 필요 시 0 허용
+        int plan_timeout_ms = 0;
+
+        ///< @brief Write power(cdBm). 0 이하면 "기본값 사용"(설정하지 않음)
+        int write_power_cdbm = 0;
+
+        ///< @brief 내부 read 버퍼 용량(태그 최대 수)
+        std::size_t capacity = 64;
+
+        ///< @brief 적응형 dwell 스케줄러(기본 비활성)
+        DwellConfig dwell;
+
+        ///< @brief Gen2 Q/session/target/링크 튜닝(기본 비활성)
+        Gen2TuneConfig gen2;
+
+        ///< @brief 안테나별 read power(cdBm), antennas와 같은 순서. 비어 있으면 write_power_cdbm 공통 적용
+        std::vector<int> antenna_power_cdbm;
+
+        ///< @brief 안테나별 read power 폐루프 제어(기본 비활성)
+        PowerCtrlConfig power_ctrl;
+
+        ///< @brief 리더 측 Select 필터(최대 RFID_SELECT_MAX개, 비어 있으면 모든 태그 보고)
+        std::vector<SelectFilter> select_filters;
+        ///< @brief select_filters가 여러 개일 때 결합 방식
+        SelectCombine select_combine = SelectCombine::Any;
+
+        ///< @brief 시리얼 baud 자동 협상(기본 비활성)
+        BaudConfig baud;
+
+        ///< @brief 태그 응답 metadata(kTagMeta* 조합). 0이면 SDK 기본값(전체 metadata)
+        std::uint32_t tag_metadata = 0;
+
+        ///< @brief 가중치 read plan 목록(최대 RFID_PLAN_MAX개). 지정하면 antennas 대신 사용
+        std::vector<ReadPlanConfig> plans;
+
+        ///< @brief 태그별 메모리 embedded read(기본 비활성). 결과는 Tag::data
+        EmbeddedReadConfig embedded_read;
+    };
+
+    /**
+     * @brief JSON 문자열에서 Config를 파싱한다.
+     *
+     * @note
+     * - 헤더에서 JSON 타입을 노출하지 않기 위해 문자열 기반 API로 제공한다.
+     * - nlohmann/json.hpp 가 빌드에 포함되어 있어야 구현이 활성화된다.
+     *
+     * @param[in] json_text JSON 문자열
+     * @param[out] out_cfg 파싱 결과
+     * @param[out] out_err 실패 시 에러 메시지(NULL 허용)
+     * @return 성공 시 true
+     */
+    bool ParseConfigJson(const std::string &json_text, Config &out_cfg, std::string *out_err = nullptr);
+
+    /**
+     * @brief GS1 EPC 부호화 방식
+     */
+    enum class Gs1Scheme : std::uint8_t {
+        Unknown = 0, ///< @brief GS1 96bit 방식이 아니거나 규격 범위를 벗어남
+        Sgtin96, ///< @brief 상품 단위(GTIN + serial)
+        Sscc96, ///< @brief 물류 단위
+        Grai96, ///< @brief 회수 자산(asset type + serial)
+        Giai96 ///< @brief 개별 자산
+    };
+
+    /**
+     * @brief GS1 EPC 해석 결과
+     * @note reference/serial 의 뜻은 방식마다 다르다(rfid_gs1_record_t 참고).
+     */
+    struct Gs1Record {
+        Gs1Scheme scheme = Gs1Scheme::Unknown; ///< @brief 부호화 방식
+        std::uint8_t header = 0; ///< @brief EPC header
+        std::uint8_t filter = 0; ///< @brief filter 값
+        std::uint8_t partition = 0; ///< @brief partition 값
+        std::uint64_t company_prefix = 0; ///< @brief 업체 코드 값
+        std::uint64_t reference = 0; ///< @brief 방식별 참조 값
+        std::uint64_t serial = 0; ///< @brief 방식별 serial(SGTIN/GRAI)
+        int company_digits = 0; ///< @brief 업체 코드 자릿수
+        int reference_digits = 0; ///< @brief 참조 자릿수
+        std::string urn; ///< @brief EPC URN(해석하지 못했거나 URN 을 요청하지 않았으면 빈 문자열)
+    };
+
+    /**
+     * @brief Read 결과 태그의 바이너리 EPC 를 GS1 필드로 해석한다(SGTIN/SSCC/GRAI/GIAI-96).
+     *
+     * @param[in] tags Read 결과
+     * @param[out] out_records 태그 순서대로 해석 결과(기존 내용은 지움)
+     * @param[in] with_urn true면 Gs1Record::urn 을 채운다
+     * @param[in] tag_uri true면 URN 을 filter 가 들어간 tag URI(urn:epc:tag:...)로 만든다
+     * @return 해석에 성공한 태그 수
+     */
+    std::size_t DecodeGs1(const std::vector<Tag> &tags
+                          , std::vector<Gs1Record> &out_records
+                          , const bool with_urn = true
+                          , const bool tag_uri = false);
+
+    /**
+     * @brief RFID 예외
+     */
+    class RfidException : public std::runtime_error {
+    public:
+        /**
+         * @brief 예외 생성
+         * @param r Result 코드
+         * @param msg 에러 메시지
+         */
+        explicit RfidException(Result r, const std::string &msg) : std::runtime_error(msg), result_(r) {}
+
+        /**
+         * @brief 실패 원인 코드
+         */
+        Result result() const noexcept {
+            return result_;
+        }
+
+    private:
+        Result result_;
+    };
+
+    class Reader;
+
+    /**
+     * @brief 컴파일된 EPC 규칙 엔진 (Pimpl)
+     *
+     * @note
+     * - 수천 개의 접두사/마스크 규칙을 DFA로 컴파일해 태그 1건을 EPC 길이에 비례하는 시간에 분류한다.
+     * - Load는 새 규칙을 컴파일한 뒤 원자적으로 교체하므로, Read/Classify 와 동시에 호출해도 안전하다.
+     * - 여러 규칙이 일치하면 bit_length 가 가장 긴 규칙을 고른다.
+     */
+    class EpcMatcher {
+    public:
+        EpcMatcher();
+        ~EpcMatcher();
+
+        EpcMatcher(const EpcMatcher &) = delete;
+        EpcMatcher& operator=(const EpcMatcher &) = delete;
+
+        /**
+         * @brief 규칙 집합을 컴파일해 교체한다(실패 시 기존 규칙 유지).
+         * @param rules 규칙 목록(empty면 모든 태그 불일치)
+         * @return 결과 코드
+         */
+        Result Load(const std::vector<EpcRule> &rules);
+
+        /**
+         * @brief 바이너리 EPC 1건을 분류한다.
+         * @param epc EPC 바이트 배열
+         * @param len 바이트 수
+         * @return 일치한 rule_id, 없으면 kEpcRuleNone
+         */
+        std::uint32_t Classify(const std::uint8_t *epc, const std::size_t len) const;
+
+        /**
+         * @brief 태그 1건을 분류한다(epc_bytes 기준).
+         * @param tag 태그
+         * @return 일치한 rule_id, 없으면 kEpcRuleNone
+         */
+        std::uint32_t Classify(const Tag &tag) const;
+
+        /**
+         * @brief 현재 규칙의 DFA 상태 수(메모리 사용량 확인용)
+         */
+        std::size_t StateCount() const;
+
+    private:
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /**
+     * @brief mmap 기반 append-only 바이너리 태그 로그 (Pimpl)
+     *
+     * @note
+     * - 태그를 64바이트 고정 레코드로 미리 할당한 세그먼트 파일에 기록한다(rfid_tag_log_tool 로 조회/변환).
+     * - Append 는 메모리 큐에 복사만 하고 반환한다. 기록/msync/세그먼트 교체는 전용 스레드가 수행한다.
+     * - 소멸자에서 남은 레코드를 기록하고 닫는다. Reader 에 연결하면 Reader 가 참조를 유지한다.
+     */
+    class TagLog {
+    public:
+        TagLog();
+        ~TagLog();
+
+        TagLog(const TagLog &) = delete;
+        TagLog& operator=(const TagLog &) = delete;
+
+        /**
+         * @brief 로그를 연다(이미 열려 있으면 InvalidArg).
+         * @param cfg 로그 설정
+         * @return 결과 코드
+         */
+        Result Open(const TagLogConfig &cfg);
+
+        /**
+         * @brief 태그를 기록 큐에 넣는다(막히지 않음).
+         * @param tags 태그 목록
+         * @param reader_id 레코드에 기록할 리더 id
+         * @return 큐에 넣은 태그 수(큐가 가득 차면 tags.size() 보다 작다)
+         */
+        std::size_t Append(const std::vector<Tag> &tags, const std::uint16_t reader_id = 0);
+
+        /**
+         * @brief 지금까지 넣은 태그가 기록되고 msync 될 때까지 기다린다.
+         * @return 결과 코드
+         */
+        Result Flush();
+
+        /**
+         * @brief 로그 상태를 조회한다.
+         * @param[out] out_stats 로그 상태
+         * @return 결과 코드
+         */
+        Result GetStats(TagLogStats &out_stats) const;
+
+    private:
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /**
+     * @brief 공유 메모리 태그 버스 발행자 (Pimpl)
+     *
+     * @note
+     * - 같은 호스트의 다른 프로세스가 TagSubscriber 로 태그를 받는다(중개 프로세스/소켓 없음).
+     * - 발행은 구독자를 기다리지 않는다. 느린 구독자는 링이 한 바퀴 돌면 손실 수를 보고받는다.
+     * - 소멸자에서 버스를 닫는다. Reader 에 연결하면 Reader 가 참조를 유지한다.
+     */
+    class TagBus {
+    public:
+        TagBus();
+        ~TagBus();
+
+        TagBus(const TagBus &) = delete;
+        TagBus& operator=(const TagBus &) = delete;
+
+        /**
+         * @brief 버스를 만든다(이미 열려 있으면 InvalidArg).
+         * @param name 공유 메모리 이름(예: "rfid_tags")
+         * @param capacity 링 용량(레코드 수, 0이면 65536)
+         * @return 결과 코드
+         */
+        Result Open(const std::string &name, const std::uint32_t capacity = 0);
+
+        /**
+         * @brief 태그를 발행한다(막히지 않음).
+         * @param tags 태그 목록
+         * @param reader_id 레코드에 기록할 리더 id
+         * @return 발행한 태그 수
+         */
+        std::size_t Publish(const std::vector<Tag> &tags, const std::uint16_t reader_id = 0);
+
+    private:
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /**
+     * @brief 공유 메모리 태그 버스 구독자 (Pimpl)
+     * @note 한 구독자 객체는 한 스레드에서만 사용한다.
+     */
+    class TagSubscriber {
+    public:
+        TagSubscriber();
+        ~TagSubscriber();
+
+        TagSubscriber(const TagSubscriber &) = delete;
+        TagSubscriber& operator=(const TagSubscriber &) = delete;
+
+        /**
+         * @brief 버스를 구독한다(이미 열려 있으면 InvalidArg, 버스가 없으면 NotInitialized).
+         * @param name 공유 메모리 이름(TagBus::Open 과 같은 값)
+         * @param from_oldest true면 링에 남은 가장 오래된 레코드부터 읽는다
+         * @return 결과 코드
+         */
+        Result Open(const std::string &name, const bool from_oldest = false);
+
+        /**
+         * @brief 새 레코드를 읽는다. 없으면 timeout_ms 까지 기다린다.
+         * @param[out] out_records 읽은 레코드(기존 내용은 지움, timeout 이면 비어 있음)
+         * @param max_records 최대 레코드 수
+         * @param timeout_ms 최대 대기 시간(ms, 0이면 기다리지 않음, 음수면 무기한)
+         * @param[out] out_lost 느려서 놓친 레코드 수(nullptr 허용)
+         * @return 결과 코드(발행자가 버스를 닫았고 남은 레코드가 없으면 NotInitialized)
+         */
+        Result Read(std::vector<TagBusRecord> &out_records
+                    , const std::size_t max_records = 1024
+                    , const int timeout_ms = -1
+                    , std::uint64_t *out_lost = nullptr);
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /**
+     * @brief 태그 존재 감지 엔진 (Pimpl)
+     *
+     * @note
+     * - Read 결과를 넣으면 (EPC, zone) 별 ARRIVE / PRESENT(holdoff 간격) / DEPART 이벤트만 돌려준다.
+     * - 태그가 없을 때도 주기적으로 Update 를 호출해야 DEPART 가 나온다.
+     * - snapshot_path 를 주면 추적 상태를 주기적으로 파일에 남기고, 재시작 후 Restore(또는 Reader::SetPresenceEngine)로 이어간다.
+     * - 한 엔진은 한 스레드에서만 사용한다.
+     */
+    class PresenceEngine {
+    public:
+        PresenceEngine();
+        ~PresenceEngine();
+
+        PresenceEngine(const PresenceEngine &) = delete;
+        PresenceEngine& operator=(const PresenceEngine &) = delete;
+
+        /**
+         * @brief 엔진을 만든다(이미 열려 있으면 InvalidArg).
+         * @param cfg 엔진 설정
+         * @return 결과 코드
+         */
+        Result Open(const PresenceConfig &cfg = PresenceConfig{});
+
+        /**
+         * @brief read 결과를 반영하고 이벤트를 얻는다.
+         * @param tags Read 결과(비어 있으면 DEPART 판정만)
+         * @param[out] out_events 이벤트(기존 내용은 지움)
+         * @param now_ms 현재 시각(ms, 단조 증가). 0이면 단조 시계 사용
+         * @return 결과 코드
+         */
+        Result Update(const std::vector<Tag> &tags, std::vector<PresenceEvent> &out_events, const std::uint64_t now_ms = 0);
+
+        /**
+         * @brief 스냅샷에서 추적 상태를 복원한다(첫 Update 전에만 가능).
+         * @param identity 스냅샷 소유자(리더 URI 등). 다른 소유자의 스냅샷은 복원하지 않는다.
+         * @param[out] out_restored 복원한 (EPC, zone) 수(스냅샷이 없거나 오래됐으면 0)
+         * @param now_ms 현재 시각(ms). 0이면 단조 시계 사용
+         * @return 결과 코드(이미 Update 했으면 InvalidArg)
+         */
+        Result Restore(const std::string &identity, std::uint32_t &out_restored, const std::uint64_t now_ms = 0);
+
+        /**
+         * @brief 스냅샷을 바로 기록하고 디스크 반영까지 기다린다.
+         * @return 결과 코드(스냅샷을 쓰지 않으면 InvalidArg)
+         */
+        Result Snapshot();
+
+        /**
+         * @brief 엔진 상태를 조회한다.
+         * @param[out] out_stats 엔진 상태
+         * @return 결과 코드
+         */
+        Result GetStats(PresenceStats &out_stats) const;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
     };
 
     /**
-     * @brief 초기화 파라미터 모델
+     * @brief 계층형 타이밍 휠 (Pimpl)
+     *
+     * @note
+     * - 태그별 만료 시각을 ms 해상도로 관리한다. 등록/재등록/취소 O(1), Advance 는 만료 수에 비례한다.
+     *   단, 상위 단계 경계(65536 ms 마다) tick 의 Advance 는 그 구간 타이머를 한 번에 옮기므로 활성 타이머 수에 비례한다
+     *   (1M 개면 약 70 ms, rfid_timer_wheel.h 참고).
+     * - 시각은 NowMs() 와 같은 단조 시계 기준이다.
+     * - 한 휠은 한 스레드에서만 사용한다.
      */
-    struct Config {
-        ///< @brief 0이면 RFID 기능 비활성
-        bool enable = true;
-        ///< @brief 예: "tmr:///dev/ttyUSB0"
-        std::string uri;
-        ///< @brief region 설정(Auto 포함)
-        Region region = Region::Auto;
-        ///< @brief 사용할 안테나 목록(예: {1,2})
-        std::vector<int> antennas{1, 2};
-        ///< @brief read plan timeout(ms), 필요 시 0 허용
-        int plan_timeout_ms = 0;
+    class TimerWheel {
+    public:
+        TimerWheel();
+        ~TimerWheel();
 
-        ///< @brief Write power(cdBm). 0 이하면 "기본값 사용"(설정하지 않음)
-        int write_power_cdbm = 0;
+        TimerWheel(const TimerWheel &) = delete;
+        TimerWheel& operator=(const TimerWheel &) = delete;
 
-        ///< @brief 내부 read 버퍼 용량(태그 최대 수)
-        std::size_t capacity = 64;
+        /**
+         * @brief 단조 시계 기준 현재 시각(ms)
+         * @return 현재 시각(ms)
+         */
+        static std::uint64_t NowMs();
+
+        /**
+         * @brief 휠을 만든다(이미 열려 있으면 InvalidArg).
+         * @param capacity 최대 타이머 수(0이면 262144)
+         * @param start_ms 시작 시각(ms). 0이면 NowMs()
+         * @return 결과 코드
+         */
+        Result Open(const std::uint32_t capacity = 0, const std::uint64_t start_ms = 0);
+
+        /**
+         * @brief 타이머를 등록한다.
+         * @param deadline_ms 만료 시각(ms)
+         * @param user_data 만료 시 돌려받을 값
+         * @param[out] out_id 타이머 id
+         * @return 결과 코드(용량 초과 시 InternalError)
+         */
+        Result Schedule(const std::uint64_t deadline_ms, const std::uint64_t user_data, std::uint64_t &out_id);
+
+        /**
+         * @brief 타이머 만료 시각을 바꾼다.
+         * @param id 타이머 id
+         * @param deadline_ms 새 만료 시각(ms)
+         * @return 결과 코드(이미 만료/취소된 id 이면 InvalidArg)
+         */
+        Result Reschedule(const std::uint64_t id, const std::uint64_t deadline_ms);
+
+        /**
+         * @brief 타이머를 취소한다.
+         * @param id 타이머 id
+         * @return 결과 코드(이미 만료/취소된 id 이면 InvalidArg)
+         */
+        Result Cancel(const std::uint64_t id);
+
+        /**
+         * @brief 휠 시각을 now_ms 까지 진행하고 만료된 타이머를 모두 꺼낸다.
+         * @param[out] out_expired 만료된 타이머(시각 순, 기존 내용은 지움)
+         * @param now_ms 현재 시각(ms). 0이면 NowMs()
+         * @return 결과 코드
+         */
+        Result Advance(std::vector<TimerExpiry> &out_expired, const std::uint64_t now_ms = 0);
+
+        /**
+         * @brief 휠 상태를 조회한다.
+         * @param[out] out_stats 휠 상태
+         * @return 결과 코드
+         */
+        Result GetStats(TimerWheelStats &out_stats) const;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
     };
 
     /**
-     * @brief JSON 문자열에서 Config를 파싱한다.
+     * @brief 리더 간 병합 단계 (Pimpl)
      *
      * @note
-     * - 헤더에서 JSON 타입을 노출하지 않기 위해 문자열 기반 API로 제공한다.
-     * - nlohmann/json.hpp 가 빌드에 포함되어 있어야 구현이 활성화된다.
+     * - 겹치는 구역을 읽는 여러 Reader 의 결과를 EPC 별 window_ms 창으로 합쳐 창마다 이벤트 1개를 낸다.
+     * - 이벤트의 리더/안테나는 창 안에서 RSSI 가 가장 높았던 read 를 따른다.
+     * - EPC 해시 shard 마다 잠금을 따로 두므로 여러 Reader 스레드가 전역 잠금 없이 Push 한다.
+     * - Push/Poll/GetStats 는 여러 스레드에서 동시에 호출할 수 있다. Reader 에 연결하면 Reader 가 참조를 유지한다.
+     */
+    class TagMerger {
+    public:
+        TagMerger();
+        ~TagMerger();
+
+        TagMerger(const TagMerger &) = delete;
+        TagMerger& operator=(const TagMerger &) = delete;
+
+        /**
+         * @brief 병합 단계를 만든다(이미 열려 있으면 InvalidArg).
+         * @param cfg 병합 설정
+         * @return 결과 코드
+         */
+        Result Open(const MergeConfig &cfg = MergeConfig{});
+
+        /**
+         * @brief 한 리더의 Read 결과를 넣는다.
+         * @param reader_id 리더 id(이벤트에 기록)
+         * @param tags Read 결과
+         * @param now_ms 현재 시각(ms, 모든 리더가 같은 단조 시계). 0이면 단조 시계 사용
+         * @return 결과 코드
+         */
+        Result Push(const std::uint16_t reader_id, const std::vector<Tag> &tags, const std::uint64_t now_ms = 0);
+
+        /**
+         * @brief 닫힌 창을 이벤트로 모두 꺼낸다.
+         * @param[out] out_events 이벤트(기존 내용은 지움)
+         * @param now_ms 현재 시각(ms). 0이면 단조 시계, UINT64_MAX 이면 열린 창까지 모두 꺼낸다
+         * @return 결과 코드
+         */
+        Result Poll(std::vector<MergeEvent> &out_events, const std::uint64_t now_ms = 0);
+
+        /**
+         * @brief 병합 단계 상태와 지연 백분위를 조회한다.
+         * @param[out] out_stats 병합 단계 상태
+         * @return 결과 코드
+         */
+        Result GetStats(MergeStats &out_stats) const;
+
+    private:
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /**
+     * @brief EPC ↔ 32bit id 변환 테이블 (Pimpl)
      *
-     * @param[in] json_text JSON 문자열
-     * @param[out] out_cfg 파싱 결과
-     * @param[out] out_err 실패 시 에러 메시지(NULL 허용)
-     * @return 성공 시 true
+     * @note
+     * - EPC 마다 0 ~ EpcInternStats::capacity - 1 범위의 id 를 하나 주므로 상위 계층은 EPC 문자열 대신 id 로 배열/맵을 만들 수 있다.
+     * - id 는 shard 안에서만 조밀하다(id = shard 안 인덱스 << log2(shards) | shard). 발급 순서대로 0 부터 채워지지 않는다.
+     * - 이미 등록된 EPC 조회는 shard 읽기 잠금만 잡는다. 모든 메서드는 여러 스레드에서 동시에 호출할 수 있다.
+     * - idle_ms 를 주면 가득 찼을 때 오래 조회되지 않은 id 를 재사용하므로 id 를 idle_ms 보다 오래 보관하지 않는다.
+     *   id 에는 세대 값이 없으므로 오래 보관한 id 는 Lookup 으로 EPC 를 다시 확인한다.
+     * - id 는 프로세스 안에서만 유효하다. Reader 에 연결하면 Reader 가 참조를 유지한다.
      */
-    bool ParseConfigJson(const std::string &json_text, Config &out_cfg, std::string *out_err = nullptr);
+    class EpcIntern {
+    public:
+        EpcIntern();
+        ~EpcIntern();
+
+        EpcIntern(const EpcIntern &) = delete;
+        EpcIntern& operator=(const EpcIntern &) = delete;
+
+        /**
+         * @brief 테이블을 만든다(이미 열려 있으면 InvalidArg).
+         * @param cfg 테이블 설정
+         * @return 결과 코드
+         */
+        Result Open(const EpcInternConfig &cfg = EpcInternConfig{});
+
+        /**
+         * @brief EPC 의 id 를 얻는다(처음 보는 EPC 면 발급).
+         * @param epc_bytes 바이너리 EPC(MSB first)
+         * @param[out] out_id id(실패 시 kEpcIdNone)
+         * @return 결과 코드(용량 초과 시 InternalError)
+         */
+        Result Intern(const std::vector<std::uint8_t> &epc_bytes, std::uint32_t &out_id);
+
+        /**
+         * @brief 등록된 EPC 의 id 를 찾는다(발급하지 않음).
+         * @param epc_bytes 바이너리 EPC(MSB first)
+         * @param[out] out_id id(등록되지 않았으면 kEpcIdNone)
+         * @return 결과 코드
+         */
+        Result Find(const std::vector<std::uint8_t> &epc_bytes, std::uint32_t &out_id) const;
+
+        /**
+         * @brief id 가 가리키는 EPC 를 얻는다.
+         * @param id id
+         * @param[out] out_epc_bytes 바이너리 EPC
+         * @return 결과 코드(발급되지 않은 id 이면 InvalidArg)
+         */
+        Result Lookup(const std::uint32_t id, std::vector<std::uint8_t> &out_epc_bytes) const;
+
+        /**
+         * @brief 테이블 상태를 조회한다.
+         * @param[out] out_stats 테이블 상태
+         * @return 결과 코드
+         */
+        Result GetStats(EpcInternStats &out_stats) const;
+
+    private:
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
 
     /**
-     * @brief RFID 예외
+     * @brief 태그 후처리 작업 풀 (Pimpl)
+     *
+     * @note
+     * - Read 스레드는 태그를 풀에 복사만 하고, 등록한 stage(필터/해석/sink 등)는 작업 스레드가 순서대로 실행한다.
+     * - 대기 메모리는 Open 시 고정되며, 가득 찼을 때의 동작은 PoolConfig::policy 로 고른다.
+     * - 같은 EPC 는 같은 lane 으로 가서 넣은 순서대로 처리되며, 바쁜 작업 스레드의 lane 은 쉬는 작업 스레드가 훔쳐 간다.
+     * - C++ stage 는 호출마다 C 태그와 PoolItem 을 서로 변환한다. 처리량이 중요하면 C API(rfid_pool.h)로 stage 를 등록한다.
+     * - Submit/Drain/GetStats 는 여러 스레드에서 동시에 호출할 수 있다. Reader 에 연결하면 Reader 가 참조를 유지한다.
      */
-    class RfidException : public std::runtime_error {
+    class TagPool {
     public:
+        TagPool();
+        ~TagPool();
+
+        TagPool(const TagPool &) = delete;
+        TagPool& operator=(const TagPool &) = delete;
+
         /**
-         * @brief 예외 생성
-         * @param r Result 코드
-         * @param msg 에러 메시지
+         * @brief stage 를 등록한다(Open 전에만, 등록 순서대로 실행).
+         * @param name stage 이름(통계용)
+         * @param stage stage 함수
+         * @return 결과 코드(이미 열렸거나 stage 가 비었거나 너무 많으면 InvalidArg)
          */
-        explicit RfidException(Result r, const std::string &msg) : std::runtime_error(msg), result_(r) {}
+        Result AddStage(const std::string &name, PoolStage stage);
 
         /**
-         * @brief 실패 원인 코드
+         * @brief 작업 스레드를 시작한다(이미 열려 있거나 stage 가 없으면 InvalidArg).
+         * @param cfg 풀 설정
+         * @return 결과 코드
          */
-        Result result() const noexcept {
-            return result_;
-        }
+        Result Open(const PoolConfig &cfg = PoolConfig{});
+
+        /**
+         * @brief 한 리더의 Read 결과를 넣는다(복사 후 바로 반환).
+         * @param reader_id 리더 id(PoolItem::reader_id)
+         * @param tags Read 결과
+         * @param[out] out_accepted 받은 태그 수(nullptr 허용, 나머지는 dropped)
+         * @return 결과 코드
+         */
+        Result Submit(const std::uint16_t reader_id, const std::vector<Tag> &tags, std::size_t *out_accepted = nullptr);
+
+        /**
+         * @brief 대기 중인 태그가 모두 처리될 때까지 기다린다.
+         * @param timeout_ms 최대 대기 시간(ms)
+         * @param[out] out_pending 남은 태그 수(0이면 모두 처리)
+         * @return 결과 코드
+         */
+        Result Drain(const std::uint32_t timeout_ms, std::uint32_t &out_pending);
+
+        /**
+         * @brief 풀 상태와 stage 별 대기 시간/처리율을 조회한다.
+         * @param[out] out_stats 풀 상태
+         * @return 결과 코드
+         */
+        Result GetStats(PoolStats &out_stats) const;
 
     private:
-        Result result_;
+        friend class Reader;
+        class Impl;
+        std::unique_ptr<Impl> impl_;
     };
 
     /**
@@ -152,6 +1529,230 @@ namespace mercuryapi {
          */
         Result SetWritePowerCdbm(const int write_power_cdbm);
 
+        /**
+         * @brief 리더 측 Select 필터를 교체한다(다음 Read부터 적용).
+         * @param filters 필터 목록(empty면 필터 해제)
+         * @param combine 결합 방식
+         * @return 결과 코드
+         */
+        Result SetSelectFilters(const std::vector<SelectFilter> &filters, const SelectCombine combine = SelectCombine::Any);
+
+        /**
+         * @brief embedded read 설정을 교체한다(다음 Read부터 적용).
+         * @param cfg 설정(enable false면 해제)
+         * @return 결과 코드
+         */
+        Result SetEmbeddedRead(const EmbeddedReadConfig &cfg);
+
+        /**
+         * @brief 적응형 dwell 스케줄러의 안테나별 상태를 조회한다.
+         * @param[out] out_stats 안테나별 상태(비활성이면 empty)
+         * @return 결과 코드
+         */
+        Result GetDwellStats(std::vector<DwellStat> &out_stats);
+
+        /**
+         * @brief 안테나 1개의 read power(cdBm)를 변경한다.
+         * @param antenna 안테나 번호
+         * @param power_cdbm read power(cdBm)
+         * @return 결과 코드
+         */
+        Result SetAntennaPowerCdbm(const int antenna, const int power_cdbm);
+
+        /**
+         * @brief 안테나별 read power 제어 상태를 조회한다.
+         * @param[out] out_stats 안테나별 상태(미사용이면 empty)
+         * @return 결과 코드
+         */
+        Result GetPowerStats(std::vector<PowerStat> &out_stats);
+
+        /**
+         * @brief Gen2 튜닝 모드를 변경한다(Manual이면 즉시 적용).
+         * @param cfg 튜닝 설정
+         * @return 결과 코드
+         */
+        Result SetGen2Tuning(const Gen2TuneConfig &cfg);
+
+        /**
+         * @brief 현재 Gen2 튜닝 상태를 조회한다.
+         * @param[out] out_status 튜닝 상태
+         * @return 결과 코드
+         */
+        Result GetGen2Status(Gen2Status &out_status);
+
+        /**
+         * @brief 호스트 측 EPC 규칙 엔진을 연결한다(다음 Read부터 Tag::rule_id 채움).
+         * @param matcher 규칙 엔진(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @param drop_unmatched true면 규칙에 일치하지 않는 태그를 결과에서 제외
+         * @return 결과 코드
+         */
+        Result SetEpcMatcher(std::shared_ptr<EpcMatcher> matcher, const bool drop_unmatched = false);
+
+        /**
+         * @brief 태그 로그를 연결한다(다음 Read부터 결과 태그를 로그에 기록).
+         * @param log 열린 태그 로그(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @param reader_id 레코드에 기록할 리더 id(여러 Reader 가 로그 하나를 공유할 때 구분용)
+         * @return 결과 코드
+         */
+        Result SetTagLog(std::shared_ptr<TagLog> log, const std::uint16_t reader_id = 0);
+
+        /**
+         * @brief 공유 메모리 태그 버스를 연결한다(다음 Read부터 결과 태그를 버스에 발행).
+         * @param bus 열린 태그 버스(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @param reader_id 레코드에 기록할 리더 id(여러 Reader 가 버스 하나를 공유할 때 구분용)
+         * @return 결과 코드
+         */
+        Result SetTagBus(std::shared_ptr<TagBus> bus, const std::uint16_t reader_id = 0);
+
+        /**
+         * @brief 태그 존재 감지 엔진을 연결한다. 다음 Init 성공 시 Config::uri 를 소유자로 스냅샷을 복원한다.
+         * @param engine 열린 엔진(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @return 결과 코드
+         * @note Init 전에 호출할 수 있다. 엔진에 Update 로 결과를 넣는 것은 호출자 몫이다.
+         */
+        Result SetPresenceEngine(std::shared_ptr<PresenceEngine> engine);
+
+        /**
+         * @brief 리더 간 병합 단계를 연결한다(다음 Read부터 결과 태그를 병합 단계에 넣는다).
+         * @param merger 열린 병합 단계(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @param reader_id 병합 단계에 넘길 리더 id(병합 단계를 공유하는 Reader 마다 다르게)
+         * @return 결과 코드
+         */
+        Result SetTagMerger(std::shared_ptr<TagMerger> merger, const std::uint16_t reader_id = 0);
+
+        /**
+         * @brief EPC intern 테이블을 연결한다(다음 Read부터 Tag::epc_id 채움).
+         * @param intern 열린 테이블(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @return 결과 코드
+         * @note 여러 Reader 에 같은 테이블을 연결하면 같은 EPC 는 같은 id 를 받는다.
+         */
+        Result SetEpcIntern(std::shared_ptr<EpcIntern> intern);
+
+        /**
+         * @brief 태그 후처리 풀을 연결한다(다음 Read부터 결과 태그를 풀에 넣는다).
+         * @param pool 열린 풀(nullptr이면 해제). Reader가 참조를 유지한다.
+         * @param reader_id 풀에 넘길 리더 id(PoolItem::reader_id)
+         * @return 결과 코드
+         */
+        Result SetTagPool(std::shared_ptr<TagPool> pool, const std::uint16_t reader_id = 0);
+
+        /**
+         * @brief 시리얼 링크 상태(현재 baud, 처리량, 오류/하향 횟수)를 조회한다.
+         * @param[out] out_stat 링크 상태
+         * @return 결과 코드
+         */
+        Result GetLinkStats(LinkStat &out_stat);
+
+        /**
+         * @brief 리더 상태 카운터(링크 프레임/오류, read 사이클, 안테나별 처리량) 스냅샷을 얻는다.
+         * @note Read 중인 다른 스레드에서 호출해도 된다(마지막 오류 상태를 바꾸지 않음). Init/Deinit 과는 동시에 호출하지 않는다.
+         * @param[out] out_counters 카운터 스냅샷
+         * @return 결과 코드
+         */
+        Result GetCounters(ReaderCounters &out_counters) const;
+
+        /**
+         * @brief 카운터 스냅샷을 Prometheus text exposition 형식으로 만든다(GetCounters 와 같은 스레드 규칙).
+         * @param[out] out_text exposition 텍스트
+         * @param reader_label reader 라벨 값(빈 문자열이면 라벨 생략)
+         * @return 결과 코드
+         */
+        Result GetCountersText(std::string &out_text, const std::string &reader_label = "") const;
+
+        /**
+         * @brief 가중치 read plan 항목별 누적 태그 수와 발견율을 조회한다.
+         * @param[out] out_stats 항목별 상태(Config::plans 순서, 미사용이면 empty)
+         * @return 결과 코드
+         */
+        Result GetPlanStats(std::vector<PlanStat> &out_stats);
+
+        /**
+         * @brief 가중치 read plan 항목의 가중치를 바꾼다(다음 Read부터 적용).
+         * @param weights 항목별 가중치(Config::plans 와 같은 개수, 각 > 0)
+         * @return 결과 코드
+         */
+        Result SetPlanWeights(const std::vector<int> &weights);
+
+        /**
+         * @brief 조건(고유 태그 N개 또는 기대 EPC 전부)을 충족하는 즉시 끝나는 태그 읽기
+         * @param read_timeout_ms 최대 대기 시간(ms)
+         * @param cond 종료 조건
+         * @param[out] out_tags 결과 태그 리스트(EPC 기준 중복 제거)
+         * @param[out] out_report 종료 사유/지연 시간(nullptr 허용)
+         * @return 결과 코드(조건 미충족으로 timeout 까지 읽은 경우도 Ok)
+         */
+        Result ReadUntil(const int read_timeout_ms
+                         , const EarlyExit &cond
+                         , std::vector<Tag> &out_tags
+                         , EarlyExitReport *out_report = nullptr);
+
+        /**
+         * @brief 태그 발행(commissioning) 작업 목록을 순서대로 실행한다.
+         * @note 쓰기와 확인 읽기는 모듈이 지원하면 한 명령으로 보내며, 단계별로 cfg.max_attempts 까지 재시도한다.
+         * @param jobs 작업 목록(empty면 InvalidArg)
+         * @param[out] out_results 작업별 결과(jobs 와 같은 순서)
+         * @param[out] out_stats 호출 요약(nullptr 허용)
+         * @param cfg 실행 설정
+         * @return 결과 코드(작업이 실패해도 모두 실행했으면 Ok, 작업별 결과는 out_results)
+         */
+        Result Commission(const std::vector<CommissionJob> &jobs
+                          , std::vector<CommissionResult> &out_results
+                          , CommissionStats *out_stats = nullptr
+                          , const CommissionConfig &cfg = CommissionConfig{});
+
+        /**
+         * @brief 모듈을 autonomous read 로 전환하고 모듈이 보내는 태그 스트림을 받기 시작한다(호스트 polling 없음).
+         * @note Arm 은 Init 의 안테나(또는 가중치 plan 목록)로 read plan 을 만든다. 받은 태그는 Read 와 같은 하류
+         *       (EPC 규칙/intern/로그/버스/병합/풀)를 거쳐 cfg.on_tags 로 전달된다. 스트림이 끊기면 다시 연결한다.
+         *       수신 중에는 Read/설정 변경/하류 연결이 Busy 를 반환한다. 호스트 재시작 뒤에는 Init 후 Resume 으로 다시 붙는다.
+         * @param cfg 설정
+         * @return 결과 코드
+         */
+        Result StartAutonomous(const AutonomousConfig &cfg = AutonomousConfig{});
+
+        /**
+         * @brief autonomous read 수신을 멈추고 모듈 스트림을 정지한다(수신 중이 아니면 Ok).
+         * @return 결과 코드
+         */
+        Result StopAutonomous();
+
+        /**
+         * @brief autonomous read 상태 조회(수신 중에 다른 스레드에서 호출할 수 있다)
+         * @param[out] out_stats 결과
+         * @return 결과 코드
+         */
+        Result GetAutonomousStats(AutonomousStats &out_stats) const;
+
+        /**
+         * @brief 모듈 GPI 입력(포토아이 등)에 맞춰 read 를 켜고 끄는 trigger read 를 시작한다.
+         * @note Init 의 안테나(또는 가중치 plan 목록)로 읽는다. 태그는 Read 와 같은 하류를 거쳐 cfg.on_tags 로 전달된다.
+         *       실행 중에는 Read/설정 변경/하류 연결이 Busy 를 반환한다.
+         * @param cfg 설정
+         * @return 결과 코드(모듈 입력 핀이 아닌 번호가 있으면 InvalidArg)
+         */
+        Result StartTrigger(const TriggerConfig &cfg);
+
+        /**
+         * @brief trigger read 를 멈춘다(실행 중이 아니면 Ok).
+         * @return 결과 코드
+         */
+        Result StopTrigger();
+
+        /**
+         * @brief trigger read 상태 조회(실행 중에 다른 스레드에서 호출할 수 있다)
+         * @param[out] out_stats 결과
+         * @return 결과 코드
+         */
+        Result GetTriggerStats(TriggerStats &out_stats) const;
+
+        /**
+         * @brief 태그 지연 구간 분포 조회(모듈 read → 수신 → 변환 → 전달, 읽는 중에 다른 스레드에서 호출할 수 있다)
+         * @note 풀 대기 구간은 TagPool::GetStats 의 rx_p*_us 로 본다.
+         * @param[out] out_stats 결과
+         * @return 결과 코드
+         */
+        Result GetLatencyStats(LatencyStats &out_stats) const;
+
         /**
          * @brief 마지막 에러 코드(GetLastError 스타일)
          */